@@ -0,0 +1,30 @@
+#include "u_locals.glsl"
+
+uniform sampler2D sMainTex;
+uniform sampler2D sChromaU;
+uniform sampler2D sChromaV;
+
+noperspective in vec2 fragUV1;
+
+out vec4 fragColor;
+
+// Limited range BT.601, must match movie/yuvutil.cpp
+vec3 yuvToRGB(float y, float u, float v) {
+    float luma = 1.164383 * (y - 16.0 / 255.0);
+    float cb = u - 128.0 / 255.0;
+    float cr = v - 128.0 / 255.0;
+    return clamp(vec3(
+                     luma + 1.596027 * cr,
+                     luma - 0.391762 * cb - 0.812968 * cr,
+                     luma + 2.017232 * cb),
+                 0.0, 1.0);
+}
+
+void main() {
+    vec2 uv = vec2(uUV * vec3(fragUV1, 1.0));
+    vec3 rgb = yuvToRGB(
+        texture(sMainTex, uv).r,
+        texture(sChromaU, uv).r,
+        texture(sChromaV, uv).r);
+    fragColor = vec4(uColor.rgb * rgb, uColor.a);
+}
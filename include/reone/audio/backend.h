@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace reone {
+
+namespace audio {
+
+/**
+ * Abstraction over the low-level audio API, i.e. OpenAL sources and buffers.
+ */
+class IAudioBackend {
+public:
+    virtual ~IAudioBackend() = default;
+
+    virtual uint32_t createSource() = 0;
+    virtual void deleteSource(uint32_t source) = 0;
+
+    virtual void createBuffers(int count, uint32_t *buffers) = 0;
+    virtual void deleteBuffers(int count, const uint32_t *buffers) = 0;
+    virtual void setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) = 0;
+
+    virtual void setSourceGain(uint32_t source, float gain) = 0;
+    virtual void setSourcePosition(uint32_t source, glm::vec3 position) = 0;
+    virtual void setSourceRelative(uint32_t source, bool relative) = 0;
+    virtual void setSourceLooping(uint32_t source, bool loop) = 0;
+    virtual void setSourceBuffer(uint32_t source, uint32_t buffer) = 0;
+    virtual void setSourceOffset(uint32_t source, float seconds) = 0;
+
+    virtual void queueBuffers(uint32_t source, int count, const uint32_t *buffers) = 0;
+    virtual void unqueueBuffers(uint32_t source, int count, uint32_t *buffers) = 0;
+
+    virtual int getProcessedBufferCount(uint32_t source) = 0;
+    virtual int getQueuedBufferCount(uint32_t source) = 0;
+    virtual bool isSourceStopped(uint32_t source) = 0;
+
+    virtual void playSource(uint32_t source) = 0;
+    virtual void stopSource(uint32_t source) = 0;
+};
+
+class ALAudioBackend : public IAudioBackend, boost::noncopyable {
+public:
+    uint32_t createSource() override;
+    void deleteSource(uint32_t source) override;
+
+    void createBuffers(int count, uint32_t *buffers) override;
+    void deleteBuffers(int count, const uint32_t *buffers) override;
+    void setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) override;
+
+    void setSourceGain(uint32_t source, float gain) override;
+    void setSourcePosition(uint32_t source, glm::vec3 position) override;
+    void setSourceRelative(uint32_t source, bool relative) override;
+    void setSourceLooping(uint32_t source, bool loop) override;
+    void setSourceBuffer(uint32_t source, uint32_t buffer) override;
+    void setSourceOffset(uint32_t source, float seconds) override;
+
+    void queueBuffers(uint32_t source, int count, const uint32_t *buffers) override;
+    void unqueueBuffers(uint32_t source, int count, uint32_t *buffers) override;
+
+    int getProcessedBufferCount(uint32_t source) override;
+    int getQueuedBufferCount(uint32_t source) override;
+    bool isSourceStopped(uint32_t source) override;
+
+    void playSource(uint32_t source) override;
+    void stopSource(uint32_t source) override;
+};
+
+/**
+ * Backend that does not talk to any audio device, e.g. for headless runs.
+ * Audio data is discarded. Non-looping sources stop as soon as they are
+ * played, while looping and streaming sources play until stopped, their
+ * queued buffers never being processed.
+ *
+ * Thread-safe.
+ */
+class NullAudioBackend : public IAudioBackend, boost::noncopyable {
+public:
+    uint32_t createSource() override;
+    void deleteSource(uint32_t source) override;
+
+    void createBuffers(int count, uint32_t *buffers) override;
+    void deleteBuffers(int count, const uint32_t *buffers) override {}
+    void setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) override {}
+
+    void setSourceGain(uint32_t source, float gain) override {}
+    void setSourcePosition(uint32_t source, glm::vec3 position) override {}
+    void setSourceRelative(uint32_t source, bool relative) override {}
+    void setSourceLooping(uint32_t source, bool loop) override;
+    void setSourceBuffer(uint32_t source, uint32_t buffer) override {}
+    void setSourceOffset(uint32_t source, float seconds) override {}
+
+    void queueBuffers(uint32_t source, int count, const uint32_t *buffers) override;
+    void unqueueBuffers(uint32_t source, int count, uint32_t *buffers) override;
+
+    int getProcessedBufferCount(uint32_t source) override { return 0; }
+    int getQueuedBufferCount(uint32_t source) override;
+    bool isSourceStopped(uint32_t source) override;
+
+    void playSource(uint32_t source) override;
+    void stopSource(uint32_t source) override;
+
+private:
+    struct SourceState {
+        bool looping {false};
+        bool playing {false};
+        std::deque<uint32_t> queue;
+    };
+
+    uint32_t _nextName {1};
+    std::unordered_map<uint32_t, SourceState> _sources;
+    std::mutex _mutex;
+};
+
+/**
+ * Decorates another backend, recycling deleted sources and buffers instead
+ * of returning them to the underlying API. Recycled sources are stopped,
+ * detached from their buffers and reset to default state.
+ *
+ * Thread-safe, as long as the underlying backend is.
+ */
+class PooledAudioBackend : public IAudioBackend, boost::noncopyable {
+public:
+    PooledAudioBackend(IAudioBackend &backend) :
+        _backend(backend) {
+    }
+
+    ~PooledAudioBackend();
+
+    uint32_t createSource() override;
+    void deleteSource(uint32_t source) override;
+
+    void createBuffers(int count, uint32_t *buffers) override;
+    void deleteBuffers(int count, const uint32_t *buffers) override;
+
+    void setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) override {
+        _backend.setBufferData(buffer, format, data, size, sampleRate);
+    }
+
+    void setSourceGain(uint32_t source, float gain) override { _backend.setSourceGain(source, gain); }
+    void setSourcePosition(uint32_t source, glm::vec3 position) override { _backend.setSourcePosition(source, position); }
+    void setSourceRelative(uint32_t source, bool relative) override { _backend.setSourceRelative(source, relative); }
+    void setSourceLooping(uint32_t source, bool loop) override { _backend.setSourceLooping(source, loop); }
+    void setSourceBuffer(uint32_t source, uint32_t buffer) override { _backend.setSourceBuffer(source, buffer); }
+    void setSourceOffset(uint32_t source, float seconds) override { _backend.setSourceOffset(source, seconds); }
+
+    void queueBuffers(uint32_t source, int count, const uint32_t *buffers) override {
+        _backend.queueBuffers(source, count, buffers);
+    }
+
+    void unqueueBuffers(uint32_t source, int count, uint32_t *buffers) override {
+        _backend.unqueueBuffers(source, count, buffers);
+    }
+
+    int getProcessedBufferCount(uint32_t source) override { return _backend.getProcessedBufferCount(source); }
+    int getQueuedBufferCount(uint32_t source) override { return _backend.getQueuedBufferCount(source); }
+    bool isSourceStopped(uint32_t source) override { return _backend.isSourceStopped(source); }
+
+    void playSource(uint32_t source) override { _backend.playSource(source); }
+    void stopSource(uint32_t source) override { _backend.stopSource(source); }
+
+private:
+    IAudioBackend &_backend;
+
+    std::mutex _mutex;
+    std::vector<uint32_t> _freeSources;
+    std::vector<uint32_t> _freeBuffers;
+};
+
+} // namespace audio
+
+} // namespace reone
@@ -25,6 +25,9 @@ namespace reone {
 
 namespace audio {
 
+class IAudioBackend;
+class IAudioDecoder;
+
 class AudioClip : boost::noncopyable {
 public:
     struct Frame {
@@ -48,16 +51,62 @@ public:
         }
     };
 
+    using DecoderFactory = std::function<std::unique_ptr<IAudioDecoder>()>;
+
+    AudioClip() = default;
+
+    /**
+     * Constructs a streaming clip, which holds no PCM data and instead creates
+     * decoders on demand.
+     *
+     * @param encodedSize size of encoded data, retained by decoder factory
+     */
+    AudioClip(DecoderFactory decoderFactory, float duration, size_t encodedSize = 0) :
+        _decoderFactory(std::move(decoderFactory)),
+        _duration(duration),
+        _size(encodedSize) {
+    }
+
+    ~AudioClip();
+
     void add(Frame &&frame);
 
+    /**
+     * Uploads PCM data of a single-frame clip into a backend buffer, which is
+     * then shared by all sources playing this clip. Clip must therefore only
+     * be played on the device of that backend. The buffer is deleted together
+     * with the clip.
+     */
+    void upload(IAudioBackend &backend);
+
+    /**
+     * Decoders of non-streaming clips read frames of this clip, which must
+     * therefore outlive them.
+     */
+    std::unique_ptr<IAudioDecoder> createDecoder() const;
+
+    bool isStreaming() const { return static_cast<bool>(_decoderFactory); }
+
     int getFrameCount() const;
     const Frame &getFrame(int index) const;
     float duration() const { return _duration; }
 
+    /**
+     * @return approximate number of bytes held in memory by this clip
+     */
+    size_t size() const { return _size; }
+
+    uint32_t sharedBuffer() const { return _sharedBuffer; }
+
 private:
+    DecoderFactory _decoderFactory;
     float _duration {0};
+    size_t _size {0};
     std::vector<Frame> _frames;
 
+    IAudioBackend *_sharedBufferBackend {nullptr};
+    uint32_t _sharedBuffer {0};
+
     int getALAudioFormat(AudioFormat format) const;
 };
 
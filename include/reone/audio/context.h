@@ -28,6 +28,11 @@ public:
     virtual void setListenerPosition(glm::vec3 position) = 0;
 };
 
+class NullContext : public IContext, boost::noncopyable {
+public:
+    void setListenerPosition(glm::vec3 position) override {}
+};
+
 class Context : public IContext, boost::noncopyable {
 public:
     ~Context() { deinit(); }
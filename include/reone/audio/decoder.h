@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "clip.h"
+
+namespace reone {
+
+namespace audio {
+
+/**
+ * Pull-based source of PCM data. Each audio source owns a decoder instance,
+ * so that a clip can be played by multiple sources at once.
+ */
+class IAudioDecoder {
+public:
+    virtual ~IAudioDecoder() = default;
+
+    /**
+     * Decodes up to maxBytes of PCM data, appending it to the chunk. Stops
+     * early when format or sample rate of the stream differs from that of a
+     * non-empty chunk.
+     *
+     * @return false if nothing was appended to the chunk
+     */
+    virtual bool decode(AudioClip::Frame &chunk, size_t maxBytes) = 0;
+
+    virtual void rewind() = 0;
+};
+
+} // namespace audio
+
+} // namespace reone
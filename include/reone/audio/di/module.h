@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../backend.h"
 #include "../context.h"
 #include "../mixer.h"
 #include "../options.h"
@@ -38,7 +39,8 @@ public:
     void init();
     void deinit();
 
-    Context &context() { return *_context; }
+    IContext &context() { return *_context; }
+    IAudioBackend &backend() { return *_backend; }
     AudioMixer &mixer() { return *_mixer; }
 
     AudioServices &services() { return *_services; }
@@ -46,7 +48,8 @@ public:
 private:
     AudioOptions &_options;
 
-    std::unique_ptr<Context> _context;
+    std::unique_ptr<IContext> _context;
+    std::unique_ptr<IAudioBackend> _backend;
     std::unique_ptr<AudioMixer> _mixer;
 
     std::unique_ptr<AudioServices> _services;
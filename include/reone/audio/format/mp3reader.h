@@ -21,25 +21,62 @@
 
 #include "reone/system/types.h"
 
+#include "../clip.h"
+#include "../decoder.h"
+
 namespace reone {
 
 class IInputStream;
 
 namespace audio {
 
-class AudioClip;
+class Mp3Decoder : public IAudioDecoder, boost::noncopyable {
+public:
+    Mp3Decoder(std::shared_ptr<ByteBuffer> input);
+    ~Mp3Decoder();
+
+    bool decode(AudioClip::Frame &chunk, size_t maxBytes) override;
+    void rewind() override;
+
+    /**
+     * Computes duration of MP3 data by scanning frame headers, without decoding.
+     */
+    static float computeDuration(const ByteBuffer &input);
+
+private:
+    std::shared_ptr<ByteBuffer> _input;
+
+    mad_stream _stream;
+    mad_frame _frame;
+    mad_synth _synth;
+
+    int _pcmOffset {0};
+
+    bool decodeFrame();
+};
 
 class Mp3Reader : boost::noncopyable {
 public:
+    /**
+     * @param streaming whether to produce a streaming clip, decoded on demand, instead of decoding the whole input up front
+     */
+    Mp3Reader(bool streaming = false) :
+        _streaming(streaming) {
+    }
+
     virtual void load(IInputStream &stream);
 
     std::shared_ptr<AudioClip> stream() const { return _stream; }
 
 private:
+    bool _streaming;
+
     ByteBuffer _input;
     std::shared_ptr<AudioClip> _stream;
     bool _done {false};
 
+    void loadStreaming(IInputStream &stream);
+
     static mad_flow inputFunc(void *playbuf, mad_stream *stream);
     static mad_flow headerFunc(void *playbuf, mad_header const *header);
     static mad_flow outputFunc(void *playbuf, mad_header const *header, mad_pcm *pcm);
@@ -52,9 +89,16 @@ public:
 
 class Mp3ReaderFactory : public IMp3ReaderFactory {
 public:
+    Mp3ReaderFactory(bool streaming = false) :
+        _streaming(streaming) {
+    }
+
     std::shared_ptr<Mp3Reader> create() override {
-        return std::make_shared<Mp3Reader>();
+        return std::make_shared<Mp3Reader>(_streaming);
     }
+
+private:
+    bool _streaming;
 };
 
 } // namespace audio
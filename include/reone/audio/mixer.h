@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include "reone/system/spscqueue.h"
+
+#include "backend.h"
 #include "options.h"
 #include "source.h"
 #include "types.h"
@@ -31,46 +34,142 @@ class IAudioMixer {
 public:
     virtual ~IAudioMixer() = default;
 
+    /**
+     * Refills buffers of active sources, unless this is done by the audio thread.
+     */
     virtual void render() = 0;
     virtual void stop(AudioType type) = 0;
     virtual void stopAll() = 0;
 
+    virtual void setListenerPosition(glm::vec3 position) = 0;
+
     virtual std::shared_ptr<AudioSource> play(
         std::shared_ptr<AudioClip> clip,
         AudioType type,
         float gain = 1.0f,
         bool loop = false,
-        std::optional<glm::vec3> position = std::nullopt) = 0;
+        std::optional<glm::vec3> position = std::nullopt,
+        AudioPriority priority = AudioPriority::Normal) = 0;
 };
 
+/**
+ * Once initialized, AudioMixer owns a dedicated audio thread, which decodes
+ * and refills buffers of active sources. Game thread communicates with the
+ * audio thread through a lock-free command queue, so play, stop and stopAll
+ * must only be called from a single (game) thread.
+ *
+ * When not initialized, commands are processed synchronously on render.
+ *
+ * Number of concurrently playing voices is limited, both in total and per
+ * audio type. Voices compete for these slots by priority, then by audibility,
+ * which accounts for gain and distance to the listener. Voices that lose
+ * their slot, or become inaudible, are virtualized: their backend objects
+ * are released, but playback time keeps advancing, so that they resume from
+ * the right position once they win a slot again. Backend sources and buffers
+ * are pooled and reused between voices.
+ */
 class AudioMixer : public IAudioMixer, boost::noncopyable {
 public:
-    AudioMixer(AudioOptions &options) :
-        _options(options) {
+    AudioMixer(AudioOptions &options, IAudioBackend &backend) :
+        _options(options),
+        _pool(backend) {
     }
 
+    ~AudioMixer() { deinit(); }
+
+    void init();
+    void deinit();
+
     void render() override;
     void stop(AudioType type) override;
     void stopAll() override;
 
+    void setListenerPosition(glm::vec3 position) override;
+
     std::shared_ptr<AudioSource> play(
         std::shared_ptr<AudioClip> clip,
         AudioType type,
         float gain = 1.0f,
         bool loop = false,
-        std::optional<glm::vec3> = std::nullopt) override;
+        std::optional<glm::vec3> = std::nullopt,
+        AudioPriority priority = AudioPriority::Normal) override;
+
+    /**
+     * Processes pending commands, assigns voice slots and refills buffers of
+     * playing sources. Must be called from the audio thread, if running.
+     *
+     * @param dt time in seconds since the previous update
+     */
+    void update(float dt);
+
+    int numRealVoices() const { return _numRealVoices; }
+    int numVirtualVoices() const { return _numVirtualVoices; }
 
 private:
-    struct ActiveSource {
+    static constexpr size_t kCommandQueueCapacity = 1024;
+
+    enum class CommandType {
+        Play,
+        Stop,
+        StopAll
+    };
+
+    struct Command {
+        CommandType type {CommandType::Play};
+        AudioType audioType {AudioType::Sound};
+        AudioPriority priority {AudioPriority::Normal};
+        std::shared_ptr<AudioSource> source;
+    };
+
+    struct Voice {
         std::shared_ptr<AudioSource> source;
         AudioType type {AudioType::Sound};
+        AudioPriority priority {AudioPriority::Normal};
+        float time {0.0f};
+        float audibility {0.0f};
+        bool real {false};
+        bool selected {false};
     };
 
     AudioOptions &_options;
+    PooledAudioBackend _pool;
+
+    SpscQueue<Command, kCommandQueueCapacity> _commands;
+
+    std::atomic<float> _listenerX {0.0f};
+    std::atomic<float> _listenerY {0.0f};
+    std::atomic<float> _listenerZ {0.0f};
+
+    // Audio thread
+
+    std::vector<Voice> _voices;
+    std::vector<int> _voiceOrder;
+    std::chrono::steady_clock::time_point _lastUpdate;
+    bool _updated {false};
+
+    // END Audio thread
+
+    std::atomic_int _numRealVoices {0};
+    std::atomic_int _numVirtualVoices {0};
+
+    std::thread _thread;
+    std::atomic_bool _running {false};
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondVar;
+
+    void threadFunc();
+    void tick();
+
+    void enqueue(Command command);
+
+    void processCommands();
+    void assignVoices();
+    void releaseVoice(Voice &voice);
 
-    std::vector<ActiveSource> _sources;
+    float getAudibility(const AudioSource &source, const glm::vec3 &listener) const;
 
     float gainByType(AudioType type, float gain) const;
+    int maxVoicesByType(AudioType type) const;
 };
 
 } // namespace audio
@@ -26,6 +26,19 @@ struct AudioOptions {
     int voiceVolume {85};
     int soundVolume {85};
     int movieVolume {85};
+    int bufferMs {100};
+    int clipCacheMb {64};
+
+    int maxVoices {32};
+    int maxMusicVoices {2};
+    int maxVoiceVoices {4};
+    int maxSoundVoices {24};
+    int maxMovieVoices {2};
+
+    /**
+     * Do not open an audio device, discard everything that would be played.
+     */
+    bool headless {false};
 };
 
 } // namespace audio
@@ -17,27 +17,59 @@
 
 #pragma once
 
+#include "clip.h"
+#include "decoder.h"
+
 namespace reone {
 
 namespace audio {
 
-class AudioClip;
+class IAudioBackend;
 
+/**
+ * Plays an audio clip through an OpenAL source, streaming multi-frame clips
+ * through a small queue of buffers.
+ *
+ * play, stop and setPosition may be called from the game thread while the
+ * audio thread calls init, deinit and render: these requests are recorded
+ * atomically and applied on the next render.
+ *
+ * Sources may be deinitialized and initialized again to release the backend
+ * objects while keeping the playback state, see AudioMixer.
+ */
 class AudioSource : boost::noncopyable {
 public:
-    AudioSource(std::shared_ptr<AudioClip> clip,
+    AudioSource(IAudioBackend &backend,
+                std::shared_ptr<AudioClip> clip,
                 float gain = 1.0f,
                 bool loop = false,
-                std::optional<glm::vec3> position = std::nullopt) :
+                std::optional<glm::vec3> position = std::nullopt,
+                int bufferMs = kDefaultBufferMs) :
+        _backend(backend),
         _stream(std::move(clip)),
         _gain(gain),
         _loop(loop),
+        _relative(!position),
+        _bufferMs(bufferMs),
         _position(std::move(position)) {
+        if (_position) {
+            storePosition(*_position);
+        }
     }
 
     ~AudioSource() { deinit(); }
 
-    void init();
+    /**
+     * Acquires backend objects and starts playback, if requested, from the
+     * specified time in seconds.
+     */
+    void init(float time = 0.0f);
+
+    /**
+     * Releases backend objects.
+     */
+    void deinit();
+
     void render();
 
     void play();
@@ -46,28 +78,60 @@ public:
     void setPosition(glm::vec3 position);
 
     bool isPlaying() const { return _playing; }
+    bool isLooping() const { return _loop; }
+    bool isPositional() const { return !_relative; }
+
+    float gain() const { return _gain; }
+    glm::vec3 position() const { return loadPosition(); }
 
     float duration() const;
 
+    static constexpr int kDefaultBufferMs = 100;
+
 private:
+    enum PendingFlags {
+        kPendingPlayback = 1,
+        kPendingPosition = 2
+    };
+
+    IAudioBackend &_backend;
     std::shared_ptr<AudioClip> _stream;
     float _gain;
     bool _loop;
-    std::optional<glm::vec3> _position;
+    bool _relative;
+    int _bufferMs;
+
+    std::optional<glm::vec3> _position; // game thread
 
     bool _inited {false};
-    bool _playing {false};
+    std::atomic_bool _playing {false};
+    std::atomic_int _pending {0};
+    std::atomic<float> _positionX {0.0f};
+    std::atomic<float> _positionY {0.0f};
+    std::atomic<float> _positionZ {0.0f};
 
     std::vector<uint32_t> _buffers;
     bool _streaming {false};
     uint32_t _source {0};
-    int _nextFrame {0};
-    int _nextBuffer {0};
 
-    bool _playingDirty {false};
-    bool _positionDirty {false};
+    std::unique_ptr<IAudioDecoder> _decoder;
+    AudioClip::Frame _chunk;
 
-    void deinit();
+    void skip(float time);
+    bool fillNextBuffer(uint32_t buffer);
+
+    void storePosition(const glm::vec3 &position) {
+        _positionX.store(position.x, std::memory_order_relaxed);
+        _positionY.store(position.y, std::memory_order_relaxed);
+        _positionZ.store(position.z, std::memory_order_relaxed);
+    }
+
+    glm::vec3 loadPosition() const {
+        return glm::vec3(
+            _positionX.load(std::memory_order_relaxed),
+            _positionY.load(std::memory_order_relaxed),
+            _positionZ.load(std::memory_order_relaxed));
+    }
 };
 
 } // namespace audio
@@ -35,6 +35,12 @@ enum class AudioType {
     Movie
 };
 
+enum class AudioPriority {
+    Low,
+    Normal,
+    High
+};
+
 } // namespace audio
 
 } // namespace reone
@@ -121,6 +121,12 @@ public:
 
     // END Force Powers
 
+    /**
+     * @return approximate number of bytes allocated by containers of this
+     *         aggregate, excluding the aggregate itself
+     */
+    size_t heapBytes() const;
+
 private:
     std::vector<std::pair<CreatureClass *, int>> _classLevels;
     std::map<Ability, int> _abilityScores;
@@ -43,6 +43,7 @@
 #include "gui/map.h"
 #include "gui/partyselect.h"
 #include "gui/saveload.h"
+#include "itemblueprints.h"
 #include "journal.h"
 #include "location.h"
 #include "object/area.h"
@@ -60,6 +61,7 @@
 #include "object/store.h"
 #include "object/trigger.h"
 #include "object/waypoint.h"
+#include "objectblueprints.h"
 #include "options.h"
 #include "party.h"
 #include "script/runner.h"
@@ -116,7 +118,10 @@ public:
         _party(*this),
         _combat(*this, services),
         _swoopRace(*this),
-        _journal(services.resource.gffs, services.resource.strings) {
+        _journal(services.resource.gffs, services.resource.strings),
+        _itemBlueprints(services),
+        _creatureBlueprints(resource::ResType::Utc, services.resource.gffs),
+        _placeableBlueprints(resource::ResType::Utp, services.resource.gffs) {
         initJournalNotifications();
     }
 
@@ -138,6 +143,9 @@ public:
     Party &party() { return _party; }
     Combat &combat() { return _combat; }
     Journal &journal() { return _journal; }
+    ItemBlueprints &itemBlueprints() { return _itemBlueprints; }
+    ObjectBlueprints<Creature::Blueprint> &creatureBlueprints() { return _creatureBlueprints; }
+    ObjectBlueprints<Placeable::Blueprint> &placeableBlueprints() { return _placeableBlueprints; }
     ScriptRunner &scriptRunner() { return *_scriptRunner; }
     Map &map() { return *_map; }
     script::IRoutines &routines() { return *_routines; }
@@ -438,6 +446,9 @@ private:
     SwoopRace _swoopRace;
     Journal _journal;
     StatusSummaryAccumulator _statusSummary;
+    ItemBlueprints _itemBlueprints;
+    ObjectBlueprints<Creature::Blueprint> _creatureBlueprints;
+    ObjectBlueprints<Placeable::Blueprint> _placeableBlueprints;
 
     std::unique_ptr<script::IRoutines> _routines;
     std::unique_ptr<ScriptRunner> _scriptRunner;
@@ -581,6 +592,7 @@ private:
 
     void initConsole();
     void initJournalNotifications();
+    void clearBlueprints();
     int getPlotXPByIndex(int plotIndex);
 
     using ConsoleCommandHandler = void (Game::*)(const ConsoleArgs &);
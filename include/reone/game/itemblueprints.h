@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/resource/strings.h"
+
+#include "objectblueprints.h"
+#include "types.h"
+
+namespace reone {
+
+namespace audio {
+
+class AudioClip;
+
+}
+
+namespace graphics {
+
+class Model;
+class Texture;
+
+} // namespace graphics
+
+namespace game {
+
+struct ServicesView;
+
+struct ItemAmmunitionType {
+    std::shared_ptr<graphics::Model> model;
+    std::shared_ptr<graphics::Model> muzzleFlash;
+    std::shared_ptr<audio::AudioClip> shotSound1;
+    std::shared_ptr<audio::AudioClip> shotSound2;
+    std::shared_ptr<audio::AudioClip> impactSound1;
+    std::shared_ptr<audio::AudioClip> impactSound2;
+};
+
+struct ItemPropertyEntry {
+    uint8_t chanceAppear {0};
+    uint8_t costTable {0};
+    uint16_t costValue {0};
+    uint8_t paramTable {0};
+    uint8_t paramValue {0};
+    uint16_t propertyName {0};
+    uint16_t subtype {0};
+    uint8_t upgradeType {0};
+};
+
+/**
+ * Item state derived from UTI templates: names, variations, properties and
+ * everything looked up from baseitems.2da. Blueprints are immutable once
+ * published by ItemBlueprints and are shared between items spawned from the
+ * same template. Items copy a blueprint before applying instance overrides.
+ */
+struct ItemBlueprint {
+    int32_t baseItem {0};
+    resource::LocString localizedName;
+    resource::LocString description;
+    resource::LocString descIdentified;
+    uint8_t modelVariation {0};
+    uint8_t bodyVariation {0};
+    uint8_t textureVariation {0};
+
+    std::string baseBodyVariation;
+    std::string itemClass;
+
+    std::shared_ptr<graphics::Texture> icon;
+    uint32_t equipableSlots {0};
+    int attackRange {0};
+    int numDice {0};
+    int dieToRoll {0};
+    int damageFlags {0};
+    WeaponType weaponType {WeaponType::None};
+    WeaponWield weaponWield {WeaponWield::None};
+
+    std::shared_ptr<ItemAmmunitionType> ammunitionType;
+
+    int criticalThreat {0};
+    int criticalHitMultiplier {0};
+
+    std::optional<SpellType> activateSpell;
+    int disguiseAppearance {-1};
+    std::vector<ItemPropertyEntry> properties;
+
+    bool isEquippable(int slot) const {
+        return (equipableSlots >> slot) & 1;
+    }
+
+    /**
+     * @return approximate number of bytes owned by this blueprint, excluding
+     *         shared textures, models and audio clips
+     */
+    size_t residentBytes() const;
+
+    /**
+     * Blueprint of an item that was never deserialized.
+     */
+    static const std::shared_ptr<const ItemBlueprint> &defaultInstance();
+};
+
+/**
+ * Parsed UTI template together with the blueprint it produces when applied to
+ * a default item.
+ */
+using ItemTemplate = ObjectTemplate<ItemBlueprint>;
+
+/**
+ * Cache of item templates. Each UTI is parsed into a blueprint once by
+ * ObjectBlueprints, no matter how many items are spawned from it. Results of
+ * stacking a template on top of another cached blueprint (e.g. a UTI referencing itself via TemplateResRef)
+ * are memoized as well, so that such items keep sharing state.
+ *
+ * Templates may be overridden by module resources, so the cache must be
+ * cleared whenever the set of loaded modules changes. Blueprints held by
+ * existing items outlive the cache.
+ */
+class ItemBlueprints : boost::noncopyable {
+public:
+    struct Stats {
+        size_t numTemplates {0};
+        size_t numParses {0};
+        size_t numHits {0};
+        size_t numStacked {0};
+        size_t numCopies {0};
+        size_t residentBytes {0};
+    };
+
+    ItemBlueprints(ServicesView &services);
+
+    /**
+     * Drops all cached templates and blueprints and resets statistics.
+     */
+    void clear();
+
+    /**
+     * @return cached template, or nullptr if UTI resource is not found
+     */
+    std::shared_ptr<const ItemTemplate> get(const std::string &resRef);
+
+    /**
+     * @return blueprint produced by applying template on top of base blueprint
+     */
+    std::shared_ptr<const ItemBlueprint> stack(const std::shared_ptr<const ItemBlueprint> &base, const ItemTemplate &tmpl);
+
+    /**
+     * @return blueprint of a default item that was deserialized from a GFF
+     *         without blueprint fields
+     */
+    std::shared_ptr<const ItemBlueprint> empty();
+
+    /**
+     * @return private copy of a blueprint, for applying instance overrides
+     */
+    std::shared_ptr<ItemBlueprint> copy(const ItemBlueprint &blueprint);
+
+    /**
+     * Applies blueprint fields of GFF struct to blueprint.
+     */
+    void deserialize(const resource::Gff &gff, ItemBlueprint &blueprint);
+
+    Stats stats() const;
+
+    /**
+     * @return whether GFF struct has fields that override blueprint state
+     */
+    static bool hasBlueprintFields(const resource::Gff &gff);
+
+private:
+    struct StackedKey {
+        const ItemBlueprint *base {nullptr};
+        const ItemTemplate *tmpl {nullptr};
+
+        bool operator<(const StackedKey &other) const {
+            return std::tie(base, tmpl) < std::tie(other.base, other.tmpl);
+        }
+    };
+
+    struct StackedValue {
+        std::shared_ptr<const ItemBlueprint> base; /**< keeps key alive */
+        std::shared_ptr<const ItemBlueprint> blueprint;
+    };
+
+    ServicesView &_services;
+
+    ObjectBlueprints<ItemBlueprint> _templates;
+    std::map<StackedKey, StackedValue> _stacked;
+    std::shared_ptr<const ItemBlueprint> _empty;
+
+    size_t _numStackedHits {0};
+    size_t _numCopies {0};
+
+    void deserializeProperties(const resource::Gff &gff, ItemBlueprint &blueprint);
+    void deserializeBase(const resource::Gff &gff, ItemBlueprint &blueprint);
+    void loadAmmunitionType(ItemBlueprint &blueprint);
+};
+
+} // namespace game
+
+} // namespace reone
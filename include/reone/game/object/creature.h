@@ -69,6 +69,10 @@ public:
         void selectNextPoint();
     };
 
+    // The original engine does not retain perception range in savegames.
+    // Default range matches PercepRngDefault from ranges.2da.
+    static constexpr float kDefaultPerceptionRange = 20.0f;
+
     struct BodyBag {
         std::string name;
         int appearance {0}; /**< index into placeables.2da */
@@ -82,6 +86,29 @@ public:
         std::set<uint32_t> heard;
     };
 
+    /**
+     * Creature state that a UTC template derives from talk tables and 2DA
+     * files. Shared between creatures spawned from the same template.
+     */
+    struct Blueprint {
+        resource::LocString firstName;
+        resource::LocString lastName;
+        uint16_t soundSetId {0xFFFF};
+        std::shared_ptr<resource::SoundSet> soundSet;
+        uint8_t bodyBagId {0xFF};
+        BodyBag bodyBag;
+        uint8_t perceptionId {0xFF};
+        float sightRange {kDefaultPerceptionRange};
+        float hearingRange {kDefaultPerceptionRange};
+        CreatureAttributes attributes;
+
+        /**
+         * @return approximate number of bytes owned by this blueprint,
+         *         excluding the shared sound set
+         */
+        size_t residentBytes() const;
+    };
+
     struct CombatState {
         bool active {false};
         bool shouldDeactivate {false};
@@ -425,14 +452,19 @@ private:
     // END Animation
 
     // Blueprint
+    bool deserializeTemplate(const std::string &resRef);
     void deserializeAll(const resource::Gff &gff);
-    void deserializeName(const resource::Gff &gff);
-    void deserializeSoundSet(const resource::Gff &gff);
-    void deserializeBodyBag(const resource::Gff &gff);
-    void deserializeAttributes(const resource::Gff &gff);
-    void deserializeClass(const resource::Gff &gff);
-    void deserializePerception(const resource::Gff &gff);
+    void deserializeFields(const resource::Gff &gff);
+    void deserializeBlueprint(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializeSoundSet(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializeBodyBag(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializeAttributes(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializeClass(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializePerception(const resource::Gff &gff, Blueprint &blueprint) const;
     void deserializeEquipItems(const resource::Gff &gff);
+
+    Blueprint captureBlueprint() const;
+    void applyBlueprint(const Blueprint &blueprint);
     // END Blueprint
 };
 
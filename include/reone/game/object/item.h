@@ -23,6 +23,7 @@
 #include "reone/graphics/texture.h"
 #include "reone/resource/strings.h"
 
+#include "../itemblueprints.h"
 #include "../object.h"
 #include "../types.h"
 
@@ -39,25 +40,8 @@ public:
     // itemclass of the Credits base item in baseitems.2da, lower-cased
     static constexpr char kCreditsItemClass[] = "i_credits";
 
-    struct AmmunitionType {
-        std::shared_ptr<graphics::Model> model;
-        std::shared_ptr<graphics::Model> muzzleFlash;
-        std::shared_ptr<audio::AudioClip> shotSound1;
-        std::shared_ptr<audio::AudioClip> shotSound2;
-        std::shared_ptr<audio::AudioClip> impactSound1;
-        std::shared_ptr<audio::AudioClip> impactSound2;
-    };
-
-    struct PropertyEntry {
-        uint8_t chanceAppear {0};
-        uint8_t costTable {0};
-        uint16_t costValue {0};
-        uint8_t paramTable {0};
-        uint8_t paramValue {0};
-        uint16_t propertyName {0};
-        uint16_t subtype {0};
-        uint8_t upgradeType {0};
-    };
+    using AmmunitionType = ItemAmmunitionType;
+    using PropertyEntry = ItemPropertyEntry;
 
     Item(
         uint32_t id,
@@ -85,37 +69,42 @@ public:
 
     bool isEquippable() const;
     bool isEquippable(int slot) const;
-    bool isCredits() const { return _itemClass == kCreditsItemClass; }
+    bool isCredits() const { return _blueprint->itemClass == kCreditsItemClass; }
     bool isDropable() const { return _dropable; }
     bool isIdentified() const { return _identified; }
     bool isEquipped() const { return _equipped; }
-    bool isRanged() const { return _weaponType == WeaponType::Ranged; }
-
-    const std::string &baseBodyVariation() const { return _baseBodyVariation; }
-    const std::string &itemClass() const { return _itemClass; }
-    const std::string &localizedName() const { return _localizedName.str(); }
-    float attackRange() const { return static_cast<float>(_attackRange); }
-    int bodyVariation() const { return _bodyVariation; }
-    int damageFlags() const { return _damageFlags; }
-    int dieToRoll() const { return _dieToRoll; }
-    int modelVariation() const { return _modelVariation; }
-    int numDice() const { return _numDice; }
+    bool isRanged() const { return _blueprint->weaponType == WeaponType::Ranged; }
+
+    const std::string &baseBodyVariation() const { return _blueprint->baseBodyVariation; }
+    const std::string &itemClass() const { return _blueprint->itemClass; }
+    const std::string &localizedName() const { return _blueprint->localizedName.str(); }
+    float attackRange() const { return static_cast<float>(_blueprint->attackRange); }
+    int bodyVariation() const { return _blueprint->bodyVariation; }
+    int damageFlags() const { return _blueprint->damageFlags; }
+    int dieToRoll() const { return _blueprint->dieToRoll; }
+    int modelVariation() const { return _blueprint->modelVariation; }
+    int numDice() const { return _blueprint->numDice; }
     int stackSize() const { return _stackSize; }
-    int textureVariation() const { return _textureVariation; }
-    std::shared_ptr<AmmunitionType> ammunitionType() const { return _ammunitionType; }
-    std::shared_ptr<graphics::Texture> icon() const { return _icon; }
-    WeaponType weaponType() const { return _weaponType; }
-    WeaponWield weaponWield() const { return _weaponWield; }
-    const std::string &description() const { return _description.str(); }
-    const std::string &descIdentified() const { return _descIdentified.str(); }
-    int baseItemType() const { return _baseItem; }
-    int criticalThreat() const { return _criticalThreat; }
-    int criticalHitMultiplier() const { return _criticalHitMultiplier; }
-    std::optional<SpellType> activateSpell() const { return _activateSpell; }
-    const std::vector<PropertyEntry> &properties() const { return _properties; }
-
-    bool hasDisguise() const { return _disguiseAppearance >= 0; }
-    int disguiseAppearance() const { return _disguiseAppearance; }
+    int textureVariation() const { return _blueprint->textureVariation; }
+    std::shared_ptr<AmmunitionType> ammunitionType() const { return _blueprint->ammunitionType; }
+    std::shared_ptr<graphics::Texture> icon() const { return _blueprint->icon; }
+    WeaponType weaponType() const { return _blueprint->weaponType; }
+    WeaponWield weaponWield() const { return _blueprint->weaponWield; }
+    const std::string &description() const { return _blueprint->description.str(); }
+    const std::string &descIdentified() const { return _blueprint->descIdentified.str(); }
+    int baseItemType() const { return _blueprint->baseItem; }
+    int criticalThreat() const { return _blueprint->criticalThreat; }
+    int criticalHitMultiplier() const { return _blueprint->criticalHitMultiplier; }
+    std::optional<SpellType> activateSpell() const { return _blueprint->activateSpell; }
+    const std::vector<PropertyEntry> &properties() const { return _blueprint->properties; }
+
+    bool hasDisguise() const { return _blueprint->disguiseAppearance >= 0; }
+    int disguiseAppearance() const { return _blueprint->disguiseAppearance; }
+
+    /**
+     * @return template-derived state, possibly shared with other items
+     */
+    const ItemBlueprint &blueprint() const { return *_blueprint; }
 
     void setDropable(bool dropable);
     void setStackSize(int size);
@@ -124,51 +113,28 @@ public:
 
 private:
     // Serializable
-    int32_t _baseItem {0};
-    resource::LocString _localizedName;
-    resource::LocString _description;
-    resource::LocString _descIdentified;
     uint8_t _charges {0};
     uint32_t _cost {0};
     uint32_t _addCost {0};
     bool _stolen {false};
     uint16_t _stackSize {1};
     bool _identified {true};
-    uint8_t _modelVariation {0};
-    uint8_t _bodyVariation {0};
-    uint8_t _textureVariation {0};
     bool _dropable {false};
     // END Serializable
 
-    std::string _baseBodyVariation;
-    std::string _itemClass;
-
-    std::shared_ptr<graphics::Texture> _icon;
-    uint32_t _equipableSlots {0};
-    int _attackRange {0};
-    int _numDice {0};
-    int _dieToRoll {0};
-    int _damageFlags {0};
-    WeaponType _weaponType {WeaponType::None};
-    WeaponWield _weaponWield {WeaponWield::None};
-
     bool _equipped {false};
-    std::shared_ptr<AmmunitionType> _ammunitionType;
 
-    int _criticalThreat {0};
-    int _criticalHitMultiplier {0};
-
-    std::optional<SpellType> _activateSpell;
-    int _disguiseAppearance {-1};
-    std::vector<PropertyEntry> _properties;
+    std::shared_ptr<const ItemBlueprint> _blueprint {ItemBlueprint::defaultInstance()};
+    std::shared_ptr<ItemBlueprint> _ownedBlueprint; /**< non-null once instance overrides were applied */
 
     std::shared_ptr<audio::AudioSource> _audioSource;
 
+    ItemBlueprint &mutableBlueprint();
+
     // Blueprint
-    void deserializeAll(const resource::Gff &gff);
-    void deserializeProperties(const resource::Gff &gff);
-    void deserializeBase(const resource::Gff &gff);
-    void loadAmmunitionType();
+    void deserializeTemplates(const resource::Gff &gff);
+    void applyTemplate(const ItemTemplate &tmpl);
+    void deserializeInstance(const resource::Gff &gff);
     // END Blueprint
 };
 
@@ -28,6 +28,21 @@ namespace game {
 
 class Placeable : public Object {
 public:
+    /**
+     * Placeable state that a UTP template derives from talk tables. Shared
+     * between placeables spawned from the same template.
+     */
+    struct Blueprint {
+        resource::LocString locName;
+        std::string name;
+        resource::LocString description;
+
+        /**
+         * @return approximate number of bytes owned by this blueprint
+         */
+        size_t residentBytes() const;
+    };
+
     Placeable(
         uint32_t id,
         std::string sceneName,
@@ -139,7 +154,15 @@ private:
     void runDamagedScript(uint32_t damagerId);
     void runDeathScript(uint32_t damagerId);
 
+    bool deserializeTemplate(const std::string &resRef);
     void deserializeAll(const resource::Gff &gff);
+    void deserializeFields(const resource::Gff &gff);
+    void deserializeBlueprint(const resource::Gff &gff, Blueprint &blueprint) const;
+    void deserializeItems(const resource::Gff &gff);
+
+    Blueprint captureBlueprint() const;
+    void applyBlueprint(const Blueprint &blueprint);
+
     void loadAppearance();
 
     void updateTransform() override;
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "reone/resource/gff.h"
+#include "reone/resource/provider/gffs.h"
+#include "reone/resource/types.h"
+#include "reone/resource/typeutil.h"
+#include "reone/system/trace.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Parsed UTC, UTP or UTI template together with the blueprint derived from it.
+ */
+template <class Blueprint>
+struct ObjectTemplate {
+    std::string resRef;
+    std::shared_ptr<resource::Gff> gff;
+    std::shared_ptr<const Blueprint> blueprint;
+};
+
+/**
+ * Cache of creature, placeable and item templates. Blueprints hold the state
+ * that objects derive from a template by looking up talk tables and 2DA files,
+ * so that it is computed once per template, no matter how many objects are
+ * spawned from it. Template fields themselves are read from the GFF tree,
+ * which is shared as well.
+ *
+ * Blueprint must provide residentBytes(), which is used for statistics.
+ *
+ * Templates may be overridden by module resources, so the cache must be
+ * cleared whenever the set of loaded modules changes.
+ */
+template <class Blueprint>
+class ObjectBlueprints : boost::noncopyable {
+public:
+    struct Stats {
+        size_t numTemplates {0};
+        size_t numParses {0};
+        size_t numHits {0};
+        size_t residentBytes {0};
+    };
+
+    using Parser = std::function<void(const resource::Gff &, Blueprint &)>;
+
+    ObjectBlueprints(resource::ResType type, resource::IGffs &gffs) :
+        _type(type),
+        _gffs(gffs),
+        _hitsCounter(getExtByResType(type) + " blueprint cache hits"),
+        _parsesCounter(getExtByResType(type) + " blueprint parses") {
+    }
+
+    /**
+     * Drops all cached templates and resets statistics.
+     */
+    void clear() {
+        _templates.clear();
+        _numParses = 0;
+        _numHits = 0;
+    }
+
+    /**
+     * @param parse function that derives blueprint from template, called on cache miss
+     * @return cached template, or nullptr if resource is not found
+     */
+    std::shared_ptr<const ObjectTemplate<Blueprint>> get(const std::string &resRef, const Parser &parse) {
+        auto maybeTemplate = _templates.find(resRef);
+        if (maybeTemplate != _templates.end()) {
+            ++_numHits;
+            R_TRACE_COUNTER(_hitsCounter.c_str(), _numHits);
+            return maybeTemplate->second;
+        }
+        std::shared_ptr<ObjectTemplate<Blueprint>> tmpl;
+        if (auto gff = _gffs.get(resRef, _type)) {
+            auto blueprint = std::make_shared<Blueprint>();
+            parse(*gff, *blueprint);
+            tmpl = std::make_shared<ObjectTemplate<Blueprint>>();
+            tmpl->resRef = resRef;
+            tmpl->gff = std::move(gff);
+            tmpl->blueprint = std::move(blueprint);
+            ++_numParses;
+            R_TRACE_COUNTER(_parsesCounter.c_str(), _numParses);
+        }
+        _templates.insert({resRef, tmpl});
+        return tmpl;
+    }
+
+    Stats stats() const {
+        Stats stats;
+        for (auto &[resRef, tmpl] : _templates) {
+            if (!tmpl) {
+                continue;
+            }
+            ++stats.numTemplates;
+            stats.residentBytes += tmpl->blueprint->residentBytes();
+        }
+        stats.numParses = _numParses;
+        stats.numHits = _numHits;
+        return stats;
+    }
+
+private:
+    resource::ResType _type;
+    resource::IGffs &_gffs;
+    std::string _hitsCounter;
+    std::string _parsesCounter;
+
+    std::unordered_map<std::string, std::shared_ptr<const ObjectTemplate<Blueprint>>> _templates;
+
+    size_t _numParses {0};
+    size_t _numHits {0};
+};
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * In headless mode there is no OpenGL context. GL objects keep their
+ * CPU-side data, but skip creating GPU storage, so that resources can be
+ * loaded and scenes updated without a display. Nothing must be rendered.
+ *
+ * OpenGL state is process-wide, and so is this switch.
+ */
+void setHeadless(bool headless);
+
+bool isHeadless();
+
+} // namespace graphics
+
+} // namespace reone
@@ -35,10 +35,12 @@ struct GraphicsOptions {
     bool ssr {true};
     bool fxaa {true};
     bool sharpen {true};
+    bool movieYUV {true};
     TextureQuality textureQuality {TextureQuality::High};
     int shadowResolution {2048};
     int anisotropicFiltering {2};
     float drawDistance {kDefaultObjectDrawDistance};
+    bool headless {false};
 };
 
 } // namespace graphics
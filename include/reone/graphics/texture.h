@@ -160,6 +160,12 @@ public:
     void setPixels(int w, int h, PixelFormat format, Layer layer, bool refresh = false);
     void setPixels(int w, int h, PixelFormat format, std::vector<Layer> layers, bool refresh = false);
 
+    /**
+     * Uploads pixels of a region of a 2D texture, without reallocating its
+     * storage. Texture must be bound. Pixels are not retained in layers.
+     */
+    void setSubPixels(int x, int y, int w, int h, const ByteBuffer &pixels);
+
     // END Pixels
 
     // OpenGL
@@ -172,6 +172,11 @@ struct TextureUnits {
 
     static constexpr int envMapCube = 18;
     static constexpr int shadowMapCube = 19;
+
+    // Video
+
+    static constexpr int chromaU = 20;
+    static constexpr int chromaV = 21;
 };
 
 // MDL
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/audio/clip.h"
+#include "reone/audio/decoder.h"
+
+namespace reone {
+
+namespace movie {
+
+/**
+ * Sequential source of audio frames.
+ */
+class IAudioStream {
+public:
+    virtual ~IAudioStream() = default;
+
+    /**
+     * Decodes the next frame of this stream, replacing contents of the frame.
+     *
+     * @return false if end of stream is reached
+     */
+    virtual bool decodeFrame(audio::AudioClip::Frame &frame) = 0;
+
+    virtual void rewind() = 0;
+};
+
+/**
+ * Adapts an audio stream to the pull-based decoder interface, decoding frames
+ * only as chunks are requested, so that neither decoding time nor memory
+ * usage depend on length of the stream.
+ */
+class AudioStreamDecoder : public audio::IAudioDecoder, boost::noncopyable {
+public:
+    AudioStreamDecoder(std::unique_ptr<IAudioStream> stream) :
+        _stream(std::move(stream)) {
+    }
+
+    bool decode(audio::AudioClip::Frame &chunk, size_t maxBytes) override;
+
+    void rewind() override;
+
+private:
+    std::unique_ptr<IAudioStream> _stream;
+
+    audio::AudioClip::Frame _frame;
+    size_t _offset {0};
+    bool _ended {false};
+};
+
+} // namespace movie
+
+} // namespace reone
@@ -21,6 +21,7 @@ namespace reone {
 
 namespace graphics {
 
+struct GraphicsOptions;
 struct GraphicsServices;
 
 }
@@ -39,9 +40,11 @@ class BikReader {
 public:
     BikReader(
         std::filesystem::path path,
+        graphics::GraphicsOptions &graphicsOpt,
         graphics::GraphicsServices &graphicsSvc,
         audio::IAudioMixer &audioPlayer) :
         _path(std::move(path)),
+        _graphicsOpt(graphicsOpt),
         _graphicsSvc(graphicsSvc),
         _audioPlayer(audioPlayer) {
     }
@@ -52,6 +55,7 @@ public:
 
 private:
     std::filesystem::path _path;
+    graphics::GraphicsOptions &_graphicsOpt;
     graphics::GraphicsServices &_graphicsSvc;
     audio::IAudioMixer &_audioPlayer;
 
@@ -21,6 +21,7 @@
 #include "reone/graphics/texture.h"
 #include "reone/system/types.h"
 
+#include "videoplayer.h"
 #include "videostream.h"
 
 namespace reone {
@@ -72,25 +73,31 @@ public:
 
     bool isFinished() const override { return _finished; }
 
-    void setVideoStream(std::shared_ptr<VideoStream> stream) { _videoStream = std::move(stream); }
+    void setVideoStream(std::shared_ptr<IVideoStream> stream) { _videoStream = std::move(stream); }
     void setAudioClip(std::shared_ptr<audio::AudioClip> stream) { _audioStream = std::move(stream); }
+    void setConvertToRGB(bool convert) { _convertToRGB = convert; }
 
 private:
     graphics::GraphicsServices &_graphicsSvc;
     audio::IAudioMixer &_audioPlayer;
 
     bool _inited {false};
+    bool _convertToRGB {false};
 
     int _width {0};
     int _height {0};
 
     float _time {0.0f};
     bool _finished {false};
+    bool _frameChanged {false};
 
-    std::shared_ptr<VideoStream> _videoStream;
+    std::shared_ptr<IVideoStream> _videoStream;
     std::shared_ptr<audio::AudioClip> _audioStream;
 
-    std::shared_ptr<graphics::Texture> _texture;
+    std::unique_ptr<VideoPlayer> _videoPlayer;
+
+    std::shared_ptr<graphics::Texture> _texture;                     /**< RGB, only if converting to RGB */
+    std::array<std::shared_ptr<graphics::Texture>, 3> _planeTextures; /**< Y, U and V */
     std::shared_ptr<audio::AudioSource> _audioSource;
 };
 
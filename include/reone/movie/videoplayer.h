@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "reone/system/spscqueue.h"
+#include "reone/system/types.h"
+
+#include "videostream.h"
+
+namespace reone {
+
+namespace movie {
+
+/**
+ * Decodes video frames on a worker thread into a small ring of reusable frame
+ * buffers, from which the main thread selects frames by presentation time.
+ * Frames are kept in planar YUV 4:2:0 and optionally converted to RGB by the
+ * worker.
+ *
+ * Main thread never waits for the worker: if decoding falls behind, the
+ * current frame simply stays selected. Frames superseded before they could be
+ * selected are dropped, and the worker skips copying of frames that are
+ * already late.
+ */
+class VideoPlayer : boost::noncopyable {
+public:
+    struct Frame {
+        float time {0.0f};
+        std::array<std::shared_ptr<ByteBuffer>, 3> planes; /**< Y, U and V */
+        std::shared_ptr<ByteBuffer> pixels;                /**< RGB, only if converting to RGB */
+    };
+
+    VideoPlayer(std::shared_ptr<IVideoStream> stream, bool convertToRGB = false) :
+        _stream(std::move(stream)),
+        _convertToRGB(convertToRGB) {
+    }
+
+    ~VideoPlayer() { deinit(); }
+
+    void init();
+    void deinit();
+
+    /**
+     * Selects the latest decoded frame, whose presentation time does not
+     * exceed the specified time.
+     *
+     * @return true if a new frame was selected
+     */
+    bool update(float time);
+
+    /**
+     * @return true if all frames of the stream have been decoded and selected
+     */
+    bool hasEnded() const;
+
+    /**
+     * @return currently selected frame, or nullptr if none was selected yet
+     */
+    const Frame *frame() const;
+
+    int numDroppedFrames() const { return _numDroppedFrames; }
+    int numSkippedFrames() const { return _numSkippedFrames; }
+
+private:
+    static constexpr size_t kNumFrames = 4;
+
+    std::shared_ptr<IVideoStream> _stream;
+    bool _convertToRGB;
+
+    std::array<Frame, kNumFrames> _frames;
+    SpscQueue<int, kNumFrames> _decodedFrames; // worker to main thread
+    SpscQueue<int, kNumFrames> _freeFrames;    // main thread to worker
+    int _currentFrame {-1};
+    int _numDroppedFrames {0};
+
+    std::thread _thread;
+    std::atomic_bool _running {false};
+    std::atomic_bool _ended {false};
+    std::atomic<float> _time {0.0f};
+    std::atomic_int _numSkippedFrames {0};
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondVar;
+
+    void threadFunc();
+
+    void releaseFrame(int index);
+};
+
+} // namespace movie
+
+} // namespace reone
@@ -21,27 +21,32 @@ namespace reone {
 
 namespace movie {
 
-class VideoStream {
+/**
+ * Sequential source of video frames.
+ */
+class IVideoStream {
 public:
-    struct Frame {
-        std::shared_ptr<ByteBuffer> pixels;
-    };
-
-    virtual void seek(float time) = 0;
-
-    bool hasEnded() const { return _ended; }
-
-    int width() const { return _width; }
-    int height() const { return _height; }
-    const Frame &frame() const { return _frame; }
-
-protected:
-    int _width {0};
-    int _height {0};
-
-    Frame _frame;
-
-    bool _ended {false};
+    virtual ~IVideoStream() = default;
+
+    virtual int width() const = 0;
+    virtual int height() const = 0;
+
+    /**
+     * Decodes the next frame of this stream.
+     *
+     * @param time receives presentation time of the decoded frame in seconds
+     * @return false if end of stream is reached
+     */
+    virtual bool decodeFrame(float &time) = 0;
+
+    /**
+     * Copies the last decoded frame as tightly packed planar YUV 4:2:0.
+     *
+     * @param y destination buffer of width * height bytes
+     * @param u destination buffer of chroma width * chroma height bytes
+     * @param v destination buffer of chroma width * chroma height bytes
+     */
+    virtual void copyFrame(uint8_t *y, uint8_t *u, uint8_t *v) = 0;
 };
 
 } // namespace movie
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace movie {
+
+/**
+ * Size of a chroma plane of a YUV 4:2:0 image, rounded up for odd dimensions.
+ */
+inline int getChromaSize(int size) {
+    return (size + 1) / 2;
+}
+
+/**
+ * Converts a single limited range BT.601 YUV sample to RGB, using fixed point
+ * arithmetic. Results match glsl/f_texyuv.glsl to within rounding.
+ */
+glm::u8vec3 convertYUVToRGB(uint8_t y, uint8_t u, uint8_t v);
+
+/**
+ * Converts a tightly packed planar YUV 4:2:0 image to RGB.
+ *
+ * @param rgb destination buffer of w * h * 3 bytes
+ */
+void convertYUV420ToRGB(int w, int h, const uint8_t *y, const uint8_t *u, const uint8_t *v, uint8_t *rgb);
+
+} // namespace movie
+
+} // namespace reone
@@ -25,6 +25,14 @@ namespace resource {
 
 class TwoDAReader;
 
+/**
+ * Two-dimensional table, stored column by column as offsets into a shared
+ * pool of unique cell values.
+ *
+ * Column names are resolved through a hash map, or once into a Column handle.
+ * Integer and float columns, as well as per-column value indices, are parsed
+ * lazily on first access and cached. Cached lookups are thread-safe.
+ */
 class TwoDA : boost::noncopyable {
 public:
     struct Row {
@@ -52,30 +60,61 @@ public:
         std::vector<Row> _rows;
     };
 
-    TwoDA(std::vector<std::string> columns, std::vector<Row> rows) :
-        _columns(std::move(columns)),
-        _rows(std::move(rows)) {
-        size_t numColumns = _columns.size();
-        for (size_t row = 0; row < _rows.size(); ++row) {
-            size_t numValues = _rows[row].values.size();
-            if (numValues != numColumns) {
-                throw ValidationException(str(boost::format("Expected %d columns in 2DA row %d, was %d") % numColumns % row % numValues));
-            }
+    /**
+     * Pre-resolved column, valid only for the table it was obtained from.
+     */
+    class Column {
+    public:
+        Column() = default;
+
+        bool isValid() const { return _index != -1; }
+
+        int index() const { return _index; }
+
+    private:
+        int _index {-1};
+
+        explicit Column(int index) :
+            _index(index) {
         }
-    }
+
+        friend class TwoDA;
+    };
+
+    TwoDA(std::vector<std::string> columns, std::vector<Row> rows);
+
+    /**
+     * @param pool null-terminated cell values
+     * @param offsets row-major offsets of cell values into pool
+     */
+    TwoDA(std::vector<std::string> columns, int rowCount, std::string pool, const std::vector<uint16_t> &offsets);
+
+    ~TwoDA();
+
+    /**
+     * @return column handle, invalid when not found
+     */
+    Column column(const std::string &name) const;
+
+    bool hasColumn(const std::string &name) const { return _columnIndices.count(name) > 0; }
 
     /**
      * @return row index or -1 when not found
      */
     int indexByCellValue(const std::string &column, const std::string &value) const;
 
+    /**
+     * @return row index or -1 when not found
+     */
+    int indexByCellValue(Column column, std::string_view value) const;
+
     /**
      * @return row index or -1 when not found
      */
     int indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const;
 
     int getColumnCount() const { return static_cast<int>(_columns.size()); }
-    int getRowCount() const { return static_cast<int>(_rows.size()); }
+    int getRowCount() const { return _rowCount; }
 
     std::string getString(int row, const std::string &column, std::string defValue = "") const;
     int getInt(int row, const std::string &column, int defValue = 0) const;
@@ -89,8 +128,26 @@ public:
     std::optional<float> getFloatOpt(int row, const std::string &column) const;
     std::optional<bool> getBoolOpt(int row, const std::string &column) const;
 
+    std::string getString(int row, Column column, std::string defValue = "") const;
+    int getInt(int row, Column column, int defValue = 0) const;
+    uint32_t getHexInt(int row, Column column, uint32_t defValue = 0) const;
+    float getFloat(int row, Column column, float defValue = 0.0f) const;
+    bool getBool(int row, Column column, bool defValue = false) const;
+
+    std::optional<std::string_view> getStringOpt(int row, Column column) const;
+    std::optional<int> getIntOpt(int row, Column column) const;
+    std::optional<uint32_t> getHexIntOpt(int row, Column column) const;
+    std::optional<float> getFloatOpt(int row, Column column) const;
+    std::optional<bool> getBoolOpt(int row, Column column) const;
+
+    /**
+     * @return raw cell value, including deleted cells
+     */
+    std::string_view cell(int row, int column) const {
+        return &_pool[_cells[static_cast<size_t>(column) * _rowCount + row]];
+    }
+
     const std::vector<std::string> &columns() const { return _columns; }
-    const std::vector<Row> &rows() const { return _rows; }
 
     static Row newRow(std::vector<std::string> values) {
         auto row = Row();
@@ -99,11 +156,23 @@ public:
     }
 
 private:
+    struct ColumnCache;
+
     std::vector<std::string> _columns;
-    std::vector<Row> _rows;
+    std::unordered_map<std::string, int> _columnIndices;
+    int _rowCount {0};
+
+    std::string _pool;
+    std::vector<uint32_t> _cells; /**< column-major offsets into pool */
+
+    std::vector<std::unique_ptr<ColumnCache>> _caches;
+
+    void indexColumns();
+
+    bool checkCell(int row, Column column) const;
 
-    int getColumnIndex(const std::string &column) const;
-    std::vector<int> getColumnIndices(const std::vector<std::string> &columns) const;
+    const ColumnCache &intColumn(Column column) const;
+    const ColumnCache &floatColumn(Column column) const;
 };
 
 } // namespace resource
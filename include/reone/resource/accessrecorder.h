@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "id.h"
+
+namespace reone {
+
+class IOutputStream;
+
+namespace resource {
+
+/**
+ * Records which resources each module touches: the container a resource
+ * was found in, its size, the time spent decoding it and the frame it was
+ * first accessed in. Only the first access of a resource per module is
+ * recorded.
+ *
+ * Accesses made under ScopedWarmUp are held back, and only recorded when
+ * the resource is later hit in a provider cache, so that warming up a
+ * working set does not feed it back into itself.
+ */
+class ResourceAccessRecorder : boost::noncopyable {
+public:
+    struct Record {
+        std::string module;
+        ResourceId id;
+        std::string container;
+        size_t size {0};
+        int64_t decodeMicros {0};
+        uint32_t frame {0};
+    };
+
+    void beginModule(std::string name);
+    void advanceFrame();
+
+    void recordAccess(const ResourceId &id, const std::string &container, size_t size);
+    void recordDecode(const ResourceId &id, std::chrono::microseconds time);
+    void recordCacheHit(const ResourceId &id);
+
+    /**
+     * Writes records as tab-separated lines: module, resource, container,
+     * size, decode time in microseconds and first access frame.
+     */
+    void save(IOutputStream &stream) const;
+
+    std::vector<Record> records() const;
+
+private:
+    struct ModuleRecords {
+        std::string name;
+        std::vector<Record> records;
+        std::unordered_map<ResourceId, size_t> idToRecord;
+        std::unordered_map<ResourceId, Record> idToWarmedUp;
+    };
+
+    std::list<ModuleRecords> _modules;
+    uint32_t _frame {0};
+    mutable std::mutex _mutex;
+
+    Record &getOrAddRecord(const ResourceId &id);
+    ModuleRecords &currentModule();
+};
+
+/**
+ * Marks resource accesses made by the current thread until destruction as
+ * warm-up loads.
+ */
+class ScopedWarmUp : boost::noncopyable {
+public:
+    ScopedWarmUp();
+    ~ScopedWarmUp();
+
+private:
+    bool _wasWarmingUp;
+};
+
+/**
+ * Records time until destruction as decode time of a resource. Does nothing
+ * when recorder is nullptr.
+ */
+class ScopedDecodeTimer : boost::noncopyable {
+public:
+    ScopedDecodeTimer(ResourceAccessRecorder *recorder, const ResourceId &id) :
+        _recorder(recorder) {
+        if (_recorder) {
+            _id = id;
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedDecodeTimer() {
+        if (_recorder) {
+            auto time = std::chrono::steady_clock::now() - _start;
+            _recorder->recordDecode(*_id, std::chrono::duration_cast<std::chrono::microseconds>(time));
+        }
+    }
+
+private:
+    ResourceAccessRecorder *_recorder;
+    std::optional<ResourceId> _id; /**< copied, as caller's id may not outlive the timer */
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../container.h"
+#include "../resourceindex.h"
 #include "utils.h"
 
 namespace reone {
@@ -30,6 +31,9 @@ public:
         _storage(std::move(storage)) {}
 
     void init();
+    void init(const ResourceIndex::Snapshot &snapshot);
+
+    ResourceIndex::Snapshot snapshot() const;
 
     // IResourceContainer
 
@@ -47,6 +51,7 @@ private:
     };
 
     Storage _storage;
+    std::mutex _streamMutex; /**< stream is shared by concurrent reads */
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
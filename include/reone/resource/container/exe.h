@@ -49,6 +49,7 @@ private:
 
     std::filesystem::path _path;
     std::unique_ptr<FileInputStream> _exe;
+    std::mutex _streamMutex; /**< stream is shared by concurrent reads */
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
@@ -17,9 +17,11 @@
 
 #pragma once
 
+#include "reone/system/filehandlecache.h"
 #include "reone/system/types.h"
 
 #include "../container.h"
+#include "../resourceindex.h"
 #include "../types.h"
 
 namespace reone {
@@ -28,12 +30,20 @@ namespace resource {
 
 class FolderResourceContainer : public IResourceContainer, boost::noncopyable {
 public:
-    FolderResourceContainer(std::filesystem::path path) :
-        _path(std::move(path)) {
+    FolderResourceContainer(std::filesystem::path path, FileHandleCache &fileHandles) :
+        _path(std::move(path)),
+        _fileHandles(fileHandles) {
     }
 
     void init();
 
+    /**
+     * Initializes from an index snapshot, without walking the directory tree.
+     */
+    void init(const ResourceIndex::Snapshot &snapshot);
+
+    ResourceIndex::Snapshot snapshot() const;
+
     // IResourceContainer
 
     std::optional<ByteBuffer> findResourceData(const ResourceId &id) override;
@@ -46,9 +56,13 @@ private:
     struct Resource {
         std::filesystem::path path;
         ResType type;
+        uint32_t size {0};    /**< at index time */
+        int64_t modified {0}; /**< at index time */
     };
 
     std::filesystem::path _path;
+    FileHandleCache &_fileHandles;
+    std::vector<std::filesystem::path> _subdirectories;
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
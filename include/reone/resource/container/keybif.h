@@ -17,9 +17,10 @@
 
 #pragma once
 
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/filehandlecache.h"
 
 #include "../container.h"
+#include "../resourceindex.h"
 
 namespace reone {
 
@@ -29,12 +30,20 @@ class BifReader;
 
 class KeyBifResourceContainer : public IResourceContainer, boost::noncopyable {
 public:
-    KeyBifResourceContainer(std::filesystem::path keyPath) :
-        _keyPath(std::move(keyPath)) {
+    KeyBifResourceContainer(std::filesystem::path keyPath, FileHandleCache &fileHandles) :
+        _keyPath(std::move(keyPath)),
+        _fileHandles(fileHandles) {
     }
 
     void init();
 
+    /**
+     * Initializes from an index snapshot, without reading the KEY and BIF tables.
+     */
+    void init(const ResourceIndex::Snapshot &snapshot);
+
+    ResourceIndex::Snapshot snapshot() const;
+
     // IResourceContainer
 
     std::optional<ByteBuffer> findResourceData(const ResourceId &id) override;
@@ -51,8 +60,9 @@ private:
     };
 
     std::filesystem::path _keyPath;
+    FileHandleCache &_fileHandles;
 
-    std::vector<std::unique_ptr<FileInputStream>> _bifs;
+    std::vector<std::filesystem::path> _bifPaths; /**< BIF files are opened on first access */
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
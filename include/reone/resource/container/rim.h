@@ -20,6 +20,7 @@
 #include "reone/system/stream/fileinput.h"
 
 #include "../container.h"
+#include "../resourceindex.h"
 #include "utils.h"
 
 namespace reone {
@@ -32,6 +33,9 @@ public:
         _storage(std::move(storage)) {}
 
     void init();
+    void init(const ResourceIndex::Snapshot &snapshot);
+
+    ResourceIndex::Snapshot snapshot() const;
 
     // IResourceContainer
 
@@ -49,6 +53,7 @@ private:
     };
 
     Storage _storage;
+    std::mutex _streamMutex; /**< stream is shared by concurrent reads */
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
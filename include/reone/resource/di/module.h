@@ -38,11 +38,14 @@
 #include "../provider/walkmeshes.h"
 #include "../resources.h"
 #include "../strings.h"
+#include "../workingset.h"
 
 #include "services.h"
 
 namespace reone {
 
+class IThreadPool;
+
 namespace audio {
 
 class AudioModule;
@@ -105,6 +108,11 @@ public:
     Shaders &shaders() { return *_shaders; }
     ResourceDirector &director() { return *_director; }
 
+    /**
+     * @return recorder of resource accesses, nullptr unless recording is enabled
+     */
+    ResourceAccessRecorder *accessRecorder() { return _accessRecorder.get(); }
+
     ResourceServices &services() { return *_services; }
 
     void setGameID(GameID id) {
@@ -115,6 +123,22 @@ public:
         _gamePath = std::move(path);
     }
 
+    /**
+     * Enables recording of resource accesses, saved to an access log on
+     * deinit. Must be called before init.
+     */
+    void setRecordAccess(bool record) {
+        _recordAccess = record;
+    }
+
+    /**
+     * Sets a thread pool to load working sets of modules on, or nullptr to
+     * load them synchronously. Must be called before init.
+     */
+    void setThreadPool(IThreadPool *threadPool) {
+        _threadPool = threadPool;
+    }
+
 private:
     GameID _gameId;
     std::filesystem::path _gamePath;
@@ -124,6 +148,11 @@ private:
     audio::AudioModule &_audio;
     script::ScriptModule &_script;
 
+    bool _recordAccess {false};
+    IThreadPool *_threadPool {nullptr};
+    std::unique_ptr<ResourceAccessRecorder> _accessRecorder;
+    std::unique_ptr<WorkingSetManifest> _workingSet;
+
     std::unique_ptr<Gffs> _gffs;
     std::unique_ptr<Resources> _resources;
     std::unique_ptr<Strings> _strings;
@@ -19,9 +19,13 @@
 
 #include "resources.h"
 #include "types.h"
+#include "workingset.h"
 
 namespace reone {
 
+class IThreadPool;
+class Task;
+
 namespace graphics {
 
 struct GraphicsOptions;
@@ -82,6 +86,10 @@ public:
         _scripts(scripts) {
     }
 
+    ~ResourceDirector() {
+        finishWarmUp();
+    }
+
     void init() override;
     void onModuleLoad(const std::string &name) override;
     void onGameLoad(std::string_view name) override;
@@ -89,6 +97,22 @@ public:
     std::set<std::string> moduleNames() override;
     std::set<std::string> saveNames() override;
 
+    /**
+     * Sets a recorder, which is told about module changes, or nullptr.
+     */
+    void setAccessRecorder(ResourceAccessRecorder *recorder) { _accessRecorder = recorder; }
+
+    /**
+     * Sets a manifest of resources to load ahead of need when a module is loaded, or nullptr.
+     */
+    void setWorkingSet(const WorkingSetManifest *workingSet) { _workingSet = workingSet; }
+
+    /**
+     * Sets a thread pool to warm up caches on, or nullptr to warm them up
+     * synchronously on module load.
+     */
+    void setThreadPool(IThreadPool *threadPool) { _threadPool = threadPool; }
+
 private:
     GameID _gameId;
     const std::filesystem::path &_gamePath;
@@ -102,6 +126,11 @@ private:
     IResources &_resources;
     IScripts &_scripts;
 
+    ResourceAccessRecorder *_accessRecorder {nullptr};
+    const WorkingSetManifest *_workingSet {nullptr};
+    IThreadPool *_threadPool {nullptr};
+    std::shared_ptr<Task> _warmUpTask;
+
     // Set when a savegame is loaded.
     std::optional<std::filesystem::path> _savegamePath;
 
@@ -109,6 +138,10 @@ private:
     void loadModuleResources(const std::string &name);
     void loadSaveGameResources(std::string_view name);
 
+    void warmUpModule(const std::string &name);
+    void warmUpResources(const std::vector<ResourceId> &ids, const std::atomic_bool &canceled);
+    void finishWarmUp();
+
     void loadRIM(const std::filesystem::path &path, const std::string &name, ContainerKind kind);
     void loadERF(const std::filesystem::path &path, const std::string &name, ContainerKind kind);
 };
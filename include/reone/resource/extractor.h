@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/threadpool.h"
+
+#include "id.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Extracts resources from ERF, MOD, SAV and RIM archives into a directory.
+ *
+ * Resources are copied with bulk reads and writes through a reusable buffer.
+ * When a thread pool is given, resources are split into contiguous batches of
+ * similar total size, each extracted by a separate task through its own file
+ * handle.
+ */
+class ArchiveExtractor : boost::noncopyable {
+public:
+    struct Entry {
+        ResourceId resId;
+        uint32_t offset {0};
+        uint32_t size {0};
+    };
+
+    struct Filter {
+        std::set<ResType> types; /**< empty to accept any type */
+        std::string pattern;     /**< file name glob, supporting * and ?, empty to accept any name */
+
+        bool matches(const ResourceId &resId) const;
+    };
+
+    ArchiveExtractor(const std::filesystem::path &archivePath) :
+        _archivePath(archivePath) {
+    }
+
+    void load();
+
+    /**
+     * Extracts entries into the destination directory, creating it if
+     * necessary.
+     *
+     * @param threadPool thread pool to extract on, or nullptr to extract on the calling thread
+     * @param numTasks maximum number of concurrent tasks
+     */
+    void extract(const std::vector<Entry> &entries,
+                 const std::filesystem::path &destPath,
+                 IThreadPool *threadPool = nullptr,
+                 int numTasks = 1);
+
+    std::vector<Entry> entries(const Filter &filter) const;
+
+    const std::vector<Entry> &entries() const { return _entries; }
+
+private:
+    std::filesystem::path _archivePath;
+
+    std::vector<Entry> _entries;
+
+    void extractBatch(const std::vector<const Entry *> &batch, const std::filesystem::path &destPath);
+};
+
+/**
+ * Matches a string against a glob pattern, ignoring case. Supports * and ?
+ * wildcards.
+ */
+bool matchesGlob(std::string_view s, std::string_view pattern);
+
+} // namespace resource
+
+} // namespace reone
@@ -43,7 +43,8 @@ private:
     int _dataSize {0};
 
     std::vector<std::string> _columns;
-    std::vector<TwoDA::Row> _rows;
+    std::vector<uint16_t> _offsets;
+    std::string _pool;
 
     std::shared_ptr<TwoDA> _twoDa;
 
@@ -58,8 +58,11 @@ private:
     int _fieldIncidesCount {0};
     uint32_t _listIndicesOffset {0};
     int _listIndicesCount {0};
+    std::vector<GffLabel> _labels;
     std::shared_ptr<Gff> _root;
 
+    void loadLabels();
+
     std::unique_ptr<Gff> readStruct(int idx);
     Gff::Field readField(int idx);
     std::string readLabel(int idx);
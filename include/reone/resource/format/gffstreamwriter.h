@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+#include "../gff.h"
+#include "../types.h"
+
+namespace reone {
+
+class IOutputStream;
+
+namespace resource {
+
+/**
+ * Writes GFF files without building a Gff tree first.
+ *
+ * Structs, fields and lists are appended in the order they are written into
+ * flat arrays of fixed-size records, and labels are deduplicated as they
+ * are written. On save, records are laid out breadth-first and offsets are
+ * patched, producing output identical to that of GffWriter for an equivalent
+ * Gff tree.
+ *
+ * Root struct is open on construction. Fields are written into the innermost
+ * open struct.
+ */
+class GffStreamWriter : boost::noncopyable {
+public:
+    GffStreamWriter(ResType resType, uint32_t rootType = 0xffffffff);
+
+    void writeByte(std::string_view label, uint32_t val);
+    void writeChar(std::string_view label, int32_t val);
+    void writeWord(std::string_view label, uint32_t val);
+    void writeShort(std::string_view label, int32_t val);
+    void writeDword(std::string_view label, uint32_t val);
+    void writeInt(std::string_view label, int32_t val);
+    void writeDword64(std::string_view label, uint64_t val);
+    void writeInt64(std::string_view label, int64_t val);
+    void writeFloat(std::string_view label, float val);
+    void writeDouble(std::string_view label, double val);
+    void writeCExoString(std::string_view label, std::string_view val);
+    void writeResRef(std::string_view label, std::string_view val);
+    void writeCExoLocString(std::string_view label, int32_t strRef, std::string_view val);
+    void writeVoid(std::string_view label, const ByteBuffer &val);
+    void writeOrientation(std::string_view label, const glm::quat &val);
+    void writeVector(std::string_view label, const glm::vec3 &val);
+    void writeStrRef(std::string_view label, int32_t val);
+
+    /**
+     * Opens a struct as the value of a Struct field.
+     */
+    void beginStruct(std::string_view label, uint32_t type);
+
+    /**
+     * Opens a struct as the next item of the innermost open list.
+     */
+    void beginListItem(uint32_t type);
+
+    void endStruct();
+
+    void beginList(std::string_view label);
+    void endList();
+
+    void save(const std::filesystem::path &path);
+    void save(IOutputStream &out);
+
+private:
+    static constexpr uint32_t kNone = 0xffffffff;
+
+    struct StructRecord {
+        uint32_t type {0};
+        uint32_t numFields {0};
+        uint32_t parentList {kNone}; /**< index of list field this struct is an item of */
+    };
+
+    struct FieldRecord {
+        uint32_t type {0};
+        uint32_t structIdx {0};
+        uint32_t labelIdx {0};
+        uint32_t value {0};    /**< simple value, offset into data, child struct index or list size */
+        uint32_t dataSize {0}; /**< size of complex data */
+    };
+
+    ResType _resType;
+
+    std::vector<StructRecord> _structs;
+    std::vector<FieldRecord> _fields;
+    std::vector<std::string> _labels;
+    std::unordered_map<std::string, uint32_t> _labelToIdx;
+    ByteBuffer _data;
+
+    std::vector<uint32_t> _openStructs;
+    std::vector<uint32_t> _openLists; /**< field indices */
+
+    uint32_t labelIndex(std::string_view label);
+
+    FieldRecord &appendField(Gff::FieldType type, std::string_view label);
+    void appendSimpleField(Gff::FieldType type, std::string_view label, uint32_t val);
+    FieldRecord &beginComplexField(Gff::FieldType type, std::string_view label);
+    void endComplexField(FieldRecord &field);
+
+    template <class T>
+    void appendData(const T &val) {
+        auto bytes = reinterpret_cast<const char *>(&val);
+        _data.insert(_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    uint32_t openStruct(uint32_t type, uint32_t parentList);
+};
+
+} // namespace resource
+
+} // namespace reone
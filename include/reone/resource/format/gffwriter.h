@@ -17,11 +17,12 @@
 
 #pragma once
 
-#include "reone/system/binarywriter.h"
 #include "reone/system/types.h"
 
 #include "../types.h"
 
+#include "gffstreamwriter.h"
+
 namespace reone {
 
 class IOutputStream;
@@ -43,42 +44,10 @@ public:
     void save(IOutputStream &out);
 
 private:
-    struct WriteStruct {
-        uint32_t type {0};
-        uint32_t dataOrDataOffset {0};
-        uint32_t fieldCount {0};
-    };
-
-    struct WriteField {
-        uint32_t type {0};
-        uint32_t labelIndex {0};
-        uint32_t dataOrDataOffset {0};
-    };
-
-    struct WriteContext {
-        std::vector<WriteStruct> structs;
-        std::vector<WriteField> fields;
-        std::vector<std::string> labels;
-        ByteBuffer fieldData;
-        std::vector<uint32_t> fieldIndices;
-        std::vector<uint32_t> listIndices;
-    };
-
     ResType _resType;
     const Gff &_root;
 
-    WriteContext _context;
-    std::unique_ptr<BinaryWriter> _writer;
-
-    void processTree();
-
-    void writeHeader();
-    void writeStructArray();
-    void writeFieldArray();
-    void writeLabelArray();
-    void writeFieldData();
-    void writeFieldIndices();
-    void writeListIndices();
+    void writeStruct(const Gff &gff, GffStreamWriter &writer);
 };
 
 } // namespace resource
@@ -24,6 +24,37 @@ namespace reone {
 
 namespace resource {
 
+/**
+ * Symbol of a GFF field label. Labels are interned into a global table, so
+ * that fields can be looked up by comparing integers. Symbols of equal labels
+ * are equal.
+ */
+class GffLabel {
+public:
+    GffLabel() = default;
+
+    explicit GffLabel(std::string_view name) :
+        _id(intern(name)) {
+    }
+
+    /**
+     * @return symbol of a label, or std::nullopt if it was never interned
+     */
+    static std::optional<GffLabel> find(std::string_view name);
+
+    const std::string &name() const;
+
+    uint32_t id() const { return _id; }
+
+    bool operator==(const GffLabel &rhs) const { return _id == rhs._id; }
+    bool operator!=(const GffLabel &rhs) const { return _id != rhs._id; }
+
+private:
+    uint32_t _id {0}; /**< 0 is reserved for an empty label */
+
+    static uint32_t intern(std::string_view name);
+};
+
 class Gff : boost::noncopyable {
 public:
     enum class FieldType : uint16_t {
@@ -48,9 +79,41 @@ public:
         StrRef = 18
     };
 
+    /**
+     * Key of a field lookup: either a label name, or an interned label symbol.
+     */
+    class FieldKey {
+    public:
+        FieldKey(const char *name) :
+            _name(name) {
+        }
+
+        FieldKey(std::string_view name) :
+            _name(name) {
+        }
+
+        FieldKey(const std::string &name) :
+            _name(name) {
+        }
+
+        FieldKey(GffLabel symbol) :
+            _symbol(symbol),
+            _bySymbol(true) {
+        }
+
+        bool isSymbol() const { return _bySymbol; }
+
+        std::string_view name() const { return _name; }
+        GffLabel symbol() const { return _symbol; }
+
+    private:
+        std::string_view _name;
+        GffLabel _symbol;
+        bool _bySymbol {false};
+    };
+
     struct Field {
         FieldType type {FieldType::Int};
-        std::string label;
         std::string strValue; /**< covers CExoString and ResRef */
         glm::vec3 vecValue {0.0f};
         glm::quat quatValue {1.0f, 0.0f, 0.0f, 0.0f};
@@ -69,13 +132,32 @@ public:
         Field() = default;
 
         Field(FieldType type, std::string label) :
-            type(type), label(std::move(label)) {
+            type(type), _label(std::move(label)), _symbol(_label) {
+        }
+
+        Field(FieldType type, GffLabel symbol) :
+            type(type), _label(symbol.name()), _symbol(symbol) {
+        }
+
+        const std::string &label() const { return _label; }
+        GffLabel symbol() const { return _symbol; }
+
+        /**
+         * Fields of an indexed struct must be renamed via Gff::mutableFields,
+         * so that its field index is rebuilt.
+         */
+        void setLabel(std::string label) {
+            _label = std::move(label);
+            _symbol = GffLabel(_label);
         }
 
         std::string toString() const;
 
         Field deepCopy() const {
-            Field copy {type, label};
+            Field copy;
+            copy.type = type;
+            copy._label = _label;
+            copy._symbol = _symbol;
             copy.strValue = strValue;
             copy.vecValue = vecValue;
             copy.quatValue = quatValue;
@@ -159,6 +241,10 @@ public:
         static Field newOrientation(std::string label, glm::quat val);
         static Field newVector(std::string label, glm::vec3 val);
         static Field newStrRef(std::string label, int32_t val);
+
+    private:
+        std::string _label;
+        GffLabel _symbol; /**< interned label */
     };
 
     class Builder {
@@ -184,62 +270,77 @@ public:
 
     Gff(uint32_t type, std::vector<Field> fields) :
         _type(type), _fields(std::move(fields)) {
+        reindex();
     }
 
-    bool readByte(uint8_t &val, std::string_view label) const;
-    bool readChar(int8_t &val, std::string_view label) const;
-    bool readWord(uint16_t &val, std::string_view label) const;
-    bool readShort(int16_t &val, std::string_view label) const;
-    bool readDword(uint32_t &val, std::string_view label) const;
-    bool readInt(int32_t &val, std::string_view label) const;
-    bool readDword64(uint64_t &val, std::string_view label) const;
-    bool readInt64(int64_t &val, std::string_view label) const;
-    bool readFloat(float &val, std::string_view label) const;
-    bool readDouble(double &val, std::string_view label) const;
-    bool readVector(glm::vec3 &val, std::string_view label) const;
-    bool readOrientation(glm::quat &val, std::string_view label) const;
-    bool readString(std::string &val, std::string_view label) const;
-    bool readResRef(std::string &val, std::string_view label) const;
-    bool readLocString(LocString &val, std::string_view label, IStrings &strings) const;
-    bool readStrRef(StrRef &val, std::string_view label, IStrings &strings) const;
+    bool readByte(uint8_t &val, const FieldKey &key) const;
+    bool readChar(int8_t &val, const FieldKey &key) const;
+    bool readWord(uint16_t &val, const FieldKey &key) const;
+    bool readShort(int16_t &val, const FieldKey &key) const;
+    bool readDword(uint32_t &val, const FieldKey &key) const;
+    bool readInt(int32_t &val, const FieldKey &key) const;
+    bool readDword64(uint64_t &val, const FieldKey &key) const;
+    bool readInt64(int64_t &val, const FieldKey &key) const;
+    bool readFloat(float &val, const FieldKey &key) const;
+    bool readDouble(double &val, const FieldKey &key) const;
+    bool readVector(glm::vec3 &val, const FieldKey &key) const;
+    bool readOrientation(glm::quat &val, const FieldKey &key) const;
+    bool readString(std::string &val, const FieldKey &key) const;
+    bool readResRef(std::string &val, const FieldKey &key) const;
+    bool readLocString(LocString &val, const FieldKey &key, IStrings &strings) const;
+    bool readStrRef(StrRef &val, const FieldKey &key, IStrings &strings) const;
 
     template <class T>
-    bool readEnum(T &value, const std::string &label) const {
-        if (const Field *field = get(label)) {
+    bool readEnum(T &value, const FieldKey &key) const {
+        if (const Field *field = get(key)) {
             value = static_cast<T>(field->uintValue);
             return true;
         }
         return false;
     }
 
-    bool readBool(bool &value, std::string_view label) const {
-        if (const Field *field = get(label)) {
+    bool readBool(bool &value, const FieldKey &key) const {
+        if (const Field *field = get(key)) {
             value = field->uintValue;
             return true;
         }
         return false;
     }
 
-    bool getBool(const std::string &name, bool defValue = false) const;
-    int32_t getInt(const std::string &name, int32_t defValue = 0) const;
-    int64_t getInt64(const std::string &name, int64_t defValue = 0) const;
-    uint32_t getUint(const std::string &name, uint32_t defValue = 0) const;
-    uint64_t getUint64(const std::string &name, uint64_t defValue = 0) const;
-    glm::vec3 getColor(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
-    float getFloat(const std::string &name, float defValue = 0.0f) const;
-    double getDouble(const std::string &name, double defValue = 0.0) const;
-    std::string getString(const std::string &name, std::string defValue = "") const;
-    glm::vec3 getVector(const std::string &name, glm::vec3 defValue = glm::vec3(0.0f)) const;
-    glm::quat getOrientation(const std::string &name, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
-    std::vector<std::shared_ptr<Gff>> getList(const std::string &name) const;
-    ByteBuffer getData(const std::string &name) const;
-    std::shared_ptr<Gff> findStruct(std::string_view name) const;
+    bool getBool(const FieldKey &key, bool defValue = false) const;
+    int32_t getInt(const FieldKey &key, int32_t defValue = 0) const;
+    int64_t getInt64(const FieldKey &key, int64_t defValue = 0) const;
+    uint32_t getUint(const FieldKey &key, uint32_t defValue = 0) const;
+    uint64_t getUint64(const FieldKey &key, uint64_t defValue = 0) const;
+    glm::vec3 getColor(const FieldKey &key, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    float getFloat(const FieldKey &key, float defValue = 0.0f) const;
+    double getDouble(const FieldKey &key, double defValue = 0.0) const;
+    std::string getString(const FieldKey &key, std::string defValue = "") const;
+    glm::vec3 getVector(const FieldKey &key, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    glm::quat getOrientation(const FieldKey &key, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
+    std::vector<std::shared_ptr<Gff>> getList(const FieldKey &key) const;
+    ByteBuffer getData(const FieldKey &key) const;
+    std::shared_ptr<Gff> findStruct(const FieldKey &key) const;
 
     const std::optional<std::string> &signature() const { return _signature; }
     uint32_t type() const { return _type; }
-    std::vector<Field> &fields() { return _fields; }
     const std::vector<Field> &fields() const { return _fields; }
 
+    /**
+     * Mutable access to fields. Marks the field index dirty, so that it is
+     * rebuilt on next lookup.
+     */
+    std::vector<Field> &mutableFields() {
+        _indexDirty = true;
+        return _fields;
+    }
+
+    /**
+     * Rebuilds field index now, rather than on next lookup. Mutated structs
+     * must be reindexed before they are looked up from several threads.
+     */
+    void reindex();
+
     void setType(uint32_t type) {
         _type = type;
     }
@@ -266,16 +367,33 @@ public:
     }
 
     template <class T>
-    T getEnum(const std::string &name, T defValue) const {
-        return static_cast<T>(getInt(name, static_cast<int32_t>(defValue)));
+    T getEnum(const FieldKey &key, T defValue) const {
+        return static_cast<T>(getInt(key, static_cast<int32_t>(defValue)));
     }
 
 private:
+    struct IndexEntry {
+        uint32_t labelId {0};
+        uint32_t fieldIdx {0};
+    };
+
+    struct NameIndexEntry {
+        size_t nameHash {0};
+        uint32_t fieldIdx {0};
+    };
+
     std::optional<std::string> _signature;
     uint32_t _type {0};
     std::vector<Field> _fields;
+    mutable std::vector<IndexEntry> _index;         /**< sorted by label symbol, empty if not indexed */
+    mutable std::vector<NameIndexEntry> _nameIndex; /**< sorted by label hash, empty if not indexed */
+    mutable std::atomic_bool _indexDirty {false};   /**< fields changed since last index build */
+
+    void buildIndex() const;
 
-    const Field *get(std::string_view name) const;
+    const Field *get(const FieldKey &key) const;
+    const Field *getByName(std::string_view name) const;
+    const Field *getBySymbol(GffLabel symbol) const;
 };
 
 } // namespace resource
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "gff.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Read-only view of a GFF struct over the raw GFF buffer.
+ *
+ * Structs, fields, labels and field data are referenced by index into the
+ * arrays of the original buffer, which is shared between all views of a
+ * file. Nothing is parsed or allocated until a value is requested, and
+ * materialize() converts a view into a mutable Gff tree on demand.
+ *
+ * Accessors mirror those of Gff and return identical values.
+ */
+class GffView {
+public:
+    GffView() = default;
+
+    /**
+     * Validates GFF header and returns a view of the root struct.
+     */
+    static GffView load(std::shared_ptr<const ByteBuffer> buffer);
+
+    bool readByte(uint8_t &val, std::string_view label) const;
+    bool readChar(int8_t &val, std::string_view label) const;
+    bool readWord(uint16_t &val, std::string_view label) const;
+    bool readShort(int16_t &val, std::string_view label) const;
+    bool readDword(uint32_t &val, std::string_view label) const;
+    bool readInt(int32_t &val, std::string_view label) const;
+    bool readDword64(uint64_t &val, std::string_view label) const;
+    bool readInt64(int64_t &val, std::string_view label) const;
+    bool readFloat(float &val, std::string_view label) const;
+    bool readDouble(double &val, std::string_view label) const;
+    bool readVector(glm::vec3 &val, std::string_view label) const;
+    bool readOrientation(glm::quat &val, std::string_view label) const;
+    bool readString(std::string &val, std::string_view label) const;
+    bool readResRef(std::string &val, std::string_view label) const;
+    bool readLocString(LocString &val, std::string_view label, IStrings &strings) const;
+    bool readStrRef(StrRef &val, std::string_view label, IStrings &strings) const;
+
+    bool getBool(std::string_view name, bool defValue = false) const;
+    int32_t getInt(std::string_view name, int32_t defValue = 0) const;
+    int64_t getInt64(std::string_view name, int64_t defValue = 0) const;
+    uint32_t getUint(std::string_view name, uint32_t defValue = 0) const;
+    uint64_t getUint64(std::string_view name, uint64_t defValue = 0) const;
+    glm::vec3 getColor(std::string_view name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    float getFloat(std::string_view name, float defValue = 0.0f) const;
+    double getDouble(std::string_view name, double defValue = 0.0) const;
+    std::string getString(std::string_view name, std::string defValue = "") const;
+    glm::vec3 getVector(std::string_view name, glm::vec3 defValue = glm::vec3(0.0f)) const;
+    glm::quat getOrientation(std::string_view name, glm::quat defValue = glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) const;
+    std::vector<GffView> getList(std::string_view name) const;
+    ByteBuffer getData(std::string_view name) const;
+    GffView findStruct(std::string_view name) const;
+
+    /**
+     * @return string value of a CExoString, ResRef or CExoLocString field, referencing the GFF buffer
+     */
+    std::string_view getStringView(std::string_view name) const;
+
+    /**
+     * Builds a mutable copy of this struct and all of its descendants.
+     */
+    std::shared_ptr<Gff> materialize() const;
+
+    std::string_view signature() const;
+    uint32_t type() const;
+    int numFields() const;
+    Gff::FieldType fieldType(int index) const;
+    std::string_view fieldLabel(int index) const;
+
+    explicit operator bool() const { return static_cast<bool>(_file); }
+
+private:
+    struct File {
+        std::shared_ptr<const ByteBuffer> buffer;
+
+        uint32_t structOffset {0};
+        uint32_t structCount {0};
+        uint32_t fieldOffset {0};
+        uint32_t fieldCount {0};
+        uint32_t labelOffset {0};
+        uint32_t labelCount {0};
+        uint32_t fieldDataOffset {0};
+        uint32_t fieldDataSize {0};
+        uint32_t fieldIndicesOffset {0};
+        uint32_t fieldIndicesSize {0};
+        uint32_t listIndicesOffset {0};
+        uint32_t listIndicesSize {0};
+
+        const char *bytes(uint32_t offset, uint32_t size) const;
+        uint32_t readUint32(uint32_t offset) const;
+    };
+
+    struct FieldEntry {
+        Gff::FieldType type {Gff::FieldType::Int};
+        uint32_t labelIndex {0};
+        uint32_t dataOrDataOffset {0};
+    };
+
+    std::shared_ptr<const File> _file;
+    uint32_t _structIndex {0};
+    uint32_t _type {0};
+    uint32_t _fieldCount {0};
+    uint32_t _fieldsOrFieldIndicesOffset {0};
+
+    GffView(std::shared_ptr<const File> file, uint32_t structIndex);
+
+    uint32_t fieldIndex(int index) const;
+    FieldEntry fieldEntry(uint32_t fieldIndex) const;
+    std::string_view label(uint32_t labelIndex) const;
+    std::optional<FieldEntry> find(std::string_view label) const;
+
+    uint64_t value(const FieldEntry &field) const;
+    std::string_view stringValue(const FieldEntry &field) const;
+    glm::vec3 vectorValue(const FieldEntry &field) const;
+    glm::quat orientationValue(const FieldEntry &field) const;
+    const char *fieldData(uint32_t offset, uint32_t size) const;
+    std::vector<GffView> children(const FieldEntry &field) const;
+
+    Gff::Field materializeField(const FieldEntry &field) const;
+};
+
+} // namespace resource
+
+} // namespace reone
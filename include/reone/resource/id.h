@@ -31,13 +31,23 @@ struct ResourceId {
 
     ResourceId() = default;
 
-    ResourceId(std::string resRef, ResType type) :
-        resRef(ResRef(std::move(resRef))),
+    ResourceId(std::string_view resRef, ResType type) :
+        resRef(resRef),
+        type(type) {
+    }
+
+    ResourceId(const std::string &resRef, ResType type) :
+        resRef(resRef),
+        type(type) {
+    }
+
+    ResourceId(const char *resRef, ResType type) :
+        resRef(resRef),
         type(type) {
     }
 
     ResourceId(ResRef resRef, ResType type) :
-        resRef(std::move(resRef)),
+        resRef(resRef),
         type(type) {
     }
 
@@ -46,9 +56,8 @@ struct ResourceId {
     }
 
     size_t hash() const {
-        size_t hash = 0;
-        boost::hash_combine(hash, resRef.value());
-        boost::hash_combine(hash, type);
+        size_t hash = resRef.hash();
+        boost::hash_combine(hash, static_cast<int>(type));
         return hash;
     }
 
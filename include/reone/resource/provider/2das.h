@@ -20,6 +20,7 @@
 #include "reone/system/cache.h"
 
 #include "../2da.h"
+#include "../resref.h"
 
 namespace reone {
 
@@ -51,7 +52,7 @@ public:
 private:
     Resources &_resources;
 
-    Cache<std::string, TwoDA> _cache;
+    Cache<ResRef, TwoDA> _cache;
 };
 
 } // namespace resource
@@ -22,8 +22,9 @@ namespace reone {
 namespace audio {
 
 class AudioClip;
+class IAudioBackend;
 
-}
+} // namespace audio
 
 namespace resource {
 
@@ -38,31 +39,57 @@ public:
     virtual std::shared_ptr<audio::AudioClip> get(const std::string &key) = 0;
 };
 
-class AudioClips : public IAudioClips {
+/**
+ * Caches decoded audio clips, evicting least recently used ones when their
+ * total size exceeds the budget. Long MP3 clips are cached in streaming form,
+ * i.e. without decoded PCM data. When constructed with an audio backend,
+ * small single-frame clips are uploaded into backend buffers shared by all
+ * sources playing them.
+ */
+class AudioClips : public IAudioClips, boost::noncopyable {
 public:
-    AudioClips(Resources &resources) :
-        _resources(resources) {
+    struct Stats {
+        int hits {0};
+        int misses {0};
+        int evictions {0};
+        size_t residentBytes {0};
+    };
+
+    static constexpr size_t kDefaultBudget = 64 * 1024 * 1024;
+    static constexpr size_t kMaxSharedBufferSize = 256 * 1024;
+
+    AudioClips(Resources &resources,
+               audio::IAudioBackend *backend = nullptr,
+               size_t budget = kDefaultBudget) :
+        _resources(resources),
+        _backend(backend),
+        _budget(budget) {
     }
 
-    void clear() override {
-        _objects.clear();
-    }
+    void clear() override;
 
-    std::shared_ptr<audio::AudioClip> get(const std::string &key) override {
-        auto maybeObject = _objects.find(key);
-        if (maybeObject != _objects.end()) {
-            return maybeObject->second;
-        }
-        auto object = doGet(key);
-        return _objects.insert(make_pair(key, std::move(object))).first->second;
-    }
+    std::shared_ptr<audio::AudioClip> get(const std::string &key) override;
+
+    const Stats &stats() const { return _stats; }
 
 private:
+    struct Entry {
+        std::shared_ptr<audio::AudioClip> clip;
+        size_t size {0};
+        std::list<std::string>::iterator lruIt;
+    };
+
     Resources &_resources;
+    audio::IAudioBackend *_backend;
+    size_t _budget;
 
-    std::unordered_map<std::string, std::shared_ptr<audio::AudioClip>> _objects;
+    std::unordered_map<std::string, Entry> _objects;
+    std::list<std::string> _lru; // most recently used first
+    Stats _stats;
 
     std::shared_ptr<audio::AudioClip> doGet(std::string resRef);
+
+    void evict();
 };
 
 } // namespace resource
@@ -45,23 +45,18 @@ public:
     }
 
     void clear() override {
+        std::lock_guard<std::mutex> lock(_mutex);
         _objects.clear();
     }
 
-    std::shared_ptr<Dialog> get(const std::string &key) override {
-        auto maybeObject = _objects.find(key);
-        if (maybeObject != _objects.end()) {
-            return maybeObject->second;
-        }
-        auto object = doGet(key);
-        return _objects.insert(make_pair(key, std::move(object))).first->second;
-    }
+    std::shared_ptr<Dialog> get(const std::string &key) override;
 
 private:
     Gffs &_gffs;
     Strings &_strings;
 
     std::unordered_map<std::string, std::shared_ptr<Dialog>> _objects;
+    std::mutex _mutex;
 
     std::shared_ptr<Dialog> doGet(std::string resRef);
 
@@ -17,8 +17,6 @@
 
 #pragma once
 
-#include "reone/system/cache.h"
-
 #include "../gff.h"
 #include "../id.h"
 #include "../types.h"
@@ -27,6 +25,7 @@ namespace reone {
 
 namespace resource {
 
+class ResourceAccessRecorder;
 class Resources;
 
 class IGffs {
@@ -45,15 +44,22 @@ public:
     }
 
     void clear() override {
-        _cache.clear();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _objects.clear();
     }
 
     std::shared_ptr<Gff> get(const std::string &resRef, ResType type) override;
 
+    /**
+     * @return recorder of resource accesses, or nullptr
+     */
+    ResourceAccessRecorder *accessRecorder();
+
 private:
     Resources &_resources;
 
-    Cache<ResourceId, Gff> _cache;
+    std::unordered_map<ResourceId, std::shared_ptr<Gff>> _objects;
+    std::mutex _mutex;
 };
 
 } // namespace resource
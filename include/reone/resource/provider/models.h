@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "../resref.h"
 #include "../types.h"
 
 namespace reone {
@@ -60,9 +61,9 @@ private:
     Resources &_resources;
     graphics::IStatistic &_statistic;
 
-    std::unordered_map<std::string, std::shared_ptr<graphics::Model>> _cache;
+    std::unordered_map<ResRef, std::shared_ptr<graphics::Model>> _cache;
 
-    std::shared_ptr<graphics::Model> doGet(const std::string &resRef);
+    std::shared_ptr<graphics::Model> doGet(const ResRef &resRef);
 };
 
 } // namespace resource
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "reone/graphics/di/services.h"
+#include "reone/graphics/options.h"
 #include "reone/movie/movie.h"
 
 namespace reone {
@@ -42,9 +43,11 @@ public:
 class Movies : public IMovies, boost::noncopyable {
 public:
     Movies(std::filesystem::path gamePath,
+           graphics::GraphicsOptions &graphicsOpt,
            graphics::GraphicsServices &graphicsSvc,
            audio::IAudioMixer &audioPlayer) :
         _gamePath(gamePath),
+        _graphicsOpt(graphicsOpt),
         _graphicsSvc(graphicsSvc),
         _audioPlayer(audioPlayer) {
     }
@@ -64,6 +67,7 @@ public:
 
 private:
     std::filesystem::path _gamePath;
+    graphics::GraphicsOptions &_graphicsOpt;
     graphics::GraphicsServices &_graphicsSvc;
     audio::IAudioMixer &_audioPlayer;
 
@@ -41,22 +41,17 @@ public:
     }
 
     void clear() override {
+        std::lock_guard<std::mutex> lock(_mutex);
         _objects.clear();
     }
 
-    std::shared_ptr<script::ScriptProgram> get(const std::string &key) override {
-        auto maybeObject = _objects.find(key);
-        if (maybeObject != _objects.end()) {
-            return maybeObject->second;
-        }
-        auto object = doGet(key);
-        return _objects.insert(make_pair(key, std::move(object))).first->second;
-    }
+    std::shared_ptr<script::ScriptProgram> get(const std::string &key) override;
 
 private:
     Resources &_resources;
 
     std::unordered_map<std::string, std::shared_ptr<script::ScriptProgram>> _objects;
+    std::mutex _mutex;
 
     std::shared_ptr<script::ScriptProgram> doGet(std::string resRef);
 };
@@ -19,6 +19,8 @@
 
 #include "reone/graphics/types.h"
 
+#include "../resref.h"
+
 namespace reone {
 
 namespace graphics {
@@ -61,9 +63,9 @@ private:
     graphics::GraphicsOptions &_options;
     Resources &_resources;
 
-    std::unordered_map<std::string, std::shared_ptr<graphics::Texture>> _cache;
+    std::unordered_map<ResRef, std::shared_ptr<graphics::Texture>> _cache;
 
-    std::shared_ptr<graphics::Texture> doGet(const std::string &resRef, graphics::TextureUsage usage);
+    std::shared_ptr<graphics::Texture> doGet(const ResRef &resRef, graphics::TextureUsage usage);
 };
 
 } // namespace resource
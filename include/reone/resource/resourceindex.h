@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "id.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Snapshot of resource tables of file-based containers, persisted between
+ * runs so that archives need not be parsed and folders need not be walked on
+ * every launch.
+ *
+ * A container snapshot is reused only while sizes and modification times of
+ * the container and of its dependencies are unchanged.
+ */
+class ResourceIndex : boost::noncopyable {
+public:
+    struct Entry {
+        ResourceId id;
+        uint32_t file {0}; /**< index into Snapshot::files */
+        uint32_t offset {0};
+        uint32_t size {0};
+        int64_t modified {0}; /**< modification time of the file of a folder entry */
+    };
+
+    struct Snapshot {
+        std::vector<std::filesystem::path> dependencies; /**< must stay unchanged along with the container */
+        std::vector<std::filesystem::path> files;
+        std::vector<Entry> entries;
+    };
+
+    ResourceIndex(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    /**
+     * Loads index from disk. Missing or malformed index is treated as empty.
+     */
+    void load();
+
+    /**
+     * Saves snapshots found or put since load, if any were put.
+     */
+    void save();
+
+    /**
+     * @return snapshot of the container, or nullptr if not indexed or stale
+     */
+    const Snapshot *find(const std::filesystem::path &container);
+
+    void put(const std::filesystem::path &container, Snapshot snapshot);
+
+    int numHits() const { return _numHits; }
+    int numMisses() const { return _numMisses; }
+
+private:
+    struct FileStamp {
+        std::string path;
+        uint64_t size {0};
+        int64_t modified {0};
+
+        bool operator==(const FileStamp &rhs) const {
+            return path == rhs.path && size == rhs.size && modified == rhs.modified;
+        }
+    };
+
+    struct Record {
+        std::vector<FileStamp> stamps;
+        Snapshot snapshot;
+        bool used {false};
+    };
+
+    std::filesystem::path _path;
+
+    std::unordered_map<std::string, Record> _records;
+    bool _dirty {false};
+    int _numHits {0};
+    int _numMisses {0};
+
+    static FileStamp stamp(const std::filesystem::path &path);
+};
+
+} // namespace resource
+
+} // namespace reone
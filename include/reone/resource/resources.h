@@ -17,11 +17,16 @@
 
 #pragma once
 
+#include <shared_mutex>
+
+#include "reone/system/filehandlecache.h"
 #include "reone/system/types.h"
 
+#include "accessrecorder.h"
 #include "container.h"
 #include "id.h"
 #include "resource.h"
+#include "resourceindex.h"
 
 namespace reone {
 
@@ -36,6 +41,7 @@ enum class ContainerKind {
 struct ResourceContainerPair {
     std::unique_ptr<IResourceContainer> provider;
     ContainerKind kind;
+    std::string name;
 };
 
 using ResourceContainerList = std::list<ResourceContainerPair>;
@@ -63,6 +69,7 @@ public:
 class Resources : public IResources, boost::noncopyable {
 public:
     void clear() override {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
         _containers.clear();
     }
 
@@ -75,14 +82,16 @@ public:
     }
 
     void clearSome(ContainerKind kind) {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
         auto toErase = std::remove_if(_containers.begin(), _containers.end(), [kind](auto &pair) {
             return pair.kind == kind;
         });
         _containers.erase(toErase, _containers.end());
     }
 
-    void add(std::unique_ptr<IResourceContainer> provider, ContainerKind kind = ContainerKind::Global) {
-        _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    void add(std::unique_ptr<IResourceContainer> provider, ContainerKind kind = ContainerKind::Global, std::string name = std::string()) {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
+        _containers.push_front(ResourceContainerPair {std::move(provider), kind, std::move(name)});
     }
 
     void addEXE(const std::filesystem::path &path) override;
@@ -96,10 +105,41 @@ public:
     Resource get(const ResourceId &id) override;
     std::optional<Resource> find(const ResourceId &id) override;
 
+    /**
+     * Sets an index, from which global containers are restored when
+     * unchanged, and into which they are recorded otherwise.
+     */
+    void setIndex(std::unique_ptr<ResourceIndex> index) {
+        _index = std::move(index);
+    }
+
+    void saveIndex() {
+        if (_index) {
+            _index->save();
+        }
+    }
+
     const ResourceContainerList &containers() const { return _containers; }
 
+    /**
+     * @return file handles shared by KEY/BIF and folder containers
+     */
+    FileHandleCache &fileHandles() { return _fileHandles; }
+
+    /**
+     * Sets a recorder of resource accesses, or nullptr to stop recording.
+     * Providers use it to record decode times.
+     */
+    void setAccessRecorder(ResourceAccessRecorder *recorder) { _accessRecorder = recorder; }
+
+    ResourceAccessRecorder *accessRecorder() { return _accessRecorder; }
+
 private:
+    FileHandleCache _fileHandles; /**< must outlive containers */
     ResourceContainerList _containers;
+    std::shared_mutex _mutex; /**< containers are read from by resource director's warm-up job */
+    std::unique_ptr<ResourceIndex> _index;
+    ResourceAccessRecorder *_accessRecorder {nullptr};
 };
 
 } // namespace resource
@@ -25,44 +25,76 @@ namespace resource {
 
 static constexpr int kMaxResRefLength = 16;
 
+/**
+ * Resource reference: up to 16 characters, stored inline in lower case,
+ * together with a precomputed hash. Construction, hashing and comparison
+ * do not allocate.
+ */
 class ResRef {
 public:
     ResRef() = default;
 
-    ResRef(std::string value) :
-        _value(std::move(value)) {
-        if (_value.size() > kMaxResRefLength) {
-            _value.erase(kMaxResRefLength);
+    ResRef(std::string_view value) {
+        _length = static_cast<uint8_t>(std::min<size_t>(value.size(), kMaxResRefLength));
+        uint64_t hash = kFnvOffsetBasis;
+        for (uint8_t i = 0; i < _length; ++i) {
+            char ch = value[i];
+            if (ch >= 'A' && ch <= 'Z') {
+                ch += 'a' - 'A';
+            }
+            _chars[i] = ch;
+            hash = (hash ^ static_cast<uint8_t>(ch)) * kFnvPrime;
         }
-        boost::to_lower(_value);
+        _hash = hash;
+    }
+
+    ResRef(const std::string &value) :
+        ResRef(std::string_view(value)) {
+    }
+
+    ResRef(const char *value) :
+        ResRef(std::string_view(value)) {
     }
 
-    inline const std::string &value() const {
-        return _value;
+    inline std::string value() const {
+        return std::string(_chars.data(), _length);
+    }
+
+    inline std::string_view view() const {
+        return std::string_view(_chars.data(), _length);
+    }
+
+    inline bool empty() const {
+        return _length == 0;
     }
 
     inline size_t hash() const {
-        return std::hash<std::string>()(_value);
+        return static_cast<size_t>(_hash);
     }
 
     inline bool operator==(const ResRef &rhs) const {
-        return _value == rhs._value;
+        return _hash == rhs._hash && std::memcmp(_chars.data(), rhs._chars.data(), kMaxResRefLength) == 0;
     }
 
     inline bool operator!=(const ResRef &rhs) const {
-        return _value != rhs._value;
+        return !(*this == rhs);
     }
 
     inline bool operator<(const ResRef &rhs) const {
-        return _value < rhs._value;
+        return std::memcmp(_chars.data(), rhs._chars.data(), kMaxResRefLength) < 0;
     }
 
     inline bool operator>(const ResRef &rhs) const {
-        return _value > rhs._value;
+        return std::memcmp(_chars.data(), rhs._chars.data(), kMaxResRefLength) > 0;
     }
 
 private:
-    std::string _value;
+    static constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+    static constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+    alignas(8) std::array<char, kMaxResRefLength> _chars {}; /**< zero-padded */
+    uint64_t _hash {kFnvOffsetBasis};
+    uint8_t _length {0};
 };
 
 } // namespace resource
@@ -29,28 +29,38 @@ class IStrings {
 public:
     virtual ~IStrings() = default;
 
-    virtual std::string getText(int strRef) = 0;
-    virtual std::string getSound(int strRef) = 0;
+    /**
+     * @return reference to a string that remains valid until the talk table is replaced
+     */
+    virtual const std::string &getText(int strRef) = 0;
+
+    /**
+     * @return reference to a string that remains valid until the talk table is replaced
+     */
+    virtual const std::string &getSound(int strRef) = 0;
 };
 
+/**
+ * Maps dialog.tlk into memory and decodes strings on first access. Processed
+ * strings are cached, so that repeated lookups do not allocate.
+ */
 class Strings : public IStrings {
 public:
     Strings() = default;
 
     void init(const std::filesystem::path &gameDir);
 
-    std::string getText(int strRef) override;
-    std::string getSound(int strRef) override;
+    const std::string &getText(int strRef) override;
+    const std::string &getSound(int strRef) override;
 
-    void setTalkTable(std::shared_ptr<TalkTable> table) {
-        _table = std::move(table);
-    }
+    void setTalkTable(std::shared_ptr<TalkTable> table);
 
 private:
     std::shared_ptr<TalkTable> _table;
 
-    void process(std::string &str);
-    void stripDeveloperNotes(std::string &str);
+    std::vector<std::atomic<const std::string *>> _texts;
+    std::deque<std::string> _processedTexts;
+    std::mutex _processMutex;
 };
 
 class LocString {
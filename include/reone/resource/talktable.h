@@ -19,8 +19,15 @@
 
 namespace reone {
 
+class MappedFile;
+
 namespace resource {
 
+/**
+ * Table of localized strings. Either holds decoded strings, or decodes
+ * strings of a memory-mapped TLK file on first access and caches them.
+ * Decoding is thread-safe.
+ */
 class TalkTable : boost::noncopyable {
 public:
     struct String {
@@ -43,15 +50,26 @@ public:
         std::vector<String> _strings;
     };
 
-    TalkTable(std::vector<String> strings) :
-        _strings(std::move(strings)) {
-    }
+    TalkTable(std::vector<String> strings);
+    TalkTable(std::shared_ptr<MappedFile> tlk);
+
+    ~TalkTable();
 
     int getStringCount() const;
     const String &getString(int index) const;
 
 private:
     std::vector<String> _strings;
+
+    std::shared_ptr<MappedFile> _tlk;
+    int _stringCount {0};
+    uint32_t _stringsOffset {0};
+
+    mutable std::vector<std::atomic<const String *>> _decoded;
+    mutable std::deque<String> _decodedStrings;
+    mutable std::mutex _decodeMutex;
+
+    String decode(int index) const;
 };
 
 } // namespace resource
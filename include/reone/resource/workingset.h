@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "id.h"
+
+namespace reone {
+
+class IInputStream;
+class IOutputStream;
+
+namespace resource {
+
+/**
+ * Per-module list of resources, in order of first access, built from
+ * access logs written by ResourceAccessRecorder.
+ *
+ * Manifest format is a module name in brackets followed by one resource
+ * per line, e.g. "[end_m01aa]" then "end_trask.utc".
+ */
+class WorkingSetManifest {
+public:
+    /**
+     * Merges an access log into this manifest. When a resource is present
+     * in several logs, its earliest first access frame is kept. Resources
+     * of a loaded manifest are treated as accessed on the first frame.
+     */
+    void addAccessLog(IInputStream &log);
+
+    void load(IInputStream &stream);
+    void save(IOutputStream &stream) const;
+
+    /**
+     * @return resources of a module in order of first access, empty if module is not in the manifest
+     */
+    const std::vector<ResourceId> &moduleResources(const std::string &module) const;
+
+    const std::map<std::string, std::vector<ResourceId>> &modules() const { return _modules; }
+
+private:
+    struct Access {
+        uint32_t frame {0};
+        size_t order {0};
+    };
+
+    std::map<std::string, std::vector<ResourceId>> _modules;
+    std::map<std::string, std::unordered_map<ResourceId, Access>> _moduleToAccesses;
+
+    void sortModules();
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "mpscqueue.h"
+#include "types.h"
+
+namespace reone {
+
+/**
+ * Log sink that writes records to a stream on a background thread. Producers
+ * push pre-formatted records into a bounded lock-free queue and never touch
+ * the stream, so that logging threads do not block on disk I/O. The writer
+ * thread drains the queue in batches and flushes the stream whenever the
+ * queue runs empty.
+ */
+class AsyncLogSink : boost::noncopyable {
+public:
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    AsyncLogSink(std::unique_ptr<std::ostream> stream,
+                 LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Count,
+                 size_t capacity = kDefaultCapacity) :
+        _stream(std::move(stream)),
+        _overflowPolicy(overflowPolicy),
+        _records(capacity) {
+    }
+
+    ~AsyncLogSink() {
+        stop();
+    }
+
+    /**
+     * Starts the writer thread. Records pushed before start are kept until
+     * the queue is full.
+     */
+    void start();
+
+    /**
+     * Writes all queued records and stops the writer thread.
+     */
+    void stop();
+
+    /**
+     * Pushes a record, subject to the overflow policy.
+     *
+     * @return false if record was discarded
+     */
+    bool push(std::string record);
+
+    /**
+     * Blocks until all records pushed so far are written and the stream is
+     * flushed.
+     */
+    void flush();
+
+    /**
+     * Best-effort synchronous drain for crash handlers. Takes no mutexes, and
+     * gives up if the writer thread does not release the queue in time.
+     */
+    void drainOnCrash();
+
+    size_t numDropped() const { return _numDropped; }
+
+private:
+    std::unique_ptr<std::ostream> _stream;
+    LogOverflowPolicy _overflowPolicy;
+    MpscQueue<std::string> _records;
+
+    std::thread _writer;
+    std::atomic_bool _running {false};
+
+    std::atomic_flag _consuming = ATOMIC_FLAG_INIT; /**< held by whoever pops records */
+
+    std::atomic<size_t> _numPushed {0};
+    std::atomic<size_t> _numWritten {0}; /**< written and flushed */
+    std::atomic<size_t> _numDropped {0};
+    size_t _numDroppedReported {0};
+
+    std::mutex _mutex;
+    std::condition_variable _writerCondVar;
+    std::condition_variable _flushedCondVar;
+    bool _wakeRequested {false};
+
+    void writerThreadFunc();
+
+    /**
+     * Writes queued records to the stream and flushes it. Caller must hold
+     * _consuming.
+     *
+     * @return number of records written
+     */
+    size_t drain();
+
+    /**
+     * Drains queue on the calling thread, waiting for the writer thread to
+     * release it.
+     */
+    void drainSync();
+
+    void wakeWriter();
+    void notifyFlushed();
+};
+
+} // namespace reone
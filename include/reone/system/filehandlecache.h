@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Least recently used cache of read-only file handles. Files are opened on
+ * first access and closed when evicted. Reads are positional, so that a
+ * handle can be shared between threads without seeking.
+ */
+class FileHandleCache : boost::noncopyable {
+public:
+    class File : boost::noncopyable {
+    public:
+        /**
+         * @throws FileNotFoundException if file cannot be opened
+         */
+        File(const std::filesystem::path &path);
+        ~File();
+
+        /**
+         * Reads up to len bytes starting at offset.
+         *
+         * @return number of bytes read
+         */
+        size_t read(uint64_t offset, char *buf, size_t len) const;
+
+        /**
+         * @return size of the file at the time it was opened
+         */
+        uint64_t size() const { return _size; }
+
+        /**
+         * Checks with a single stat of the path, that the file at the path is
+         * still the one that was opened, and that it has the same size and
+         * modification time.
+         */
+        bool isCurrent(const std::filesystem::path &path) const;
+
+    private:
+        intptr_t _handle {-1};
+        uint64_t _size {0};
+        int64_t _modified {0}; /**< platform specific */
+        uint64_t _fileId {0};  /**< platform specific, zero if unknown */
+    };
+
+    struct Stats {
+        int numHandles {0};
+        int64_t numOpens {0};
+        int64_t numCloses {0};
+        int64_t numHits {0};
+    };
+
+    static constexpr int kDefaultCapacity = 64;
+
+    FileHandleCache(int capacity = kDefaultCapacity) :
+        _capacity(capacity) {
+    }
+
+    /**
+     * @return handle of the file, opening it if not cached
+     * @throws FileNotFoundException if file cannot be opened
+     */
+    std::shared_ptr<File> get(const std::filesystem::path &path);
+
+    /**
+     * Same as get, but reopens a cached file if its size or modification time
+     * have changed since it was opened, e.g. when replaced by an editor.
+     * Files are opened and checked without holding the cache lock.
+     *
+     * @throws FileNotFoundException if file cannot be opened
+     */
+    std::shared_ptr<File> getCurrent(const std::filesystem::path &path);
+
+    Stats stats() const;
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<File>>;
+
+    int _capacity;
+
+    std::list<Entry> _files; /**< most recently used first */
+    std::unordered_map<std::string, std::list<Entry>::iterator> _pathToFile;
+    Stats _stats;
+    mutable std::mutex _mutex;
+
+    std::shared_ptr<File> openFile(std::string key, const std::filesystem::path &path);
+    std::shared_ptr<File> findFile(const std::string &key);
+};
+
+} // namespace reone
@@ -22,4 +22,17 @@ namespace reone {
 std::filesystem::path getFileIgnoreCase(const std::filesystem::path &dir, std::string_view relPath);
 std::optional<std::filesystem::path> findFileIgnoreCase(const std::filesystem::path &dir, std::string_view relPath);
 
+/**
+ * @return per-user directory for files that can be regenerated, e.g. indices.
+ *         Directory is not created.
+ */
+std::filesystem::path getUserCacheDirectory();
+
+/**
+ * @return path to a file in user cache directory, named as
+ *         "<prefix>_<hash of game path><extension>", so that game
+ *         installations do not overwrite each other's files
+ */
+std::filesystem::path getGameCacheFilePath(const std::filesystem::path &gamePath, std::string_view prefix, std::string_view extension);
+
 } // namespace reone
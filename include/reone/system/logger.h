@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <array>
+
+#include "asynclogsink.h"
 #include "checkutil.h"
 #include "types.h"
 
@@ -28,39 +31,68 @@ public:
 
     void init(LogSeverity minSeverity,
               std::set<LogChannel> enabledChannels,
-              std::optional<std::string> filename);
+              std::optional<std::string> filename,
+              LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Count);
+
+    /**
+     * Writes out queued messages and disables logging, until initialized
+     * again. Does nothing if not initialized.
+     */
+    void deinit();
+
+    /**
+     * Installs signal handlers that write out queued messages before the
+     * process is terminated by SIGSEGV, SIGABRT, SIGFPE or SIGILL.
+     */
+    void installCrashHandlers();
+
+    /**
+     * Writes out queued messages from a crash handler, without waiting on
+     * any mutex.
+     */
+    void drainOnCrash();
 
     void append(std::string message,
                 LogChannel channel,
                 LogSeverity severity);
 
+    /**
+     * Formats message using boost::format syntax and appends it. Callers are
+     * expected to check isEnabled first, so that disabled statements do not
+     * pay for formatting - see R_LOG in logutil.h.
+     */
+    template <class... Args>
+    void appendFormat(LogChannel channel,
+                      LogSeverity severity,
+                      const char *format,
+                      const Args &...args) {
+        auto formatter = boost::format(format);
+        (void)(formatter % ... % args);
+        append(formatter.str(), channel, severity);
+    }
+
+    /**
+     * Blocks until all messages appended so far are written.
+     */
     void flush();
 
-    bool isChannelEnabled(LogChannel channel) const {
-        return _enabledChannels.count(channel) > 0;
+    /**
+     * @return true if messages of severity are logged to channel
+     */
+    bool isEnabled(LogSeverity severity, LogChannel channel) const {
+        return (_channelMasks[static_cast<int>(severity)] & static_cast<uint32_t>(channel)) != 0;
     }
 
 private:
-    static thread_local std::optional<std::reference_wrapper<std::ostringstream>> buffer;
-
-    LogSeverity _minSeverity {LogSeverity::Warn};
-    std::set<LogChannel> _enabledChannels;
-    std::unique_ptr<std::ostream> _stream;
+    std::array<uint32_t, kNumLogSeverities> _channelMasks {0}; /**< enabled channels by severity, all zero until initialized */
+    std::unique_ptr<AsyncLogSink> _sink;
     bool _inited {false};
 
-    std::list<std::ostringstream> _buffers;
-
-    std::mutex _buffersMutex;
-    std::mutex _streamMutex;
-
     Logger() = default;
 
     ~Logger() {
         deinit();
     }
-
-    void deinit();
-    void flush(std::ostringstream &buffer);
 };
 
 } // namespace reone
@@ -20,10 +20,30 @@
 #include "logger.h"
 #include "types.h"
 
+/**
+ * Logs a message formatted using boost::format syntax, e.g.
+ * R_DEBUG(LogChannel::Perception, "%s seen by %s", other->tag(), creature->tag()).
+ * Format arguments are neither evaluated nor formatted unless severity is
+ * enabled for channel.
+ */
+#define R_LOG(severity, channel, ...)                                                              \
+    do {                                                                                           \
+        if (::reone::Logger::instance.isEnabled((severity), (channel))) {                          \
+            ::reone::Logger::instance.appendFormat((channel), (severity), __VA_ARGS__);            \
+        }                                                                                          \
+    } while (false)
+
+#define R_ERROR(channel, ...) R_LOG(::reone::LogSeverity::Error, channel, __VA_ARGS__)
+#define R_WARN(channel, ...) R_LOG(::reone::LogSeverity::Warn, channel, __VA_ARGS__)
+#define R_INFO(channel, ...) R_LOG(::reone::LogSeverity::Info, channel, __VA_ARGS__)
+#define R_DEBUG(channel, ...) R_LOG(::reone::LogSeverity::Debug, channel, __VA_ARGS__)
+
 namespace reone {
 
 inline void error(const char *message, LogChannel channel = LogChannel::Global) {
-    Logger::instance.append(message, channel, LogSeverity::Error);
+    if (Logger::instance.isEnabled(LogSeverity::Error, channel)) {
+        Logger::instance.append(message, channel, LogSeverity::Error);
+    }
 }
 
 inline void error(const std::string &message, LogChannel channel = LogChannel::Global) {
@@ -31,7 +51,9 @@ inline void error(const std::string &message, LogChannel channel = LogChannel::G
 }
 
 inline void warn(const char *message, LogChannel channel = LogChannel::Global) {
-    Logger::instance.append(message, channel, LogSeverity::Warn);
+    if (Logger::instance.isEnabled(LogSeverity::Warn, channel)) {
+        Logger::instance.append(message, channel, LogSeverity::Warn);
+    }
 }
 
 inline void warn(const std::string &message, LogChannel channel = LogChannel::Global) {
@@ -39,7 +61,9 @@ inline void warn(const std::string &message, LogChannel channel = LogChannel::Gl
 }
 
 inline void info(const char *message, LogChannel channel = LogChannel::Global) {
-    Logger::instance.append(message, channel, LogSeverity::Info);
+    if (Logger::instance.isEnabled(LogSeverity::Info, channel)) {
+        Logger::instance.append(message, channel, LogSeverity::Info);
+    }
 }
 
 inline void info(const std::string &message, LogChannel channel = LogChannel::Global) {
@@ -47,7 +71,9 @@ inline void info(const std::string &message, LogChannel channel = LogChannel::Gl
 }
 
 inline void debug(const char *message, LogChannel channel = LogChannel::Global) {
-    Logger::instance.append(message, channel, LogSeverity::Debug);
+    if (Logger::instance.isEnabled(LogSeverity::Debug, channel)) {
+        Logger::instance.append(message, channel, LogSeverity::Debug);
+    }
 }
 
 inline void debug(const std::string &message, LogChannel channel = LogChannel::Global) {
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Read-only memory mapping of a whole file. Pages are loaded by the OS on
+ * first access.
+ */
+class MappedFile : boost::noncopyable {
+public:
+    MappedFile(const std::filesystem::path &path);
+    ~MappedFile();
+
+    const char *data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+    struct Mapping;
+
+    std::unique_ptr<Mapping> _mapping;
+    const char *_data {nullptr};
+    size_t _size {0};
+};
+
+} // namespace reone
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Bounded lock-free queue with any number of producer threads and a single
+ * consumer thread. Capacity must be a power of two.
+ *
+ * Each slot carries a sequence number, so that producers claim slots with a
+ * single compare-and-swap and the consumer knows when a claimed slot has been
+ * filled. Values pushed by the same producer are popped in order of push.
+ */
+template <class T>
+class MpscQueue : boost::noncopyable {
+public:
+    MpscQueue(size_t capacity) :
+        _cells(capacity),
+        _mask(capacity - 1) {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+            throw std::invalid_argument("Capacity must be a power of two");
+        }
+        for (size_t i = 0; i < capacity; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Moves value into the queue, unless it is full.
+     *
+     * @return false if queue is full, in which case value is left intact
+     */
+    bool push(T &&value) {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &_cells[pos & _mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Must only be called from the consumer thread.
+     *
+     * @return false if queue is empty, or the oldest slot is still being filled
+     */
+    bool pop(T &value) {
+        auto &cell = _cells[_head & _mask];
+        if (cell.sequence.load(std::memory_order_acquire) != _head + 1) {
+            return false;
+        }
+        value = std::move(cell.value);
+        cell.value = T();
+        cell.sequence.store(_head + _mask + 1, std::memory_order_release);
+        ++_head;
+        return true;
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence {0};
+        T value;
+    };
+
+    std::vector<Cell> _cells;
+    size_t _mask;
+
+    alignas(64) std::atomic<size_t> _tail {0};
+    alignas(64) size_t _head {0}; /**< owned by consumer */
+};
+
+} // namespace reone
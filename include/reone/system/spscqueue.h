@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+
+namespace reone {
+
+/**
+ * Bounded lock-free queue with a single producer thread and a single consumer
+ * thread. Capacity must be a power of two.
+ *
+ * Producer calls push, consumer calls front and pop. Neither call blocks:
+ * push returns false when the queue is full, pop returns false when it is
+ * empty.
+ */
+template <class T, size_t Capacity>
+class SpscQueue : boost::noncopyable {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    bool push(T value) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        _items[tail & kMask] = std::move(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &value) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        auto &item = _items[head & kMask];
+        value = std::move(item);
+        item = T();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return pointer to the oldest item, or nullptr if queue is empty
+     */
+    const T *front() const {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &_items[head & kMask];
+    }
+
+    bool empty() const {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    std::array<T, Capacity> _items;
+
+    alignas(64) std::atomic<size_t> _head {0};
+    alignas(64) std::atomic<size_t> _tail {0};
+};
+
+} // namespace reone
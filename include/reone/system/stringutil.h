@@ -36,4 +36,10 @@ std::string_view string_rstrip(std::string_view s, std::string_view trimChars =
  */
 std::string_view string_strip(std::string_view s, std::string_view trimChars = "\r\n\t ");
 
+/**
+ * Quote a string for use in JSON, escaping quotes, backslashes and newlines.
+ * Other control characters are replaced with spaces.
+ */
+std::string string_json_quote(std::string_view s);
+
 } // namespace reone
@@ -17,36 +17,127 @@
 
 #pragma once
 
+#include <array>
+
 namespace reone {
 
 using TaskFunc = std::function<void(const std::atomic_bool &canceled)>;
 
+/**
+ * Range of indices [begin, end) processed by a single parallelFor job.
+ */
+using RangeFunc = std::function<void(size_t begin, size_t end)>;
+
+/**
+ * Job priority classes. Workers always take the most urgent job available,
+ * whether it is in their own queue, in the shared queue or stolen from
+ * another worker.
+ */
+enum class JobPriority {
+    FrameCritical = 0,
+    Streaming = 1,
+    Background = 2
+};
+
+static constexpr int kNumJobPriorities = 3;
+
+/**
+ * Handle to a job enqueued on a thread pool. A job runs once all of its
+ * dependencies have completed. Canceling a job does not unschedule it: the
+ * function still runs and is expected to check the canceled flag.
+ */
 class Task : boost::noncopyable {
 public:
-    Task(TaskFunc func) :
-        _func(std::move(func)) {
+    Task(TaskFunc func, JobPriority priority = JobPriority::Background) :
+        _func(std::move(func)),
+        _priority(priority) {
     }
 
     inline void cancel() {
         _canceled = true;
     }
 
+    /**
+     * Blocks until this job is done, without executing other jobs. Rethrows
+     * an exception thrown by the job function, if any.
+     */
+    void wait();
+
+    /**
+     * Blocks until this job is done or timeout expires.
+     *
+     * @return true if job is done
+     */
+    bool waitFor(std::chrono::microseconds timeout);
+
+    bool isCanceled() const { return _canceled; }
+    bool isDone() const { return _done; }
+
+    JobPriority priority() const { return _priority; }
+
 private:
     TaskFunc _func;
+    JobPriority _priority;
     std::atomic_bool _canceled {false};
+    std::atomic_bool _done {false};
+    std::atomic_int _numPendingDeps {1}; /**< includes a guard released once the job is scheduled */
 
-    inline void operator()() {
-        _func(_canceled);
-    }
+    std::mutex _mutex;
+    std::condition_variable _doneCondVar;
+    std::vector<std::shared_ptr<Task>> _dependents;
+    std::exception_ptr _error;
+
+    void operator()();
 
-    friend class ThreadPool;
+    friend class IThreadPool;
 };
 
 class IThreadPool {
 public:
     virtual ~IThreadPool() = default;
 
-    virtual std::shared_ptr<Task> enqueue(TaskFunc func) = 0;
+    /**
+     * Enqueues a job that runs after all of the dependencies have completed.
+     *
+     * @return handle to wait on or to chain other jobs after
+     */
+    virtual std::shared_ptr<Task> enqueue(
+        TaskFunc func,
+        JobPriority priority = JobPriority::Background,
+        const std::vector<std::shared_ptr<Task>> &dependencies = {}) = 0;
+
+    /**
+     * Waits until job is done, executing other jobs in the meantime. Rethrows
+     * an exception thrown by the job function, if any.
+     */
+    virtual void wait(Task &task) = 0;
+
+    /**
+     * Splits [begin, end) into ranges of at most grain indices, processes
+     * them in parallel and waits for all of them. Pass zero grain to let the
+     * pool choose. Rethrows the first exception thrown by func.
+     */
+    virtual void parallelFor(
+        size_t begin,
+        size_t end,
+        size_t grain,
+        const RangeFunc &func,
+        JobPriority priority = JobPriority::FrameCritical) = 0;
+
+protected:
+    /**
+     * Registers task as a dependent of each of the dependencies.
+     *
+     * @return true if task is ready to run
+     */
+    static bool addDependencies(const std::shared_ptr<Task> &task, const std::vector<std::shared_ptr<Task>> &dependencies);
+
+    /**
+     * Runs task and marks it as done.
+     *
+     * @return dependents that became ready to run
+     */
+    static std::vector<std::shared_ptr<Task>> runTask(Task &task);
 };
 
 class ThreadPool : public IThreadPool, boost::noncopyable {
@@ -67,43 +158,58 @@ public:
     void init();
     void deinit();
 
-    std::shared_ptr<Task> enqueue(TaskFunc func) override {
-        auto task = std::make_shared<Task>(std::move(func));
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _tasks.push(task);
-        }
-        _condVar.notify_one();
-        return task;
-    }
+    std::shared_ptr<Task> enqueue(
+        TaskFunc func,
+        JobPriority priority = JobPriority::Background,
+        const std::vector<std::shared_ptr<Task>> &dependencies = {}) override;
+
+    void wait(Task &task) override;
+
+    void parallelFor(
+        size_t begin,
+        size_t end,
+        size_t grain,
+        const RangeFunc &func,
+        JobPriority priority = JobPriority::FrameCritical) override;
+
+    int numThreads() const { return static_cast<int>(_threads.size()); }
 
 private:
+    /**
+     * Job queues, one per priority. The owning worker pushes and pops at the
+     * back, while other threads steal from the front.
+     */
+    struct alignas(64) Queues {
+        std::mutex mutex;
+        std::array<std::deque<std::shared_ptr<Task>>, kNumJobPriorities> jobs;
+    };
+
     int _numThreads {-1};
 
     std::vector<std::thread> _threads;
     std::atomic_bool _running {false};
 
-    std::queue<std::shared_ptr<Task>> _tasks;
-    std::mutex _mutex;
-    std::condition_variable _condVar;
-
-    void workerThreadFunc() {
-        while (_running) {
-            std::shared_ptr<Task> task;
-            {
-                std::unique_lock<std::mutex> lock(_mutex);
-                _condVar.wait(lock, [this]() { return !_running || !_tasks.empty(); });
-                if (!_running) {
-                    return;
-                }
-                task = _tasks.front();
-                _tasks.pop();
-            }
-            if (task) {
-                (*task)();
-            }
-        }
-    }
+    std::vector<std::unique_ptr<Queues>> _workerQueues;
+    Queues _sharedQueues; /**< jobs enqueued from outside of worker threads */
+    std::atomic_int _numQueued {0};
+
+    std::mutex _idleMutex;
+    std::condition_variable _idleCondVar;
+
+    void workerThreadFunc(int workerIdx);
+
+    void schedule(std::shared_ptr<Task> task);
+    void execute(Task &task);
+
+    /**
+     * Runs the most urgent job available to the calling thread.
+     *
+     * @return false if there are no jobs
+     */
+    bool runNext();
+
+    std::shared_ptr<Task> popOwn(int workerIdx, int priority);
+    std::shared_ptr<Task> steal(Queues &queues, int priority);
 };
 
 } // namespace reone
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+enum class TraceEventType {
+    Zone,
+    Counter,
+    Frame
+};
+
+struct TraceEvent {
+    TraceEventType type {TraceEventType::Zone};
+    const char *name {nullptr};
+    uint64_t timestamp {0}; /**< microseconds since recorder creation */
+    uint64_t duration {0};  /**< zones only, microseconds */
+    int64_t value {0};      /**< counters only */
+    uint32_t frame {0};
+};
+
+/**
+ * Records profiling zones, counters and frame boundaries into per-thread ring
+ * buffers, and exports them in Chrome trace event format, which can be loaded
+ * into chrome://tracing or Perfetto.
+ *
+ * Event names are stored by pointer and must outlive the recorder - use
+ * string literals. Recording is disabled until setEnabled(true) is called.
+ *
+ * Library code should use R_TRACE_ZONE, R_TRACE_COUNTER and R_TRACE_FRAME,
+ * which compile to nothing unless R_ENABLE_TRACING is defined.
+ */
+class TraceRecorder : boost::noncopyable {
+public:
+    static constexpr size_t kDefaultEventsPerThread = 1 << 16;
+
+    static TraceRecorder instance;
+
+    TraceRecorder(size_t eventsPerThread = kDefaultEventsPerThread);
+
+    void setEnabled(bool enabled) {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool isEnabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return microseconds since recorder creation
+     */
+    uint64_t now() const {
+        auto elapsed = std::chrono::steady_clock::now() - _epoch;
+        return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    }
+
+    /**
+     * @param frame index of the frame the zone was entered in
+     */
+    void recordZone(const char *name, uint64_t start, uint64_t end, uint32_t frame);
+    void recordCounter(const char *name, int64_t value);
+
+    /**
+     * Marks the start of a new frame. Events recorded afterwards are tagged
+     * with the new frame index.
+     */
+    void markFrame();
+
+    uint32_t frame() const {
+        return _frame.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Discards recorded events of all threads.
+     */
+    void clear();
+
+    /**
+     * Discards recorded events of all threads, returning them.
+     */
+    std::vector<TraceEvent> takeEvents();
+
+    /**
+     * Writes recorded events as Chrome trace event JSON.
+     *
+     * @param frames inclusive range of frames to export, all if empty
+     */
+    void writeChromeTrace(std::ostream &stream,
+                          std::optional<std::pair<uint32_t, uint32_t>> frames = std::nullopt);
+
+    void saveChromeTrace(const std::filesystem::path &path,
+                         std::optional<std::pair<uint32_t, uint32_t>> frames = std::nullopt);
+
+private:
+    struct ThreadBuffer {
+        std::thread::id threadId;
+        uint32_t id {0};
+        std::string name;
+        std::vector<TraceEvent> events;
+        size_t next {0};
+        size_t size {0};
+        std::mutex mutex; /**< only contended while exporting */
+    };
+
+    size_t _eventsPerThread;
+    uint32_t _id;
+    std::chrono::steady_clock::time_point _epoch;
+    std::atomic_bool _enabled {false};
+    std::atomic<uint32_t> _frame {0};
+
+    std::list<ThreadBuffer> _threads;
+    std::mutex _threadsMutex;
+
+    ThreadBuffer &threadBuffer();
+
+    void record(const TraceEvent &event);
+};
+
+/**
+ * Records a zone spanning the lifetime of this object, if the recorder was
+ * enabled when it was created. The zone is tagged with the frame it was
+ * entered in, even if it ends after the next frame mark.
+ */
+class TraceZone : boost::noncopyable {
+public:
+    TraceZone(const char *name, TraceRecorder &recorder = TraceRecorder::instance) :
+        _name(name),
+        _recorder(recorder) {
+        if (recorder.isEnabled()) {
+            _active = true;
+            _start = recorder.now();
+            _frame = recorder.frame();
+        }
+    }
+
+    ~TraceZone() {
+        if (_active) {
+            _recorder.recordZone(_name, _start, _recorder.now(), _frame);
+        }
+    }
+
+private:
+    const char *_name;
+    TraceRecorder &_recorder;
+    bool _active {false};
+    uint64_t _start {0};
+    uint32_t _frame {0};
+};
+
+} // namespace reone
+
+#ifdef R_ENABLE_TRACING
+
+#define R_TRACE_CONCAT_INNER(a, b) a##b
+#define R_TRACE_CONCAT(a, b) R_TRACE_CONCAT_INNER(a, b)
+
+#define R_TRACE_ZONE(name) ::reone::TraceZone R_TRACE_CONCAT(traceZone, __LINE__)(name)
+
+#define R_TRACE_COUNTER(name, value)                                                             \
+    do {                                                                                         \
+        if (::reone::TraceRecorder::instance.isEnabled()) {                                      \
+            ::reone::TraceRecorder::instance.recordCounter((name), static_cast<int64_t>(value)); \
+        }                                                                                        \
+    } while (false)
+
+#define R_TRACE_FRAME() ::reone::TraceRecorder::instance.markFrame()
+
+#else
+
+#define R_TRACE_ZONE(name) \
+    do {                   \
+    } while (false)
+
+#define R_TRACE_COUNTER(name, value) \
+    do {                             \
+    } while (false)
+
+#define R_TRACE_FRAME() \
+    do {                \
+    } while (false)
+
+#endif
@@ -32,6 +32,17 @@ enum class LogSeverity {
     Error
 };
 
+static constexpr int kNumLogSeverities = 4;
+
+/**
+ * What to do with a log record when the log queue is full.
+ */
+enum class LogOverflowPolicy {
+    Drop,  /**< discard record */
+    Count, /**< discard record, and log the number of discarded records once there is room */
+    Block  /**< wait until there is room */
+};
+
 enum class LogChannel {
     Global = 1,
     Resources = 2,
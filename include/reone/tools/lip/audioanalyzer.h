@@ -24,15 +24,33 @@ namespace reone {
 
 class AudioAnalyzer : boost::noncopyable {
 public:
+    struct Envelope {
+        float windowDuration {0.0f};
+        std::vector<float> peak; /**< maximum absolute amplitude per window */
+        std::vector<float> rms;  /**< root mean square amplitude per window */
+    };
+
+    /**
+     * Finds spans, where peak amplitude stays under the threshold, using an
+     * envelope with 1 ms windows.
+     */
     std::vector<TimeSpan> silentSpans(const audio::AudioClip &clip,
                                       float minSilenceDuration = 0.05f,
                                       float maxSilenceAmplitude = 0.01f);
 
     std::vector<float> waveform(const audio::AudioClip &clip, int resolution);
 
+    /**
+     * Computes amplitude envelope of the first channel of a clip in a single
+     * pass over its samples. Windows without samples of their own hold the
+     * amplitude of the preceding window.
+     */
+    Envelope envelope(const audio::AudioClip &clip, float windowDuration);
+
 private:
     std::vector<TimeSpan> computeFrameSpans(const audio::AudioClip &clip);
     float sampleNormalized(const audio::AudioClip::Frame &frame, float time);
+    void normalizeSamples(const audio::AudioClip::Frame &frame, int sampleIdx, int count, float *samples);
 };
 
 } // namespace reone
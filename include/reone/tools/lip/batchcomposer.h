@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/threadpool.h"
+
+#include "composer.h"
+
+namespace reone {
+
+namespace graphics {
+
+class LipAnimation;
+
+}
+
+/**
+ * Composes LIP animations for many voice-over lines in parallel, sharing a
+ * single pronouncing dictionary between workers. Results do not depend on
+ * the number of worker threads.
+ */
+class LipBatchComposer : boost::noncopyable {
+public:
+    struct Line {
+        std::string name;
+        std::filesystem::path audioPath;
+        std::string text;
+    };
+
+    struct Result {
+        std::string name;
+        std::shared_ptr<graphics::LipAnimation> animation;
+        std::string error; /**< empty if composition succeeded */
+    };
+
+    struct Progress {
+        int numLines {0};
+        int numComposed {0};
+        int numFailed {0};
+        float elapsed {0.0f}; /**< seconds */
+
+        float linesPerSecond() const {
+            return elapsed > 0.0f ? (numComposed + numFailed) / elapsed : 0.0f;
+        }
+    };
+
+    using ProgressCallback = std::function<void(const Progress &)>;
+
+    LipBatchComposer(std::shared_ptr<const PronouncingDictionary> dict,
+                     IThreadPool &threadPool,
+                     float minSilenceDuration = 0.125f,
+                     float maxSilenceAmplitude = 0.025f) :
+        _dict(std::move(dict)),
+        _threadPool(threadPool),
+        _minSilenceDuration(minSilenceDuration),
+        _maxSilenceAmplitude(maxSilenceAmplitude) {
+    }
+
+    /**
+     * Blocks until all lines are composed, calling progress callback from the
+     * calling thread.
+     *
+     * @return results in order of lines
+     */
+    std::vector<Result> compose(const std::vector<Line> &lines, ProgressCallback progress = nullptr);
+
+    /**
+     * Pairs WAV and MP3 files in a directory with transcripts in TXT files of
+     * the same name. Audio files without a transcript are skipped.
+     *
+     * @return lines sorted by name
+     */
+    static std::vector<Line> findLines(const std::filesystem::path &dir);
+
+private:
+    std::shared_ptr<const PronouncingDictionary> _dict;
+    IThreadPool &_threadPool;
+    float _minSilenceDuration;
+    float _maxSilenceAmplitude;
+
+    Result composeLine(const Line &line);
+};
+
+} // namespace reone
@@ -45,14 +45,21 @@ private:
     std::string _word;
 };
 
+/**
+ * Phonemes are interned, so that each word only holds indices into a shared
+ * table. Once loaded, dictionary is read-only and can be shared across
+ * threads.
+ */
 class PronouncingDictionary {
 public:
     typedef std::unordered_map<std::string, std::vector<std::string>> WordPhonemesMap;
 
     PronouncingDictionary() = default;
 
-    PronouncingDictionary(WordPhonemesMap wordToPhonemes) :
-        _wordToPhonemes(std::move(wordToPhonemes)) {
+    PronouncingDictionary(const WordPhonemesMap &wordToPhonemes) {
+        for (const auto &[word, phonemes] : wordToPhonemes) {
+            add(word, phonemes);
+        }
     }
 
     void load(IInputStream &stream);
@@ -60,20 +67,22 @@ public:
     /**
      * @throws WordPhonemesNotFoundException
      */
-    std::vector<std::string> phonemes(const std::string &word) const {
-        auto codePoints = codePointsFromUTF8(word);
-        for (auto &cp : codePoints) {
-            cp = codePointToLower(cp);
-        }
-        auto lowerWord = utf8FromCodePoints(codePoints);
-        if (_wordToPhonemes.count(lowerWord) == 0) {
-            throw WordPhonemesNotFoundException(lowerWord);
-        }
-        return _wordToPhonemes.at(lowerWord);
-    }
+    std::vector<std::string> phonemes(const std::string &word) const;
+
+    size_t numWords() const { return _wordToPhonemes.size(); }
 
 private:
-    WordPhonemesMap _wordToPhonemes;
+    struct PhonemeRange {
+        uint32_t offset {0};
+        uint32_t count {0};
+    };
+
+    std::unordered_map<std::string, PhonemeRange> _wordToPhonemes;
+    std::vector<uint16_t> _phonemeIndices;
+    std::vector<std::string> _phonemes;
+    std::unordered_map<std::string, uint16_t> _phonemeToIndex;
+
+    void add(const std::string &word, const std::vector<std::string> &phonemes);
 };
 
 class TextSyntaxException : public std::runtime_error {
@@ -119,6 +128,10 @@ private:
 class LipComposer : boost::noncopyable {
 public:
     LipComposer(PronouncingDictionary dict) :
+        _dict(std::make_shared<PronouncingDictionary>(std::move(dict))) {
+    }
+
+    LipComposer(std::shared_ptr<const PronouncingDictionary> dict) :
         _dict(std::move(dict)) {
     }
 
@@ -134,7 +147,7 @@ public:
                                                     std::vector<TimeSpan> silentSpans = std::vector<TimeSpan>());
 
 private:
-    PronouncingDictionary _dict;
+    std::shared_ptr<const PronouncingDictionary> _dict;
 
     std::vector<std::vector<std::string>> split(const std::string &u8Text);
 };
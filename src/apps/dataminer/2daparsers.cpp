@@ -19,7 +19,6 @@
 
 #include "reone/resource/container/keybif.h"
 #include "reone/resource/format/2dareader.h"
-#include "reone/system/checkutil.h"
 #include "reone/system/fileutil.h"
 #include "reone/system/stream/fileoutput.h"
 #include "reone/system/stream/memoryinput.h"
@@ -220,10 +219,11 @@ void generate2DAParsers(const std::filesystem::path &k1dir,
                         const std::filesystem::path &k2dir,
                         const std::filesystem::path &destdir) {
     std::vector<std::pair<ResRef, std::shared_ptr<TwoDA>>> twoDAs;
+    auto fileHandles = FileHandleCache();
 
     auto k1KeyPath = findFileIgnoreCase(k1dir, "chitin.key");
     if (k1KeyPath) {
-        KeyBifResourceContainer k1KeyBif {*k1KeyPath};
+        KeyBifResourceContainer k1KeyBif {*k1KeyPath, fileHandles};
         k1KeyBif.init();
         for (const auto &resId : k1KeyBif.resourceIds()) {
             if (resId.type != ResType::TwoDA) {
@@ -246,7 +246,7 @@ void generate2DAParsers(const std::filesystem::path &k1dir,
 
     auto k2KeyPath = findFileIgnoreCase(k2dir, "chitin.key");
     if (k2KeyPath) {
-        KeyBifResourceContainer k2KeyBif {*k2KeyPath};
+        KeyBifResourceContainer k2KeyBif {*k2KeyPath, fileHandles};
         k2KeyBif.init();
         for (const auto &resId : k2KeyBif.resourceIds()) {
             if (resId.type != ResType::TwoDA) {
@@ -283,11 +283,10 @@ void generate2DAParsers(const std::filesystem::path &k1dir,
         if (twoDA->getRowCount() == 0) {
             continue;
         }
-        for (const auto &row : twoDA->rows()) {
-            for (size_t col = 0; col < twoDA->getColumnCount(); ++col) {
+        for (int row = 0; row < twoDA->getRowCount(); ++row) {
+            for (int col = 0; col < twoDA->getColumnCount(); ++col) {
                 auto &column = nameToColumn.at(twoDA->columns()[col]);
-                checkGreater("row values count", row.values.size(), col);
-                const auto &value = row.values[col];
+                auto value = std::string(twoDA->cell(row, col));
                 if (value.empty()) {
                     column.optional = true;
                     continue;
@@ -53,14 +53,14 @@ struct SchemaStruct {
 static void appendGffToSchema(Gff &tree, SchemaStruct &schemaStruct) {
     std::set<std::string> fields;
     for (auto &field : tree.fields()) {
-        if (schemaStruct.fields.count(field.label) == 0) {
+        if (schemaStruct.fields.count(field.label()) == 0) {
             SchemaField sf;
             sf.type = field.type;
-            sf.name = field.label;
-            sf.cppName = boost::replace_all_copy(field.label, " ", "_");
-            schemaStruct.fields[field.label] = std::move(sf);
+            sf.name = field.label();
+            sf.cppName = boost::replace_all_copy(field.label(), " ", "_");
+            schemaStruct.fields[field.label()] = std::move(sf);
         }
-        auto &schemaField = schemaStruct.fields.at(field.label);
+        auto &schemaField = schemaStruct.fields.at(field.label());
         if ((field.type == Gff::FieldType::Struct || field.type == Gff::FieldType::List) && !field.children.empty()) {
             if (!schemaField.subStruct) {
                 schemaField.subStruct = std::make_unique<SchemaStruct>();
@@ -70,7 +70,7 @@ static void appendGffToSchema(Gff &tree, SchemaStruct &schemaStruct) {
                 appendGffToSchema(*field.children[0], *schemaField.subStruct);
             }
         }
-        fields.insert(field.label);
+        fields.insert(field.label());
     }
     for (auto &[name, schemaField] : schemaStruct.fields) {
         if (fields.count(name) == 0) {
@@ -212,55 +212,55 @@ static void writeParseFunction(const SchemaStruct &schemaStruct, TextWriter &wri
         case Gff::FieldType::Byte:
         case Gff::FieldType::Word:
         case Gff::FieldType::Dword:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getUint(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getUint(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Char:
         case Gff::FieldType::Short:
         case Gff::FieldType::Int:
         case Gff::FieldType::StrRef:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getInt(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getInt(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Dword64:
-            writer.write(str(boost::format("%1%strct.%2% = gff.readUint64(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.readUint64(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Int64: {
-            writer.write(str(boost::format("%1%strct.%2% = gff.readInt64(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.readInt64(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         }
         case Gff::FieldType::Float:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getFloat(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getFloat(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Double:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getDouble(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getDouble(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::CExoString:
         case Gff::FieldType::ResRef:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getString(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getString(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::CExoLocString:
-            writer.write(str(boost::format("%1%strct.%2% = std::make_pair(gff.getInt(\"%3%\"), gff.getString(\"%3%\"));\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = std::make_pair(gff.getInt(labels::%3%), gff.getString(labels::%3%));\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Void:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getData(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getData(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Struct:
-            writer.write(str(boost::format("%1%auto %2% = gff.findStruct(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%auto %2% = gff.findStruct(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             writer.write(str(boost::format("%1%if (%2%) {\n") % kIndent % field.cppName));
             writer.write(str(boost::format("%1%%1%strct.%2% = parse%3%(*%2%);\n") % kIndent % field.cppName % field.subStruct->name));
             writer.write(str(boost::format("%1%}\n") % kIndent));
             break;
         case Gff::FieldType::List:
             if (field.subStruct) {
-                writer.write(str(boost::format("%1%for (auto &item : gff.getList(\"%2%\")) {\n") % kIndent % field.name));
+                writer.write(str(boost::format("%1%for (auto &item : gff.getList(labels::%2%)) {\n") % kIndent % field.cppName));
                 writer.write(str(boost::format("%1%%1%strct.%2%.push_back(parse%3%(*item));\n") % kIndent % field.cppName % field.subStruct->name));
                 writer.write(str(boost::format("%1%}\n") % kIndent));
             }
             break;
         case Gff::FieldType::Orientation:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getOrientation(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getOrientation(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         case Gff::FieldType::Vector:
-            writer.write(str(boost::format("%1%strct.%2% = gff.getVector(\"%3%\");\n") % kIndent % field.cppName % field.name));
+            writer.write(str(boost::format("%1%strct.%2% = gff.getVector(labels::%3%);\n") % kIndent % field.cppName % field.cppName));
             break;
         default:
             throw std::logic_error("Invalid field type: " + std::to_string(static_cast<int>(field.type)));
@@ -282,6 +282,18 @@ static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>
     writer.write("namespace reone {\n\n");
     writer.write("namespace resource {\n\n");
     writer.write("namespace generated {\n\n");
+    // Labels are interned once, so that parsing looks fields up by symbol
+    std::map<std::string, std::string> labels;
+    for (auto &[_, schemaStruct] : structs) {
+        for (auto &[name, field] : schemaStruct->fields) {
+            labels[field.cppName] = name;
+        }
+    }
+    writer.write("namespace labels {\n\n");
+    for (auto &[cppName, name] : labels) {
+        writer.write(str(boost::format("static const GffLabel %1% {\"%2%\"};\n") % cppName % name));
+    }
+    writer.write("\n} // namespace labels\n\n");
     for (auto &[_, schemaStruct] : structs) {
         writeParseFunction(*schemaStruct, writer);
     }
@@ -297,7 +309,8 @@ void generateGffParsers(resource::ResType resType,
     std::map<std::string, std::shared_ptr<Gff>> trees;
 
     auto keyPath = getFileIgnoreCase(k2dir, "chitin.key");
-    auto keyBif = KeyBifResourceContainer(keyPath);
+    auto fileHandles = FileHandleCache();
+    auto keyBif = KeyBifResourceContainer(keyPath, fileHandles);
     keyBif.init();
     for (auto &resId : keyBif.resourceIds()) {
         if (resId.type != resType) {
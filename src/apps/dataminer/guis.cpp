@@ -213,9 +213,10 @@ void generateGuis(const std::filesystem::path &k1dir,
                   const std::filesystem::path &k2dir,
                   const std::filesystem::path &destDir) {
     std::set<std::string> guiResRefs;
+    auto fileHandles = FileHandleCache();
 
     auto k1KeyPath = getFileIgnoreCase(k1dir, "chitin.key");
-    auto k1KeyBifProvider = KeyBifResourceContainer(k1KeyPath);
+    auto k1KeyBifProvider = KeyBifResourceContainer(k1KeyPath, fileHandles);
     k1KeyBifProvider.init();
     for (auto &resId : k1KeyBifProvider.resourceIds()) {
         if (resId.type == ResType::Gui) {
@@ -224,7 +225,7 @@ void generateGuis(const std::filesystem::path &k1dir,
     }
 
     auto k2KeyPath = getFileIgnoreCase(k2dir, "chitin.key");
-    auto k2KeyBifProvider = KeyBifResourceContainer(k2KeyPath);
+    auto k2KeyBifProvider = KeyBifResourceContainer(k2KeyPath, fileHandles);
     k2KeyBifProvider.init();
     for (auto &resId : k2KeyBifProvider.resourceIds()) {
         if (resId.type != ResType::Gui) {
@@ -238,7 +239,7 @@ void generateGuis(const std::filesystem::path &k1dir,
     }
 
     auto k2OverridePath = getFileIgnoreCase(k2dir, "override");
-    auto k2OverrideFolder = FolderResourceContainer(k2OverridePath);
+    auto k2OverrideFolder = FolderResourceContainer(k2OverridePath, fileHandles);
     k2OverrideFolder.init();
     for (auto &resId : k2OverrideFolder.resourceIds()) {
         if (resId.type != ResType::Gui) {
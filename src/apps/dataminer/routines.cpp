@@ -358,7 +358,8 @@ void generateRoutines(const std::filesystem::path &k1Dir,
     if (!k1KeyPath) {
         throw std::runtime_error("KotOR chitin.key file not found");
     }
-    auto k1KeyBif = KeyBifResourceContainer(*k1KeyPath);
+    auto fileHandles = FileHandleCache();
+    auto k1KeyBif = KeyBifResourceContainer(*k1KeyPath, fileHandles);
     k1KeyBif.init();
     auto k1NssBytes = k1KeyBif.findResourceData(ResourceId("nwscript", ResType::Nss));
     if (!k1NssBytes) {
@@ -387,7 +388,7 @@ void generateRoutines(const std::filesystem::path &k1Dir,
     if (!k2KeyPath) {
         throw std::runtime_error("TSL chitin.key file not found");
     }
-    auto k2KeyBif = KeyBifResourceContainer(*k1KeyPath);
+    auto k2KeyBif = KeyBifResourceContainer(*k1KeyPath, fileHandles);
     k2KeyBif.init();
     auto k2NssBytes = k2KeyBif.findResourceData(ResourceId("nwscript", ResType::Nss));
     if (!k2NssBytes) {
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+
+#include "reone/system/stringutil.h"
+
+namespace reone {
+
+static const std::string kFramePhase {"frame"};
+
+static uint64_t percentile(const std::vector<uint64_t> &sorted, int percent) {
+    size_t rank = (sorted.size() * percent + 99) / 100;
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+void BenchmarkReport::addFrame(uint64_t duration, const std::vector<TraceEvent> &events) {
+    _phases[kFramePhase].push_back(duration);
+
+    // Zones of the same name may be entered several times per frame, or on
+    // several threads - report their total time
+    std::map<std::string, uint64_t> zones;
+    for (auto &event : events) {
+        if (event.type == TraceEventType::Zone) {
+            zones[event.name] += event.duration;
+        } else if (event.type == TraceEventType::Counter) {
+            _counters[event.name] = event.value;
+        }
+    }
+    for (auto &[name, total] : zones) {
+        _phases[name].push_back(total);
+    }
+}
+
+void BenchmarkReport::write(std::ostream &stream) const {
+    stream << "{\n";
+    stream << "  \"module\": " << string_json_quote(_module) << ",\n";
+    stream << "  \"frames\": " << _frames << ",\n";
+    stream << "  \"frameTime\": " << _frameTime << ",\n";
+    stream << "  \"loadTimeUs\": " << _loadTime << ",\n";
+    stream << "  \"phases\": {";
+    bool first = true;
+    for (auto &[name, durations] : _phases) {
+        auto sorted = durations;
+        std::sort(sorted.begin(), sorted.end());
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "    " << string_json_quote(name) << ": {"
+               << "\"count\": " << sorted.size()
+               << ", \"p50Us\": " << percentile(sorted, 50)
+               << ", \"p90Us\": " << percentile(sorted, 90)
+               << ", \"p99Us\": " << percentile(sorted, 99)
+               << ", \"maxUs\": " << sorted.back()
+               << "}";
+    }
+    stream << "\n  },\n";
+    stream << "  \"counters\": {";
+    first = true;
+    for (auto &[name, value] : _counters) {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "    " << string_json_quote(name) << ": " << value;
+    }
+    stream << "\n  }\n";
+    stream << "}\n";
+}
+
+} // namespace reone
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/trace.h"
+
+namespace reone {
+
+/**
+ * Accumulates per-frame durations of profiling zones and latest values of
+ * counters over a benchmark run, and writes their summary as JSON.
+ */
+class BenchmarkReport : boost::noncopyable {
+public:
+    BenchmarkReport(std::string module, int frames, float frameTime) :
+        _module(std::move(module)),
+        _frames(frames),
+        _frameTime(frameTime) {
+    }
+
+    void setLoadTime(uint64_t micros) {
+        _loadTime = micros;
+    }
+
+    /**
+     * @param duration wall time of the frame, microseconds
+     * @param events zones and counters recorded during the frame
+     */
+    void addFrame(uint64_t duration, const std::vector<TraceEvent> &events);
+
+    void write(std::ostream &stream) const;
+
+private:
+    std::string _module;
+    int _frames;
+    float _frameTime;
+
+    uint64_t _loadTime {0};
+    std::map<std::string, std::vector<uint64_t>> _phases;
+    std::map<std::string, int64_t> _counters;
+};
+
+} // namespace reone
@@ -19,9 +19,18 @@
 
 #include "SDL3/SDL.h"
 
+#include "reone/game/action/movetopoint.h"
+#include "reone/game/object/area.h"
+#include "reone/game/object/camera/thirdperson.h"
+#include "reone/game/object/creature.h"
+#include "reone/game/object/module.h"
+#include "reone/game/party.h"
 #include "reone/graphics/window.h"
 #include "reone/resource/exception/notfound.h"
 #include "reone/resource/gameprobe.h"
+#include "reone/system/trace.h"
+
+#include "benchmark.h"
 
 using namespace reone::audio;
 using namespace reone::game;
@@ -41,12 +50,18 @@ static constexpr int kProfilerUpdateTimeIndex = 1;
 static constexpr int kProfilerRenderGraphicsTimeIndex = 2;
 static constexpr int kProfilerRenderAudioTimeIndex = 3;
 
+static constexpr int kBenchmarkNumWaypoints = 8;
+static constexpr int kBenchmarkFramesPerWaypoint = 120;
+static constexpr float kBenchmarkWaypointRadius = 4.0f;
+
 void Engine::init() {
-    if (!SDL_Init(SDL_INIT_VIDEO)) {
-        throw std::runtime_error("SDL_Init failed: " + std::string(SDL_GetError()));
+    if (!_options.graphics.headless) {
+        if (!SDL_Init(SDL_INIT_VIDEO)) {
+            throw std::runtime_error("SDL_Init failed: " + std::string(SDL_GetError()));
+        }
+        _window = std::make_unique<Window>(_options.graphics);
+        _window->init();
     }
-    _window = std::make_unique<Window>(_options.graphics);
-    _window->init();
 
     _optionsView = _options.toView();
     GameProbe probe {_options.game.path};
@@ -91,6 +106,8 @@ void Engine::init() {
     _audioModule->init();
     _movieModule->init();
     _scriptModule->init();
+    _resourceModule->setRecordAccess(_options.traceResources);
+    _resourceModule->setThreadPool(&_systemModule->services().threadPool);
     _resourceModule->init();
     _sceneModule->init();
     _guiModule->init();
@@ -119,6 +136,7 @@ void Engine::init() {
          glm::vec3 {0.0f, 1.0f, 0.0f},
          glm::vec3 {1.0f, 0.0f, 0.0f},
          glm::vec3 {1.0f, 1.0f, 0.0f}});
+    TraceRecorder::instance.setEnabled(_options.tracing.enabled);
 
     _console = std::make_unique<Console>(
         _options.graphics,
@@ -176,6 +194,9 @@ void Engine::deinit() {
 }
 
 int Engine::run() {
+    if (!_options.benchmark.module.empty()) {
+        return runBenchmark();
+    }
     auto &clock = _services->system.clock;
     _ticks = clock.millis();
 
@@ -193,7 +214,16 @@ int Engine::run() {
         uint64_t ticks = clock.micros();
         auto frameTime = (ticks - _ticks) / 10e5f;
         _ticks = ticks;
+        if (auto accessRecorder = _resourceModule->accessRecorder()) {
+            accessRecorder->advanceFrame();
+        }
+        R_TRACE_FRAME();
+        auto &tracing = _options.tracing;
+        if (tracing.lastFrame >= 0 && TraceRecorder::instance.frame() == static_cast<uint32_t>(tracing.lastFrame) + 1) {
+            _profiler->saveTrace(std::make_pair(static_cast<uint32_t>(std::max(0, tracing.firstFrame)), static_cast<uint32_t>(tracing.lastFrame)));
+        }
         _profiler->measure(kMainThreadName, kProfilerInputTimeIndex, [this, &quit]() {
+            R_TRACE_ZONE("input");
             while (!_events.empty()) {
                 auto event = _events.front();
                 _events.pop();
@@ -216,6 +246,7 @@ int Engine::run() {
             break;
         }
         _profiler->measure(kMainThreadName, kProfilerUpdateTimeIndex, [this, &frameTime]() {
+            R_TRACE_ZONE("update");
             _game->update(frameTime);
             bool showcur = _game->cursorType() == CursorType::None;
             bool relmouse = _game->relativeMouseMode();
@@ -224,6 +255,7 @@ int Engine::run() {
             _profiler->update(frameTime);
         });
         _profiler->measure(kMainThreadName, kProfilerRenderGraphicsTimeIndex, [this]() {
+            R_TRACE_ZONE("render");
             _services->graphics.statistic.resetDrawCalls();
             if (_options.graphics.pbr) {
                 _services->graphics.pbrTextures.refresh();
@@ -233,8 +265,10 @@ int Engine::run() {
             _profiler->render();
             _console->render();
             _window->swap();
+            R_TRACE_COUNTER("draw calls", _services->graphics.statistic.numDrawCalls());
         });
         _profiler->measure(kMainThreadName, kProfilerRenderAudioTimeIndex, [this]() {
+            R_TRACE_ZONE("audio");
             _services->audio.mixer.render();
         });
     }
@@ -242,6 +276,60 @@ int Engine::run() {
     return 0;
 }
 
+int Engine::runBenchmark() {
+    auto &benchmark = _options.benchmark;
+    auto &clock = _services->system.clock;
+    auto &recorder = TraceRecorder::instance;
+    BenchmarkReport report {benchmark.module, benchmark.frames, benchmark.frameTime};
+
+    uint64_t loadStart = clock.micros();
+    _game->loadModule(benchmark.module, benchmark.entry);
+    report.setLoadTime(clock.micros() - loadStart);
+    auto module = _game->module();
+    if (!module) {
+        throw std::runtime_error("Failed to load module: " + benchmark.module);
+    }
+
+    // Walk the party leader around its spawn point, while orbiting the camera
+    auto leader = _game->party().getLeader();
+    glm::vec3 origin = leader ? leader->position() : glm::vec3(0.0f);
+    auto camera = module->area()->getCamera<ThirdPersonCamera>(game::CameraType::ThirdPerson);
+
+#ifndef R_ENABLE_TRACING
+    warn("Built without ENABLE_TRACING, benchmark will only report frame times");
+#endif
+    recorder.setEnabled(true);
+    recorder.takeEvents();
+    for (int frame = 0; frame < benchmark.frames; ++frame) {
+        if (leader && frame % kBenchmarkFramesPerWaypoint == 0) {
+            int waypoint = (frame / kBenchmarkFramesPerWaypoint) % kBenchmarkNumWaypoints;
+            float angle = glm::two_pi<float>() * waypoint / kBenchmarkNumWaypoints;
+            auto point = origin + kBenchmarkWaypointRadius * glm::vec3(glm::cos(angle), glm::sin(angle), 0.0f);
+            leader->clearAllActions();
+            leader->addAction(_game->newAction<MoveToPointAction>(point));
+        }
+        if (camera) {
+            camera->setFacing(glm::two_pi<float>() * frame / benchmark.frames);
+        }
+        uint64_t frameStart = clock.micros();
+        R_TRACE_FRAME();
+        {
+            R_TRACE_ZONE("update");
+            _game->update(benchmark.frameTime);
+        }
+        {
+            R_TRACE_ZONE("audio");
+            _services->audio.mixer.render();
+        }
+        report.addFrame(clock.micros() - frameStart, recorder.takeEvents());
+    }
+    recorder.setEnabled(_options.tracing.enabled);
+
+    report.write(std::cout);
+
+    return 0;
+}
+
 void Engine::processEvents(bool &quit) {
     std::queue<input::Event> unhandled;
     SDL_Event sdlEvent;
@@ -90,6 +90,8 @@ private:
     bool _showCursor {true};
     bool _relativeMouseMode {false};
 
+    int runBenchmark();
+
     void processEvents(bool &quit);
 
     void showCursor(bool show);
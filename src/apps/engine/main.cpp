@@ -49,7 +49,8 @@ int main(int argc, char **argv) {
         return 1;
     }
     try {
-        Logger::instance.init(options->logging.severity, options->logging.channels, kLogFilename);
+        Logger::instance.init(options->logging.severity, options->logging.channels, kLogFilename, options->logging.overflowPolicy);
+        Logger::instance.installCrashHandlers();
         info(kEngineStartupMessage);
         Logger::instance.flush();
     } catch (const std::exception &ex) {
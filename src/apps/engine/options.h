@@ -28,6 +28,39 @@ struct Options {
     struct Logging {
         LogSeverity severity {LogSeverity::Info};
         std::set<LogChannel> channels {LogChannel::Global};
+        LogOverflowPolicy overflowPolicy {LogOverflowPolicy::Count};
+    };
+
+    struct Tracing {
+        /**
+         * Record profiling zones and counters. Press F6 to save recorded
+         * events as a Chrome trace.
+         */
+        bool enabled {false};
+
+        /**
+         * Save a Chrome trace of this inclusive frame range once it is
+         * recorded. Disabled if negative.
+         */
+        int firstFrame {-1};
+        int lastFrame {-1};
+    };
+
+    struct Benchmark {
+        /**
+         * Load this module without a window, OpenGL context or audio device,
+         * simulate a fixed number of frames and print timings as JSON.
+         * Disabled if empty.
+         */
+        std::string module;
+
+        /**
+         * Waypoint tag to spawn the party at, module entry if empty.
+         */
+        std::string entry;
+
+        int frames {600};
+        float frameTime {1.0f / 60.0f};
     };
 
     game::GameOptions game;
@@ -35,12 +68,19 @@ struct Options {
     audio::AudioOptions audio;
 
     Logging logging;
+    Tracing tracing;
+    Benchmark benchmark;
 
     /**
      * Execute console commands from a file at startup.
      */
     std::string commandsFile;
 
+    /**
+     * Record resource accesses per module into an access log.
+     */
+    bool traceResources {false};
+
     std::unique_ptr<game::OptionsView> toView() {
         return std::make_unique<game::OptionsView>(game, graphics, audio);
     }
@@ -42,6 +42,14 @@ std::unique_ptr<Options> OptionsParser::parse() {
     descCommon.add_options()                                                                                                    //
         ("game", value<std::string>(), "path to game directory")                                                                //
         ("commands-file", value<std::string>()->default_value(""), "execute console commands from a file at startup")           //
+        ("traceres", value<bool>()->default_value(options->traceResources), "record resource accesses per module")              //
+        ("trace", value<bool>()->default_value(options->tracing.enabled), "record profiling zones, F6 to save trace")           //
+        ("tracefirst", value<int>()->default_value(options->tracing.firstFrame), "first frame of trace to save")                //
+        ("tracelast", value<int>()->default_value(options->tracing.lastFrame), "last frame of trace to save")                   //
+        ("benchmark", value<std::string>()->default_value(""), "time frames of module headless, zones need ENABLE_TRACING")     //
+        ("benchentry", value<std::string>()->default_value(""), "waypoint tag to spawn the party at in benchmark")              //
+        ("benchframes", value<int>()->default_value(options->benchmark.frames), "number of frames to simulate in benchmark")    //
+        ("benchfps", value<int>()->default_value(60), "simulated frame rate in benchmark")                                      //
         ("dev", value<bool>()->default_value(options->game.developer), "enable developer mode")                                 //
         ("width", value<int>()->default_value(options->graphics.width), "render width")                                         //
         ("height", value<int>()->default_value(options->graphics.height), "render height")                                      //
@@ -54,6 +62,7 @@ std::unique_ptr<Options> OptionsParser::parse() {
         ("ssr", value<bool>()->default_value(options->graphics.ssr), "enable screen-space reflections")                         //
         ("fxaa", value<bool>()->default_value(options->graphics.fxaa), "enable anti-aliasing")                                  //
         ("sharpen", value<bool>()->default_value(options->graphics.sharpen), "enable image sharpening")                         //
+        ("movieyuv", value<bool>()->default_value(options->graphics.movieYUV), "convert movie frames to RGB on GPU")            //
         ("texquality", value<int>()->default_value(static_cast<int>(options->graphics.textureQuality)), "texture quality")      //
         ("shadowres", value<int>()->default_value(glm::log2(options->graphics.shadowResolution) - 10), "shadow map resolution") //
         ("anisofilter", value<int>()->default_value(options->graphics.anisotropicFiltering), "anisotropic filtering")           //
@@ -62,8 +71,11 @@ std::unique_ptr<Options> OptionsParser::parse() {
         ("voicevol", value<int>()->default_value(options->audio.voiceVolume), "voice volume in percents")                       //
         ("soundvol", value<int>()->default_value(options->audio.soundVolume), "sound volume in percents")                       //
         ("movievol", value<int>()->default_value(options->audio.movieVolume), "movie volume in percents")                       //
+        ("audiobuf", value<int>()->default_value(options->audio.bufferMs), "audio streaming buffer length in milliseconds")     //
+        ("audiocache", value<int>()->default_value(options->audio.clipCacheMb), "audio clip cache size in megabytes")           //
         ("logsev", value<int>()->default_value(static_cast<int>(options->logging.severity)), "minimum log severity")            //
-        ("logch", value<int>()->default_value(defaultLogChannels), "log channel mask");
+        ("logch", value<int>()->default_value(defaultLogChannels), "log channel mask")                                         //
+        ("logoverflow", value<int>()->default_value(static_cast<int>(options->logging.overflowPolicy)), "log queue overflow policy: 0 - drop, 1 - count, 2 - block");
 
     options_description descCmdLine {"Usage"};
     descCmdLine.add(descCommon);
@@ -92,6 +104,7 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options->graphics.ssr = vars["ssr"].as<bool>();
     options->graphics.fxaa = vars["fxaa"].as<bool>();
     options->graphics.sharpen = vars["sharpen"].as<bool>();
+    options->graphics.movieYUV = vars["movieyuv"].as<bool>();
     options->graphics.textureQuality = static_cast<TextureQuality>(vars["texquality"].as<int>());
     options->graphics.shadowResolution = 1 << (10 + vars["shadowres"].as<int>());
     options->graphics.anisotropicFiltering = vars["anisofilter"].as<int>();
@@ -100,7 +113,10 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options->audio.voiceVolume = vars["voicevol"].as<int>();
     options->audio.soundVolume = vars["soundvol"].as<int>();
     options->audio.movieVolume = vars["movievol"].as<int>();
+    options->audio.bufferMs = vars["audiobuf"].as<int>();
+    options->audio.clipCacheMb = vars["audiocache"].as<int>();
     options->logging.severity = static_cast<LogSeverity>(vars["logsev"].as<int>());
+    options->logging.overflowPolicy = static_cast<LogOverflowPolicy>(vars["logoverflow"].as<int>());
 
     std::set<LogChannel> logChannels;
     int logChannelsMask = vars["logch"].as<int>();
@@ -143,6 +159,18 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options->logging.channels = std::move(logChannels);
 
     options->commandsFile = vars["commands-file"].as<std::string>();
+    options->traceResources = vars["traceres"].as<bool>();
+    options->tracing.enabled = vars["trace"].as<bool>();
+    options->tracing.firstFrame = vars["tracefirst"].as<int>();
+    options->tracing.lastFrame = vars["tracelast"].as<int>();
+    options->benchmark.module = vars["benchmark"].as<std::string>();
+    options->benchmark.entry = vars["benchentry"].as<std::string>();
+    options->benchmark.frames = vars["benchframes"].as<int>();
+    options->benchmark.frameTime = 1.0f / std::max(1, vars["benchfps"].as<int>());
+    if (!options->benchmark.module.empty()) {
+        options->graphics.headless = true;
+        options->audio.headless = true;
+    }
 
     return options;
 }
@@ -30,7 +30,9 @@
 #include "reone/system/checkutil.h"
 #include "reone/system/clock.h"
 #include "reone/system/di/services.h"
+#include "reone/system/logutil.h"
 #include "reone/system/stringbuilder.h"
+#include "reone/system/trace.h"
 
 using namespace reone::game;
 using namespace reone::graphics;
@@ -65,6 +67,10 @@ bool Profiler::handle(const input::Event &event) {
         _enabled.store(!enabled, std::memory_order::memory_order_release);
         return true;
     }
+    if (event.key.code == input::KeyCode::F6 && TraceRecorder::instance.isEnabled()) {
+        saveTrace();
+        return true;
+    }
     if (!enabled) {
         return false;
     }
@@ -196,6 +202,16 @@ void Profiler::renderStatistic(int xOffset) {
         TextGravity::RightBottom);
 }
 
+void Profiler::saveTrace(std::optional<std::pair<uint32_t, uint32_t>> frames) {
+    auto path = std::filesystem::current_path() / str(boost::format("trace_%d.json") % TraceRecorder::instance.frame());
+    try {
+        TraceRecorder::instance.saveChromeTrace(path, std::move(frames));
+        info("Trace saved to " + path.string());
+    } catch (const std::exception &ex) {
+        warn(str(boost::format("Error saving trace: %s") % ex.what()));
+    }
+}
+
 void Profiler::reserveThread(std::string name, std::vector<glm::vec3> colors) {
     if (_nameToTimedThread.count(name) > 0) {
         return;
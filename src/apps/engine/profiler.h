@@ -65,6 +65,13 @@ public:
     void update(float dt);
     void render();
 
+    /**
+     * Saves events recorded by the trace recorder as a Chrome trace.
+     *
+     * @param frames inclusive range of frames to save, all if empty
+     */
+    void saveTrace(std::optional<std::pair<uint32_t, uint32_t>> frames = std::nullopt);
+
     void reserveThread(std::string name,
                        std::vector<glm::vec3> colors = {}) override;
 
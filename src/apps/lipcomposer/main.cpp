@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/format/lipwriter.h"
+#include "reone/graphics/lipanimation.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/threadpool.h"
+#include "reone/tools/lip/batchcomposer.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+using CmdArgs = boost::program_options::variables_map;
+
+// Dictionaries looked up in the current directory, same as in toolkit
+static const std::vector<std::string> kDefaultDictionaries {"cmudict.dict", "ru.dic", "pronouncing.dict"};
+
+static std::shared_ptr<PronouncingDictionary> loadDictionary(const std::vector<std::string> &paths) {
+    auto dict = std::make_shared<PronouncingDictionary>();
+    for (auto &path : paths) {
+        if (!std::filesystem::exists(path)) {
+            continue;
+        }
+        auto stream = FileInputStream(path);
+        dict->load(stream);
+    }
+    return dict;
+}
+
+static int run(const CmdArgs &args) {
+    auto inputDir = std::filesystem::path(args["input-dir"].as<std::string>());
+    auto outputDir = args.count("output-dir") > 0 ? std::filesystem::path(args["output-dir"].as<std::string>()) : inputDir;
+    auto dictPaths = args.count("dict") > 0 ? args["dict"].as<std::vector<std::string>>() : kDefaultDictionaries;
+
+    auto dict = loadDictionary(dictPaths);
+    if (dict->numWords() == 0) {
+        std::cerr << "pronouncing dictionary is empty\n";
+        return -1;
+    }
+    auto lines = LipBatchComposer::findLines(inputDir);
+
+    auto threadPool = ThreadPool(args["threads"].as<int>());
+    threadPool.init();
+    auto composer = LipBatchComposer(
+        dict,
+        threadPool,
+        args["minsilence"].as<float>(),
+        args["maxsilenceamp"].as<float>());
+    auto lastProgress = LipBatchComposer::Progress();
+    auto results = composer.compose(lines, [&lastProgress](const auto &progress) {
+        std::cout << str(boost::format("\rComposed %d/%d lines, %d failed, %.1f lines/s") %
+                         progress.numComposed %
+                         progress.numLines %
+                         progress.numFailed %
+                         progress.linesPerSecond())
+                  << std::flush;
+        lastProgress = progress;
+    });
+    std::cout << std::endl;
+    threadPool.deinit();
+
+    std::filesystem::create_directories(outputDir);
+    for (auto &result : results) {
+        if (!result.error.empty()) {
+            std::cerr << result.name << ": " << result.error << std::endl;
+            continue;
+        }
+        auto writer = LipWriter(*result.animation);
+        writer.save(outputDir / (result.name + ".lip"));
+    }
+    std::cout << str(boost::format("Composed %d lines in %.2f s") % lastProgress.numComposed % lastProgress.elapsed) << std::endl;
+
+    return lastProgress.numFailed == 0 ? 0 : 1;
+}
+
+static void parseOptions(int argc, char **argv, CmdArgs &vars) {
+    using namespace boost::program_options;
+    options_description description;
+    description.add_options()                                                              //
+        ("input-dir", value<std::string>()->required())                                    //
+        ("output-dir", value<std::string>())                                               //
+        ("dict", value<std::vector<std::string>>()->multitoken())                          //
+        ("threads", value<int>()->default_value(-1))                                       //
+        ("minsilence", value<float>()->default_value(0.125f), "min silence duration")      //
+        ("maxsilenceamp", value<float>()->default_value(0.025f), "max silence amplitude"); //
+
+    positional_options_description positional;
+    positional.add("input-dir", 1);
+
+    basic_command_line_parser parser(argc, argv);
+    store(parser.options(description).positional(positional).run(),
+          vars, /*utf8=*/true);
+    notify(vars);
+}
+
+int main(int argc, char **argv) {
+    try {
+        CmdArgs args;
+        parseOptions(argc, argv, args);
+        return run(args);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/workingset.h"
+#include "reone/system/fileutil.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/fileoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+using CmdArgs = boost::program_options::variables_map;
+
+static int run(const CmdArgs &args) {
+    auto manifest = WorkingSetManifest();
+    std::filesystem::path outputPath;
+    if (args.count("output-file")) {
+        outputPath = args["output-file"].as<std::string>();
+    } else if (args.count("game")) {
+        // Engine loads the manifest from the same directory it writes access logs to
+        outputPath = getGameCacheFilePath(args["game"].as<std::string>(), "workingset", ".txt");
+    } else {
+        throw std::invalid_argument("Either game or output-file must be specified");
+    }
+    if (args["merge"].as<bool>() && std::filesystem::exists(outputPath)) {
+        auto stream = FileInputStream(outputPath);
+        manifest.load(stream);
+    }
+    for (auto &logPath : args["log-file"].as<std::vector<std::string>>()) {
+        auto stream = FileInputStream(logPath);
+        manifest.addAccessLog(stream);
+    }
+    auto stream = FileOutputStream(outputPath);
+    manifest.save(stream);
+
+    for (auto &[module, ids] : manifest.modules()) {
+        std::cout << module << ": " << ids.size() << " resources" << std::endl;
+    }
+    return 0;
+}
+
+static void parseOptions(int argc, char **argv, CmdArgs &vars) {
+    using namespace boost::program_options;
+
+    options_description description;
+    description.add_options()                                                                              //
+        ("log-file", value<std::vector<std::string>>()->required()->multitoken(), "resource access logs")  //
+        ("game", value<std::string>(), "game directory, for which to write working set manifest")          //
+        ("output-file", value<std::string>(), "working set manifest to write, instead of game's")          //
+        ("merge", bool_switch(), "merge access logs into an existing manifest instead of replacing it");
+
+    positional_options_description positional;
+    positional.add("log-file", -1);
+
+    basic_command_line_parser parser(argc, argv);
+    store(parser.options(description).positional(positional).run(),
+          vars, /*utf8=*/true);
+    notify(vars);
+}
+
+int main(int argc, char **argv) {
+    try {
+        CmdArgs args;
+        parseOptions(argc, argv, args);
+        return run(args);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+}
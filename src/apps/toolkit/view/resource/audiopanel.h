@@ -25,6 +25,7 @@
 
 #include <wx/panel.h>
 
+#include "reone/audio/backend.h"
 #include "reone/audio/source.h"
 
 namespace reone {
@@ -48,6 +49,7 @@ private:
 
     wxButton *m_stopAudioBtn {nullptr};
 
+    audio::ALAudioBackend m_audioBackend;
     std::unique_ptr<audio::AudioSource> m_audioSource;
 
     void InitControls();
@@ -209,10 +209,10 @@ void GFFResourcePanel::OnTreeCtrlItemContextMenu(wxDataViewEvent &event) {
         }
         case MenuItemId::RenameField: {
             auto &field = m_viewModel.fieldByTreeNodeId(node.id);
-            wxTextEntryDialog dialog {nullptr, "New field name:", "Field rename", field.label};
+            wxTextEntryDialog dialog {nullptr, "New field name:", "Field rename", field.label()};
             if (dialog.ShowModal() == wxID_OK) {
                 auto newName = dialog.GetValue().ToStdString();
-                if (newName != field.label) {
+                if (newName != field.label()) {
                     m_viewModel.renameField(node.id, newName);
                 }
             }
@@ -174,10 +174,9 @@ void ResourceExplorerViewModel::openResource(const ResourceId &id, IInputStream
         }
         auto rows = std::vector<std::vector<std::string>>();
         for (int i = 0; i < twoDa->getRowCount(); ++i) {
-            auto &row = twoDa->rows()[i];
             auto values = std::vector<std::string>();
-            for (auto &value : row.values) {
-                values.push_back(value);
+            for (int j = 0; j < twoDa->getColumnCount(); ++j) {
+                values.emplace_back(twoDa->cell(i, j));
             }
             rows.push_back(std::move(values));
         }
@@ -55,14 +55,14 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
         auto ctx = stack.top();
         stack.pop();
 
-        for (auto &field : ctx.gff.fields()) {
-            auto fieldNodeId = str(boost::format("%s.%s") % ctx.node.id % field.label);
+        for (auto &field : ctx.gff.mutableFields()) {
+            auto fieldNodeId = str(boost::format("%s.%s") % ctx.node.id % field.label());
             _treeNodeIdToField.insert({fieldNodeId, field});
             switch (field.type) {
             case Gff::FieldType::Byte:
             case Gff::FieldType::Word:
             case Gff::FieldType::Dword: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %d") % field.label % static_cast<int>(field.type) % field.uintValue);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %d") % field.label() % static_cast<int>(field.type) % field.uintValue);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
@@ -70,38 +70,38 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
             case Gff::FieldType::Short:
             case Gff::FieldType::Int:
             case Gff::FieldType::StrRef: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %d") % field.label % static_cast<int>(field.type) % field.intValue);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %d") % field.label() % static_cast<int>(field.type) % field.intValue);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::Dword64: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %llu") % field.label % static_cast<int>(field.type) % field.uint64Value);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %llu") % field.label() % static_cast<int>(field.type) % field.uint64Value);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::Int64: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %lld") % field.label % static_cast<int>(field.type) % field.int64Value);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %lld") % field.label() % static_cast<int>(field.type) % field.int64Value);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::Float: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %f") % field.label % static_cast<int>(field.type) % field.floatValue);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %f") % field.label() % static_cast<int>(field.type) % field.floatValue);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::Double: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = %f") % field.label % static_cast<int>(field.type) % field.doubleValue);
+                auto fieldDisplayName = str(boost::format("%s [%d] = %f") % field.label() % static_cast<int>(field.type) % field.doubleValue);
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::CExoString:
             case Gff::FieldType::ResRef: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = \"%s\"") % field.label % static_cast<int>(field.type) % boost::replace_all_copy(field.strValue, "\n", "\\n"));
+                auto fieldDisplayName = str(boost::format("%s [%d] = \"%s\"") % field.label() % static_cast<int>(field.type) % boost::replace_all_copy(field.strValue, "\n", "\\n"));
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::CExoLocString: {
-                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label % static_cast<int>(field.type));
+                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label() % static_cast<int>(field.type));
                 auto fieldNode = std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id);
                 nodes.push_back(fieldNode);
                 auto strRefNodeId = str(boost::format("%s.StrRef") % fieldNodeId);
@@ -119,12 +119,12 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
                 break;
             }
             case Gff::FieldType::Void: {
-                auto fieldDisplayName = str(boost::format("%s [%d] = \"%s\"") % field.label % static_cast<int>(field.type) % hexify(field.data, ""));
+                auto fieldDisplayName = str(boost::format("%s [%d] = \"%s\"") % field.label() % static_cast<int>(field.type) % hexify(field.data, ""));
                 nodes.push_back(std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id));
                 break;
             }
             case Gff::FieldType::Orientation: {
-                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label % static_cast<int>(field.type));
+                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label() % static_cast<int>(field.type));
                 auto fieldNode = std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id);
                 nodes.push_back(fieldNode);
                 auto wNodeId = str(boost::format("%s.W") % fieldNodeId);
@@ -142,7 +142,7 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
                 break;
             }
             case Gff::FieldType::Vector: {
-                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label % static_cast<int>(field.type));
+                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label() % static_cast<int>(field.type));
                 auto fieldNode = std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::Field, fieldDisplayName, ctx.node.id);
                 nodes.push_back(fieldNode);
                 auto xNodeId = str(boost::format("%s.X") % fieldNodeId);
@@ -157,7 +157,7 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
                 break;
             }
             case Gff::FieldType::Struct: {
-                auto fieldDisplayName = str(boost::format("%s [%d,%d]") % field.label % static_cast<int>(field.type) % field.children.front()->type());
+                auto fieldDisplayName = str(boost::format("%s [%d,%d]") % field.label() % static_cast<int>(field.type) % field.children.front()->type());
                 auto fieldNode = std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::StructField, fieldDisplayName, ctx.node.id);
                 nodes.push_back(fieldNode);
                 _treeNodeIdToGff.insert({fieldNodeId, *field.children.front()});
@@ -165,7 +165,7 @@ void GFFResourceViewModel::rebuildTreeFromGff() {
                 break;
             }
             case Gff::FieldType::List: {
-                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label % static_cast<int>(field.type));
+                auto fieldDisplayName = str(boost::format("%s [%d]") % field.label() % static_cast<int>(field.type));
                 auto fieldNode = std::make_shared<GFFTreeNode>(fieldNodeId, GFFTreeNodeType::ListField, fieldDisplayName, ctx.node.id);
                 nodes.push_back(fieldNode);
                 for (size_t i = 0; i < field.children.size(); ++i) {
@@ -199,10 +199,10 @@ void GFFResourceViewModel::setStructType(const GFFTreeNodeId &id, uint32_t type)
 }
 
 void GFFResourceViewModel::appendField(const GFFTreeNodeId &id) {
-    auto &fields = _treeNodeIdToGff.at(id).get().fields();
+    auto &fields = _treeNodeIdToGff.at(id).get().mutableFields();
     int numNewFields = 1;
     for (const auto &field : fields) {
-        if (boost::starts_with(field.label, "New_Field")) {
+        if (boost::starts_with(field.label(), "New_Field")) {
             ++numNewFields;
         }
     }
@@ -211,13 +211,21 @@ void GFFResourceViewModel::appendField(const GFFTreeNodeId &id) {
         label += std::to_string(numNewFields);
     }
     auto newField = Gff::Field::newInt(label, 0);
-    _treeNodeIdToGff.at(id).get().fields().push_back(std::move(newField));
+    fields.push_back(std::move(newField));
     _modified = true;
     rebuildTreeFromGff();
 }
 
 void GFFResourceViewModel::renameField(const GFFTreeNodeId &id, std::string name) {
-    _treeNodeIdToField.at(id).get().label = std::move(name);
+    auto &node = _idToTreeNode.at(id).get();
+    auto &parentGff = _treeNodeIdToGff.at(*node.parentId).get();
+    auto &field = _treeNodeIdToField.at(id).get();
+    for (auto &parentField : parentGff.mutableFields()) {
+        if (&parentField == &field) {
+            parentField.setLabel(std::move(name));
+            break;
+        }
+    }
     _modified = true;
     rebuildTreeFromGff();
 }
@@ -246,9 +254,9 @@ void GFFResourceViewModel::deleteField(const GFFTreeNodeId &id) {
     auto &node = _idToTreeNode.at(id).get();
     auto &parentGff = _treeNodeIdToGff.at(*node.parentId).get();
     auto &field = _treeNodeIdToField.at(id).get();
-    for (auto it = parentGff.fields().begin(); it != parentGff.fields().end(); ++it) {
-        if (it->label == field.label) {
-            parentGff.fields().erase(it);
+    for (auto it = parentGff.mutableFields().begin(); it != parentGff.mutableFields().end(); ++it) {
+        if (it->label() == field.label()) {
+            parentGff.mutableFields().erase(it);
             break;
         }
     }
@@ -15,49 +15,69 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include "reone/resource/format/erfreader.h"
-#include "reone/resource/id.h"
-#include "reone/system/stream/fileinput.h"
+#include "reone/resource/extractor.h"
+#include "reone/resource/typeutil.h"
+#include "reone/system/threadpool.h"
 
 using namespace reone;
 using namespace reone::resource;
 
-// Write a file from an ERF container into the current directory.
-static void extract(ResourceId id, IInputStream &file, size_t size) {
-    std::string name = id.string();
-    std::ofstream outs(name, std::ios::binary);
-    while (size--) {
-        outs.put(file.readByte());
+using CmdArgs = boost::program_options::variables_map;
+
+static ArchiveExtractor::Filter makeFilter(const CmdArgs &args) {
+    auto filter = ArchiveExtractor::Filter();
+    if (args.count("type") > 0) {
+        for (auto &ext : args["type"].as<std::vector<std::string>>()) {
+            auto type = getResTypeByExt(boost::to_lower_copy(ext), false);
+            if (type == ResType::Invalid) {
+                throw std::invalid_argument("Unknown resource type: " + ext);
+            }
+            filter.types.insert(type);
+        }
+    }
+    if (args.count("glob") > 0) {
+        filter.pattern = args["glob"].as<std::string>();
     }
+    return filter;
 }
 
-// Extract all files from an ERF container and write them to the current
-// directory.
-static void extractAll(IInputStream &file) {
-    ErfReader erf(file);
-    erf.load();
-
-    for (size_t i = 0; i < erf.keys().size(); ++i) {
-        auto &key = erf.keys()[i];
-        auto &res = erf.resources()[i];
+static int run(const CmdArgs &args) {
+    auto extractor = ArchiveExtractor(args["input-file"].as<std::string>());
+    extractor.load();
+    auto entries = extractor.entries(makeFilter(args));
 
-        file.seek(res.offset, SeekOrigin::Begin);
-        extract(key.resId, file, res.size);
+    if (args["list"].as<bool>()) {
+        for (auto &entry : entries) {
+            std::cout << entry.resId.string() << " " << entry.size << std::endl;
+        }
+        return 0;
     }
-}
 
-using CmdArgs = boost::program_options::variables_map;
-
-static int run(const CmdArgs &args) {
-    auto file = FileInputStream(args["input-file"].as<std::string>());
-    extractAll(file);
+    auto destPath = std::filesystem::path(args["output-dir"].as<std::string>());
+    int numThreads = args["threads"].as<int>();
+    if (numThreads <= 0) {
+        numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    if (numThreads == 1) {
+        extractor.extract(entries, destPath);
+    } else {
+        auto threadPool = ThreadPool(numThreads);
+        threadPool.init();
+        extractor.extract(entries, destPath, &threadPool, numThreads);
+    }
     return 0;
 }
 
 static void parseOptions(int argc, char **argv, CmdArgs &vars) {
     using namespace boost::program_options;
     options_description description;
-    description.add_options()("input-file", value<std::string>()->required());
+    description.add_options()                                                                                  //
+        ("input-file", value<std::string>()->required(), "ERF, MOD, SAV or RIM archive")                       //
+        ("output-dir", value<std::string>()->default_value("."), "directory to extract resources into")        //
+        ("threads", value<int>()->default_value(0), "number of worker threads, 0 to use all hardware threads") //
+        ("type", value<std::vector<std::string>>()->multitoken(), "extract only resources of these types")     //
+        ("glob", value<std::string>(), "extract only resources whose file names match this pattern")           //
+        ("list", bool_switch(), "list resources instead of extracting them");
 
     positional_options_description positional;
     positional.add("input-file", 1);
@@ -65,6 +85,7 @@ static void parseOptions(int argc, char **argv, CmdArgs &vars) {
     basic_command_line_parser parser(argc, argv);
     store(parser.options(description).positional(positional).run(),
           vars, /*utf8=*/true);
+    notify(vars);
 }
 
 int main(int argc, char **argv) {
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/audio/backend.h"
+
+namespace reone {
+
+namespace audio {
+
+static int getALFormat(AudioFormat format) {
+    switch (format) {
+    case AudioFormat::Mono8:
+        return AL_FORMAT_MONO8;
+    case AudioFormat::Mono16:
+        return AL_FORMAT_MONO16;
+    case AudioFormat::Stereo8:
+        return AL_FORMAT_STEREO8;
+    case AudioFormat::Stereo16:
+        return AL_FORMAT_STEREO16;
+    default:
+        throw std::invalid_argument("Invalid audio format: " + std::to_string(static_cast<int>(format)));
+    }
+}
+
+uint32_t ALAudioBackend::createSource() {
+    uint32_t source = 0;
+    alGenSources(1, &source);
+    return source;
+}
+
+void ALAudioBackend::deleteSource(uint32_t source) {
+    alDeleteSources(1, &source);
+}
+
+void ALAudioBackend::createBuffers(int count, uint32_t *buffers) {
+    alGenBuffers(count, buffers);
+}
+
+void ALAudioBackend::deleteBuffers(int count, const uint32_t *buffers) {
+    alDeleteBuffers(count, buffers);
+}
+
+void ALAudioBackend::setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) {
+    alBufferData(buffer, getALFormat(format), data, size, sampleRate);
+}
+
+void ALAudioBackend::setSourceGain(uint32_t source, float gain) {
+    alSourcef(source, AL_GAIN, gain);
+}
+
+void ALAudioBackend::setSourcePosition(uint32_t source, glm::vec3 position) {
+    alSource3f(source, AL_POSITION, position.x, position.y, position.z);
+}
+
+void ALAudioBackend::setSourceRelative(uint32_t source, bool relative) {
+    alSourcei(source, AL_SOURCE_RELATIVE, relative ? AL_TRUE : AL_FALSE);
+}
+
+void ALAudioBackend::setSourceLooping(uint32_t source, bool loop) {
+    alSourcei(source, AL_LOOPING, loop ? AL_TRUE : AL_FALSE);
+}
+
+void ALAudioBackend::setSourceBuffer(uint32_t source, uint32_t buffer) {
+    alSourcei(source, AL_BUFFER, buffer);
+}
+
+void ALAudioBackend::setSourceOffset(uint32_t source, float seconds) {
+    alSourcef(source, AL_SEC_OFFSET, seconds);
+}
+
+void ALAudioBackend::queueBuffers(uint32_t source, int count, const uint32_t *buffers) {
+    alSourceQueueBuffers(source, count, buffers);
+}
+
+void ALAudioBackend::unqueueBuffers(uint32_t source, int count, uint32_t *buffers) {
+    alSourceUnqueueBuffers(source, count, buffers);
+}
+
+int ALAudioBackend::getProcessedBufferCount(uint32_t source) {
+    ALint processed = 0;
+    alGetSourcei(source, AL_BUFFERS_PROCESSED, &processed);
+    return processed;
+}
+
+int ALAudioBackend::getQueuedBufferCount(uint32_t source) {
+    ALint queued = 0;
+    alGetSourcei(source, AL_BUFFERS_QUEUED, &queued);
+    return queued;
+}
+
+bool ALAudioBackend::isSourceStopped(uint32_t source) {
+    ALint state = 0;
+    alGetSourcei(source, AL_SOURCE_STATE, &state);
+    return state == AL_STOPPED;
+}
+
+void ALAudioBackend::playSource(uint32_t source) {
+    alSourcePlay(source);
+}
+
+void ALAudioBackend::stopSource(uint32_t source) {
+    alSourceStop(source);
+}
+
+PooledAudioBackend::~PooledAudioBackend() {
+    for (auto source : _freeSources) {
+        _backend.deleteSource(source);
+    }
+    if (!_freeBuffers.empty()) {
+        _backend.deleteBuffers(static_cast<int>(_freeBuffers.size()), &_freeBuffers[0]);
+    }
+}
+
+uint32_t PooledAudioBackend::createSource() {
+    std::lock_guard<std::mutex> lock {_mutex};
+    if (_freeSources.empty()) {
+        return _backend.createSource();
+    }
+    uint32_t source = _freeSources.back();
+    _freeSources.pop_back();
+    return source;
+}
+
+void PooledAudioBackend::deleteSource(uint32_t source) {
+    _backend.stopSource(source);
+    _backend.setSourceBuffer(source, 0);
+    _backend.setSourceGain(source, 1.0f);
+    _backend.setSourcePosition(source, glm::vec3(0.0f));
+    _backend.setSourceRelative(source, false);
+    _backend.setSourceLooping(source, false);
+
+    std::lock_guard<std::mutex> lock {_mutex};
+    _freeSources.push_back(source);
+}
+
+void PooledAudioBackend::createBuffers(int count, uint32_t *buffers) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    int numReused = std::min(count, static_cast<int>(_freeBuffers.size()));
+    std::copy(_freeBuffers.end() - numReused, _freeBuffers.end(), buffers);
+    _freeBuffers.resize(_freeBuffers.size() - numReused);
+    if (numReused < count) {
+        _backend.createBuffers(count - numReused, buffers + numReused);
+    }
+}
+
+void PooledAudioBackend::deleteBuffers(int count, const uint32_t *buffers) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    _freeBuffers.insert(_freeBuffers.end(), buffers, buffers + count);
+}
+
+uint32_t NullAudioBackend::createSource() {
+    std::lock_guard<std::mutex> lock {_mutex};
+    uint32_t source = _nextName++;
+    _sources[source] = SourceState();
+    return source;
+}
+
+void NullAudioBackend::deleteSource(uint32_t source) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    _sources.erase(source);
+}
+
+void NullAudioBackend::createBuffers(int count, uint32_t *buffers) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    for (int i = 0; i < count; ++i) {
+        buffers[i] = _nextName++;
+    }
+}
+
+void NullAudioBackend::setSourceLooping(uint32_t source, bool loop) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    _sources[source].looping = loop;
+}
+
+void NullAudioBackend::queueBuffers(uint32_t source, int count, const uint32_t *buffers) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto &queue = _sources[source].queue;
+    queue.insert(queue.end(), buffers, buffers + count);
+}
+
+void NullAudioBackend::unqueueBuffers(uint32_t source, int count, uint32_t *buffers) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto &queue = _sources[source].queue;
+    for (int i = 0; i < count && !queue.empty(); ++i) {
+        buffers[i] = queue.front();
+        queue.pop_front();
+    }
+}
+
+int NullAudioBackend::getQueuedBufferCount(uint32_t source) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    return static_cast<int>(_sources[source].queue.size());
+}
+
+bool NullAudioBackend::isSourceStopped(uint32_t source) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto &state = _sources[source];
+    return !state.playing || (!state.looping && state.queue.empty());
+}
+
+void NullAudioBackend::playSource(uint32_t source) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    _sources[source].playing = true;
+}
+
+void NullAudioBackend::stopSource(uint32_t source) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    _sources[source].playing = false;
+}
+
+} // namespace audio
+
+} // namespace reone
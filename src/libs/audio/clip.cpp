@@ -17,13 +17,90 @@
 
 #include "reone/audio/clip.h"
 
+#include "reone/audio/backend.h"
+#include "reone/audio/decoder.h"
+
 namespace reone {
 
 namespace audio {
 
+namespace {
+
+class FrameDecoder : public IAudioDecoder, boost::noncopyable {
+public:
+    FrameDecoder(const std::vector<AudioClip::Frame> &frames) :
+        _frames(frames) {
+    }
+
+    bool decode(AudioClip::Frame &chunk, size_t maxBytes) override {
+        size_t size = chunk.samples.size();
+        size_t numBytes = size;
+        while (_frameIdx < _frames.size() && numBytes - size < maxBytes) {
+            auto &frame = _frames[_frameIdx];
+            if (numBytes == 0) {
+                chunk.format = frame.format;
+                chunk.sampleRate = frame.sampleRate;
+            } else if (chunk.format != frame.format || chunk.sampleRate != frame.sampleRate) {
+                break;
+            }
+            int stride = frame.stride();
+            size_t count = std::min(frame.samples.size() - _offset, maxBytes - (numBytes - size));
+            count -= count % stride;
+            if (count == 0 && _offset < frame.samples.size()) {
+                break;
+            }
+            chunk.samples.insert(chunk.samples.end(), frame.samples.begin() + _offset, frame.samples.begin() + _offset + count);
+            numBytes += count;
+            _offset += count;
+            if (_offset == frame.samples.size()) {
+                ++_frameIdx;
+                _offset = 0;
+            }
+        }
+        return numBytes > size;
+    }
+
+    void rewind() override {
+        _frameIdx = 0;
+        _offset = 0;
+    }
+
+private:
+    const std::vector<AudioClip::Frame> &_frames;
+
+    size_t _frameIdx {0};
+    size_t _offset {0};
+};
+
+} // namespace
+
+AudioClip::~AudioClip() {
+    if (_sharedBuffer) {
+        _sharedBufferBackend->deleteBuffers(1, &_sharedBuffer);
+    }
+}
+
 void AudioClip::add(Frame &&frame) {
     _duration += frame.samples.size() / frame.stride() / static_cast<float>(frame.sampleRate);
-    _frames.push_back(frame);
+    _size += frame.samples.size();
+    _frames.push_back(std::move(frame));
+}
+
+void AudioClip::upload(IAudioBackend &backend) {
+    if (_sharedBuffer || _frames.size() != 1) {
+        return;
+    }
+    auto &frame = _frames.front();
+    backend.createBuffers(1, &_sharedBuffer);
+    backend.setBufferData(_sharedBuffer, frame.format, frame.samples.data(), static_cast<int>(frame.samples.size()), frame.sampleRate);
+    _sharedBufferBackend = &backend;
+}
+
+std::unique_ptr<IAudioDecoder> AudioClip::createDecoder() const {
+    if (!_decoderFactory) {
+        return std::make_unique<FrameDecoder>(_frames);
+    }
+    return _decoderFactory();
 }
 
 int AudioClip::getFrameCount() const {
@@ -22,10 +22,17 @@ namespace reone {
 namespace audio {
 
 void AudioModule::init() {
-    _context = std::make_unique<Context>();
-    _mixer = std::make_unique<AudioMixer>(_options);
-
-    _context->init();
+    if (_options.headless) {
+        _context = std::make_unique<NullContext>();
+        _backend = std::make_unique<NullAudioBackend>();
+    } else {
+        auto context = std::make_unique<Context>();
+        context->init();
+        _context = std::move(context);
+        _backend = std::make_unique<ALAudioBackend>();
+    }
+    _mixer = std::make_unique<AudioMixer>(_options, *_backend);
+    _mixer->init();
 
     _services = std::make_unique<AudioServices>(*_context, *_mixer);
 }
@@ -34,6 +41,7 @@ void AudioModule::deinit() {
     _services.reset();
 
     _mixer.reset();
+    _backend.reset();
     _context.reset();
 }
 
@@ -39,7 +39,126 @@ static inline int scale(mad_fixed_t sample) {
     return sample >> (MAD_F_FRACBITS + 1 - 16);
 }
 
+static void convertSamples(const mad_pcm &pcm, int offset, int count, char *out) {
+    const mad_fixed_t *chLeft = pcm.samples[0] + offset;
+    if (pcm.channels == 2) {
+        const mad_fixed_t *chRight = pcm.samples[1] + offset;
+        for (int i = 0; i < count; ++i) {
+            int left = scale(chLeft[i]);
+            int right = scale(chRight[i]);
+            out[4 * i + 0] = (left >> 0) & 0xff;
+            out[4 * i + 1] = (left >> 8) & 0xff;
+            out[4 * i + 2] = (right >> 0) & 0xff;
+            out[4 * i + 3] = (right >> 8) & 0xff;
+        }
+    } else {
+        for (int i = 0; i < count; ++i) {
+            int sample = scale(chLeft[i]);
+            out[2 * i + 0] = (sample >> 0) & 0xff;
+            out[2 * i + 1] = (sample >> 8) & 0xff;
+        }
+    }
+}
+
+Mp3Decoder::Mp3Decoder(std::shared_ptr<ByteBuffer> input) :
+    _input(std::move(input)) {
+    mad_stream_init(&_stream);
+    mad_frame_init(&_frame);
+    mad_synth_init(&_synth);
+    rewind();
+}
+
+Mp3Decoder::~Mp3Decoder() {
+    mad_synth_finish(&_synth);
+    mad_frame_finish(&_frame);
+    mad_stream_finish(&_stream);
+}
+
+void Mp3Decoder::rewind() {
+    mad_stream_buffer(&_stream, reinterpret_cast<const unsigned char *>(_input->data()), _input->size());
+    _synth.pcm.length = 0;
+    _pcmOffset = 0;
+}
+
+bool Mp3Decoder::decode(AudioClip::Frame &chunk, size_t maxBytes) {
+    size_t size = chunk.samples.size();
+    chunk.samples.resize(size + maxBytes);
+    size_t numBytes = size;
+    while (true) {
+        if (_pcmOffset >= _synth.pcm.length) {
+            if (!decodeFrame()) {
+                break;
+            }
+            _pcmOffset = 0;
+        }
+        const mad_pcm &pcm = _synth.pcm;
+        auto format = pcm.channels == 2 ? AudioFormat::Stereo16 : AudioFormat::Mono16;
+        int sampleRate = static_cast<int>(pcm.samplerate);
+        if (numBytes == 0) {
+            chunk.format = format;
+            chunk.sampleRate = sampleRate;
+        } else if (chunk.format != format || chunk.sampleRate != sampleRate) {
+            break;
+        }
+        int stride = chunk.stride();
+        int count = std::min(pcm.length - _pcmOffset, static_cast<int>((size + maxBytes - numBytes) / stride));
+        if (count == 0) {
+            break;
+        }
+        convertSamples(pcm, _pcmOffset, count, &chunk.samples[numBytes]);
+        numBytes += static_cast<size_t>(count) * stride;
+        _pcmOffset += count;
+    }
+    chunk.samples.resize(numBytes);
+    return numBytes > size;
+}
+
+bool Mp3Decoder::decodeFrame() {
+    while (true) {
+        if (mad_frame_decode(&_frame, &_stream) == -1) {
+            if (!MAD_RECOVERABLE(_stream.error)) {
+                return false;
+            }
+            if (_stream.error != MAD_ERROR_BADCRC) {
+                continue;
+            }
+            mad_frame_mute(&_frame);
+        }
+        mad_synth_frame(&_synth, &_frame);
+        return true;
+    }
+}
+
+float Mp3Decoder::computeDuration(const ByteBuffer &input) {
+    mad_stream stream;
+    mad_stream_init(&stream);
+    mad_stream_buffer(&stream, reinterpret_cast<const unsigned char *>(input.data()), input.size());
+
+    mad_header header;
+    mad_header_init(&header);
+
+    float duration = 0.0f;
+    while (true) {
+        if (mad_header_decode(&header, &stream) == -1) {
+            if (MAD_RECOVERABLE(stream.error)) {
+                continue;
+            }
+            break;
+        }
+        duration += 32 * MAD_NSBSAMPLES(&header) / static_cast<float>(header.samplerate);
+    }
+
+    mad_header_finish(&header);
+    mad_stream_finish(&stream);
+
+    return duration;
+}
+
 void Mp3Reader::load(IInputStream &stream) {
+    if (_streaming) {
+        loadStreaming(stream);
+        return;
+    }
     stream.seek(0, SeekOrigin::End);
     size_t size = stream.position();
 
@@ -65,6 +184,21 @@ void Mp3Reader::load(IInputStream &stream) {
     mad_decoder_finish(&decoder);
 }
 
+void Mp3Reader::loadStreaming(IInputStream &stream) {
+    stream.seek(0, SeekOrigin::End);
+    size_t size = stream.position();
+
+    auto input = std::make_shared<ByteBuffer>(size, '\0');
+    stream.seek(0, SeekOrigin::Begin);
+    stream.read(input->data(), size);
+
+    float duration = Mp3Decoder::computeDuration(*input);
+    _stream = std::make_shared<AudioClip>(
+        [input]() { return std::make_unique<Mp3Decoder>(input); },
+        duration,
+        input->size());
+}
+
 mad_flow Mp3Reader::inputFunc(void *playbuf, mad_stream *stream) {
     Mp3Reader *mp3 = reinterpret_cast<Mp3Reader *>(playbuf);
     if (mp3->_done) {
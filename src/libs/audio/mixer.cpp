@@ -17,57 +17,267 @@
 
 #include "reone/audio/mixer.h"
 
+#include "reone/system/logutil.h"
+#include "reone/system/threadutil.h"
+
 namespace reone {
 
 namespace audio {
 
-void AudioMixer::render() {
-    for (auto it = _sources.begin(); it != _sources.end();) {
-        auto &source = it->source;
-        source->render();
-        if (!source->isPlaying()) {
-            it = _sources.erase(it);
-        } else {
-            ++it;
+static constexpr int kUpdateIntervalMs = 5;
+static constexpr float kMinAudibleGain = 0.01f;
+
+void AudioMixer::init() {
+    if (_running) {
+        return;
+    }
+    _running = true;
+    _thread = std::thread(std::bind(&AudioMixer::threadFunc, this));
+}
+
+void AudioMixer::deinit() {
+    if (_running) {
+        {
+            std::lock_guard<std::mutex> lock {_wakeMutex};
+            _running = false;
+        }
+        _wakeCondVar.notify_one();
+        _thread.join();
+    }
+    Command command;
+    while (_commands.pop(command)) {
+    }
+    for (auto &voice : _voices) {
+        voice.source->stop();
+        releaseVoice(voice);
+    }
+    _voices.clear();
+    _numRealVoices = 0;
+    _numVirtualVoices = 0;
+}
+
+void AudioMixer::threadFunc() {
+    setThreadName("audio");
+    while (_running) {
+        try {
+            tick();
+        } catch (const std::exception &ex) {
+            error("Audio mixer update failed: " + std::string(ex.what()));
         }
+        std::unique_lock<std::mutex> lock {_wakeMutex};
+        _wakeCondVar.wait_for(lock, std::chrono::milliseconds {kUpdateIntervalMs}, [this]() {
+            return !_running || !_commands.empty();
+        });
     }
 }
 
-void AudioMixer::stop(AudioType type) {
-    for (auto it = _sources.begin(); it != _sources.end();) {
-        if (it->type != type) {
+void AudioMixer::render() {
+    if (_running) {
+        return;
+    }
+    tick();
+}
+
+void AudioMixer::tick() {
+    auto now = std::chrono::steady_clock::now();
+    float dt = _updated ? std::chrono::duration<float>(now - _lastUpdate).count() : 0.0f;
+    _lastUpdate = now;
+    _updated = true;
+    update(dt);
+}
+
+void AudioMixer::update(float dt) {
+    // Advance playback time, dropping virtual voices that have finished
+    for (auto it = _voices.begin(); it != _voices.end();) {
+        auto &voice = *it;
+        voice.time += dt;
+        if (!voice.real) {
+            auto &source = *voice.source;
+            float duration = source.duration();
+            if (!source.isPlaying() || (!source.isLooping() && voice.time >= duration)) {
+                source.stop();
+                it = _voices.erase(it);
+                continue;
+            }
+        }
+        ++it;
+    }
+
+    processCommands();
+    assignVoices();
+
+    int numReal = 0;
+    for (auto it = _voices.begin(); it != _voices.end();) {
+        auto &voice = *it;
+        if (!voice.real) {
             ++it;
             continue;
         }
+        try {
+            voice.source->render();
+        } catch (const std::exception &ex) {
+            error("Audio source failed: " + std::string(ex.what()));
+            voice.source->stop();
+        }
+        if (!voice.source->isPlaying()) {
+            releaseVoice(voice);
+            it = _voices.erase(it);
+            continue;
+        }
+        ++numReal;
+        ++it;
+    }
+    _numRealVoices = numReal;
+    _numVirtualVoices = static_cast<int>(_voices.size()) - numReal;
+}
 
-        it->source->stop();
-        it = _sources.erase(it);
+void AudioMixer::processCommands() {
+    Command command;
+    while (_commands.pop(command)) {
+        switch (command.type) {
+        case CommandType::Play: {
+            Voice voice;
+            voice.source = std::move(command.source);
+            voice.type = command.audioType;
+            voice.priority = command.priority;
+            _voices.push_back(std::move(voice));
+            break;
+        }
+        case CommandType::Stop:
+        case CommandType::StopAll:
+            for (auto it = _voices.begin(); it != _voices.end();) {
+                if (command.type == CommandType::Stop && it->type != command.audioType) {
+                    ++it;
+                    continue;
+                }
+                it->source->stop();
+                releaseVoice(*it);
+                it = _voices.erase(it);
+            }
+            break;
+        }
     }
 }
 
-void AudioMixer::stopAll() {
-    for (auto &source : _sources) {
-        source.source->stop();
+void AudioMixer::assignVoices() {
+    auto listener = glm::vec3(
+        _listenerX.load(std::memory_order_relaxed),
+        _listenerY.load(std::memory_order_relaxed),
+        _listenerZ.load(std::memory_order_relaxed));
+
+    _voiceOrder.clear();
+    for (size_t i = 0; i < _voices.size(); ++i) {
+        auto &voice = _voices[i];
+        voice.audibility = getAudibility(*voice.source, listener);
+        _voiceOrder.push_back(static_cast<int>(i));
+    }
+    std::stable_sort(_voiceOrder.begin(), _voiceOrder.end(), [this](int lhs, int rhs) {
+        auto &left = _voices[lhs];
+        auto &right = _voices[rhs];
+        if (left.priority != right.priority) {
+            return left.priority > right.priority;
+        }
+        if (left.audibility != right.audibility) {
+            return left.audibility > right.audibility;
+        }
+        return left.real && !right.real;
+    });
+
+    int numTotal = 0;
+    int numByType[4] {0};
+    for (int idx : _voiceOrder) {
+        auto &voice = _voices[idx];
+        int &numOfType = numByType[static_cast<int>(voice.type)];
+        voice.selected = voice.audibility >= kMinAudibleGain &&
+                         numTotal < _options.maxVoices &&
+                         numOfType < maxVoicesByType(voice.type);
+        if (voice.selected) {
+            ++numTotal;
+            ++numOfType;
+        }
+    }
+
+    // Release stolen voices before realizing new ones, so that backend
+    // objects are reused
+    for (auto &voice : _voices) {
+        if (voice.real && !voice.selected) {
+            releaseVoice(voice);
+        }
+    }
+    for (auto &voice : _voices) {
+        if (!voice.real && voice.selected) {
+            try {
+                voice.source->init(voice.time);
+                voice.real = true;
+            } catch (const std::exception &ex) {
+                // Stopped voice is dropped on next update
+                error("Audio source failed to start: " + std::string(ex.what()));
+                voice.source->stop();
+            }
+        }
+    }
+}
+
+void AudioMixer::releaseVoice(Voice &voice) {
+    voice.source->deinit();
+    voice.real = false;
+}
+
+float AudioMixer::getAudibility(const AudioSource &source, const glm::vec3 &listener) const {
+    float gain = source.gain();
+    if (!source.isPositional()) {
+        return gain;
     }
-    _sources.clear();
+    // Matches the default OpenAL distance model, i.e. inverse distance
+    // clamped to the unit reference distance
+    float distance = glm::distance(source.position(), listener);
+    return gain / std::max(1.0f, distance);
+}
+
+void AudioMixer::stop(AudioType type) {
+    enqueue(Command {CommandType::Stop, type, AudioPriority::Normal, nullptr});
+}
+
+void AudioMixer::stopAll() {
+    enqueue(Command {CommandType::StopAll, AudioType::Sound, AudioPriority::Normal, nullptr});
+}
+
+void AudioMixer::setListenerPosition(glm::vec3 position) {
+    _listenerX.store(position.x, std::memory_order_relaxed);
+    _listenerY.store(position.y, std::memory_order_relaxed);
+    _listenerZ.store(position.z, std::memory_order_relaxed);
 }
 
 std::shared_ptr<AudioSource> AudioMixer::play(std::shared_ptr<AudioClip> clip,
                                               AudioType type,
                                               float gain,
                                               bool loop,
-                                              std::optional<glm::vec3> position) {
+                                              std::optional<glm::vec3> position,
+                                              AudioPriority priority) {
     auto source = std::make_shared<AudioSource>(
+        _pool,
         std::move(clip),
         gainByType(type, gain),
         loop,
-        std::move(position));
-    source->init();
+        std::move(position),
+        _options.bufferMs);
     source->play();
-    _sources.push_back(ActiveSource {source, type});
+    enqueue(Command {CommandType::Play, type, priority, source});
     return source;
 }
 
+void AudioMixer::enqueue(Command command) {
+    while (!_commands.push(command)) {
+        if (!_running) {
+            tick();
+            continue;
+        }
+        _wakeCondVar.notify_one();
+        std::this_thread::yield();
+    }
+    _wakeCondVar.notify_one();
+}
+
 float AudioMixer::gainByType(AudioType type, float gain) const {
     int volume;
     switch (type) {
@@ -90,6 +300,21 @@ float AudioMixer::gainByType(AudioType type, float gain) const {
     return gain * (volume / 100.0f);
 }
 
+int AudioMixer::maxVoicesByType(AudioType type) const {
+    switch (type) {
+    case AudioType::Music:
+        return _options.maxMusicVoices;
+    case AudioType::Voice:
+        return _options.maxVoiceVoices;
+    case AudioType::Sound:
+        return _options.maxSoundVoices;
+    case AudioType::Movie:
+        return _options.maxMovieVoices;
+    default:
+        return _options.maxVoices;
+    }
+}
+
 } // namespace audio
 
 } // namespace reone
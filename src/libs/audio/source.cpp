@@ -17,71 +17,89 @@
 
 #include "reone/audio/source.h"
 
+#include "reone/audio/backend.h"
 #include "reone/audio/clip.h"
-#include "reone/system/threadutil.h"
 
 namespace reone {
 
 namespace audio {
 
-static constexpr int kMaxBufferCount = 8;
-
-static int getALFormat(AudioFormat format) {
-    switch (format) {
-    case AudioFormat::Mono8:
-        return AL_FORMAT_MONO8;
-    case AudioFormat::Mono16:
-        return AL_FORMAT_MONO16;
-    case AudioFormat::Stereo8:
-        return AL_FORMAT_STEREO8;
-    case AudioFormat::Stereo16:
-        return AL_FORMAT_STEREO16;
-    default:
-        throw std::invalid_argument("Invalid audio format: " + std::to_string(static_cast<int>(format)));
-    }
-}
+static constexpr int kNumStreamingBuffers = 4;
+static constexpr size_t kMinChunkSize = 4096;
+static constexpr size_t kSkipChunkSize = 65536;
 
-static void fillBuffer(const AudioClip::Frame &frame, uint32_t buffer) {
-    alBufferData(
-        buffer,
-        getALFormat(frame.format),
-        &frame.samples[0],
-        static_cast<int>(frame.samples.size()),
-        frame.sampleRate);
+static size_t getChunkSize(const AudioClip::Frame &chunk, int bufferMs) {
+    int stride = chunk.stride();
+    size_t size = static_cast<size_t>(chunk.sampleRate) * stride * bufferMs / 1000;
+    size -= size % stride;
+    return std::max(size, kMinChunkSize);
 }
 
-void AudioSource::init() {
+void AudioSource::init(float time) {
     if (_inited) {
         return;
     }
-    checkMainThread();
-
-    int frameCount = _stream->getFrameCount();
-    int bufferCount = std::min(std::max(frameCount, 1), kMaxBufferCount);
+    try {
+        if (_loop && time > 0.0f && _stream->duration() > 0.0f) {
+            time = glm::mod(time, _stream->duration());
+        }
+        int bufferCount;
+        if (_stream->isStreaming() || _stream->getFrameCount() > 1) {
+            _decoder = _stream->createDecoder();
+            bufferCount = kNumStreamingBuffers;
+        } else if (_stream->sharedBuffer()) {
+            bufferCount = 0;
+        } else {
+            bufferCount = 1;
+        }
 
-    _buffers.resize(bufferCount);
-    _streaming = bufferCount > 1;
+        _buffers.resize(bufferCount);
+        _streaming = bufferCount > 1;
 
-    alGenBuffers(bufferCount, &_buffers[0]);
-    alGenSources(1, &_source);
-    alSourcef(_source, AL_GAIN, _gain);
+        if (bufferCount > 0) {
+            _backend.createBuffers(bufferCount, &_buffers[0]);
+        }
+        _source = _backend.createSource();
+        _backend.setSourceGain(_source, _gain);
 
-    if (_position) {
-        alSource3f(_source, AL_POSITION, _position->x, _position->y, _position->z);
-    } else {
-        alSourcei(_source, AL_SOURCE_RELATIVE, AL_TRUE);
-    }
-    if (_streaming) {
-        for (int i = 0; i < bufferCount; ++i) {
-            auto &frame = _stream->getFrame(_nextFrame++);
-            fillBuffer(frame, _buffers[i]);
+        if (_relative) {
+            _backend.setSourceRelative(_source, true);
+        } else {
+            _backend.setSourcePosition(_source, loadPosition());
+        }
+        if (_streaming) {
+            if (time > 0.0f) {
+                skip(time);
+            }
+            int numQueued = 0;
+            while (numQueued < bufferCount && fillNextBuffer(_buffers[numQueued])) {
+                ++numQueued;
+            }
+            if (numQueued > 0) {
+                _backend.queueBuffers(_source, numQueued, &_buffers[0]);
+            }
+        } else {
+            uint32_t buffer = _stream->sharedBuffer();
+            if (!buffer) {
+                auto &frame = _stream->getFrame(0);
+                buffer = _buffers[0];
+                _backend.setBufferData(buffer, frame.format, frame.samples.data(), static_cast<int>(frame.samples.size()), frame.sampleRate);
+            }
+            _backend.setSourceBuffer(_source, buffer);
+            _backend.setSourceLooping(_source, _loop);
+            if (time > 0.0f) {
+                _backend.setSourceOffset(_source, time);
+            }
+        }
+        _pending.fetch_and(~kPendingPlayback, std::memory_order_acquire);
+        if (_playing) {
+            _backend.playSource(_source);
         }
-        alSourceQueueBuffers(_source, bufferCount, &_buffers[0]);
-    } else {
-        auto &frame = _stream->getFrame(0);
-        fillBuffer(frame, _buffers[0]);
-        alSourcei(_source, AL_BUFFER, _buffers[0]);
-        alSourcei(_source, AL_LOOPING, _loop);
+    } catch (...) {
+        // Return backend objects acquired before the failure
+        _inited = true;
+        deinit();
+        throw;
     }
 
     _inited = true;
@@ -91,16 +109,17 @@ void AudioSource::deinit() {
     if (!_inited) {
         return;
     }
-    checkMainThread();
     if (_source) {
-        alSourceStop(_source);
-        alDeleteSources(1, &_source);
+        _backend.stopSource(_source);
+        _backend.deleteSource(_source);
         _source = 0;
     }
     if (!_buffers.empty()) {
-        alDeleteBuffers(static_cast<int>(_buffers.size()), &_buffers[0]);
+        _backend.deleteBuffers(static_cast<int>(_buffers.size()), &_buffers[0]);
         _buffers.clear();
     }
+    _decoder.reset();
+    _chunk.samples.clear();
     _inited = false;
 }
 
@@ -108,49 +127,99 @@ void AudioSource::render() {
     if (!_source) {
         return;
     }
+    int pending = _pending.exchange(0, std::memory_order_acquire);
+    if (pending & kPendingPosition) {
+        _backend.setSourcePosition(_source, loadPosition());
+    }
+    if (pending & kPendingPlayback) {
+        if (_playing) {
+            _backend.playSource(_source);
+        } else {
+            _backend.stopSource(_source);
+        }
+    }
+    if (!_playing) {
+        return;
+    }
     if (!_streaming) {
-        ALint state = 0;
-        alGetSourcei(_source, AL_SOURCE_STATE, &state);
-        if (state == AL_STOPPED) {
+        if (_backend.isSourceStopped(_source)) {
             _playing = false;
         }
         return;
     }
-    ALint processed = 0;
-    alGetSourcei(_source, AL_BUFFERS_PROCESSED, &processed);
+    int processed = _backend.getProcessedBufferCount(_source);
     while (processed-- > 0) {
-        alSourceUnqueueBuffers(_source, 1, &_buffers[_nextBuffer]);
-        if (_loop && _nextFrame == _stream->getFrameCount()) {
-            _nextFrame = 0;
-        }
-        if (_nextFrame < _stream->getFrameCount()) {
-            auto &frame = _stream->getFrame(_nextFrame++);
-            fillBuffer(frame, _buffers[_nextBuffer]);
-            alSourceQueueBuffers(_source, 1, &_buffers[_nextBuffer]);
+        uint32_t buffer = 0;
+        _backend.unqueueBuffers(_source, 1, &buffer);
+        if (fillNextBuffer(buffer)) {
+            _backend.queueBuffers(_source, 1, &buffer);
         }
-        _nextBuffer = (_nextBuffer + 1) % static_cast<int>(_buffers.size());
     }
-    ALint queued = 0;
-    alGetSourcei(_source, AL_BUFFERS_QUEUED, &queued);
-    if (queued == 0) {
+    if (_backend.getQueuedBufferCount(_source) == 0) {
         _playing = false;
+    } else if (_backend.isSourceStopped(_source)) {
+        // Buffer underrun
+        _backend.playSource(_source);
     }
 }
 
-void AudioSource::play() {
-    if (!_source) {
-        return;
+void AudioSource::skip(float time) {
+    bool rewound = false;
+    while (true) {
+        _chunk.samples.clear();
+        if (!_decoder->decode(_chunk, kSkipChunkSize)) {
+            if (!_loop || rewound) {
+                return;
+            }
+            _decoder->rewind();
+            rewound = true;
+            continue;
+        }
+        int stride = _chunk.stride();
+        size_t numSamples = _chunk.samples.size() / stride;
+        size_t skipSamples = static_cast<size_t>(time * _chunk.sampleRate);
+        if (skipSamples < numSamples) {
+            // Leave the remainder of this chunk for the first buffer
+            _chunk.samples.erase(_chunk.samples.begin(), _chunk.samples.begin() + skipSamples * stride);
+            return;
+        }
+        time -= numSamples / static_cast<float>(_chunk.sampleRate);
+    }
+}
+
+bool AudioSource::fillNextBuffer(uint32_t buffer) {
+    size_t chunkSize = _chunk.samples.empty() ? kMinChunkSize : getChunkSize(_chunk, _bufferMs);
+    bool rewound = false;
+    while (_chunk.samples.size() < chunkSize) {
+        size_t size = _chunk.samples.size();
+        if (!_decoder->decode(_chunk, chunkSize - size)) {
+            if (size > 0) {
+                break;
+            }
+            if (!_loop || rewound) {
+                return false;
+            }
+            _decoder->rewind();
+            rewound = true;
+            continue;
+        }
+        if (size == 0) {
+            chunkSize = getChunkSize(_chunk, _bufferMs);
+        }
     }
-    alSourcePlay(_source);
+    _backend.setBufferData(buffer, _chunk.format, _chunk.samples.data(), static_cast<int>(_chunk.samples.size()), _chunk.sampleRate);
+    _chunk.samples.clear();
+    return true;
+}
+
+void AudioSource::play() {
     _playing = true;
+    _pending.fetch_or(kPendingPlayback, std::memory_order_release);
 }
 
 void AudioSource::stop() {
     _playing = false;
-    if (!_source) {
-        return;
-    }
-    alSourceStop(_source);
+    _pending.fetch_or(kPendingPlayback, std::memory_order_release);
 }
 
 float AudioSource::duration() const {
@@ -161,9 +230,8 @@ void AudioSource::setPosition(glm::vec3 position) {
     if (_position == position) {
         return;
     }
-    if (_source) {
-        alSource3f(_source, AL_POSITION, position.x, position.y, position.z);
-    }
+    storePosition(position);
+    _pending.fetch_or(kPendingPosition, std::memory_order_release);
     _position = std::move(position);
 }
 
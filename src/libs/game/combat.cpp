@@ -190,10 +190,7 @@ void Combat::finishRound(CombatRound &round) {
         objects.insert(action.attacker);
         objects.insert(action.target);
 
-        if (Logger::instance.isChannelEnabled(LogChannel::Combat)) {
-            auto attacker = _game.getObjectById<Creature>(action.attacker);
-            debug(str(boost::format("Finish round: %s") % attacker->tag()), LogChannel::Combat);
-        }
+        R_DEBUG(LogChannel::Combat, "Finish round: %s", _game.getObjectById<Creature>(action.attacker)->tag());
     }
 
     for (uint32_t id : objects) {
@@ -26,10 +26,22 @@ namespace game {
 static constexpr int kDefaultAbilityScore = 8;
 static constexpr int kDefaultSkillRank = 0;
 
+// Parent, left and right pointers plus color of a red-black tree node
+static constexpr size_t kTreeNodeOverhead = 4 * sizeof(void *);
+
 int CreatureAttributes::getDefense() const {
     return 10 + getAbilityModifier(Ability::Dexterity);
 }
 
+size_t CreatureAttributes::heapBytes() const {
+    size_t bytes = _classLevels.capacity() * sizeof(std::pair<CreatureClass *, int>);
+    bytes += _abilityScores.size() * (kTreeNodeOverhead + sizeof(std::pair<const Ability, int>));
+    bytes += _skillRanks.size() * (kTreeNodeOverhead + sizeof(std::pair<const SkillType, int>));
+    bytes += _feats.size() * (kTreeNodeOverhead + sizeof(FeatType));
+    bytes += _spells.size() * (kTreeNodeOverhead + sizeof(SpellType));
+    return bytes;
+}
+
 int CreatureAttributes::getAbilityScore(Ability ability) const {
     auto it = _abilityScores.find(ability);
     return it != _abilityScores.end() ? it->second : kDefaultAbilityScore;
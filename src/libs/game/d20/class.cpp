@@ -34,10 +34,6 @@ static const char kFeatTwoDAResRef[] = "feat";
 static const char kFeatGainTwoDAResRef[] = "featgain";
 static const char kPowerGainTwoDAResRef[] = "classpowergain";
 
-static bool hasColumn(const TwoDA &twoDa, const std::string &column) {
-    return std::find(twoDa.columns().begin(), twoDa.columns().end(), column) != twoDa.columns().end();
-}
-
 static std::optional<int> getLevel(const TwoDA &twoDa, int row) {
     if (auto level = twoDa.getIntOpt(row, "label")) {
         return level;
@@ -80,8 +76,9 @@ void CreatureClass::load(const TwoDA &twoDa, int row) {
 
 void CreatureClass::loadClassSkills(const std::string &skillsTable) {
     std::shared_ptr<TwoDA> skills(_twoDas.get(kSkillsTwoDAResRef));
+    auto classColumn = skills->column(skillsTable + "_class");
     for (int row = 0; row < skills->getRowCount(); ++row) {
-        if (skills->getInt(row, skillsTable + "_class") == 1) {
+        if (skills->getInt(row, classColumn) == 1) {
             _classSkills.insert(static_cast<SkillType>(row));
         }
     }
@@ -114,8 +111,11 @@ void CreatureClass::loadFeatListValues(const std::string &featsPrefix) {
     }
 
     std::shared_ptr<TwoDA> feats(_twoDas.get(kFeatTwoDAResRef));
-    std::string listColumn(featsPrefix + "_list");
-    if (!feats || !hasColumn(*feats, listColumn)) {
+    if (!feats) {
+        return;
+    }
+    auto listColumn = feats->column(featsPrefix + "_list");
+    if (!listColumn.isValid()) {
         return;
     }
 
@@ -131,8 +131,11 @@ void CreatureClass::loadFeatGains(const std::string &featGainPrefix) {
     }
 
     std::shared_ptr<TwoDA> featGain(_twoDas.get(kFeatGainTwoDAResRef));
-    std::string regularGainColumn(featGainPrefix + "_reg");
-    if (!featGain || !hasColumn(*featGain, regularGainColumn)) {
+    if (!featGain) {
+        return;
+    }
+    auto regularGainColumn = featGain->column(featGainPrefix + "_reg");
+    if (!regularGainColumn.isValid()) {
         return;
     }
 
@@ -150,14 +153,18 @@ void CreatureClass::loadPowerGains(const std::string &powerGainPrefix) {
     }
 
     std::shared_ptr<TwoDA> powerGain(_twoDas.get(kPowerGainTwoDAResRef));
-    if (!powerGain || !hasColumn(*powerGain, powerGainPrefix)) {
+    if (!powerGain) {
+        return;
+    }
+    auto gainColumn = powerGain->column(powerGainPrefix);
+    if (!gainColumn.isValid()) {
         return;
     }
 
     for (int row = 0; row < powerGain->getRowCount(); ++row) {
         auto level = getLevel(*powerGain, row);
         if (level) {
-            _powerGainsByLevel.insert(std::make_pair(*level, powerGain->getInt(row, powerGainPrefix, 0)));
+            _powerGainsByLevel.insert(std::make_pair(*level, powerGain->getInt(row, gainColumn, 0)));
         }
     }
 }
@@ -89,6 +89,7 @@
 #include "reone/system/logutil.h"
 #include "reone/system/smallset.h"
 #include "reone/system/threadutil.h"
+#include "reone/system/trace.h"
 
 using namespace reone::audio;
 using namespace reone::graphics;
@@ -230,7 +231,9 @@ void Game::init() {
     _moduleNames = _services.resource.director.moduleNames();
     _saveNames = _services.resource.director.saveNames();
 
-    playVideo("legal");
+    if (!_options.graphics.headless) {
+        playVideo("legal");
+    }
     openMainMenu();
 }
 
@@ -405,12 +408,19 @@ void Game::update(float frameTime) {
 
     bool updModule = !_movie && _module && (_screen == Screen::InGame || _screen == Screen::Conversation);
     if (updModule && !_paused) {
-        _module->update(dt);
-        _combat.update(dt);
+        {
+            R_TRACE_ZONE("module update");
+            _module->update(dt);
+        }
+        {
+            R_TRACE_ZONE("combat update");
+            _combat.update(dt);
+        }
     }
 
     auto gui = getScreenGUI();
     if (gui) {
+        R_TRACE_ZONE("gui update");
         gui->update(dt);
     }
     updateSceneGraph(dt);
@@ -420,6 +430,9 @@ void Game::update(float frameTime) {
 }
 
 void Game::render() {
+    if (_options.graphics.headless) {
+        return;
+    }
     if (_movie) {
         _movie->render();
     } else {
@@ -580,6 +593,7 @@ void Game::loadModule(const std::string &name, std::string entry, bool fromSave)
                 _hud->resetStatusSummaryPresentation();
             }
 
+            clearBlueprints();
             _services.resource.director.onModuleLoad(name);
 
             if (_loadScreen) {
@@ -634,6 +648,24 @@ void Game::loadModule(const std::string &name, std::string entry, bool fromSave)
     });
 }
 
+void Game::clearBlueprints() {
+    auto stats = _itemBlueprints.stats();
+    debug(str(boost::format("Item blueprints: %d templates, %d parses, %d hits, %d stacked, %d copies, %d bytes resident") %
+              stats.numTemplates % stats.numParses % stats.numHits % stats.numStacked % stats.numCopies % stats.residentBytes),
+          LogChannel::Resources);
+    auto creatureStats = _creatureBlueprints.stats();
+    debug(str(boost::format("Creature blueprints: %d templates, %d parses, %d hits, %d bytes resident") %
+              creatureStats.numTemplates % creatureStats.numParses % creatureStats.numHits % creatureStats.residentBytes),
+          LogChannel::Resources);
+    auto placeableStats = _placeableBlueprints.stats();
+    debug(str(boost::format("Placeable blueprints: %d templates, %d parses, %d hits, %d bytes resident") %
+              placeableStats.numTemplates % placeableStats.numParses % placeableStats.numHits % placeableStats.residentBytes),
+          LogChannel::Resources);
+    _itemBlueprints.clear();
+    _creatureBlueprints.clear();
+    _placeableBlueprints.clear();
+}
+
 void Game::resetGame() {
     if (_swoopRace.isActive()) {
         _swoopRace.stop();
@@ -691,6 +723,7 @@ void Game::loadGame(std::string_view name) {
     // Add module files to resource resolution. Since all savegame files are
     // already in scope, this is going to resolve to the last module from the
     // save game.
+    clearBlueprints();
     _services.resource.director.onModuleLoad(nfo.lastModule);
 
     // Deserialize global variables
@@ -1467,6 +1500,7 @@ void Game::updateCamera(float dt) {
         } else {
             listenerPosition = camera->sceneNode()->origin();
         }
+        _services.audio.mixer.setListenerPosition(listenerPosition);
         _services.audio.context.setListenerPosition(std::move(listenerPosition));
     }
 }
@@ -288,7 +288,7 @@ void Conversation::loadVoiceOver() {
     if (!voiceResRef.empty()) {
         auto clip = _services.resource.audioClips.get(voiceResRef);
         if (clip) {
-            _currentVoice = _services.audio.mixer.play(std::move(clip), AudioType::Voice);
+            _currentVoice = _services.audio.mixer.play(std::move(clip), AudioType::Voice, 1.0f, false, std::nullopt, AudioPriority::High);
         }
     }
 }
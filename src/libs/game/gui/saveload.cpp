@@ -21,7 +21,7 @@
 #include "reone/graphics/format/tgareader.h"
 #include "reone/resource/container/erf.h"
 #include "reone/resource/format/erfreader.h"
-#include "reone/resource/format/gffreader.h"
+#include "reone/resource/gffview.h"
 #include "reone/resource/strings.h"
 #include "reone/system/logutil.h"
 #include "reone/system/stream/memoryinput.h"
@@ -167,10 +167,9 @@ void SaveLoad::refreshSavedGames() {
 static SavedGame peekSavedGame(const std::filesystem::path &path) {
     auto erfResourceContainer = ErfResourceContainer(path);
 
+    // Only a few fields of NFO are needed, so read them in place
     auto nfoData = erfResourceContainer.findResourceData(ResourceId("savenfo", ResType::Res));
-    auto nfoStream = MemoryInputStream(*nfoData);
-    GffReader nfo(nfoStream);
-    nfo.load();
+    auto nfo = GffView::load(std::make_shared<ByteBuffer>(std::move(*nfoData)));
 
     std::shared_ptr<Texture> screen;
     auto screenData = erfResourceContainer.findResourceData(ResourceId("screen", ResType::Tga));
@@ -183,7 +182,7 @@ static SavedGame peekSavedGame(const std::filesystem::path &path) {
 
     SavedGame result;
     result.screen = std::move(screen);
-    result.lastModule = nfo.root()->getString("LastModule");
+    result.lastModule = nfo.getString("LastModule");
 
     return result;
 }
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/itemblueprints.h"
+
+#include "reone/game/di/services.h"
+#include "reone/graphics/texture.h"
+#include "reone/resource/2da.h"
+#include "reone/resource/di/services.h"
+#include "reone/resource/gff.h"
+#include "reone/resource/provider/2das.h"
+#include "reone/resource/provider/audioclips.h"
+#include "reone/resource/provider/gffs.h"
+#include "reone/resource/provider/models.h"
+#include "reone/resource/provider/textures.h"
+
+using namespace reone::graphics;
+using namespace reone::resource;
+
+namespace reone {
+
+namespace game {
+
+static const std::set<std::string_view> kBlueprintFieldLabels {
+    "LocalizedName",
+    "Description",
+    "DescIdentified",
+    "ModelVariation",
+    "TextureVar",
+    "BodyVariation",
+    "BaseItem"};
+
+size_t ItemBlueprint::residentBytes() const {
+    size_t bytes = sizeof(ItemBlueprint);
+    bytes += localizedName.str().capacity();
+    bytes += description.str().capacity();
+    bytes += descIdentified.str().capacity();
+    bytes += baseBodyVariation.capacity();
+    bytes += itemClass.capacity();
+    bytes += properties.capacity() * sizeof(ItemPropertyEntry);
+    if (ammunitionType) {
+        bytes += sizeof(ItemAmmunitionType);
+    }
+    return bytes;
+}
+
+const std::shared_ptr<const ItemBlueprint> &ItemBlueprint::defaultInstance() {
+    static const std::shared_ptr<const ItemBlueprint> instance = std::make_shared<ItemBlueprint>();
+    return instance;
+}
+
+ItemBlueprints::ItemBlueprints(ServicesView &services) :
+    _services(services),
+    _templates(ResType::Uti, services.resource.gffs) {
+}
+
+void ItemBlueprints::clear() {
+    _stacked.clear();
+    _templates.clear();
+    _empty.reset();
+    _numStackedHits = 0;
+    _numCopies = 0;
+}
+
+std::shared_ptr<const ItemTemplate> ItemBlueprints::get(const std::string &resRef) {
+    return _templates.get(resRef, [this](auto &uti, auto &blueprint) {
+        deserialize(uti, blueprint);
+    });
+}
+
+std::shared_ptr<const ItemBlueprint> ItemBlueprints::stack(const std::shared_ptr<const ItemBlueprint> &base, const ItemTemplate &tmpl) {
+    if (base == ItemBlueprint::defaultInstance()) {
+        return tmpl.blueprint;
+    }
+    auto key = StackedKey {base.get(), &tmpl};
+    auto maybeStacked = _stacked.find(key);
+    if (maybeStacked != _stacked.end()) {
+        ++_numStackedHits;
+        return maybeStacked->second.blueprint;
+    }
+    auto blueprint = std::make_shared<ItemBlueprint>(*base);
+    deserialize(*tmpl.gff, *blueprint);
+    _stacked.insert({key, StackedValue {base, blueprint}});
+    return blueprint;
+}
+
+std::shared_ptr<const ItemBlueprint> ItemBlueprints::empty() {
+    if (!_empty) {
+        auto blueprint = std::make_shared<ItemBlueprint>();
+        loadAmmunitionType(*blueprint);
+        _empty = std::move(blueprint);
+    }
+    return _empty;
+}
+
+std::shared_ptr<ItemBlueprint> ItemBlueprints::copy(const ItemBlueprint &blueprint) {
+    ++_numCopies;
+    return std::make_shared<ItemBlueprint>(blueprint);
+}
+
+ItemBlueprints::Stats ItemBlueprints::stats() const {
+    auto templateStats = _templates.stats();
+    Stats stats;
+    stats.numTemplates = templateStats.numTemplates;
+    stats.numParses = templateStats.numParses;
+    stats.numHits = templateStats.numHits + _numStackedHits;
+    stats.numStacked = _stacked.size();
+    stats.numCopies = _numCopies;
+    stats.residentBytes = templateStats.residentBytes;
+    for (auto &[key, stacked] : _stacked) {
+        stats.residentBytes += stacked.blueprint->residentBytes();
+    }
+    return stats;
+}
+
+bool ItemBlueprints::hasBlueprintFields(const Gff &gff) {
+    for (auto &field : gff.fields()) {
+        if (field.type == Gff::FieldType::List) {
+            if (field.label() == "PropertiesList" && !field.children.empty()) {
+                return true;
+            }
+            continue;
+        }
+        if (kBlueprintFieldLabels.count(field.label()) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ItemBlueprints::deserialize(const Gff &gff, ItemBlueprint &blueprint) {
+    gff.readLocString(blueprint.localizedName, "LocalizedName", _services.resource.strings);
+    gff.readLocString(blueprint.description, "Description", _services.resource.strings);
+    gff.readLocString(blueprint.descIdentified, "DescIdentified", _services.resource.strings);
+
+    gff.readByte(blueprint.modelVariation, "ModelVariation");
+    gff.readByte(blueprint.textureVariation, "TextureVar");
+    gff.readByte(blueprint.bodyVariation, "BodyVariation");
+
+    deserializeProperties(gff, blueprint);
+    deserializeBase(gff, blueprint);
+
+    loadAmmunitionType(blueprint);
+}
+
+void ItemBlueprints::deserializeProperties(const Gff &gff, ItemBlueprint &blueprint) {
+    for (const auto &prop : gff.getList("PropertiesList")) {
+        ItemPropertyEntry entry;
+        prop->readByte(entry.chanceAppear, "ChanceAppear");
+        prop->readByte(entry.costTable, "CostTable");
+        prop->readWord(entry.costValue, "CostValue");
+        prop->readByte(entry.paramTable, "Param1");
+        prop->readByte(entry.paramValue, "Param1Value");
+        prop->readWord(entry.subtype, "Subtype");
+        prop->readByte(entry.upgradeType, "UpgradeType");
+
+        if (prop->readWord(entry.propertyName, "PropertyName")) {
+            switch (static_cast<ItemProperty>(entry.propertyName)) {
+            case ItemProperty::ActivateItem:
+                blueprint.activateSpell = static_cast<SpellType>(entry.subtype);
+                break;
+            case ItemProperty::Disguise:
+                blueprint.disguiseAppearance = entry.subtype;
+                break;
+            default:
+                break;
+            }
+        }
+
+        blueprint.properties.push_back(entry);
+    }
+}
+
+void ItemBlueprints::deserializeBase(const Gff &gff, ItemBlueprint &blueprint) {
+    if (!gff.readInt(blueprint.baseItem, "BaseItem")) {
+        return;
+    }
+
+    std::shared_ptr<TwoDA> baseItems(_services.resource.twoDas.get("baseitems"));
+    if (!baseItems) {
+        return;
+    }
+    int baseItem = blueprint.baseItem;
+    blueprint.attackRange = baseItems->getInt(baseItem, "maxattackrange");
+    blueprint.criticalHitMultiplier = baseItems->getInt(baseItem, "crithitmult");
+    blueprint.criticalThreat = baseItems->getInt(baseItem, "critthreat");
+    blueprint.damageFlags = baseItems->getInt(baseItem, "damageflags");
+    blueprint.dieToRoll = baseItems->getInt(baseItem, "dietoroll");
+    blueprint.equipableSlots = baseItems->getHexInt(baseItem, "equipableslots", 0);
+    blueprint.itemClass = boost::to_lower_copy(baseItems->getString(baseItem, "itemclass"));
+    blueprint.numDice = baseItems->getInt(baseItem, "numdice");
+    blueprint.weaponType = static_cast<WeaponType>(baseItems->getInt(baseItem, "weapontype"));
+    blueprint.weaponWield = static_cast<WeaponWield>(baseItems->getInt(baseItem, "weaponwield"));
+
+    std::string iconResRef;
+    if (blueprint.isEquippable(InventorySlots::body)) {
+        blueprint.baseBodyVariation = boost::to_lower_copy(baseItems->getString(baseItem, "bodyvar"));
+        iconResRef = str(boost::format("i%s_%03d") % blueprint.itemClass % (int)blueprint.textureVariation);
+    } else if (blueprint.isEquippable(InventorySlots::rightWeapon)) {
+        iconResRef = str(boost::format("i%s_%03d") % blueprint.itemClass % (int)blueprint.modelVariation);
+    } else {
+        iconResRef = str(boost::format("i%s_%03d") % blueprint.itemClass % (int)blueprint.modelVariation);
+    }
+    blueprint.icon = _services.resource.textures.get(iconResRef, TextureUsage::GUI);
+    if (!blueprint.icon && blueprint.isEquippable(InventorySlots::body)) {
+        // Some body items (e.g. disguises) key the inventory icon on ModelVariation
+        // rather than TextureVar; fall back to it when the primary icon is missing.
+        iconResRef = str(boost::format("i%s_%03d") % blueprint.itemClass % (int)blueprint.modelVariation);
+        blueprint.icon = _services.resource.textures.get(iconResRef, TextureUsage::GUI);
+    }
+}
+
+void ItemBlueprints::loadAmmunitionType(ItemBlueprint &blueprint) {
+    std::shared_ptr<TwoDA> baseItems(_services.resource.twoDas.get("baseitems"));
+
+    int ammunitionIdx = baseItems->getInt(blueprint.baseItem, "ammunitiontype", -1);
+    if (ammunitionIdx != -1) {
+        std::shared_ptr<TwoDA> twoDa(_services.resource.twoDas.get("ammunitiontypes"));
+        auto ammunitionType = std::make_shared<ItemAmmunitionType>();
+        ammunitionType->model = _services.resource.models.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "model")));
+        ammunitionType->muzzleFlash = _services.resource.models.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "muzzleflash")));
+        ammunitionType->shotSound1 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "shotsound0")));
+        ammunitionType->shotSound2 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "shotsound1")));
+        ammunitionType->impactSound1 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "impactsound0")));
+        ammunitionType->impactSound2 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "impactsound1")));
+        blueprint.ammunitionType = std::move(ammunitionType);
+    }
+}
+
+} // namespace game
+
+} // namespace reone
@@ -31,49 +31,77 @@ namespace reone {
 
 namespace game {
 
+// Field labels shared by object blueprints and GIT instances, interned once
+namespace labels {
+
+static const resource::GffLabel Tag {"Tag"};
+static const resource::GffLabel TemplateResRef {"TemplateResRef"};
+static const resource::GffLabel Conversation {"Conversation"};
+static const resource::GffLabel ScriptHeartbeat {"ScriptHeartbeat"};
+static const resource::GffLabel ScriptUserDefine {"ScriptUserDefine"};
+static const resource::GffLabel Min1HP {"Min1HP"};
+static const resource::GffLabel Plot {"Plot"};
+static const resource::GffLabel Commandable {"Commandable"};
+static const resource::GffLabel Interruptable {"Interruptable"};
+static const resource::GffLabel HitPoints {"HitPoints"};
+static const resource::GffLabel MaxHitPoints {"MaxHitPoints"};
+static const resource::GffLabel CurrentHitPoints {"CurrentHitPoints"};
+static const resource::GffLabel X {"X"};
+static const resource::GffLabel XPosition {"XPosition"};
+static const resource::GffLabel Y {"Y"};
+static const resource::GffLabel YPosition {"YPosition"};
+static const resource::GffLabel Z {"Z"};
+static const resource::GffLabel ZPosition {"ZPosition"};
+static const resource::GffLabel XOrientation {"XOrientation"};
+static const resource::GffLabel YOrientation {"YOrientation"};
+static const resource::GffLabel Bearing {"Bearing"};
+static const resource::GffLabel ItemList {"ItemList"};
+
+} // namespace labels
+
 static constexpr float kKeepPathDuration = 1000.0f;
 static constexpr float kDefaultMaxObjectDistance = 2.0f;
 static constexpr float kMaxConversationDistance = 4.0f;
 static constexpr float kDistanceWalk = 4.0f;
 
 void Object::deserialize(const resource::Gff &gff) {
-    if (gff.readString(_tag, "Tag")) {
+    if (gff.readString(_tag, labels::Tag)) {
         boost::to_lower(_tag);
     }
 
     // FIXME: not all of these properties are shared by all object subclasses.
-    gff.readResRef(_blueprintResRef, "TemplateResRef");
-    gff.readResRef(_conversation, "Conversation");
-    gff.readResRef(_onHeartbeat, "ScriptHeartbeat");
-    gff.readResRef(_onUserDefined, "ScriptUserDefine");
-    gff.readBool(_minOneHP, "Min1HP");
-    gff.readBool(_plot, "Plot");
-    gff.readBool(_commandable, "Commandable");
-    gff.readBool(_interruptable, "Interruptable");
-    gff.readShort(_hitPoints, "HitPoints");
-    gff.readShort(_maxHitPoints, "MaxHitPoints");
-    gff.readShort(_currentHitPoints, "CurrentHitPoints");
-
-    gff.readFloat(_position[0], "X");
-    gff.readFloat(_position[0], "XPosition");
-    gff.readFloat(_position[1], "Y");
-    gff.readFloat(_position[1], "YPosition");
-    gff.readFloat(_position[2], "Z");
-    gff.readFloat(_position[2], "ZPosition");
+    gff.readResRef(_blueprintResRef, labels::TemplateResRef);
+    gff.readResRef(_conversation, labels::Conversation);
+    gff.readResRef(_onHeartbeat, labels::ScriptHeartbeat);
+    gff.readResRef(_onUserDefined, labels::ScriptUserDefine);
+    gff.readBool(_minOneHP, labels::Min1HP);
+    gff.readBool(_plot, labels::Plot);
+    gff.readBool(_commandable, labels::Commandable);
+    gff.readBool(_interruptable, labels::Interruptable);
+    gff.readShort(_hitPoints, labels::HitPoints);
+    gff.readShort(_maxHitPoints, labels::MaxHitPoints);
+    gff.readShort(_currentHitPoints, labels::CurrentHitPoints);
+
+    gff.readFloat(_position[0], labels::X);
+    gff.readFloat(_position[0], labels::XPosition);
+    gff.readFloat(_position[1], labels::Y);
+    gff.readFloat(_position[1], labels::YPosition);
+    gff.readFloat(_position[2], labels::Z);
+    gff.readFloat(_position[2], labels::ZPosition);
 
     {
         float cosine, sine;
-        if (gff.readFloat(cosine, "XOrientation") && gff.readFloat(sine, "YOrientation")) {
+        if (gff.readFloat(cosine, labels::XOrientation) && gff.readFloat(sine, labels::YOrientation)) {
             _orientation = glm::quat(glm::vec3(0.0f, 0.0f, -glm::atan(cosine, sine)));
         }
 
         float bearing;
-        if (gff.readFloat(bearing, "Bearing")) {
+        if (gff.readFloat(bearing, labels::Bearing)) {
             _orientation = glm::quat(glm::vec3(0.0f, 0.0f, bearing));
         }
     }
 
-    for (const auto &itemGff : gff.getList("ItemList")) {
+    for (const auto &itemGff : gff.getList(labels::ItemList)) {
         std::shared_ptr<Item> item = _game.newItem();
         item->deserialize(*itemGff);
         addItem(item);
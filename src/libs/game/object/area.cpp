@@ -70,6 +70,21 @@ namespace reone {
 
 namespace game {
 
+// GIT field labels, interned once
+namespace labels {
+
+static const GffLabel Creature_List {"Creature List"};
+static const GffLabel Door_List {"Door List"};
+static const GffLabel Placeable_List {"Placeable List"};
+static const GffLabel WaypointList {"WaypointList"};
+static const GffLabel TriggerList {"TriggerList"};
+static const GffLabel SoundList {"SoundList"};
+static const GffLabel CameraList {"CameraList"};
+static const GffLabel Encounter_List {"Encounter List"};
+static const GffLabel StoreList {"StoreList"};
+
+} // namespace labels
+
 static constexpr float kDefaultFieldOfView = 75.0f;
 static constexpr float kUpdatePerceptionInterval = 1.0f; // seconds
 static constexpr float kLineOfSightHeight = 1.7f;        // TODO: make it appearance-based
@@ -323,7 +338,7 @@ void Area::loadProperties(const resource::generated::GIT &git) {
 }
 
 void Area::loadCreatures(const resource::Gff &gff) {
-    for (const auto &creatureGff : gff.getList("Creature List")) {
+    for (const auto &creatureGff : gff.getList(labels::Creature_List)) {
         std::shared_ptr<Creature> creature = _game.newCreature(_sceneName);
         creature->deserialize(*creatureGff);
         landObject(*creature);
@@ -332,7 +347,7 @@ void Area::loadCreatures(const resource::Gff &gff) {
 }
 
 void Area::loadDoors(const resource::Gff &gff) {
-    for (auto &doorGff : gff.getList("Door List")) {
+    for (auto &doorGff : gff.getList(labels::Door_List)) {
         std::shared_ptr<Door> door = _game.newDoor(_sceneName);
         door->deserialize(*doorGff);
         add(door);
@@ -340,7 +355,7 @@ void Area::loadDoors(const resource::Gff &gff) {
 }
 
 void Area::loadPlaceables(const resource::Gff &gff) {
-    for (auto &placeableGff : gff.getList("Placeable List")) {
+    for (auto &placeableGff : gff.getList(labels::Placeable_List)) {
         std::shared_ptr<Placeable> placeable = _game.newPlaceable(_sceneName);
         placeable->deserialize(*placeableGff);
         add(placeable);
@@ -348,7 +363,7 @@ void Area::loadPlaceables(const resource::Gff &gff) {
 }
 
 void Area::loadWaypoints(const resource::Gff &gff) {
-    for (auto &waypointGff : gff.getList("WaypointList")) {
+    for (auto &waypointGff : gff.getList(labels::WaypointList)) {
         std::shared_ptr<Waypoint> waypoint = _game.newWaypoint(_sceneName);
         waypoint->deserialize(*waypointGff);
         add(waypoint);
@@ -356,7 +371,7 @@ void Area::loadWaypoints(const resource::Gff &gff) {
 }
 
 void Area::loadTriggers(const resource::Gff &gff) {
-    for (auto &triggerGff : gff.getList("TriggerList")) {
+    for (auto &triggerGff : gff.getList(labels::TriggerList)) {
         std::shared_ptr<Trigger> trigger = _game.newTrigger(_sceneName);
         trigger->deserialize(*triggerGff);
         add(trigger);
@@ -364,7 +379,7 @@ void Area::loadTriggers(const resource::Gff &gff) {
 }
 
 void Area::loadSounds(const resource::Gff &gff) {
-    for (auto &soundGff : gff.getList("SoundList")) {
+    for (auto &soundGff : gff.getList(labels::SoundList)) {
         std::shared_ptr<Sound> sound = _game.newSound(_sceneName);
         sound->deserialize(*soundGff);
         add(sound);
@@ -372,7 +387,7 @@ void Area::loadSounds(const resource::Gff &gff) {
 }
 
 void Area::loadCameras(const resource::Gff &gff) {
-    for (auto &cameraGff : gff.getList("CameraList")) {
+    for (auto &cameraGff : gff.getList(labels::CameraList)) {
         std::shared_ptr<StaticCamera> camera = _game.newStaticCamera(_cameraAspect, _sceneName);
         camera->deserialize(*cameraGff);
         add(camera);
@@ -380,7 +395,7 @@ void Area::loadCameras(const resource::Gff &gff) {
 }
 
 void Area::loadEncounters(const resource::Gff &gff) {
-    for (auto &encounterGff : gff.getList("Encounter List")) {
+    for (auto &encounterGff : gff.getList(labels::Encounter_List)) {
         std::shared_ptr<Encounter> encounter = _game.newEncounter(_sceneName);
         encounter->deserialize(*encounterGff);
         add(encounter);
@@ -388,7 +403,7 @@ void Area::loadEncounters(const resource::Gff &gff) {
 }
 
 void Area::loadStores(const resource::Gff &gff) {
-    for (auto &storeGff : gff.getList("StoreList")) {
+    for (auto &storeGff : gff.getList(labels::StoreList)) {
         std::shared_ptr<Store> store = _game.newStore(_sceneName);
         store->deserialize(*storeGff);
         add(store);
@@ -1413,12 +1428,12 @@ void Area::doUpdatePerception() {
             }
 
             if (wasHeard != heard) {
-                debug(str(boost::format("%s %s %s") % other->tag() % (heard ? "heard by" : "inaudible by") % creature->tag()), LogChannel::Perception);
+                R_DEBUG(LogChannel::Perception, "%s %s %s", other->tag(), heard ? "heard by" : "inaudible by", creature->tag());
                 creature->setObjectHeard(other, heard);
             }
 
             if (wasSeen != seen) {
-                debug(str(boost::format("%s %s %s") % other->tag() % (seen ? "seen by" : "vanished from") % creature->tag()), LogChannel::Perception);
+                R_DEBUG(LogChannel::Perception, "%s %s %s", other->tag(), seen ? "seen by" : "vanished from", creature->tag());
                 creature->setObjectSeen(other, seen);
             }
 
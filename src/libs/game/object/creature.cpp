@@ -63,6 +63,70 @@ namespace reone {
 
 namespace game {
 
+// UTC field labels, interned once
+namespace labels {
+
+static const GffLabel TemplateResRef {"TemplateResRef"};
+static const GffLabel Race {"Race"};
+static const GffLabel SubraceIndex {"SubraceIndex"};
+static const GffLabel Appearance_Type {"Appearance_Type"};
+static const GffLabel PM_IsDisguised {"PM_IsDisguised"};
+static const GffLabel PM_Appearance {"PM_Appearance"};
+static const GffLabel Gender {"Gender"};
+static const GffLabel PortraitId {"PortraitId"};
+static const GffLabel IsPC {"IsPC"};
+static const GffLabel FactionID {"FactionID"};
+static const GffLabel Disarmable {"Disarmable"};
+static const GffLabel NoPermDeath {"NoPermDeath"};
+static const GffLabel NotReorienting {"NotReorienting"};
+static const GffLabel BodyVariation {"BodyVariation"};
+static const GffLabel TextureVar {"TextureVar"};
+static const GffLabel PartyInteract {"PartyInteract"};
+static const GffLabel WalkRate {"WalkRate"};
+static const GffLabel NaturalAC {"NaturalAC"};
+static const GffLabel ForcePoints {"ForcePoints"};
+static const GffLabel CurrentForce {"CurrentForce"};
+static const GffLabel refbonus {"refbonus"};
+static const GffLabel willbonus {"willbonus"};
+static const GffLabel fortbonus {"fortbonus"};
+static const GffLabel GoodEvil {"GoodEvil"};
+static const GffLabel ChallengeRating {"ChallengeRating"};
+static const GffLabel Experience {"Experience"};
+static const GffLabel ScriptOnNotice {"ScriptOnNotice"};
+static const GffLabel ScriptSpellAt {"ScriptSpellAt"};
+static const GffLabel ScriptAttacked {"ScriptAttacked"};
+static const GffLabel ScriptDamaged {"ScriptDamaged"};
+static const GffLabel ScriptDisturbed {"ScriptDisturbed"};
+static const GffLabel ScriptEndRound {"ScriptEndRound"};
+static const GffLabel ScriptEndDialogu {"ScriptEndDialogu"};
+static const GffLabel ScriptDialogue {"ScriptDialogue"};
+static const GffLabel ScriptSpawn {"ScriptSpawn"};
+static const GffLabel ScriptDeath {"ScriptDeath"};
+static const GffLabel ScriptOnBlocked {"ScriptOnBlocked"};
+static const GffLabel FirstName {"FirstName"};
+static const GffLabel LastName {"LastName"};
+static const GffLabel SoundSetFile {"SoundSetFile"};
+static const GffLabel BodyBag {"BodyBag"};
+static const GffLabel Str {"Str"};
+static const GffLabel Dex {"Dex"};
+static const GffLabel Con {"Con"};
+static const GffLabel Int {"Int"};
+static const GffLabel Wis {"Wis"};
+static const GffLabel Cha {"Cha"};
+static const GffLabel ClassList {"ClassList"};
+static const GffLabel SkillList {"SkillList"};
+static const GffLabel Rank {"Rank"};
+static const GffLabel FeatList {"FeatList"};
+static const GffLabel Feat {"Feat"};
+static const GffLabel Class {"Class"};
+static const GffLabel ClassLevel {"ClassLevel"};
+static const GffLabel KnownList0 {"KnownList0"};
+static const GffLabel Spell {"Spell"};
+static const GffLabel PerceptionRange {"PerceptionRange"};
+static const GffLabel Equip_ItemList {"Equip_ItemList"};
+
+} // namespace labels
+
 static constexpr int kStrRefRemains = 38151;
 static constexpr float kKeepPathDuration = 1000.0f;
 
@@ -91,10 +155,8 @@ Creature::Creature(
     ServicesView &services) :
     Object(id, ObjectType::Creature, std::move(sceneName), game, services) {
 
-    // Workaround: the original engine does not retain perception range in
-    // savegames. Set default ranges to match PercepRngDefault from ranges.2da.
-    _perception.sightRange = 20.0f;
-    _perception.hearingRange = 20.0f;
+    _perception.sightRange = kDefaultPerceptionRange;
+    _perception.hearingRange = kDefaultPerceptionRange;
 }
 
 void Creature::Path::selectNextPoint() {
@@ -105,14 +167,12 @@ void Creature::Path::selectNextPoint() {
 }
 
 void Creature::loadFromBlueprint(const std::string &resRef) {
-    auto utc = _services.resource.gffs.get(resRef, ResType::Utc);
-    if (!utc) {
-        return;
-    }
     // A blueprint is a single source, so deserialize it once. Routing through
     // deserialize() would re-read the self-referential TemplateResRef and
     // deserialize the same data twice, doubling accumulated class levels.
-    deserializeAll(*utc);
+    if (!deserializeTemplate(resRef)) {
+        return;
+    }
     updateTransform();
     loadAppearance();
 }
@@ -843,7 +903,8 @@ void Creature::onEventSignalled(const std::string &name) {
             AudioType::Sound,
             1.0f,
             false,
-            _position);
+            _position,
+            AudioPriority::Low);
     }
 }
 
@@ -1394,10 +1455,8 @@ std::string Creature::getWeaponModelName(int slot) const {
 
 void Creature::deserialize(const resource::Gff &gff) {
     std::string templateRes;
-    if (gff.readResRef(templateRes, "TemplateResRef")) {
-        if (auto utc = _services.resource.gffs.get(templateRes, ResType::Utc)) {
-            deserializeAll(*utc);
-        }
+    if (gff.readResRef(templateRes, labels::TemplateResRef)) {
+        deserializeTemplate(templateRes);
     }
     deserializeAll(gff);
 
@@ -1405,17 +1464,40 @@ void Creature::deserialize(const resource::Gff &gff) {
     loadAppearance();
 }
 
+bool Creature::deserializeTemplate(const std::string &resRef) {
+    auto tmpl = _game.creatureBlueprints().get(resRef, [this](auto &utc, auto &blueprint) {
+        deserializeBlueprint(utc, blueprint);
+    });
+    if (!tmpl) {
+        return false;
+    }
+    deserializeFields(*tmpl->gff);
+    applyBlueprint(*tmpl->blueprint);
+    deserializeEquipItems(*tmpl->gff);
+    return true;
+}
+
 void Creature::deserializeAll(const resource::Gff &gff) {
+    deserializeFields(gff);
+
+    auto blueprint = captureBlueprint();
+    deserializeBlueprint(gff, blueprint);
+    applyBlueprint(blueprint);
+
+    deserializeEquipItems(gff);
+}
+
+void Creature::deserializeFields(const resource::Gff &gff) {
     Object::deserialize(gff);
 
     // index into racialtypes.2da
-    gff.readEnum(_race, "Race");
+    gff.readEnum(_race, labels::Race);
 
     // index into subrace.2da
-    gff.readEnum(_subrace, "SubraceIndex");
+    gff.readEnum(_subrace, labels::SubraceIndex);
 
     // index into appearance.2da
-    gff.readEnum(_appearance, "Appearance_Type");
+    gff.readEnum(_appearance, labels::Appearance_Type);
 
     // Savegames keep the visible disguise appearance in Appearance_Type and
     // the normal appearance separately. Restore this before equipped items
@@ -1424,79 +1506,113 @@ void Creature::deserializeAll(const resource::Gff &gff) {
     _appearanceBeforeDisguise = 0;
     bool disguised;
     uint16_t appearanceBeforeDisguise;
-    if (gff.readBool(disguised, "PM_IsDisguised") &&
+    if (gff.readBool(disguised, labels::PM_IsDisguised) &&
         disguised &&
-        gff.readWord(appearanceBeforeDisguise, "PM_Appearance")) {
+        gff.readWord(appearanceBeforeDisguise, labels::PM_Appearance)) {
         _disguised = true;
         _appearanceBeforeDisguise = appearanceBeforeDisguise;
     }
 
     // in dex into gender.2da
-    gff.readEnum(_gender, "Gender");
+    gff.readEnum(_gender, labels::Gender);
 
     // index into portrait.2da
-    gff.readWord(_portraitId, "PortraitId");
+    gff.readWord(_portraitId, labels::PortraitId);
 
-    gff.readBool(_isPC, "IsPC");
+    gff.readBool(_isPC, labels::IsPC);
 
     // index into repute.2da
-    gff.readEnum(_faction, "FactionID");
+    gff.readEnum(_faction, labels::FactionID);
 
-    gff.readBool(_disarmable, "Disarmable");
-    gff.readBool(_noPermDeath, "NoPermDeath");
-    gff.readBool(_notReorienting, "NotReorienting");
-    gff.readByte(_bodyVariation, "BodyVariation");
-    gff.readByte(_textureVar, "TextureVar");
-    gff.readBool(_partyInteract, "PartyInteract");
+    gff.readBool(_disarmable, labels::Disarmable);
+    gff.readBool(_noPermDeath, labels::NoPermDeath);
+    gff.readBool(_notReorienting, labels::NotReorienting);
+    gff.readByte(_bodyVariation, labels::BodyVariation);
+    gff.readByte(_textureVar, labels::TextureVar);
+    gff.readBool(_partyInteract, labels::PartyInteract);
 
     // index into creaturespeed.2da
-    gff.readInt(_walkRate, "WalkRate");
-
-    gff.readByte(_naturalAC, "NaturalAC");
-    gff.readShort(_forcePoints, "ForcePoints");
-    gff.readShort(_currentForce, "CurrentForce");
-    gff.readShort(_refBonus, "refbonus");
-    gff.readShort(_willBonus, "willbonus");
-    gff.readShort(_fortBonus, "fortbonus");
-    gff.readByte(_goodEvil, "GoodEvil");
-    gff.readFloat(_challengeRating, "ChallengeRating");
-    gff.readDword(_xp, "Experience");
-
-    gff.readResRef(_onNotice, "ScriptOnNotice");
-    gff.readResRef(_onSpellAt, "ScriptSpellAt");
-    gff.readResRef(_onAttacked, "ScriptAttacked");
-    gff.readResRef(_onDamaged, "ScriptDamaged");
-    gff.readResRef(_onDisturbed, "ScriptDisturbed");
-    gff.readResRef(_onEndRound, "ScriptEndRound");
-    gff.readResRef(_onEndDialogue, "ScriptEndDialogu");
-    gff.readResRef(_onDialogue, "ScriptDialogue");
-    gff.readResRef(_onSpawn, "ScriptSpawn");
-    gff.readResRef(_onDeath, "ScriptDeath");
-    gff.readResRef(_onBlocked, "ScriptOnBlocked");
-
-    deserializeName(gff);
-    deserializeSoundSet(gff);
-    deserializeBodyBag(gff);
-    deserializeAttributes(gff);
-    deserializePerception(gff);
-    deserializeEquipItems(gff);
-}
-
-void Creature::deserializeName(const resource::Gff &gff) {
-    gff.readLocString(_firstName, "FirstName", _services.resource.strings);
-    gff.readLocString(_lastName, "LastName", _services.resource.strings);
-
+    gff.readInt(_walkRate, labels::WalkRate);
+
+    gff.readByte(_naturalAC, labels::NaturalAC);
+    gff.readShort(_forcePoints, labels::ForcePoints);
+    gff.readShort(_currentForce, labels::CurrentForce);
+    gff.readShort(_refBonus, labels::refbonus);
+    gff.readShort(_willBonus, labels::willbonus);
+    gff.readShort(_fortBonus, labels::fortbonus);
+    gff.readByte(_goodEvil, labels::GoodEvil);
+    gff.readFloat(_challengeRating, labels::ChallengeRating);
+    gff.readDword(_xp, labels::Experience);
+
+    gff.readResRef(_onNotice, labels::ScriptOnNotice);
+    gff.readResRef(_onSpellAt, labels::ScriptSpellAt);
+    gff.readResRef(_onAttacked, labels::ScriptAttacked);
+    gff.readResRef(_onDamaged, labels::ScriptDamaged);
+    gff.readResRef(_onDisturbed, labels::ScriptDisturbed);
+    gff.readResRef(_onEndRound, labels::ScriptEndRound);
+    gff.readResRef(_onEndDialogue, labels::ScriptEndDialogu);
+    gff.readResRef(_onDialogue, labels::ScriptDialogue);
+    gff.readResRef(_onSpawn, labels::ScriptSpawn);
+    gff.readResRef(_onDeath, labels::ScriptDeath);
+    gff.readResRef(_onBlocked, labels::ScriptOnBlocked);
+}
+
+size_t Creature::Blueprint::residentBytes() const {
+    size_t bytes = sizeof(Blueprint);
+    bytes += firstName.str().capacity();
+    bytes += lastName.str().capacity();
+    bytes += bodyBag.name.capacity();
+    bytes += attributes.heapBytes();
+    return bytes;
+}
+
+void Creature::deserializeBlueprint(const resource::Gff &gff, Blueprint &blueprint) const {
+    gff.readLocString(blueprint.firstName, labels::FirstName, _services.resource.strings);
+    gff.readLocString(blueprint.lastName, labels::LastName, _services.resource.strings);
+
+    deserializeSoundSet(gff, blueprint);
+    deserializeBodyBag(gff, blueprint);
+    deserializeAttributes(gff, blueprint);
+    deserializePerception(gff, blueprint);
+}
+
+Creature::Blueprint Creature::captureBlueprint() const {
+    Blueprint blueprint;
+    blueprint.firstName = _firstName;
+    blueprint.lastName = _lastName;
+    blueprint.soundSetId = _soundSetId;
+    blueprint.soundSet = _soundSet;
+    blueprint.bodyBagId = _bodyBagId;
+    blueprint.bodyBag = _bodyBag;
+    blueprint.perceptionId = _perceptionId;
+    blueprint.sightRange = _perception.sightRange;
+    blueprint.hearingRange = _perception.hearingRange;
+    blueprint.attributes = _attributes;
+    return blueprint;
+}
+
+void Creature::applyBlueprint(const Blueprint &blueprint) {
+    _firstName = blueprint.firstName;
+    _lastName = blueprint.lastName;
     _name = _firstName.str();
     const std::string &last = _lastName.str();
     if (!_name.empty() && !last.empty()) {
         _name += ' ';
     }
     _name += last;
+
+    _soundSetId = blueprint.soundSetId;
+    _soundSet = blueprint.soundSet;
+    _bodyBagId = blueprint.bodyBagId;
+    _bodyBag = blueprint.bodyBag;
+    _perceptionId = blueprint.perceptionId;
+    _perception.sightRange = blueprint.sightRange;
+    _perception.hearingRange = blueprint.hearingRange;
+    _attributes = blueprint.attributes;
 }
 
-void Creature::deserializeSoundSet(const resource::Gff &gff) {
-    gff.readWord(_soundSetId, "SoundSetFile");
-    if (_soundSetId == 0xffff) {
+void Creature::deserializeSoundSet(const resource::Gff &gff, Blueprint &blueprint) const {
+    if (!gff.readWord(blueprint.soundSetId, labels::SoundSetFile) || blueprint.soundSetId == 0xffff) {
         return;
     }
 
@@ -1504,15 +1620,14 @@ void Creature::deserializeSoundSet(const resource::Gff &gff) {
     if (!soundSetTable) {
         return;
     }
-    std::string soundSetResRef(soundSetTable->getString(_soundSetId, "resref"));
+    std::string soundSetResRef(soundSetTable->getString(blueprint.soundSetId, "resref"));
     if (!soundSetResRef.empty()) {
-        _soundSet = _services.resource.soundSets.get(soundSetResRef);
+        blueprint.soundSet = _services.resource.soundSets.get(soundSetResRef);
     }
 }
 
-void Creature::deserializeBodyBag(const resource::Gff &gff) {
-    gff.readByte(_bodyBagId, "BodyBag");
-    if (_bodyBagId == 0xFF) {
+void Creature::deserializeBodyBag(const resource::Gff &gff, Blueprint &blueprint) const {
+    if (!gff.readByte(blueprint.bodyBagId, labels::BodyBag) || blueprint.bodyBagId == 0xFF) {
         return;
     }
 
@@ -1520,73 +1635,72 @@ void Creature::deserializeBodyBag(const resource::Gff &gff) {
     if (!bodyBags) {
         return;
     }
-    _bodyBag.name = _services.resource.strings.getText(bodyBags->getInt(_bodyBagId, "name"));
-    _bodyBag.appearance = bodyBags->getInt(_bodyBagId, "appearance");
-    _bodyBag.corpse = bodyBags->getBool(_bodyBagId, "corpse");
+    blueprint.bodyBag.name = _services.resource.strings.getText(bodyBags->getInt(blueprint.bodyBagId, "name"));
+    blueprint.bodyBag.appearance = bodyBags->getInt(blueprint.bodyBagId, "appearance");
+    blueprint.bodyBag.corpse = bodyBags->getBool(blueprint.bodyBagId, "corpse");
     return;
 }
 
-void Creature::deserializeAttributes(const resource::Gff &gff) {
-    CreatureAttributes &attributes = _attributes;
+void Creature::deserializeAttributes(const resource::Gff &gff, Blueprint &blueprint) const {
+    CreatureAttributes &attributes = blueprint.attributes;
     {
         uint8_t value;
-        if (gff.readByte(value, "Str")) {
+        if (gff.readByte(value, labels::Str)) {
             attributes.setAbilityScore(Ability::Strength, value);
         }
-        if (gff.readByte(value, "Dex")) {
+        if (gff.readByte(value, labels::Dex)) {
             attributes.setAbilityScore(Ability::Dexterity, value);
         }
-        if (gff.readByte(value, "Con")) {
+        if (gff.readByte(value, labels::Con)) {
             attributes.setAbilityScore(Ability::Constitution, value);
         }
-        if (gff.readByte(value, "Int")) {
+        if (gff.readByte(value, labels::Int)) {
             attributes.setAbilityScore(Ability::Intelligence, value);
         }
-        if (gff.readByte(value, "Wis")) {
+        if (gff.readByte(value, labels::Wis)) {
             attributes.setAbilityScore(Ability::Wisdom, value);
         }
-        if (gff.readByte(value, "Cha")) {
+        if (gff.readByte(value, labels::Cha)) {
             attributes.setAbilityScore(Ability::Charisma, value);
         }
     }
 
-    for (const auto &clazz : gff.getList("ClassList")) {
-        deserializeClass(*clazz);
+    for (const auto &clazz : gff.getList(labels::ClassList)) {
+        deserializeClass(*clazz, blueprint);
     }
 
     int skillType = 0;
-    for (const auto &skill : gff.getList("SkillList")) {
+    for (const auto &skill : gff.getList(labels::SkillList)) {
         attributes.setSkillRank(
-            static_cast<SkillType>(skillType++), skill->getUint("Rank"));
+            static_cast<SkillType>(skillType++), skill->getUint(labels::Rank));
     }
 
-    for (const auto &feat : gff.getList("FeatList")) {
-        auto featType = static_cast<FeatType>(feat->getUint("Feat"));
-        _attributes.addFeat(featType);
+    for (const auto &feat : gff.getList(labels::FeatList)) {
+        auto featType = static_cast<FeatType>(feat->getUint(labels::Feat));
+        attributes.addFeat(featType);
     }
 }
 
-void Creature::deserializeClass(const resource::Gff &gff) {
+void Creature::deserializeClass(const resource::Gff &gff, Blueprint &blueprint) const {
     auto clazz = _services.game.classes.get(
-        static_cast<ClassType>(gff.getInt("Class")));
+        static_cast<ClassType>(gff.getInt(labels::Class)));
     if (!clazz) {
         return;
     }
 
     int16_t level;
-    if (gff.readShort(level, "ClassLevel")) {
-        _attributes.addClassLevels(clazz.get(), level);
+    if (gff.readShort(level, labels::ClassLevel)) {
+        blueprint.attributes.addClassLevels(clazz.get(), level);
     }
 
-    for (const auto &spell : gff.getList("KnownList0")) {
-        auto spellType = static_cast<SpellType>(spell->getUint("Spell"));
-        _attributes.addSpell(spellType);
+    for (const auto &spell : gff.getList(labels::KnownList0)) {
+        auto spellType = static_cast<SpellType>(spell->getUint(labels::Spell));
+        blueprint.attributes.addSpell(spellType);
     }
 }
 
-void Creature::deserializePerception(const resource::Gff &gff) {
-    gff.readByte(_perceptionId, "PerceptionRange");
-    if (_perceptionId == 0xFF) {
+void Creature::deserializePerception(const resource::Gff &gff, Blueprint &blueprint) const {
+    if (!gff.readByte(blueprint.perceptionId, labels::PerceptionRange) || blueprint.perceptionId == 0xFF) {
         return;
     }
 
@@ -1595,12 +1709,12 @@ void Creature::deserializePerception(const resource::Gff &gff) {
         return;
     }
 
-    _perception.sightRange = ranges->getFloat(_perceptionId, "primaryrange");
-    _perception.hearingRange = ranges->getFloat(_perceptionId, "secondaryrange");
+    blueprint.sightRange = ranges->getFloat(blueprint.perceptionId, "primaryrange");
+    blueprint.hearingRange = ranges->getFloat(blueprint.perceptionId, "secondaryrange");
 }
 
 void Creature::deserializeEquipItems(const resource::Gff &gff) {
-    for (const auto &itemGff : gff.getList("Equip_ItemList")) {
+    for (const auto &itemGff : gff.getList(labels::Equip_ItemList)) {
         std::shared_ptr<Item> item = _game.newItem();
         item->deserialize(*itemGff);
         if (item->isEquippable(InventorySlots::body)) {
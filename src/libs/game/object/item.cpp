@@ -22,15 +22,7 @@
 #include "reone/game/di/services.h"
 #include "reone/game/game.h"
 #include "reone/graphics/di/services.h"
-#include "reone/resource/2da.h"
 #include "reone/resource/di/services.h"
-#include "reone/resource/provider/2das.h"
-#include "reone/resource/provider/audioclips.h"
-#include "reone/resource/provider/gffs.h"
-#include "reone/resource/provider/models.h"
-#include "reone/resource/provider/textures.h"
-#include "reone/resource/resources.h"
-#include "reone/resource/strings.h"
 
 using namespace reone::audio;
 using namespace reone::graphics;
@@ -40,153 +32,85 @@ namespace reone {
 
 namespace game {
 
+static constexpr std::array<const char *, 3> kTemplateFields {"EquippedRes", "InventoryRes", "TemplateResRef"};
+
 void Item::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> uti(_services.resource.gffs.get(resRef, ResType::Uti));
-    if (uti) {
-        deserialize(*uti);
+    auto tmpl = _game.itemBlueprints().get(resRef);
+    if (tmpl) {
+        deserializeTemplates(*tmpl->gff);
+        applyTemplate(*tmpl);
         return;
     }
 }
 
 void Item::deserialize(const resource::Gff &gff) {
-    std::string ref;
-    if (gff.readResRef(ref, "EquippedRes")) {
-        if (auto uti = _services.resource.gffs.get(ref, ResType::Uti)) {
-            deserializeAll(*uti);
-        }
-    }
+    deserializeTemplates(gff);
 
-    if (gff.readResRef(ref, "InventoryRes")) {
-        if (auto uti = _services.resource.gffs.get(ref, ResType::Uti)) {
-            deserializeAll(*uti);
-        }
+    Object::deserialize(gff);
+    deserializeInstance(gff);
+
+    auto &blueprints = _game.itemBlueprints();
+    if (ItemBlueprints::hasBlueprintFields(gff)) {
+        blueprints.deserialize(gff, mutableBlueprint());
+    } else if (_blueprint == ItemBlueprint::defaultInstance()) {
+        _blueprint = blueprints.empty();
     }
 
-    if (gff.readResRef(ref, "TemplateResRef")) {
-        if (auto uti = _services.resource.gffs.get(ref, ResType::Uti)) {
-            deserializeAll(*uti);
+    updateTransform();
+}
+
+void Item::deserializeTemplates(const resource::Gff &gff) {
+    std::string ref;
+    for (auto &field : kTemplateFields) {
+        if (!gff.readResRef(ref, field)) {
+            continue;
+        }
+        if (auto tmpl = _game.itemBlueprints().get(ref)) {
+            applyTemplate(*tmpl);
         }
     }
-
-    deserializeAll(gff);
 }
 
-void Item::deserializeAll(const resource::Gff &gff) {
-    Object::deserialize(gff);
+void Item::applyTemplate(const ItemTemplate &tmpl) {
+    Object::deserialize(*tmpl.gff);
+    deserializeInstance(*tmpl.gff);
 
-    gff.readLocString(_localizedName, "LocalizedName", _services.resource.strings);
-    gff.readLocString(_description, "Description", _services.resource.strings);
-    gff.readLocString(_descIdentified, "DescIdentified", _services.resource.strings);
+    if (_ownedBlueprint) {
+        _game.itemBlueprints().deserialize(*tmpl.gff, *_ownedBlueprint);
+    } else {
+        _blueprint = _game.itemBlueprints().stack(_blueprint, tmpl);
+    }
+
+    updateTransform();
+}
 
+void Item::deserializeInstance(const resource::Gff &gff) {
     gff.readByte(_charges, "Charges");
     gff.readDword(_cost, "Cost");
     gff.readDword(_addCost, "AddCost");
     gff.readBool(_stolen, "Stolen");
     gff.readWord(_stackSize, "StackSize");
-
     gff.readBool(_identified, "Identified");
-    gff.readByte(_modelVariation, "ModelVariation");
-    gff.readByte(_textureVariation, "TextureVar");
-    gff.readByte(_bodyVariation, "BodyVariation");
     gff.readBool(_dropable, "Dropable");
-
-    deserializeProperties(gff);
-    deserializeBase(gff);
-
-    loadAmmunitionType();
-    updateTransform();
-}
-
-void Item::deserializeProperties(const resource::Gff &gff) {
-    for (const auto &prop : gff.getList("PropertiesList")) {
-        PropertyEntry entry;
-        prop->readByte(entry.chanceAppear, "ChanceAppear");
-        prop->readByte(entry.costTable, "CostTable");
-        prop->readWord(entry.costValue, "CostValue");
-        prop->readByte(entry.paramTable, "Param1");
-        prop->readByte(entry.paramValue, "Param1Value");
-        prop->readWord(entry.subtype, "Subtype");
-        prop->readByte(entry.upgradeType, "UpgradeType");
-
-        if (prop->readWord(entry.propertyName, "PropertyName")) {
-            switch (static_cast<ItemProperty>(entry.propertyName)) {
-            case ItemProperty::ActivateItem:
-                _activateSpell = static_cast<SpellType>(entry.subtype);
-                break;
-            case ItemProperty::Disguise:
-                _disguiseAppearance = entry.subtype;
-                break;
-            default:
-                break;
-            }
-        }
-
-        _properties.push_back(entry);
-    }
-}
-
-void Item::deserializeBase(const resource::Gff &gff) {
-    if (!gff.readInt(_baseItem, "BaseItem")) {
-        return;
-    }
-
-    std::shared_ptr<TwoDA> baseItems(_services.resource.twoDas.get("baseitems"));
-    if (!baseItems) {
-        return;
-    }
-    _attackRange = baseItems->getInt(_baseItem, "maxattackrange");
-    _criticalHitMultiplier = baseItems->getInt(_baseItem, "crithitmult");
-    _criticalThreat = baseItems->getInt(_baseItem, "critthreat");
-    _damageFlags = baseItems->getInt(_baseItem, "damageflags");
-    _dieToRoll = baseItems->getInt(_baseItem, "dietoroll");
-    _equipableSlots = baseItems->getHexInt(_baseItem, "equipableslots", 0);
-    _itemClass = boost::to_lower_copy(baseItems->getString(_baseItem, "itemclass"));
-    _numDice = baseItems->getInt(_baseItem, "numdice");
-    _weaponType = static_cast<WeaponType>(baseItems->getInt(_baseItem, "weapontype"));
-    _weaponWield = static_cast<WeaponWield>(baseItems->getInt(_baseItem, "weaponwield"));
-
-    std::string iconResRef;
-    if (isEquippable(InventorySlots::body)) {
-        _baseBodyVariation = boost::to_lower_copy(baseItems->getString(_baseItem, "bodyvar"));
-        iconResRef = str(boost::format("i%s_%03d") % _itemClass % (int)_textureVariation);
-    } else if (isEquippable(InventorySlots::rightWeapon)) {
-        iconResRef = str(boost::format("i%s_%03d") % _itemClass % (int)_modelVariation);
-    } else {
-        iconResRef = str(boost::format("i%s_%03d") % _itemClass % (int)_modelVariation);
-    }
-    _icon = _services.resource.textures.get(iconResRef, TextureUsage::GUI);
-    if (!_icon && isEquippable(InventorySlots::body)) {
-        // Some body items (e.g. disguises) key the inventory icon on ModelVariation
-        // rather than TextureVar; fall back to it when the primary icon is missing.
-        iconResRef = str(boost::format("i%s_%03d") % _itemClass % (int)_modelVariation);
-        _icon = _services.resource.textures.get(iconResRef, TextureUsage::GUI);
-    }
 }
 
-void Item::loadAmmunitionType() {
-    std::shared_ptr<TwoDA> baseItems(_services.resource.twoDas.get("baseitems"));
-
-    int ammunitionIdx = baseItems->getInt(_baseItem, "ammunitiontype", -1);
-    if (ammunitionIdx != -1) {
-        std::shared_ptr<TwoDA> twoDa(_services.resource.twoDas.get("ammunitiontypes"));
-        _ammunitionType = std::make_shared<Item::AmmunitionType>();
-        _ammunitionType->model = _services.resource.models.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "model")));
-        _ammunitionType->muzzleFlash = _services.resource.models.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "muzzleflash")));
-        _ammunitionType->shotSound1 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "shotsound0")));
-        _ammunitionType->shotSound2 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "shotsound1")));
-        _ammunitionType->impactSound1 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "impactsound0")));
-        _ammunitionType->impactSound2 = _services.resource.audioClips.get(boost::to_lower_copy(twoDa->getString(ammunitionIdx, "impactsound1")));
+ItemBlueprint &Item::mutableBlueprint() {
+    if (!_ownedBlueprint) {
+        _ownedBlueprint = _game.itemBlueprints().copy(*_blueprint);
+        _blueprint = _ownedBlueprint;
     }
+    return *_ownedBlueprint;
 }
 
 void Item::update(float dt) {
 }
 
 void Item::playShotSound(int variant, glm::vec3 position) {
-    if (!_ammunitionType) {
+    auto &ammunitionType = _blueprint->ammunitionType;
+    if (!ammunitionType) {
         return;
     }
-    auto clip = variant == 1 ? _ammunitionType->shotSound2 : _ammunitionType->shotSound1;
+    auto clip = variant == 1 ? ammunitionType->shotSound2 : ammunitionType->shotSound1;
     if (clip) {
         _audioSource = _services.audio.mixer.play(
             std::move(clip),
@@ -198,10 +122,11 @@ void Item::playShotSound(int variant, glm::vec3 position) {
 }
 
 void Item::playImpactSound(int variant, glm::vec3 position) {
-    if (!_ammunitionType) {
+    auto &ammunitionType = _blueprint->ammunitionType;
+    if (!ammunitionType) {
         return;
     }
-    auto clip = variant == 1 ? _ammunitionType->impactSound2 : _ammunitionType->impactSound1;
+    auto clip = variant == 1 ? ammunitionType->impactSound2 : ammunitionType->impactSound1;
     if (clip) {
         _services.audio.mixer.play(
             std::move(clip),
@@ -213,11 +138,11 @@ void Item::playImpactSound(int variant, glm::vec3 position) {
 }
 
 bool Item::isEquippable() const {
-    return _equipableSlots != 0;
+    return _blueprint->equipableSlots != 0;
 }
 
 bool Item::isEquippable(int slot) const {
-    return (_equipableSlots >> slot) & 1;
+    return _blueprint->isEquippable(slot);
 }
 
 void Item::setDropable(bool dropable) {
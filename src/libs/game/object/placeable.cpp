@@ -46,33 +46,61 @@ namespace reone {
 
 namespace game {
 
+size_t Placeable::Blueprint::residentBytes() const {
+    size_t bytes = sizeof(Blueprint);
+    bytes += locName.str().capacity();
+    bytes += name.capacity();
+    bytes += description.str().capacity();
+    return bytes;
+}
+
 void Placeable::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utp(_services.resource.gffs.get(resRef, ResType::Utp));
-    if (!utp) {
+    // Same as for creatures, deserialize a blueprint once, rather than once
+    // more via its self-referential TemplateResRef
+    if (!deserializeTemplate(resRef)) {
         return;
     }
-    deserialize(*utp);
+    loadAppearance();
+    updateTransform();
 }
 
 void Placeable::deserialize(const resource::Gff &gff) {
     std::string templateRes;
     if (gff.readResRef(templateRes, "TemplateResRef")) {
-        if (auto utp = _services.resource.gffs.get(templateRes, ResType::Utp)) {
-            deserializeAll(*utp);
-        }
+        deserializeTemplate(templateRes);
     }
     deserializeAll(gff);
     loadAppearance();
     updateTransform();
 }
 
+bool Placeable::deserializeTemplate(const std::string &resRef) {
+    auto tmpl = _game.placeableBlueprints().get(resRef, [this](auto &utp, auto &blueprint) {
+        deserializeBlueprint(utp, blueprint);
+    });
+    if (!tmpl) {
+        return false;
+    }
+    deserializeFields(*tmpl->gff);
+    applyBlueprint(*tmpl->blueprint);
+    deserializeItems(*tmpl->gff);
+    return true;
+}
+
 void Placeable::deserializeAll(const resource::Gff &gff) {
+    deserializeFields(gff);
+
+    auto blueprint = captureBlueprint();
+    deserializeBlueprint(gff, blueprint);
+    applyBlueprint(blueprint);
+
+    deserializeItems(gff);
+}
+
+void Placeable::deserializeFields(const resource::Gff &gff) {
     if (gff.readString(_tag, "Tag")) {
         boost::to_lower(_tag);
     }
-    if (gff.readLocString(_locName, "LocName", _services.resource.strings)) {
-        _name = _locName.str();
-    }
     gff.readBool(_autoRemoveKey, "AutoRemoveKey");
     gff.readEnum(_faction, "Faction");
     gff.readBool(_plot, "Plot");
@@ -111,7 +139,6 @@ void Placeable::deserializeAll(const resource::Gff &gff) {
     gff.readByte(_bodyBagId, "BodyBag");
     gff.readBool(_dieWhenEmpty, "DieWhenEmpty");
     gff.readByte(_lightState, "LightState");
-    gff.readLocString(_description, "Description", _services.resource.strings);
     gff.readResRef(_onClosed, "OnClosed");
     gff.readResRef(_onDamaged, "OnDamaged");
     gff.readResRef(_onDeath, "OnDeath");
@@ -142,7 +169,30 @@ void Placeable::deserializeAll(const resource::Gff &gff) {
     gff.readBool(_isBodyBagVisible, "IsBodyBagVisible");
     gff.readBool(_isCorpse, "IsCorpse");
     gff.readBool(_commandable, "Commandable");
+}
+
+void Placeable::deserializeBlueprint(const resource::Gff &gff, Blueprint &blueprint) const {
+    if (gff.readLocString(blueprint.locName, "LocName", _services.resource.strings)) {
+        blueprint.name = blueprint.locName.str();
+    }
+    gff.readLocString(blueprint.description, "Description", _services.resource.strings);
+}
+
+Placeable::Blueprint Placeable::captureBlueprint() const {
+    Blueprint blueprint;
+    blueprint.locName = _locName;
+    blueprint.name = _name;
+    blueprint.description = _description;
+    return blueprint;
+}
+
+void Placeable::applyBlueprint(const Blueprint &blueprint) {
+    _locName = blueprint.locName;
+    _name = blueprint.name;
+    _description = blueprint.description;
+}
 
+void Placeable::deserializeItems(const resource::Gff &gff) {
     for (const auto &itemGff : gff.getList("ItemList")) {
         std::shared_ptr<Item> item = _game.newItem();
         item->deserialize(*itemGff);
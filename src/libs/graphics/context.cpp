@@ -17,6 +17,7 @@
 
 #include "reone/graphics/context.h"
 #include "reone/graphics/framebuffer.h"
+#include "reone/graphics/headless.h"
 #include "reone/graphics/shaderprogram.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniformbuffer.h"
@@ -42,6 +43,10 @@ void Context::init() {
         return;
     }
     checkMainThread();
+    if (isHeadless()) {
+        info("Graphics context is headless, OpenGL will not be loaded");
+        return;
+    }
     if (!gladLoadGL(SDL_GL_GetProcAddress)) {
         // Attempt to retrieve basic version information manually for diagnosis
         // Use manual glGetString which might work even if GLAD failed to load everything
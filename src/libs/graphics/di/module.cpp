@@ -17,11 +17,15 @@
 
 #include "reone/graphics/di/module.h"
 
+#include "reone/graphics/headless.h"
+
 namespace reone {
 
 namespace graphics {
 
 void GraphicsModule::init() {
+    setHeadless(_options.headless);
+
     _context = std::make_unique<Context>(_options);
     _statistic = std::make_unique<Statistic>();
     _meshRegistry = std::make_unique<MeshRegistry>(*_statistic);
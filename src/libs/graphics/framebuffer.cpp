@@ -17,6 +17,7 @@
 
 #include "reone/graphics/framebuffer.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/graphics/renderbuffer.h"
 #include "reone/graphics/texture.h"
 #include "reone/system/exception/notimplemented.h"
@@ -30,6 +31,9 @@ void Framebuffer::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
     glGenFramebuffers(1, &_nameGL);
     glBindFramebuffer(GL_FRAMEBUFFER, _nameGL);
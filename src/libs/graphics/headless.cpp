@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/headless.h"
+
+namespace reone {
+
+namespace graphics {
+
+static bool g_headless = false;
+
+void setHeadless(bool headless) {
+    g_headless = headless;
+}
+
+bool isHeadless() {
+    return g_headless;
+}
+
+} // namespace graphics
+
+} // namespace reone
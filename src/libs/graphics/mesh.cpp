@@ -18,6 +18,7 @@
 #include "reone/graphics/mesh.h"
 
 #include "reone/graphics/barycentricutil.h"
+#include "reone/graphics/headless.h"
 #include "reone/graphics/statistic.h"
 #include "reone/graphics/triangleutil.h"
 #include "reone/system/checkutil.h"
@@ -31,6 +32,9 @@ void Mesh::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
 
     std::vector<uint16_t> indices;
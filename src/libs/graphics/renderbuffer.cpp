@@ -17,6 +17,7 @@
 
 #include "reone/graphics/renderbuffer.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/graphics/pixelutil.h"
 #include "reone/system/threadutil.h"
 
@@ -28,6 +29,9 @@ void Renderbuffer::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
     glGenRenderbuffers(1, &_nameGL);
     bind();
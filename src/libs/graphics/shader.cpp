@@ -17,6 +17,7 @@
 
 #include "reone/graphics/shader.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/system/threadutil.h"
 
 namespace reone {
@@ -40,6 +41,9 @@ void Shader::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
 
     std::vector<const char *> sourcePtrs;
@@ -17,6 +17,7 @@
 
 #include "reone/graphics/shaderprogram.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/graphics/types.h"
 #include "reone/system/threadutil.h"
 
@@ -28,6 +29,9 @@ void ShaderProgram::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
 
     _nameGL = glCreateProgram();
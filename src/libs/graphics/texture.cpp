@@ -17,6 +17,7 @@
 
 #include "reone/graphics/texture.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/graphics/pixelutil.h"
 #include "reone/graphics/textureutil.h"
 #include "reone/system/exception/notimplemented.h"
@@ -114,6 +115,9 @@ void Texture::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
 
     glGenTextures(1, &_nameGL);
@@ -198,6 +202,10 @@ void Texture::configureCubeMap() {
 }
 
 void Texture::refresh() {
+    // Called by init before the texture is marked as initialized
+    if (isHeadless()) {
+        return;
+    }
     if (isCubeMapArray()) {
         refreshCubeMapArray();
     } else if (isCubeMap()) {
@@ -341,7 +349,7 @@ void Texture::clear(int w, int h, PixelFormat format, int numLayers, bool refres
     _layers.clear();
     _layers.resize(numLayers);
 
-    if (refresh) {
+    if (refresh && _inited) {
         this->refresh();
     }
 }
@@ -359,11 +367,31 @@ void Texture::setPixels(int w, int h, PixelFormat format, std::vector<Layer> lay
     _pixelFormat = format;
     _layers = std::move(layers);
 
-    if (refresh) {
+    if (refresh && _inited) {
         this->refresh();
     }
 }
 
+void Texture::setSubPixels(int x, int y, int w, int h, const ByteBuffer &pixels) {
+    if (!_inited) {
+        return;
+    }
+    if (!is2D()) {
+        throw NotImplementedException("Sub-image upload is only supported for 2D textures");
+    }
+    // Rows are tightly packed, which is not necessarily 4-byte aligned
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(
+        GL_TEXTURE_2D,
+        0,
+        x, y,
+        w, h,
+        getPixelFormatGL(_pixelFormat),
+        getPixelTypeGL(_pixelFormat),
+        pixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
 uint32_t Texture::getTargetGL() const {
     if (isCubeMapArray()) {
         return GL_TEXTURE_CUBE_MAP_ARRAY;
@@ -17,6 +17,7 @@
 
 #include "reone/graphics/uniformbuffer.h"
 
+#include "reone/graphics/headless.h"
 #include "reone/system/threadutil.h"
 
 namespace reone {
@@ -27,6 +28,9 @@ void UniformBuffer::init() {
     if (_inited) {
         return;
     }
+    if (isHeadless()) {
+        return;
+    }
     checkMainThread();
     glGenBuffers(1, &_nameGL);
     glBindBuffer(GL_UNIFORM_BUFFER, _nameGL);
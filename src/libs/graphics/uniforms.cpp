@@ -18,6 +18,7 @@
 #include "reone/graphics/uniforms.h"
 
 #include "reone/graphics/context.h"
+#include "reone/graphics/headless.h"
 
 namespace reone {
 
@@ -48,15 +49,17 @@ void Uniforms::init() {
     _ubText = initBuffer(&defaultText, sizeof(TextUniforms));
     _ubScreenEffect = initBuffer(&defaultScreenEffect, sizeof(ScreenEffectUniforms));
 
-    _context.bindUniformBuffer(*_ubGlobals, UniformBlockBindingPoints::globals);
-    _context.bindUniformBuffer(*_ubLocals, UniformBlockBindingPoints::locals);
-    _context.bindUniformBuffer(*_ubBones, UniformBlockBindingPoints::bones);
-    _context.bindUniformBuffer(*_ubDangly, UniformBlockBindingPoints::dangly);
-    _context.bindUniformBuffer(*_ubParticles, UniformBlockBindingPoints::particles);
-    _context.bindUniformBuffer(*_ubGrass, UniformBlockBindingPoints::grass);
-    _context.bindUniformBuffer(*_ubWalkmesh, UniformBlockBindingPoints::walkmesh);
-    _context.bindUniformBuffer(*_ubText, UniformBlockBindingPoints::text);
-    _context.bindUniformBuffer(*_ubScreenEffect, UniformBlockBindingPoints::screenEffect);
+    if (!isHeadless()) {
+        _context.bindUniformBuffer(*_ubGlobals, UniformBlockBindingPoints::globals);
+        _context.bindUniformBuffer(*_ubLocals, UniformBlockBindingPoints::locals);
+        _context.bindUniformBuffer(*_ubBones, UniformBlockBindingPoints::bones);
+        _context.bindUniformBuffer(*_ubDangly, UniformBlockBindingPoints::dangly);
+        _context.bindUniformBuffer(*_ubParticles, UniformBlockBindingPoints::particles);
+        _context.bindUniformBuffer(*_ubGrass, UniformBlockBindingPoints::grass);
+        _context.bindUniformBuffer(*_ubWalkmesh, UniformBlockBindingPoints::walkmesh);
+        _context.bindUniformBuffer(*_ubText, UniformBlockBindingPoints::text);
+        _context.bindUniformBuffer(*_ubScreenEffect, UniformBlockBindingPoints::screenEffect);
+    }
 
     _inited = true;
 }
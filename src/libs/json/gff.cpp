@@ -140,7 +140,7 @@ static boost::json::value serializeGffFieldValue(const Gff::Field &field) {
 static boost::json::object serializeGff(const Gff &gff) {
     boost::json::object tree;
     for (const auto &field : gff.fields()) {
-        tree[field.label] = {{"type", serializeGffFieldType(field.type)}, {"value", serializeGffFieldValue(field)}};
+        tree[field.label()] = {{"type", serializeGffFieldType(field.type)}, {"value", serializeGffFieldValue(field)}};
     }
     return tree;
 }
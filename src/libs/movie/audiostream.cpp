@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/movie/audiostream.h"
+
+using namespace reone::audio;
+
+namespace reone {
+
+namespace movie {
+
+bool AudioStreamDecoder::decode(AudioClip::Frame &chunk, size_t maxBytes) {
+    size_t size = chunk.samples.size();
+    size_t numBytes = size;
+    while (numBytes - size < maxBytes) {
+        if (_offset == _frame.samples.size()) {
+            if (_ended || !_stream->decodeFrame(_frame)) {
+                _ended = true;
+                break;
+            }
+            _offset = 0;
+            continue;
+        }
+        if (numBytes == 0) {
+            chunk.format = _frame.format;
+            chunk.sampleRate = _frame.sampleRate;
+        } else if (chunk.format != _frame.format || chunk.sampleRate != _frame.sampleRate) {
+            break;
+        }
+        int stride = _frame.stride();
+        size_t count = std::min(_frame.samples.size() - _offset, maxBytes - (numBytes - size));
+        count -= count % stride;
+        if (count == 0) {
+            break;
+        }
+        chunk.samples.insert(chunk.samples.end(), _frame.samples.begin() + _offset, _frame.samples.begin() + _offset + count);
+        numBytes += count;
+        _offset += count;
+    }
+    return numBytes > size;
+}
+
+void AudioStreamDecoder::rewind() {
+    _stream->rewind();
+    _frame.samples.clear();
+    _offset = 0;
+    _ended = false;
+}
+
+} // namespace movie
+
+} // namespace reone
@@ -18,10 +18,14 @@
 #include "reone/movie/format/bikreader.h"
 
 #include "reone/audio/clip.h"
+#include "reone/graphics/options.h"
+#include "reone/movie/audiostream.h"
 #include "reone/movie/movie.h"
 #include "reone/movie/videostream.h"
+#include "reone/movie/yuvutil.h"
 #include "reone/system/exception/filenotfound.h"
 #include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
 
 #ifdef R_ENABLE_MOVIE
 
@@ -43,92 +47,136 @@ namespace movie {
 
 #ifdef R_ENABLE_MOVIE
 
-class BinkVideoDecoder : public movie::VideoStream {
+/**
+ * Demuxer of a BIK file, shared by video and audio decoders, which run on
+ * different threads. Packets of one stream read while looking for a packet
+ * of another stream are queued for their decoder, so that the file is
+ * demuxed in a single pass.
+ */
+class BinkDemuxer : boost::noncopyable {
 public:
-    BinkVideoDecoder(std::filesystem::path path) :
+    BinkDemuxer(std::filesystem::path path) :
         _path(std::move(path)) {
     }
 
-    ~BinkVideoDecoder() { deinit(); }
-
-    void deinit() {
-        if (_avFrameScaled) {
-            av_frame_free(&_avFrameScaled);
-        }
-        if (_avFrame) {
-            av_frame_free(&_avFrame);
-        }
-        if (_frameBuffer) {
-            av_free(_frameBuffer);
-            _frameBuffer = nullptr;
-        }
-        if (_swrContext) {
-            swr_free(&_swrContext);
-        }
-        if (_swsContext) {
-            sws_freeContext(_swsContext);
-            _swsContext = nullptr;
-        }
-        if (_audioCodecCtx) {
-            avcodec_free_context(&_audioCodecCtx);
-        }
-        if (_videoCodecCtx) {
-            avcodec_free_context(&_videoCodecCtx);
+    ~BinkDemuxer() {
+        for (auto &[_, queue] : _queues) {
+            freePackets(queue);
         }
         if (_formatCtx) {
             avformat_close_input(&_formatCtx);
         }
     }
 
-    void load() {
+    void open() {
         if (avformat_open_input(&_formatCtx, _path.string().c_str(), nullptr, nullptr) != 0) {
             throw ValidationException("Failed to open BIK file: " + _path.string());
         }
         findStreams();
+    }
 
-        // Video
+    /**
+     * Starts or stops queueing packets of a stream. Packets of streams that
+     * are not queued are discarded when read for another stream.
+     */
+    void setQueued(int streamIdx, bool queued) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _queues.find(streamIdx);
+        if (queued && it == _queues.end()) {
+            _queues.insert({streamIdx, std::deque<AVPacket *>()});
+        } else if (!queued && it != _queues.end()) {
+            freePackets(it->second);
+            _queues.erase(it);
+        }
+    }
 
-        openCodec(_videoStreamIdx, &_videoCodecCtx);
-        initFrames();
-        initScalingContext();
+    /**
+     * Returns the next packet of a stream, taking it from the stream's queue
+     * or reading the file until one is found.
+     *
+     * @return packet, which caller must free, or nullptr at end of stream
+     */
+    AVPacket *readPacket(int streamIdx) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _queues.find(streamIdx);
+        if (it != _queues.end() && !it->second.empty()) {
+            AVPacket *packet = it->second.front();
+            it->second.pop_front();
+            return packet;
+        }
+        AVPacket *packet = av_packet_alloc();
+        while (av_read_frame(_formatCtx, packet) >= 0) {
+            if (packet->stream_index == streamIdx) {
+                return packet;
+            }
+            auto queue = _queues.find(packet->stream_index);
+            if (queue != _queues.end()) {
+                queue->second.push_back(packet);
+                packet = av_packet_alloc();
+            } else {
+                av_packet_unref(packet);
+            }
+        }
+        av_packet_free(&packet);
+        return nullptr;
+    }
 
-        _width = _videoCodecCtx->width;
-        _height = _videoCodecCtx->height;
+    const std::filesystem::path &path() const { return _path; }
 
-        // Audio
+    bool hasAudio() const {
+        return _audioStreamIdx != -1;
+    }
 
-        if (hasAudio()) {
-            openCodec(_audioStreamIdx, &_audioCodecCtx);
-            initResamplingContext();
-            loadAudioClip();
-            seekBeginning();
+    /**
+     * @return duration of the audio stream in seconds, or zero if unknown
+     */
+    float audioDuration() const {
+        if (!hasAudio()) {
+            return 0.0f;
+        }
+        int64_t duration = _formatCtx->streams[_audioStreamIdx]->duration;
+        if (duration != AV_NOPTS_VALUE) {
+            return timeFromStreamTimestamp(_audioStreamIdx, duration);
         }
+        if (_formatCtx->duration != AV_NOPTS_VALUE) {
+            return _formatCtx->duration / static_cast<float>(AV_TIME_BASE);
+        }
+        return 0.0f;
     }
 
-    void seek(float time) override {
-        int64_t timestamp = streamTimestampFromTime(_videoStreamIdx, time);
-        loadVideoFrame(timestamp);
+    int videoStreamIdx() const { return _videoStreamIdx; }
+    int audioStreamIdx() const { return _audioStreamIdx; }
+
+    void openCodec(int streamIdx, AVCodecContext **codecCtx) const {
+        AVCodecParameters *codecParams = _formatCtx->streams[streamIdx]->codecpar;
+        const AVCodec *codec = avcodec_find_decoder(codecParams->codec_id);
+        if (!codec) {
+            throw ValidationException("BIK codec not found");
+        }
+        *codecCtx = avcodec_alloc_context3(codec);
+        if (avcodec_parameters_to_context(*codecCtx, codecParams) != 0) {
+            throw ValidationException("Failed to copy BIK codec parameters");
+        }
+        if (avcodec_open2(*codecCtx, codec, nullptr) != 0) {
+            throw ValidationException("Failed to open BIK codec");
+        }
     }
 
-    std::shared_ptr<audio::AudioClip> audioStream() const { return _audioStream; }
+    float timeFromStreamTimestamp(int streamIdx, int64_t timestamp) const {
+        int64_t micros = av_rescale_q(timestamp, _formatCtx->streams[streamIdx]->time_base, AVRational {1, AV_TIME_BASE});
+        return micros / 1e6f;
+    }
 
 private:
     std::filesystem::path _path;
 
     int _videoStreamIdx {-1};
     int _audioStreamIdx {-1};
-    int64_t _lastPacketTimestamp {-1};
 
     AVFormatContext *_formatCtx {nullptr};
-    AVCodecContext *_videoCodecCtx {nullptr};
-    AVCodecContext *_audioCodecCtx {nullptr};
-    SwsContext *_swsContext {nullptr};
-    SwrContext *_swrContext {nullptr};
-    AVFrame *_avFrame {nullptr};
-    AVFrame *_avFrameScaled {nullptr};
-    uint8_t *_frameBuffer {nullptr};
 
-    std::shared_ptr<audio::AudioClip> _audioStream;
+    std::map<int, std::deque<AVPacket *>> _queues;
+    std::mutex _mutex;
 
     void findStreams() {
         if (avformat_find_stream_info(_formatCtx, nullptr) != 0) {
@@ -152,45 +200,190 @@ private:
         }
     }
 
-    void openCodec(int streamIdx, AVCodecContext **codecCtx) {
-        AVCodecParameters *codecParams = _formatCtx->streams[streamIdx]->codecpar;
-        const AVCodec *codec = avcodec_find_decoder(codecParams->codec_id);
-        if (!codec) {
-            throw ValidationException("BIK codec not found");
+    void freePackets(std::deque<AVPacket *> &queue) {
+        for (auto &packet : queue) {
+            av_packet_free(&packet);
         }
-        *codecCtx = avcodec_alloc_context3(codec);
-        if (avcodec_parameters_to_context(*codecCtx, codecParams) != 0) {
-            throw ValidationException("Failed to copy BIK codec parameters");
+        queue.clear();
+    }
+};
+
+/**
+ * Takes the next packet of a stream from the demuxer and sends it to the
+ * codec. Flushes the codec at end of stream.
+ *
+ * @return false if end of stream is reached
+ */
+static bool sendNextPacket(BinkDemuxer &demuxer, int streamIdx, AVCodecContext *codecCtx) {
+    AVPacket *packet = demuxer.readPacket(streamIdx);
+    if (!packet) {
+        avcodec_send_packet(codecCtx, nullptr);
+        return false;
+    }
+    avcodec_send_packet(codecCtx, packet);
+    av_packet_free(&packet);
+    return true;
+}
+
+class BinkVideoDecoder : public IVideoStream, boost::noncopyable {
+public:
+    BinkVideoDecoder(std::shared_ptr<BinkDemuxer> demuxer) :
+        _demuxer(std::move(demuxer)) {
+    }
+
+    ~BinkVideoDecoder() {
+        _demuxer->setQueued(_demuxer->videoStreamIdx(), false);
+        if (_avFrame) {
+            av_frame_free(&_avFrame);
         }
-        if (avcodec_open2(*codecCtx, codec, nullptr) != 0) {
-            throw ValidationException("Failed to open BIK codec");
+        if (_swsContext) {
+            sws_freeContext(_swsContext);
+        }
+        if (_videoCodecCtx) {
+            avcodec_free_context(&_videoCodecCtx);
         }
     }
 
-    void initFrames() {
+    void load() {
+        _demuxer->openCodec(_demuxer->videoStreamIdx(), &_videoCodecCtx);
+        _demuxer->setQueued(_demuxer->videoStreamIdx(), true);
         _avFrame = av_frame_alloc();
-        _avFrameScaled = av_frame_alloc();
-
-        int bufSize = av_image_get_buffer_size(AV_PIX_FMT_RGB24, _videoCodecCtx->width, _videoCodecCtx->height, 32);
-        _frameBuffer = static_cast<uint8_t *>(av_malloc(bufSize));
-        av_image_fill_arrays(
-            _avFrameScaled->data, _avFrameScaled->linesize,
-            _frameBuffer,
-            AV_PIX_FMT_RGB24,
-            _videoCodecCtx->width, _videoCodecCtx->height,
-            32);
+
+        _width = _videoCodecCtx->width;
+        _height = _videoCodecCtx->height;
+    }
+
+    int width() const override { return _width; }
+    int height() const override { return _height; }
+
+    bool decodeFrame(float &time) override {
+        while (true) {
+            int ret = avcodec_receive_frame(_videoCodecCtx, _avFrame);
+            if (ret == 0) {
+                int64_t timestamp = _avFrame->best_effort_timestamp;
+                time = timestamp != AV_NOPTS_VALUE ? _demuxer->timeFromStreamTimestamp(_demuxer->videoStreamIdx(), timestamp) : 0.0f;
+                return true;
+            }
+            if (ret != AVERROR(EAGAIN) || _draining) {
+                return false;
+            }
+            // End of file: flush frames buffered by the decoder
+            _draining = !sendNextPacket(*_demuxer, _demuxer->videoStreamIdx(), _videoCodecCtx);
+        }
+    }
+
+    void copyFrame(uint8_t *y, uint8_t *u, uint8_t *v) override {
+        int chromaWidth = getChromaSize(_width);
+        int chromaHeight = getChromaSize(_height);
+        if (!isPlanarYUV420(static_cast<AVPixelFormat>(_avFrame->format))) {
+            // Unusual source format: let libswscale produce YUV 4:2:0
+            if (!_swsContext) {
+                initScalingContext();
+            }
+            uint8_t *dstData[4] {y, u, v, nullptr};
+            int dstLinesize[4] {_width, chromaWidth, chromaWidth, 0};
+            sws_scale(
+                _swsContext,
+                _avFrame->data, _avFrame->linesize, 0, _height,
+                dstData, dstLinesize);
+            return;
+        }
+        av_image_copy_plane(y, _width, _avFrame->data[0], _avFrame->linesize[0], _width, _height);
+        av_image_copy_plane(u, chromaWidth, _avFrame->data[1], _avFrame->linesize[1], chromaWidth, chromaHeight);
+        av_image_copy_plane(v, chromaWidth, _avFrame->data[2], _avFrame->linesize[2], chromaWidth, chromaHeight);
     }
 
+private:
+    std::shared_ptr<BinkDemuxer> _demuxer;
+
+    int _width {0};
+    int _height {0};
+
+    bool _draining {false};
+
+    AVCodecContext *_videoCodecCtx {nullptr};
+    SwsContext *_swsContext {nullptr};
+    AVFrame *_avFrame {nullptr};
+
     void initScalingContext() {
         _swsContext = sws_getContext(
             _videoCodecCtx->width, _videoCodecCtx->height,
             _videoCodecCtx->pix_fmt,
             _videoCodecCtx->width, _videoCodecCtx->height,
-            AV_PIX_FMT_RGB24,
+            AV_PIX_FMT_YUV420P,
             SWS_BILINEAR,
             nullptr, nullptr, nullptr);
     }
 
+    // Alpha plane of YUVA, if present, is ignored
+    inline bool isPlanarYUV420(AVPixelFormat format) const {
+        return format == AV_PIX_FMT_YUV420P || format == AV_PIX_FMT_YUVA420P;
+    }
+};
+
+class BinkAudioDecoder : public IAudioStream, boost::noncopyable {
+public:
+    BinkAudioDecoder(std::shared_ptr<BinkDemuxer> demuxer) :
+        _demuxer(std::move(demuxer)) {
+    }
+
+    ~BinkAudioDecoder() {
+        _demuxer->setQueued(_demuxer->audioStreamIdx(), false);
+        if (_avFrame) {
+            av_frame_free(&_avFrame);
+        }
+        if (_swrContext) {
+            swr_free(&_swrContext);
+        }
+        if (_audioCodecCtx) {
+            avcodec_free_context(&_audioCodecCtx);
+        }
+    }
+
+    void load() {
+        if (!_demuxer->hasAudio()) {
+            throw ValidationException("Audio stream not found in BIK");
+        }
+        _demuxer->openCodec(_demuxer->audioStreamIdx(), &_audioCodecCtx);
+        _demuxer->setQueued(_demuxer->audioStreamIdx(), true);
+        _avFrame = av_frame_alloc();
+        initResamplingContext();
+    }
+
+    bool decodeFrame(AudioClip::Frame &frame) override {
+        while (true) {
+            int ret = avcodec_receive_frame(_audioCodecCtx, _avFrame);
+            if (ret == 0) {
+                resampleFrame(frame);
+                return true;
+            }
+            if (ret != AVERROR(EAGAIN) || _draining) {
+                return false;
+            }
+            _draining = !sendNextPacket(*_demuxer, _demuxer->audioStreamIdx(), _audioCodecCtx);
+        }
+    }
+
+    void rewind() override {
+        // Demuxer may be shared with the video decoder, which must not be
+        // seeked: continue from a demuxer of our own
+        auto demuxer = std::make_shared<BinkDemuxer>(_demuxer->path());
+        demuxer->open();
+        _demuxer->setQueued(_demuxer->audioStreamIdx(), false);
+        _demuxer = std::move(demuxer);
+        avcodec_flush_buffers(_audioCodecCtx);
+        _draining = false;
+    }
+
+private:
+    std::shared_ptr<BinkDemuxer> _demuxer;
+
+    bool _draining {false};
+
+    AVCodecContext *_audioCodecCtx {nullptr};
+    SwrContext *_swrContext {nullptr};
+    AVFrame *_avFrame {nullptr};
+
     void initResamplingContext() {
 #if (LIBSWRESAMPLE_VERSION_MAJOR > 4) || \
     (LIBSWRESAMPLE_VERSION_MAJOR == 4 && LIBSWRESAMPLE_VERSION_MINOR >= 7)
@@ -211,110 +404,18 @@ private:
         swr_init(_swrContext);
     }
 
-    void loadVideoFrame(int64_t timestamp) {
-        AVPacket packet;
-
-        // Do nothing if last packet timestamp is greater or equals requested
-        if (_lastPacketTimestamp != -1 && _lastPacketTimestamp >= timestamp) {
-            _frame.pixels.reset();
-            return;
-        }
-
-        int ret;
-        while ((ret = av_read_frame(_formatCtx, &packet)) >= 0) {
-            if (packet.stream_index != _videoStreamIdx) {
-                av_packet_unref(&packet);
-                continue;
-            }
-            _lastPacketTimestamp = packet.pts;
-
-            avcodec_send_packet(_videoCodecCtx, &packet);
-            ret = avcodec_receive_frame(_videoCodecCtx, _avFrame);
-            av_packet_unref(&packet);
-            if (ret == AVERROR(EAGAIN)) {
-                continue;
-            } else if (ret < 0) {
-                break;
-            }
-
-            if (_lastPacketTimestamp < timestamp) {
-                continue;
-            }
-            sws_scale(
-                _swsContext,
-                _avFrame->data, _avFrame->linesize, 0, _videoCodecCtx->height,
-                _avFrameScaled->data, _avFrameScaled->linesize);
-            auto pixels = std::make_shared<ByteBuffer>(3ll * _videoCodecCtx->width * _videoCodecCtx->height, '\0');
-            for (int y = 0; y < _videoCodecCtx->height; ++y) {
-                int dstIdx = 3 * _videoCodecCtx->width * y;
-                uint8_t *src = _avFrameScaled->data[0] + static_cast<long long>(y) * _avFrameScaled->linesize[0];
-                memcpy(pixels->data() + dstIdx, src, 3ll * _videoCodecCtx->width);
-            }
-            _frame.pixels = std::move(pixels);
-
-            break;
-        }
-        if (ret < 0) {
-            _ended = true;
-        }
-    }
-
-    void loadAudioClip() {
-        _audioStream = std::make_shared<AudioClip>();
-
-        AVPacket packet;
-        int ret;
-        while ((ret = av_read_frame(_formatCtx, &packet)) >= 0) {
-            if (packet.stream_index != _audioStreamIdx) {
-                av_packet_unref(&packet);
-                continue;
-            }
-            avcodec_send_packet(_audioCodecCtx, &packet);
-            av_packet_unref(&packet);
-            while ((ret = avcodec_receive_frame(_audioCodecCtx, _avFrame)) >= 0) {
-                // Resample frame
-                int numSamples = swr_get_out_samples(_swrContext, _avFrame->nb_samples);
-                int bufSize = av_samples_get_buffer_size(nullptr, 1, numSamples, AV_SAMPLE_FMT_S16, 1);
-                ByteBuffer samples(bufSize, '\0');
-                uint8_t *samplesPtr = reinterpret_cast<uint8_t *>(&samples[0]);
-                swr_convert(
-                    _swrContext,
-                    &samplesPtr, numSamples,
-                    const_cast<const uint8_t **>(&_avFrame->extended_data[0]), _avFrame->nb_samples);
-
-                // Save frame
-                AudioClip::Frame frame;
-                frame.format = AudioFormat::Mono16;
-                frame.sampleRate = _audioCodecCtx->sample_rate;
-                frame.samples = std::move(samples);
-                _audioStream->add(std::move(frame));
-            }
-            if (ret < 0) {
-                if (ret == AVERROR_EOF || ret == AVERROR(EAGAIN)) {
-                    continue;
-                } else {
-                    break;
-                }
-            }
-        }
-    }
-
-    void seekBeginning() {
-        av_seek_frame(_formatCtx, -1, 0, AVSEEK_FLAG_ANY);
-    }
-
-    int64_t streamTimestampFromTime(int streamIdx, float time) {
-        auto micros = static_cast<int64_t>(1e6f * time);
-        return av_rescale_q(micros, AVRational {1, AV_TIME_BASE}, _formatCtx->streams[streamIdx]->time_base);
-    }
-
-    float timeFromStreamTimestamp(int streamIdx, int64_t timestamp) {
-        int64_t micros = av_rescale_q(timestamp, _formatCtx->streams[streamIdx]->time_base, AVRational {1, AV_TIME_BASE});
-        return micros / 1e6f;
-    }
-
-    inline bool hasAudio() const {
-        return _audioStreamIdx != -1;
+    void resampleFrame(AudioClip::Frame &frame) {
+        int numSamples = swr_get_out_samples(_swrContext, _avFrame->nb_samples);
+        int bufSize = av_samples_get_buffer_size(nullptr, 1, numSamples, AV_SAMPLE_FMT_S16, 1);
+        frame.format = AudioFormat::Mono16;
+        frame.sampleRate = _audioCodecCtx->sample_rate;
+        frame.samples.resize(bufSize);
+        uint8_t *samplesPtr = reinterpret_cast<uint8_t *>(&frame.samples[0]);
+        int numConverted = swr_convert(
+            _swrContext,
+            &samplesPtr, numSamples,
+            const_cast<const uint8_t **>(&_avFrame->extended_data[0]), _avFrame->nb_samples);
+        frame.samples.resize(2ll * std::max(numConverted, 0));
     }
 };
 
@@ -326,12 +427,44 @@ void BikReader::load() {
         throw FileNotFoundException("BIK: file not found: " + _path.string());
     }
 
-    auto decoder = std::make_shared<BinkVideoDecoder>(_path);
+    auto demuxer = std::make_shared<BinkDemuxer>(_path);
+    demuxer->open();
+    auto decoder = std::make_shared<BinkVideoDecoder>(demuxer);
     decoder->load();
 
+    // Audio is decoded as it is played. First source shares the demuxer with
+    // the video decoder, so that the file is demuxed once; later sources
+    // open their own. Open it here, so that a corrupt audio track is detected
+    // on this thread rather than on the audio thread.
+    std::shared_ptr<AudioClip> audioClip;
+    if (demuxer->hasAudio()) {
+        auto opened = std::make_shared<std::unique_ptr<BinkAudioDecoder>>(std::make_unique<BinkAudioDecoder>(demuxer));
+        try {
+            (*opened)->load();
+        } catch (const std::exception &ex) {
+            warn("BIK: unreadable audio track, playing without sound: " + std::string(ex.what()));
+            opened.reset();
+        }
+        if (opened) {
+            audioClip = std::make_shared<AudioClip>(
+                [path = _path, opened]() -> std::unique_ptr<IAudioDecoder> {
+                    auto stream = std::exchange(*opened, nullptr);
+                    if (!stream) {
+                        auto ownDemuxer = std::make_shared<BinkDemuxer>(path);
+                        ownDemuxer->open();
+                        stream = std::make_unique<BinkAudioDecoder>(std::move(ownDemuxer));
+                        stream->load();
+                    }
+                    return std::make_unique<AudioStreamDecoder>(std::move(stream));
+                },
+                demuxer->audioDuration());
+        }
+    }
+
     _movie = std::make_shared<Movie>(_graphicsSvc, _audioPlayer);
     _movie->setVideoStream(decoder);
-    _movie->setAudioClip(decoder->audioStream());
+    _movie->setAudioClip(std::move(audioClip));
+    _movie->setConvertToRGB(!_graphicsOpt.movieYUV);
     _movie->init();
 #endif
 }
@@ -26,6 +26,7 @@
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/textureutil.h"
 #include "reone/graphics/uniforms.h"
+#include "reone/movie/yuvutil.h"
 
 using namespace reone::audio;
 using namespace reone::graphics;
@@ -34,19 +35,36 @@ namespace reone {
 
 namespace movie {
 
+static constexpr int kPlaneTextureUnits[] {TextureUnits::mainTex, TextureUnits::chromaU, TextureUnits::chromaV};
+
+static std::shared_ptr<Texture> createFrameTexture(std::string name, int w, int h, PixelFormat format) {
+    auto texture = std::make_shared<Texture>(
+        std::move(name),
+        TextureType::TwoDim,
+        getTextureProperties(TextureUsage::Movie));
+    texture->clear(w, h, format);
+    texture->init();
+    return texture;
+}
+
 void Movie::init() {
     if (_inited) {
         return;
     }
-    if (!_texture && _videoStream) {
+    if (!_videoPlayer && _videoStream) {
         _width = _videoStream->width();
         _height = _videoStream->height();
-        _texture = std::make_shared<Texture>(
-            "video",
-            TextureType::TwoDim,
-            getTextureProperties(TextureUsage::Movie));
-        _texture->clear(1, 1, PixelFormat::RGB8);
-        _texture->init();
+        if (_convertToRGB) {
+            _texture = createFrameTexture("video", _width, _height, PixelFormat::RGB8);
+        } else {
+            int chromaWidth = getChromaSize(_width);
+            int chromaHeight = getChromaSize(_height);
+            _planeTextures[0] = createFrameTexture("video_y", _width, _height, PixelFormat::R8);
+            _planeTextures[1] = createFrameTexture("video_u", chromaWidth, chromaHeight, PixelFormat::R8);
+            _planeTextures[2] = createFrameTexture("video_v", chromaWidth, chromaHeight, PixelFormat::R8);
+        }
+        _videoPlayer = std::make_unique<VideoPlayer>(_videoStream, _convertToRGB);
+        _videoPlayer->init();
     }
     if (!_audioSource && _audioStream) {
         _audioSource = _audioPlayer.play(_audioStream, AudioType::Movie);
@@ -64,9 +82,15 @@ void Movie::deinit() {
     if (_audioStream) {
         _audioStream.reset();
     }
+    if (_videoPlayer) {
+        _videoPlayer.reset();
+    }
     if (_texture) {
         _texture.reset();
     }
+    for (auto &texture : _planeTextures) {
+        texture.reset();
+    }
     if (_videoStream) {
         _videoStream.reset();
     }
@@ -74,25 +98,40 @@ void Movie::deinit() {
 }
 
 void Movie::update(float dt) {
-    if (!_videoStream || _finished) {
+    if (!_videoPlayer || _finished) {
         return;
     }
     _time += dt;
-    _videoStream->seek(_time);
-    if (_videoStream->hasEnded()) {
+    if (_videoPlayer->update(_time)) {
+        _frameChanged = true;
+    }
+    if (_videoPlayer->hasEnded()) {
         _finished = true;
     }
 }
 
 void Movie::render() {
-    if (!_videoStream) {
+    if (!_videoPlayer || !_videoPlayer->frame()) {
         return;
     }
-    auto &frame = _videoStream->frame();
-    if (frame.pixels) {
+    // Frame buffers are reused by the decoder once the next frame is
+    // selected, so they are uploaded right away and not retained
+    auto frame = _videoPlayer->frame();
+    if (_convertToRGB) {
         _graphicsSvc.context.bindTexture(*_texture);
-        _texture->setPixels(_width, _height, PixelFormat::RGB8, Texture::Layer {frame.pixels}, true);
+        if (_frameChanged) {
+            _texture->setSubPixels(0, 0, _width, _height, *frame->pixels);
+        }
+    } else {
+        for (int i = 0; i < 3; ++i) {
+            auto &texture = *_planeTextures[i];
+            _graphicsSvc.context.bindTexture(texture, kPlaneTextureUnits[i]);
+            if (_frameChanged) {
+                texture.setSubPixels(0, 0, texture.width(), texture.height(), *frame->planes[i]);
+            }
+        }
     }
+    _frameChanged = false;
     _graphicsSvc.uniforms.setLocals([](auto &locals) {
         locals.reset();
         locals.uv = glm::mat3x4(
@@ -100,7 +139,8 @@ void Movie::render() {
             glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
     });
-    _graphicsSvc.context.useProgram(_graphicsSvc.shaderRegistry.get(ShaderProgramId::ndcTexture));
+    auto &program = _graphicsSvc.shaderRegistry.get(_convertToRGB ? ShaderProgramId::ndcTexture : ShaderProgramId::ndcTextureYUV);
+    _graphicsSvc.context.useProgram(program);
     _graphicsSvc.meshRegistry.get(MeshName::quadNDC).draw(_graphicsSvc.statistic);
 }
 
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/movie/videoplayer.h"
+
+#include "reone/movie/yuvutil.h"
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+namespace movie {
+
+static constexpr int kWakeIntervalMs = 5;
+
+void VideoPlayer::init() {
+    if (_running) {
+        return;
+    }
+    int width = _stream->width();
+    int height = _stream->height();
+    size_t lumaSize = static_cast<size_t>(width) * height;
+    size_t chromaSize = static_cast<size_t>(getChromaSize(width)) * getChromaSize(height);
+    for (size_t i = 0; i < kNumFrames; ++i) {
+        auto &frame = _frames[i];
+        frame.planes[0] = std::make_shared<ByteBuffer>(lumaSize, '\0');
+        frame.planes[1] = std::make_shared<ByteBuffer>(chromaSize, '\0');
+        frame.planes[2] = std::make_shared<ByteBuffer>(chromaSize, '\0');
+        if (_convertToRGB) {
+            frame.pixels = std::make_shared<ByteBuffer>(3 * lumaSize, '\0');
+        }
+        _freeFrames.push(static_cast<int>(i));
+    }
+    _running = true;
+    _thread = std::thread(std::bind(&VideoPlayer::threadFunc, this));
+}
+
+void VideoPlayer::deinit() {
+    if (!_running) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock {_wakeMutex};
+        _running = false;
+    }
+    _wakeCondVar.notify_one();
+    _thread.join();
+}
+
+void VideoPlayer::threadFunc() {
+    setThreadName("video");
+    float prevTime = 0.0f;
+    bool hasPrevFrame = false;
+    while (_running) {
+        int index;
+        if (!_freeFrames.pop(index)) {
+            std::unique_lock<std::mutex> lock {_wakeMutex};
+            _wakeCondVar.wait_for(lock, std::chrono::milliseconds {kWakeIntervalMs}, [this]() {
+                return !_running || !_freeFrames.empty();
+            });
+            continue;
+        }
+        float time;
+        while (true) {
+            if (!_stream->decodeFrame(time)) {
+                _ended = true;
+                return;
+            }
+            // Frame is late if the next frame is due already
+            float duration = time - prevTime;
+            bool late = hasPrevFrame && time + duration < _time.load(std::memory_order_relaxed);
+            prevTime = time;
+            hasPrevFrame = true;
+            if (!late || !_running) {
+                break;
+            }
+            ++_numSkippedFrames;
+        }
+        auto &frame = _frames[index];
+        auto y = reinterpret_cast<uint8_t *>(frame.planes[0]->data());
+        auto u = reinterpret_cast<uint8_t *>(frame.planes[1]->data());
+        auto v = reinterpret_cast<uint8_t *>(frame.planes[2]->data());
+        _stream->copyFrame(y, u, v);
+        if (_convertToRGB) {
+            convertYUV420ToRGB(
+                _stream->width(), _stream->height(),
+                y, u, v,
+                reinterpret_cast<uint8_t *>(frame.pixels->data()));
+        }
+        frame.time = time;
+        _decodedFrames.push(index);
+    }
+}
+
+bool VideoPlayer::update(float time) {
+    _time.store(time, std::memory_order_relaxed);
+    bool selected = false;
+    const int *index;
+    while ((index = _decodedFrames.front()) && _frames[*index].time <= time) {
+        int next;
+        _decodedFrames.pop(next);
+        if (_currentFrame != -1) {
+            if (selected) {
+                ++_numDroppedFrames;
+            }
+            releaseFrame(_currentFrame);
+        }
+        _currentFrame = next;
+        selected = true;
+    }
+    return selected;
+}
+
+void VideoPlayer::releaseFrame(int index) {
+    _freeFrames.push(index);
+    _wakeCondVar.notify_one();
+}
+
+bool VideoPlayer::hasEnded() const {
+    return _ended && _decodedFrames.empty();
+}
+
+const VideoPlayer::Frame *VideoPlayer::frame() const {
+    return _currentFrame != -1 ? &_frames[_currentFrame] : nullptr;
+}
+
+} // namespace movie
+
+} // namespace reone
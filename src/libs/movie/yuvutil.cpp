@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/movie/yuvutil.h"
+
+namespace reone {
+
+namespace movie {
+
+// BT.601 coefficients in 16.16 fixed point
+static constexpr int kLumaScale = 76309; // 1.164383
+static constexpr int kCrToR = 104597;    // 1.596027
+static constexpr int kCbToG = 25675;     // 0.391762
+static constexpr int kCrToG = 53279;     // 0.812968
+static constexpr int kCbToB = 132201;    // 2.017232
+static constexpr int kRoundingBias = 32768;
+
+static inline uint8_t clampToByte(int value) {
+    return static_cast<uint8_t>(std::clamp(value, 0, 255));
+}
+
+glm::u8vec3 convertYUVToRGB(uint8_t y, uint8_t u, uint8_t v) {
+    int luma = kLumaScale * (y - 16) + kRoundingBias;
+    int cb = u - 128;
+    int cr = v - 128;
+    return glm::u8vec3(
+        clampToByte((luma + kCrToR * cr) >> 16),
+        clampToByte((luma - kCbToG * cb - kCrToG * cr) >> 16),
+        clampToByte((luma + kCbToB * cb) >> 16));
+}
+
+void convertYUV420ToRGB(int w, int h, const uint8_t *y, const uint8_t *u, const uint8_t *v, uint8_t *rgb) {
+    int chromaWidth = getChromaSize(w);
+    for (int row = 0; row < h; ++row) {
+        const uint8_t *yRow = y + static_cast<size_t>(row) * w;
+        const uint8_t *uRow = u + static_cast<size_t>(row / 2) * chromaWidth;
+        const uint8_t *vRow = v + static_cast<size_t>(row / 2) * chromaWidth;
+        for (int col = 0; col < w; ++col) {
+            auto color = convertYUVToRGB(yRow[col], uRow[col / 2], vRow[col / 2]);
+            *rgb++ = color.r;
+            *rgb++ = color.g;
+            *rgb++ = color.b;
+        }
+    }
+}
+
+} // namespace movie
+
+} // namespace reone
@@ -25,139 +25,333 @@ namespace resource {
 
 static constexpr char kCellValueDeleted[] = "****";
 
-int TwoDA::indexByCellValue(const std::string &column, const std::string &value) const {
-    int columnIdx = getColumnIndex(column);
-    if (columnIdx == -1) {
-        warn("2DA: column not found: " + column);
-        return -1;
+enum class CellState : uint8_t {
+    Empty,
+    Deleted,
+    Invalid,
+    Parsed
+};
+
+template <class T>
+struct ParsedCell {
+    CellState state {CellState::Empty};
+    T value {};
+};
+
+struct TwoDA::ColumnCache {
+    std::once_flag intsParsed;
+    std::once_flag floatsParsed;
+    std::once_flag indexed;
+
+    std::vector<ParsedCell<int>> ints;
+    std::vector<ParsedCell<float>> floats;
+    std::unordered_map<std::string_view, int> rowByValue;
+};
+
+template <class T, class Parse>
+static std::vector<ParsedCell<T>> parseColumn(const TwoDA &twoDa, int column, Parse parse) {
+    auto cells = std::vector<ParsedCell<T>>(twoDa.getRowCount());
+    for (int row = 0; row < twoDa.getRowCount(); ++row) {
+        auto value = twoDa.cell(row, column);
+        auto &cell = cells[row];
+        if (value.empty()) {
+            cell.state = CellState::Empty;
+        } else if (value == kCellValueDeleted) {
+            cell.state = CellState::Deleted;
+        } else {
+            try {
+                cell.value = parse(std::string(value));
+                cell.state = CellState::Parsed;
+            } catch (const std::exception &) {
+                cell.state = CellState::Invalid;
+            }
+        }
+    }
+    return cells;
+}
+
+static int parseInt(const std::string &value) {
+    return stoi(value);
+}
+
+static float parseFloat(const std::string &value) {
+    return stof(value);
+}
+
+TwoDA::TwoDA(std::vector<std::string> columns, std::vector<Row> rows) :
+    _columns(std::move(columns)),
+    _rowCount(static_cast<int>(rows.size())) {
+
+    size_t numColumns = _columns.size();
+    for (size_t row = 0; row < rows.size(); ++row) {
+        size_t numValues = rows[row].values.size();
+        if (numValues != numColumns) {
+            throw ValidationException(str(boost::format("Expected %d columns in 2DA row %d, was %d") % numColumns % row % numValues));
+        }
     }
-    for (size_t i = 0; i < _rows.size(); ++i) {
-        if (_rows[i].values[columnIdx] == value)
-            return static_cast<int>(i);
+
+    auto valueToOffset = std::unordered_map<std::string, uint32_t>();
+    _cells.resize(numColumns * _rowCount);
+    for (size_t row = 0; row < rows.size(); ++row) {
+        for (size_t column = 0; column < numColumns; ++column) {
+            auto &value = rows[row].values[column];
+            auto [it, inserted] = valueToOffset.emplace(value, static_cast<uint32_t>(_pool.size()));
+            if (inserted) {
+                _pool.append(value.c_str());
+                _pool.push_back('\0');
+            }
+            _cells[column * _rowCount + row] = it->second;
+        }
+    }
+    if (_pool.empty()) {
+        _pool.push_back('\0');
     }
 
-    return -1;
+    indexColumns();
+}
+
+TwoDA::TwoDA(std::vector<std::string> columns, int rowCount, std::string pool, const std::vector<uint16_t> &offsets) :
+    _columns(std::move(columns)),
+    _rowCount(rowCount),
+    _pool(std::move(pool)) {
+
+    size_t numColumns = _columns.size();
+    if (offsets.size() != numColumns * _rowCount) {
+        throw ValidationException(str(boost::format("Expected %d 2DA cells, was %d") % (numColumns * _rowCount) % offsets.size()));
+    }
+    if (_pool.empty() || _pool.back() != '\0') {
+        _pool.push_back('\0');
+    }
+
+    _cells.resize(offsets.size());
+    for (int row = 0; row < _rowCount; ++row) {
+        for (size_t column = 0; column < numColumns; ++column) {
+            uint16_t offset = offsets[row * numColumns + column];
+            if (offset >= _pool.size()) {
+                throw ValidationException(str(boost::format("2DA cell offset out of range: %d") % offset));
+            }
+            _cells[column * _rowCount + row] = offset;
+        }
+    }
+
+    indexColumns();
 }
 
-int TwoDA::getColumnIndex(const std::string &column) const {
+TwoDA::~TwoDA() = default;
+
+void TwoDA::indexColumns() {
     for (size_t i = 0; i < _columns.size(); ++i) {
-        if (_columns[i] == column)
-            return static_cast<int>(i);
+        _columnIndices.emplace(_columns[i], static_cast<int>(i));
+        _caches.push_back(std::make_unique<ColumnCache>());
     }
-    return -1;
 }
 
-static std::vector<std::string> getColumnNames(const std::vector<std::pair<std::string, std::string>> &values) {
-    std::vector<std::string> names;
-    for (auto &val : values) {
-        names.push_back(val.first);
+TwoDA::Column TwoDA::column(const std::string &name) const {
+    auto it = _columnIndices.find(name);
+    if (it == _columnIndices.end()) {
+        return Column();
+    }
+    return Column(it->second);
+}
+
+int TwoDA::indexByCellValue(const std::string &column, const std::string &value) const {
+    auto handle = this->column(column);
+    if (!handle.isValid()) {
+        warn("2DA: column not found: " + column);
+        return -1;
     }
-    return names;
+    return indexByCellValue(handle, value);
+}
+
+int TwoDA::indexByCellValue(Column column, std::string_view value) const {
+    if (!column.isValid()) {
+        return -1;
+    }
+    auto &cache = *_caches[column._index];
+    std::call_once(cache.indexed, [this, &cache, &column]() {
+        for (int row = 0; row < _rowCount; ++row) {
+            cache.rowByValue.emplace(cell(row, column._index), row);
+        }
+    });
+    auto it = cache.rowByValue.find(value);
+    return it != cache.rowByValue.end() ? it->second : -1;
 }
 
 int TwoDA::indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const {
-    std::vector<std::string> columns(getColumnNames(values));
-    std::vector<int> columnIndices(getColumnIndices(columns));
+    std::vector<int> columnIndices;
+    for (auto &[name, _] : values) {
+        auto handle = column(name);
+        if (!handle.isValid()) {
+            throw std::logic_error("Column not found: " + name);
+        }
+        columnIndices.push_back(handle._index);
+    }
 
-    for (size_t i = 0; i < _rows.size(); ++i) {
+    for (int i = 0; i < _rowCount; ++i) {
         bool match = true;
         for (size_t j = 0; j < values.size(); ++j) {
-            int columnIdx = columnIndices[j];
-            if (_rows[i].values[columnIdx] != values[j].second) {
+            if (cell(i, columnIndices[j]) != values[j].second) {
                 match = false;
                 break;
             }
         }
         if (match)
-            return static_cast<int>(i);
+            return i;
     }
 
     return -1;
 }
 
-std::vector<int> TwoDA::getColumnIndices(const std::vector<std::string> &columns) const {
-    std::vector<int> indices;
-    for (auto &column : columns) {
-        int index = getColumnIndex(column);
-        if (index == -1) {
-            throw std::logic_error("Column not found: " + column);
-        }
-        indices.push_back(index);
+bool TwoDA::checkCell(int row, Column column) const {
+    if (row < 0 || row >= _rowCount) {
+        warn("2DA: row index out of range: " + std::to_string(row));
+        return false;
     }
-    return indices;
+    return column.isValid();
 }
 
-std::string TwoDA::getString(int row, const std::string &column, std::string defValue) const {
-    return getStringOpt(row, column).value_or(defValue);
+const TwoDA::ColumnCache &TwoDA::intColumn(Column column) const {
+    auto &cache = *_caches[column._index];
+    std::call_once(cache.intsParsed, [this, &cache, &column]() {
+        cache.ints = parseColumn<int>(*this, column._index, parseInt);
+    });
+    return cache;
 }
 
-std::optional<std::string> TwoDA::getStringOpt(int row, const std::string &column) const {
-    if (row < 0 || row >= _rows.size()) {
-        warn("2DA: row index out of range: " + std::to_string(row));
+const TwoDA::ColumnCache &TwoDA::floatColumn(Column column) const {
+    auto &cache = *_caches[column._index];
+    std::call_once(cache.floatsParsed, [this, &cache, &column]() {
+        cache.floats = parseColumn<float>(*this, column._index, parseFloat);
+    });
+    return cache;
+}
+
+template <class T, class Parse>
+static std::optional<T> cachedValue(const ParsedCell<T> &cell, const TwoDA &twoDa, int row, int column, Parse parse) {
+    switch (cell.state) {
+    case CellState::Parsed:
+        return cell.value;
+    case CellState::Deleted:
+        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % twoDa.columns()[column]));
+        return std::nullopt;
+    case CellState::Invalid:
+        // Parse again to throw the same exception as uncached lookups
+        return parse(std::string(twoDa.cell(row, column)));
+    default:
         return std::nullopt;
     }
+}
 
-    int columnIdx = getColumnIndex(column);
-    if (columnIdx == -1) {
+std::string TwoDA::getString(int row, const std::string &column, std::string defValue) const {
+    return getString(row, this->column(column), std::move(defValue));
+}
+
+std::optional<std::string> TwoDA::getStringOpt(int row, const std::string &column) const {
+    auto value = getStringOpt(row, this->column(column));
+    if (!value) {
         return std::nullopt;
     }
+    return std::string(*value);
+}
+
+int TwoDA::getInt(int row, const std::string &column, int defValue) const {
+    return getInt(row, this->column(column), defValue);
+}
 
-    const std::string &value = _rows[row].values[columnIdx];
+std::optional<int> TwoDA::getIntOpt(int row, const std::string &column) const {
+    return getIntOpt(row, this->column(column));
+}
+
+uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue) const {
+    return getHexInt(row, this->column(column), defValue);
+}
+
+std::optional<uint32_t> TwoDA::getHexIntOpt(int row, const std::string &column) const {
+    return getHexIntOpt(row, this->column(column));
+}
+
+float TwoDA::getFloat(int row, const std::string &column, float defValue) const {
+    return getFloat(row, this->column(column), defValue);
+}
 
+std::optional<float> TwoDA::getFloatOpt(int row, const std::string &column) const {
+    return getFloatOpt(row, this->column(column));
+}
+
+bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
+    return getBool(row, this->column(column), defValue);
+}
+
+std::optional<bool> TwoDA::getBoolOpt(int row, const std::string &column) const {
+    return getBoolOpt(row, this->column(column));
+}
+
+std::string TwoDA::getString(int row, Column column, std::string defValue) const {
+    auto value = getStringOpt(row, column);
+    if (!value) {
+        return defValue;
+    }
+    return std::string(*value);
+}
+
+std::optional<std::string_view> TwoDA::getStringOpt(int row, Column column) const {
+    if (!checkCell(row, column)) {
+        return std::nullopt;
+    }
+    auto value = cell(row, column._index);
     if (value == kCellValueDeleted) {
-        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % column));
+        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % _columns[column._index]));
         return std::nullopt;
     }
-
     return value;
 }
 
-int TwoDA::getInt(int row, const std::string &column, int defValue) const {
+int TwoDA::getInt(int row, Column column, int defValue) const {
     return getIntOpt(row, column).value_or(defValue);
 }
 
-std::optional<int> TwoDA::getIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<int> TwoDA::getIntOpt(int row, Column column) const {
+    if (!checkCell(row, column)) {
         return std::nullopt;
     }
-    return stoi(value);
+    auto &cache = intColumn(column);
+    return cachedValue(cache.ints[row], *this, row, column._index, parseInt);
 }
 
-uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue) const {
+uint32_t TwoDA::getHexInt(int row, Column column, uint32_t defValue) const {
     return getHexIntOpt(row, column).value_or(defValue);
 }
 
-std::optional<uint32_t> TwoDA::getHexIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<uint32_t> TwoDA::getHexIntOpt(int row, Column column) const {
+    auto value = getStringOpt(row, column);
+    if (!value || value->empty()) {
         return std::nullopt;
     }
-    return stoi(value, nullptr, 16);
+    return stoi(std::string(*value), nullptr, 16);
 }
 
-float TwoDA::getFloat(int row, const std::string &column, float defValue) const {
+float TwoDA::getFloat(int row, Column column, float defValue) const {
     return getFloatOpt(row, column).value_or(defValue);
 }
 
-std::optional<float> TwoDA::getFloatOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<float> TwoDA::getFloatOpt(int row, Column column) const {
+    if (!checkCell(row, column)) {
         return std::nullopt;
     }
-    return stof(value);
+    auto &cache = floatColumn(column);
+    return cachedValue(cache.floats[row], *this, row, column._index, parseFloat);
 }
 
-bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
+bool TwoDA::getBool(int row, Column column, bool defValue) const {
     return getBoolOpt(row, column).value_or(defValue);
 }
 
-std::optional<bool> TwoDA::getBoolOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<bool> TwoDA::getBoolOpt(int row, Column column) const {
+    auto value = getIntOpt(row, column);
+    if (!value) {
         return std::nullopt;
     }
-    return stoi(value) != 0;
+    return *value != 0;
 }
 
 } // namespace resource
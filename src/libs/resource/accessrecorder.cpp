@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/accessrecorder.h"
+
+#include "reone/system/textwriter.h"
+
+namespace reone {
+
+namespace resource {
+
+static thread_local bool g_warmingUp = false;
+
+void ResourceAccessRecorder::beginModule(std::string name) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto &module = _modules.emplace_back();
+    module.name = std::move(name);
+}
+
+void ResourceAccessRecorder::advanceFrame() {
+    std::lock_guard<std::mutex> lock {_mutex};
+    ++_frame;
+}
+
+void ResourceAccessRecorder::recordAccess(const ResourceId &id, const std::string &container, size_t size) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    if (g_warmingUp) {
+        auto &module = currentModule();
+        if (module.idToRecord.count(id) == 0) {
+            auto &record = module.idToWarmedUp[id];
+            record.container = container;
+            record.size = size;
+        }
+        return;
+    }
+    auto &record = getOrAddRecord(id);
+    if (record.container.empty()) {
+        record.container = container;
+        record.size = size;
+    }
+}
+
+void ResourceAccessRecorder::recordDecode(const ResourceId &id, std::chrono::microseconds time) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    if (g_warmingUp) {
+        auto &module = currentModule();
+        auto it = module.idToWarmedUp.find(id);
+        if (it != module.idToWarmedUp.end()) {
+            it->second.decodeMicros += time.count();
+        }
+        return;
+    }
+    getOrAddRecord(id).decodeMicros += time.count();
+}
+
+void ResourceAccessRecorder::recordCacheHit(const ResourceId &id) {
+    if (g_warmingUp) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto &module = currentModule();
+    auto it = module.idToWarmedUp.find(id);
+    if (it == module.idToWarmedUp.end()) {
+        return;
+    }
+    auto warmedUp = std::move(it->second);
+    module.idToWarmedUp.erase(it);
+    auto &record = getOrAddRecord(id);
+    record.container = std::move(warmedUp.container);
+    record.size = warmedUp.size;
+    record.decodeMicros = warmedUp.decodeMicros;
+}
+
+ResourceAccessRecorder::ModuleRecords &ResourceAccessRecorder::currentModule() {
+    if (_modules.empty()) {
+        _modules.emplace_back();
+    }
+    return _modules.back();
+}
+
+ResourceAccessRecorder::Record &ResourceAccessRecorder::getOrAddRecord(const ResourceId &id) {
+    auto &module = currentModule();
+    auto it = module.idToRecord.find(id);
+    if (it != module.idToRecord.end()) {
+        return module.records[it->second];
+    }
+    auto &record = module.records.emplace_back();
+    record.module = module.name;
+    record.id = id;
+    record.frame = _frame;
+    module.idToRecord.insert({id, module.records.size() - 1});
+    return record;
+}
+
+void ResourceAccessRecorder::save(IOutputStream &stream) const {
+    auto writer = TextWriter(stream);
+    for (auto &record : records()) {
+        writer.writeLine(str(boost::format("%s\t%s\t%s\t%d\t%d\t%d") %
+                             (record.module.empty() ? "-" : record.module) %
+                             record.id.string() %
+                             (record.container.empty() ? "-" : record.container) %
+                             record.size %
+                             record.decodeMicros %
+                             record.frame));
+    }
+}
+
+std::vector<ResourceAccessRecorder::Record> ResourceAccessRecorder::records() const {
+    std::lock_guard<std::mutex> lock {_mutex};
+    std::vector<Record> records;
+    for (auto &module : _modules) {
+        records.insert(records.end(), module.records.begin(), module.records.end());
+    }
+    return records;
+}
+
+ScopedWarmUp::ScopedWarmUp() :
+    _wasWarmingUp(g_warmingUp) {
+    g_warmingUp = true;
+}
+
+ScopedWarmUp::~ScopedWarmUp() {
+    g_warmingUp = _wasWarmingUp;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -40,6 +40,30 @@ void ErfResourceContainer::init() {
     }
 }
 
+void ErfResourceContainer::init(const ResourceIndex::Snapshot &snapshot) {
+    for (auto &entry : snapshot.entries) {
+        auto resource = Resource();
+        resource.id = entry.id;
+        resource.offset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(resource.id);
+        _idToResource.insert(std::make_pair(resource.id, std::move(resource)));
+    }
+}
+
+ResourceIndex::Snapshot ErfResourceContainer::snapshot() const {
+    auto snapshot = ResourceIndex::Snapshot();
+    snapshot.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.offset = resource.offset;
+        entry.size = resource.fileSize;
+        snapshot.entries.push_back(std::move(entry));
+    }
+    return snapshot;
+}
+
 std::optional<ByteBuffer> ErfResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
@@ -52,6 +76,7 @@ std::optional<ByteBuffer> ErfResourceContainer::findResourceData(const ResourceI
     ByteBuffer buf;
     buf.resize(resource.fileSize);
 
+    std::lock_guard<std::mutex> lock(_streamMutex);
     IInputStream &erf = _storage.stream();
     erf.seek(resource.offset, SeekOrigin::Begin);
     erf.read(&buf[0], buf.size());
@@ -18,7 +18,7 @@
 #include "reone/resource/container/folder.h"
 
 #include "reone/resource/typeutil.h"
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/exception/filenotfound.h"
 
 namespace reone {
 
@@ -31,6 +31,7 @@ void FolderResourceContainer::init() {
 void FolderResourceContainer::loadDirectory(const std::filesystem::path &path) {
     for (auto &entry : std::filesystem::directory_iterator(path)) {
         if (std::filesystem::is_directory(entry.path())) {
+            _subdirectories.push_back(entry.path());
             loadDirectory(entry.path());
             continue;
         }
@@ -39,15 +40,49 @@ void FolderResourceContainer::loadDirectory(const std::filesystem::path &path) {
         auto resType = getResTypeByExt(ext);
         auto resId = ResourceId(resRef, resType);
 
+        std::error_code ec;
         Resource res;
         res.path = entry.path();
         res.type = resType;
+        res.size = static_cast<uint32_t>(entry.file_size(ec));
+        res.modified = static_cast<int64_t>(entry.last_write_time(ec).time_since_epoch().count());
 
         _resourceIds.insert(resId);
         _idToResource.insert(std::make_pair(resId, std::move(res)));
     }
 }
 
+void FolderResourceContainer::init(const ResourceIndex::Snapshot &snapshot) {
+    _subdirectories = snapshot.dependencies;
+    for (auto &entry : snapshot.entries) {
+        Resource res;
+        res.path = _path / snapshot.files.at(entry.file);
+        res.type = entry.id.type;
+        res.size = entry.size;
+        res.modified = entry.modified;
+
+        _resourceIds.insert(entry.id);
+        _idToResource.insert(std::make_pair(entry.id, std::move(res)));
+    }
+}
+
+ResourceIndex::Snapshot FolderResourceContainer::snapshot() const {
+    auto snapshot = ResourceIndex::Snapshot();
+    snapshot.dependencies = _subdirectories;
+    snapshot.files.reserve(_idToResource.size());
+    snapshot.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.file = static_cast<uint32_t>(snapshot.files.size());
+        entry.size = resource.size;
+        entry.modified = resource.modified;
+        snapshot.files.push_back(resource.path.lexically_relative(_path));
+        snapshot.entries.push_back(std::move(entry));
+    }
+    return snapshot;
+}
+
 std::optional<ByteBuffer> FolderResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
@@ -55,15 +90,19 @@ std::optional<ByteBuffer> FolderResourceContainer::findResourceData(const Resour
     }
     auto &resource = it->second;
 
-    auto stream = FileInputStream(resource.path);
-    auto len = stream.length();
-    if (len == 0) {
+    std::shared_ptr<FileHandleCache::File> file;
+    try {
+        file = _fileHandles.getCurrent(resource.path);
+    } catch (const FileNotFoundException &) {
+        return std::nullopt;
+    }
+    if (file->size() == 0) {
         return ByteBuffer();
     }
 
     ByteBuffer buf;
-    buf.resize(len);
-    stream.read(&buf[0], buf.size());
+    buf.resize(file->size());
+    buf.resize(file->read(0, &buf[0], buf.size()));
 
     return buf;
 }
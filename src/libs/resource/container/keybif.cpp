@@ -19,6 +19,7 @@
 
 #include "reone/resource/format/bifreader.h"
 #include "reone/resource/format/keyreader.h"
+#include "reone/system/exception/validation.h"
 #include "reone/system/fileutil.h"
 #include "reone/system/stream/fileinput.h"
 
@@ -42,27 +43,56 @@ void KeyBifResourceContainer::init() {
     for (auto i = 0; i < keyReader.files().size(); ++i) {
         auto &file = keyReader.files()[i];
         auto bifPath = getFileIgnoreCase(gamePath, file.filename);
-        auto bif = std::make_unique<FileInputStream>(bifPath);
-        auto bifReader = BifReader(*bif);
+        auto bif = FileInputStream(bifPath);
+        auto bifReader = BifReader(bif);
         bifReader.load();
 
-        auto &keys = bifIdxToKey.at(i);
         auto &bifResources = bifReader.resources();
+        auto keys = bifIdxToKey.find(i);
+        if (keys != bifIdxToKey.end()) {
+            for (auto &key : keys->second) {
+                auto &bifResource = bifResources[key->resIdx];
+
+                auto resource = Resource();
+                resource.bifIdx = key->bifIdx;
+                resource.bifOffset = bifResource.offset;
+                resource.fileSize = bifResource.fileSize;
+
+                _resourceIds.insert(key->resId);
+                _idToResource.insert(std::make_pair(key->resId, std::move(resource)));
+            }
+        }
 
-        for (auto &key : keys) {
-            auto &bifResource = bifResources[key->resIdx];
-
-            auto resource = Resource();
-            resource.bifIdx = key->bifIdx;
-            resource.bifOffset = bifResource.offset;
-            resource.fileSize = bifResource.fileSize;
+        _bifPaths.push_back(std::move(bifPath));
+    }
+}
 
-            _resourceIds.insert(key->resId);
-            _idToResource.insert(std::make_pair(key->resId, std::move(resource)));
-        }
+void KeyBifResourceContainer::init(const ResourceIndex::Snapshot &snapshot) {
+    _bifPaths = snapshot.files;
+    for (auto &entry : snapshot.entries) {
+        auto resource = Resource();
+        resource.bifIdx = static_cast<int>(entry.file);
+        resource.bifOffset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(entry.id);
+        _idToResource.insert(std::make_pair(entry.id, std::move(resource)));
+    }
+}
 
-        _bifs.push_back(std::move(bif));
+ResourceIndex::Snapshot KeyBifResourceContainer::snapshot() const {
+    auto snapshot = ResourceIndex::Snapshot();
+    snapshot.dependencies = _bifPaths;
+    snapshot.files = _bifPaths;
+    snapshot.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.file = static_cast<uint32_t>(resource.bifIdx);
+        entry.offset = resource.bifOffset;
+        entry.size = resource.fileSize;
+        snapshot.entries.push_back(std::move(entry));
     }
+    return snapshot;
 }
 
 std::optional<ByteBuffer> KeyBifResourceContainer::findResourceData(const ResourceId &id) {
@@ -74,12 +104,13 @@ std::optional<ByteBuffer> KeyBifResourceContainer::findResourceData(const Resour
     if (resource.fileSize == 0) {
         return ByteBuffer();
     }
+    auto bif = _fileHandles.get(_bifPaths.at(resource.bifIdx));
     ByteBuffer buf;
     buf.resize(resource.fileSize);
-
-    auto &bif = _bifs.at(resource.bifIdx);
-    bif->seek(resource.bifOffset, SeekOrigin::Begin);
-    bif->read(&buf[0], buf.size());
+    auto numRead = bif->read(resource.bifOffset, &buf[0], buf.size());
+    if (numRead != buf.size()) {
+        throw ValidationException("Resource data out of BIF bounds: " + id.string());
+    }
 
     return buf;
 }
@@ -38,6 +38,30 @@ void RimResourceContainer::init() {
     }
 }
 
+void RimResourceContainer::init(const ResourceIndex::Snapshot &snapshot) {
+    for (auto &entry : snapshot.entries) {
+        auto resource = Resource();
+        resource.id = entry.id;
+        resource.offset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(resource.id);
+        _idToResource.insert(std::make_pair(resource.id, std::move(resource)));
+    }
+}
+
+ResourceIndex::Snapshot RimResourceContainer::snapshot() const {
+    auto snapshot = ResourceIndex::Snapshot();
+    snapshot.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.offset = resource.offset;
+        entry.size = resource.fileSize;
+        snapshot.entries.push_back(std::move(entry));
+    }
+    return snapshot;
+}
+
 std::optional<ByteBuffer> RimResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
@@ -50,6 +74,7 @@ std::optional<ByteBuffer> RimResourceContainer::findResourceData(const ResourceI
     ByteBuffer buf;
     buf.resize(resource.fileSize);
 
+    std::lock_guard<std::mutex> lock(_streamMutex);
     IInputStream &rim = _storage.stream();
     rim.seek(resource.offset, SeekOrigin::Begin);
     rim.read(&buf[0], buf.size());
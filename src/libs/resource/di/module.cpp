@@ -20,13 +20,31 @@
 #include "reone/audio/di/module.h"
 #include "reone/graphics/di/module.h"
 #include "reone/script/di/module.h"
+#include "reone/system/fileutil.h"
+#include "reone/system/logutil.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/fileoutput.h"
 
 namespace reone {
 
 namespace resource {
 
+/**
+ * Resource index, access log and working set manifest are kept in a per-user
+ * cache directory, as neither the working directory nor the game directory
+ * are guaranteed to be writable. File names are derived from the game path,
+ * so that installations do not overwrite each other's files.
+ */
+static constexpr char kResourceIndexPrefix[] = "resindex";
+static constexpr char kAccessLogPrefix[] = "resaccess";
+static constexpr char kWorkingSetPrefix[] = "workingset";
+
 void ResourceModule::init() {
+    auto resourceIndex = std::make_unique<ResourceIndex>(getGameCacheFilePath(_gamePath, kResourceIndexPrefix, ".bin"));
+    resourceIndex->load();
+
     _resources = std::make_unique<Resources>();
+    _resources->setIndex(std::move(resourceIndex));
     _strings = std::make_unique<Strings>();
     _twoDas = std::make_unique<TwoDAs>(*_resources);
     _gffs = std::make_unique<Gffs>(*_resources);
@@ -50,8 +68,11 @@ void ResourceModule::init() {
         _graphics.uniforms(),
         _graphics.statistic(),
         *_resources);
-    _audioClips = std::make_unique<AudioClips>(*_resources);
-    _movies = std::make_unique<Movies>(_gamePath, _graphics.services(), _audio.mixer());
+    _audioClips = std::make_unique<AudioClips>(
+        *_resources,
+        &_audio.backend(),
+        static_cast<size_t>(_audioOpt.clipCacheMb) * 1024 * 1024);
+    _movies = std::make_unique<Movies>(_gamePath, _graphicsOpt, _graphics.services(), _audio.mixer());
     _scripts = std::make_unique<Scripts>(*_resources);
     _dialogs = std::make_unique<Dialogs>(*_gffs, *_strings);
     _layouts = std::make_unique<Layouts>(*_resources);
@@ -72,7 +93,22 @@ void ResourceModule::init() {
         *_resources,
         *_scripts);
 
+    if (_recordAccess) {
+        _accessRecorder = std::make_unique<ResourceAccessRecorder>();
+        _resources->setAccessRecorder(_accessRecorder.get());
+        _director->setAccessRecorder(_accessRecorder.get());
+    }
+    _director->setThreadPool(_threadPool);
+    auto workingSetPath = getGameCacheFilePath(_gamePath, kWorkingSetPrefix, ".txt");
+    if (std::filesystem::exists(workingSetPath)) {
+        _workingSet = std::make_unique<WorkingSetManifest>();
+        auto stream = FileInputStream(workingSetPath);
+        _workingSet->load(stream);
+        _director->setWorkingSet(_workingSet.get());
+    }
+
     _director->init();
+    _resources->saveIndex();
     _strings->init(_gamePath);
     _shaders->init();
     _textures->init();
@@ -102,6 +138,20 @@ void ResourceModule::init() {
 }
 
 void ResourceModule::deinit() {
+    if (_accessRecorder) {
+        auto logPath = getGameCacheFilePath(_gamePath, kAccessLogPrefix, ".log");
+        try {
+            std::filesystem::create_directories(logPath.parent_path());
+            auto stream = FileOutputStream(logPath);
+            _accessRecorder->save(stream);
+            info("Resource access log saved to " + logPath.string(), LogChannel::Resources);
+        } catch (const std::exception &ex) {
+            warn("Resource access log not saved: " + std::string(ex.what()), LogChannel::Resources);
+        }
+        _resources->setAccessRecorder(nullptr);
+        _director->setAccessRecorder(nullptr);
+        _accessRecorder.reset();
+    }
     _services.reset();
 
     _director.reset();
@@ -125,6 +175,7 @@ void ResourceModule::deinit() {
     _twoDas.reset();
     _strings.reset();
     _resources.reset();
+    _workingSet.reset();
 }
 
 } // namespace resource
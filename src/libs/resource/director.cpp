@@ -31,6 +31,8 @@
 #include "reone/resource/resources.h"
 #include "reone/script/di/services.h"
 #include "reone/system/fileutil.h"
+#include "reone/system/logutil.h"
+#include "reone/system/threadpool.h"
 
 using namespace reone::graphics;
 using namespace reone::resource;
@@ -73,6 +75,7 @@ void ResourceDirector::init() {
 }
 
 void ResourceDirector::onModuleLoad(const std::string &name) {
+    finishWarmUp();
     _dialogs.clear();
     _paths.clear();
     _scripts.clear();
@@ -80,10 +83,15 @@ void ResourceDirector::onModuleLoad(const std::string &name) {
     _gffs.clear();
     _resources.clearLocal();
 
+    if (_accessRecorder) {
+        _accessRecorder->beginModule(name);
+    }
     loadModuleResources(name);
+    warmUpModule(name);
 }
 
 void ResourceDirector::onGameLoad(std::string_view name) {
+    finishWarmUp();
     _resources.clearSave();
     loadSaveGameResources(name);
 }
@@ -232,6 +240,70 @@ void ResourceDirector::loadSaveGameResources(std::string_view name) {
     _resources.addERF(*_savegamePath);
 }
 
+void ResourceDirector::warmUpModule(const std::string &name) {
+    if (!_workingSet) {
+        return;
+    }
+    auto &ids = _workingSet->moduleResources(name);
+    if (ids.empty()) {
+        return;
+    }
+    if (!_threadPool) {
+        warmUpResources(ids, false);
+        return;
+    }
+    // Providers and resources only lock around cache and container lookups,
+    // so that the module can load while its working set is being parsed. Job
+    // is canceled and waited for before the next module or savegame changes
+    // the containers.
+    _warmUpTask = _threadPool->enqueue([this, &ids](auto &canceled) {
+        warmUpResources(ids, canceled);
+    });
+}
+
+void ResourceDirector::warmUpResources(const std::vector<ResourceId> &ids, const std::atomic_bool &canceled) {
+    // Only record resources as accessed once the module actually uses them
+    ScopedWarmUp warmUp;
+    for (auto &id : ids) {
+        if (canceled) {
+            return;
+        }
+        auto resRef = id.resRef.value();
+        try {
+            switch (id.type) {
+            case ResType::Ncs:
+                _scripts.get(resRef);
+                break;
+            case ResType::Dlg:
+                _dialogs.get(resRef);
+                break;
+            case ResType::Lip:
+                _lips.get(resRef);
+                break;
+            case ResType::Pth:
+                _paths.get(resRef);
+                break;
+            default:
+                if (isGFFCompatibleResType(id.type)) {
+                    _gffs.get(resRef, id.type);
+                }
+                break;
+            }
+        } catch (const std::exception &ex) {
+            warn("Working set resource not loaded: " + id.string() + ": " + std::string(ex.what()), LogChannel::Resources);
+        }
+    }
+}
+
+void ResourceDirector::finishWarmUp() {
+    if (!_warmUpTask) {
+        return;
+    }
+    _warmUpTask->cancel();
+    _threadPool->wait(*_warmUpTask);
+    _warmUpTask.reset();
+}
+
 void ResourceDirector::loadRIM(const std::filesystem::path &path, const std::string &name, ContainerKind kind) {
     // Try to find a module with the same name in already loaded resources.
     // Same idea as in loadERF.
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/extractor.h"
+
+#include "reone/resource/format/erfreader.h"
+#include "reone/resource/format/rimreader.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/stream/fileinput.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr size_t kCopyBufferSize = 1024 * 1024;
+
+bool ArchiveExtractor::Filter::matches(const ResourceId &resId) const {
+    if (!types.empty() && types.count(resId.type) == 0) {
+        return false;
+    }
+    if (!pattern.empty() && !matchesGlob(resId.string(), pattern)) {
+        return false;
+    }
+    return true;
+}
+
+void ArchiveExtractor::load() {
+    auto stream = FileInputStream(_archivePath);
+    auto signature = std::string(8, '\0');
+    if (stream.read(&signature[0], 8) != 8) {
+        throw ValidationException("Invalid archive size: " + _archivePath.string());
+    }
+    stream.seek(0, SeekOrigin::Begin);
+
+    _entries.clear();
+    if (signature == std::string("RIM V1.0", 8)) {
+        auto rim = RimReader(stream);
+        rim.load();
+        for (auto &res : rim.resources()) {
+            _entries.push_back(Entry {res.resId, res.offset, res.size});
+        }
+    } else {
+        auto erf = ErfReader(stream);
+        erf.load();
+        for (size_t i = 0; i < erf.keys().size(); ++i) {
+            auto &res = erf.resources()[i];
+            _entries.push_back(Entry {erf.keys()[i].resId, res.offset, res.size});
+        }
+    }
+}
+
+std::vector<ArchiveExtractor::Entry> ArchiveExtractor::entries(const Filter &filter) const {
+    std::vector<Entry> filtered;
+    for (auto &entry : _entries) {
+        if (filter.matches(entry.resId)) {
+            filtered.push_back(entry);
+        }
+    }
+    return filtered;
+}
+
+void ArchiveExtractor::extract(const std::vector<Entry> &entries,
+                               const std::filesystem::path &destPath,
+                               IThreadPool *threadPool,
+                               int numTasks) {
+    if (!std::filesystem::exists(destPath)) {
+        std::filesystem::create_directories(destPath);
+    } else if (!std::filesystem::is_directory(destPath)) {
+        throw std::invalid_argument("Not a directory: " + destPath.string());
+    }
+
+    // Read entries in order of offset, so that each batch reads its part of
+    // the archive sequentially
+    std::vector<const Entry *> sorted;
+    sorted.reserve(entries.size());
+    size_t totalSize = 0;
+    for (auto &entry : entries) {
+        sorted.push_back(&entry);
+        totalSize += entry.size;
+    }
+    std::sort(sorted.begin(), sorted.end(), [](auto lhs, auto rhs) { return lhs->offset < rhs->offset; });
+
+    if (!threadPool || numTasks <= 1 || sorted.size() <= 1) {
+        extractBatch(sorted, destPath);
+        return;
+    }
+
+    std::vector<std::vector<const Entry *>> batches;
+    size_t batchSize = std::max<size_t>(1, totalSize / numTasks);
+    size_t currentSize = 0;
+    for (auto entry : sorted) {
+        if (batches.empty() || (currentSize >= batchSize && batches.size() < static_cast<size_t>(numTasks))) {
+            batches.emplace_back();
+            currentSize = 0;
+        }
+        batches.back().push_back(entry);
+        currentSize += entry->size;
+    }
+
+    std::vector<std::shared_ptr<Task>> tasks;
+    for (auto &batch : batches) {
+        tasks.push_back(threadPool->enqueue([this, &batch, &destPath](auto &canceled) {
+            extractBatch(batch, destPath);
+        }));
+    }
+    std::string error;
+    for (auto &task : tasks) {
+        try {
+            threadPool->wait(*task);
+        } catch (const std::exception &ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+}
+
+void ArchiveExtractor::extractBatch(const std::vector<const Entry *> &batch, const std::filesystem::path &destPath) {
+    auto archive = FileInputStream(_archivePath);
+    auto buffer = ByteBuffer(kCopyBufferSize, '\0');
+    for (auto entry : batch) {
+        auto resPath = destPath / entry->resId.string();
+        auto res = std::ofstream(resPath, std::ios::binary);
+        if (!res) {
+            throw std::runtime_error("Unable to open file for writing: " + resPath.string());
+        }
+        archive.seek(entry->offset, SeekOrigin::Begin);
+        size_t remaining = entry->size;
+        while (remaining > 0) {
+            int len = static_cast<int>(std::min(remaining, buffer.size()));
+            if (archive.read(&buffer[0], len) != len) {
+                throw ValidationException("Resource out of archive bounds: " + entry->resId.string());
+            }
+            res.write(&buffer[0], len);
+            remaining -= len;
+        }
+    }
+}
+
+bool matchesGlob(std::string_view s, std::string_view pattern) {
+    // Iterative wildcard matching with backtracking to the last star
+    size_t sIdx = 0;
+    size_t pIdx = 0;
+    size_t starIdx = std::string_view::npos;
+    size_t starMatchIdx = 0;
+    while (sIdx < s.size()) {
+        if (pIdx < pattern.size() && (pattern[pIdx] == '?' || std::tolower(static_cast<unsigned char>(pattern[pIdx])) == std::tolower(static_cast<unsigned char>(s[sIdx])))) {
+            ++sIdx;
+            ++pIdx;
+        } else if (pIdx < pattern.size() && pattern[pIdx] == '*') {
+            starIdx = pIdx++;
+            starMatchIdx = sIdx;
+        } else if (starIdx != std::string_view::npos) {
+            pIdx = starIdx + 1;
+            sIdx = ++starMatchIdx;
+        } else {
+            return false;
+        }
+    }
+    while (pIdx < pattern.size() && pattern[pIdx] == '*') {
+        ++pIdx;
+    }
+    return pIdx == pattern.size();
+}
+
+} // namespace resource
+
+} // namespace reone
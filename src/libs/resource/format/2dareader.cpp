@@ -42,31 +42,15 @@ void TwoDAReader::loadRows() {
     if (_rowCount == 0) {
         return;
     }
-    _rows.reserve(_rowCount);
-
-    int columnCount = static_cast<int>(_columns.size());
-    int cellCount = _rowCount * columnCount;
-    std::vector<uint16_t> offsets(cellCount);
-    for (int i = 0; i < cellCount; ++i) {
-        offsets[i] = _reader.readUint16();
-    }
-
-    uint16_t dataSize = _reader.readUint16();
-    size_t pos = _reader.position();
-
-    for (int i = 0; i < _rowCount; ++i) {
-        TwoDA::Row row;
-        for (int j = 0; j < columnCount; ++j) {
-            int cellIdx = i * columnCount + j;
-            size_t off = pos + offsets[cellIdx];
-            row.values.push_back(_reader.readCStringAt(off, 128));
-        }
-        _rows.push_back(row);
-    }
+    int cellCount = _rowCount * static_cast<int>(_columns.size());
+    _offsets = _reader.readUint16Array(cellCount);
+    _dataSize = _reader.readUint16();
+    auto data = _reader.readBytes(_dataSize);
+    _pool = std::string(data.begin(), data.end());
 }
 
 void TwoDAReader::loadTable() {
-    _twoDa = std::make_shared<TwoDA>(_columns, _rows);
+    _twoDa = std::make_shared<TwoDA>(_columns, _rowCount, std::move(_pool), _offsets);
 }
 
 std::vector<std::string> TwoDAReader::readTokens(int maxCount) {
@@ -40,6 +40,8 @@ void GffReader::load() {
     _listIndicesOffset = _gff.readUint32();
     _listIndicesCount = _gff.readUint32();
 
+    loadLabels();
+
     _root = std::move(readStruct(0));
     _root->setSignature(signature);
 }
@@ -72,9 +74,10 @@ Gff::Field GffReader::readField(int idx) {
     uint32_t labelIndex = _gff.readUint32();
     uint32_t dataOrDataOffset = _gff.readUint32();
 
-    Gff::Field field;
-    field.type = static_cast<Gff::FieldType>(type);
-    field.label = readLabel(labelIndex);
+    if (labelIndex >= _labels.size()) {
+        throw ValidationException("Label index out of bounds: " + std::to_string(labelIndex));
+    }
+    Gff::Field field(static_cast<Gff::FieldType>(type), _labels[labelIndex]);
 
     switch (field.type) {
     case Gff::FieldType::Byte:
@@ -149,6 +152,14 @@ Gff::Field GffReader::readField(int idx) {
     return field;
 }
 
+void GffReader::loadLabels() {
+    // Intern each label once per file, rather than once per field
+    _labels.reserve(_labelCount);
+    for (int i = 0; i < _labelCount; ++i) {
+        _labels.push_back(GffLabel(readLabel(i)));
+    }
+}
+
 std::string GffReader::readLabel(int idx) {
     uint32_t off = _labelOffset + 16 * idx;
     return _gff.readStringAt(off, 16);
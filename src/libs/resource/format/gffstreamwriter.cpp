@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/format/gffstreamwriter.h"
+
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/fileoutput.h"
+
+namespace reone {
+
+namespace resource {
+
+static const std::unordered_map<ResType, std::string> g_signatures {
+    {ResType::Res, "RES"},
+    {ResType::Are, "ARE"},
+    {ResType::Dlg, "DLG"},
+    {ResType::Git, "GIT"},
+    {ResType::Gui, "GUI"},
+    {ResType::Ifo, "IFO"},
+    {ResType::Jrl, "JRL"},
+    {ResType::Utc, "UTC"},
+    {ResType::Utd, "UTD"},
+    {ResType::Ute, "UTE"},
+    {ResType::Uti, "UTI"},
+    {ResType::Utm, "UTM"},
+    {ResType::Utp, "UTP"},
+    {ResType::Uts, "UTS"},
+    {ResType::Utt, "UTT"},
+    {ResType::Utw, "UTW"},
+    {ResType::Pth, "PTH"}};
+
+static bool isComplex(uint32_t type) {
+    switch (static_cast<Gff::FieldType>(type)) {
+    case Gff::FieldType::Dword64:
+    case Gff::FieldType::Int64:
+    case Gff::FieldType::Double:
+    case Gff::FieldType::CExoString:
+    case Gff::FieldType::ResRef:
+    case Gff::FieldType::CExoLocString:
+    case Gff::FieldType::Void:
+    case Gff::FieldType::Orientation:
+    case Gff::FieldType::Vector:
+    case Gff::FieldType::StrRef:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void writeUint32Array(BinaryWriter &writer, const std::vector<uint32_t> &values) {
+    auto bytes = ByteBuffer(values.size() * sizeof(uint32_t));
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto value = boost::endian::native_to_little(values[i]);
+        std::memcpy(&bytes[i * sizeof(uint32_t)], &value, sizeof(uint32_t));
+    }
+    writer.write(bytes);
+}
+
+GffStreamWriter::GffStreamWriter(ResType resType, uint32_t rootType) :
+    _resType(resType) {
+    if (g_signatures.count(resType) == 0) {
+        throw std::logic_error("Unsupported GFF resource type: " + std::to_string(static_cast<int>(resType)));
+    }
+    openStruct(rootType, kNone);
+}
+
+void GffStreamWriter::writeByte(std::string_view label, uint32_t val) {
+    appendSimpleField(Gff::FieldType::Byte, label, val);
+}
+
+void GffStreamWriter::writeChar(std::string_view label, int32_t val) {
+    appendSimpleField(Gff::FieldType::Char, label, static_cast<uint32_t>(val));
+}
+
+void GffStreamWriter::writeWord(std::string_view label, uint32_t val) {
+    appendSimpleField(Gff::FieldType::Word, label, val);
+}
+
+void GffStreamWriter::writeShort(std::string_view label, int32_t val) {
+    appendSimpleField(Gff::FieldType::Short, label, static_cast<uint32_t>(val));
+}
+
+void GffStreamWriter::writeDword(std::string_view label, uint32_t val) {
+    appendSimpleField(Gff::FieldType::Dword, label, val);
+}
+
+void GffStreamWriter::writeInt(std::string_view label, int32_t val) {
+    appendSimpleField(Gff::FieldType::Int, label, static_cast<uint32_t>(val));
+}
+
+void GffStreamWriter::writeDword64(std::string_view label, uint64_t val) {
+    auto &field = beginComplexField(Gff::FieldType::Dword64, label);
+    appendData(val);
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeInt64(std::string_view label, int64_t val) {
+    auto &field = beginComplexField(Gff::FieldType::Int64, label);
+    appendData(val);
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeFloat(std::string_view label, float val) {
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(float));
+    appendSimpleField(Gff::FieldType::Float, label, bits);
+}
+
+void GffStreamWriter::writeDouble(std::string_view label, double val) {
+    auto &field = beginComplexField(Gff::FieldType::Double, label);
+    appendData(val);
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeCExoString(std::string_view label, std::string_view val) {
+    auto &field = beginComplexField(Gff::FieldType::CExoString, label);
+    appendData(static_cast<uint32_t>(val.size()));
+    _data.insert(_data.end(), val.begin(), val.end());
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeResRef(std::string_view label, std::string_view val) {
+    auto &field = beginComplexField(Gff::FieldType::ResRef, label);
+    appendData(static_cast<uint8_t>(val.size()));
+    _data.insert(_data.end(), val.begin(), val.end());
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeCExoLocString(std::string_view label, int32_t strRef, std::string_view val) {
+    auto &field = beginComplexField(Gff::FieldType::CExoLocString, label);
+    uint32_t numSubstrings = !val.empty() ? 1 : 0;
+    appendData(static_cast<uint32_t>(8 + (numSubstrings > 0 ? (8 + val.size()) : 0)));
+    appendData(strRef);
+    appendData(numSubstrings);
+    if (numSubstrings > 0) {
+        appendData(static_cast<uint32_t>(0)); // substring id
+        appendData(static_cast<uint32_t>(val.size()));
+        _data.insert(_data.end(), val.begin(), val.end());
+    }
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeVoid(std::string_view label, const ByteBuffer &val) {
+    auto &field = beginComplexField(Gff::FieldType::Void, label);
+    appendData(static_cast<uint32_t>(val.size()));
+    _data.insert(_data.end(), val.begin(), val.end());
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeOrientation(std::string_view label, const glm::quat &val) {
+    auto &field = beginComplexField(Gff::FieldType::Orientation, label);
+    appendData(val.w);
+    appendData(val.x);
+    appendData(val.y);
+    appendData(val.z);
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeVector(std::string_view label, const glm::vec3 &val) {
+    auto &field = beginComplexField(Gff::FieldType::Vector, label);
+    appendData(val.x);
+    appendData(val.y);
+    appendData(val.z);
+    endComplexField(field);
+}
+
+void GffStreamWriter::writeStrRef(std::string_view label, int32_t val) {
+    auto &field = beginComplexField(Gff::FieldType::StrRef, label);
+    appendData(static_cast<uint32_t>(4));
+    appendData(val);
+    endComplexField(field);
+}
+
+void GffStreamWriter::beginStruct(std::string_view label, uint32_t type) {
+    auto &field = appendField(Gff::FieldType::Struct, label);
+    field.value = openStruct(type, kNone);
+}
+
+void GffStreamWriter::beginListItem(uint32_t type) {
+    if (_openLists.empty()) {
+        throw std::logic_error("No open list");
+    }
+    auto listIdx = _openLists.back();
+    if (_fields[listIdx].structIdx != _openStructs.back()) {
+        throw std::logic_error("List item must be opened in a struct containing the list");
+    }
+    ++_fields[listIdx].value;
+    openStruct(type, listIdx);
+}
+
+void GffStreamWriter::endStruct() {
+    if (_openStructs.size() < 2) {
+        throw std::logic_error("No open struct to end");
+    }
+    _openStructs.pop_back();
+}
+
+void GffStreamWriter::beginList(std::string_view label) {
+    appendField(Gff::FieldType::List, label);
+    _openLists.push_back(static_cast<uint32_t>(_fields.size() - 1));
+}
+
+void GffStreamWriter::endList() {
+    if (_openLists.empty() || _fields[_openLists.back()].structIdx != _openStructs.back()) {
+        throw std::logic_error("No open list to end");
+    }
+    _openLists.pop_back();
+}
+
+uint32_t GffStreamWriter::labelIndex(std::string_view label) {
+    auto key = std::string(label);
+    auto [it, inserted] = _labelToIdx.insert(std::make_pair(key, static_cast<uint32_t>(_labels.size())));
+    if (inserted) {
+        _labels.push_back(std::move(key));
+    }
+    return it->second;
+}
+
+GffStreamWriter::FieldRecord &GffStreamWriter::appendField(Gff::FieldType type, std::string_view label) {
+    auto structIdx = _openStructs.back();
+    ++_structs[structIdx].numFields;
+
+    auto &field = _fields.emplace_back();
+    field.type = static_cast<uint32_t>(type);
+    field.structIdx = structIdx;
+    field.labelIdx = labelIndex(label);
+    return field;
+}
+
+void GffStreamWriter::appendSimpleField(Gff::FieldType type, std::string_view label, uint32_t val) {
+    appendField(type, label).value = val;
+}
+
+GffStreamWriter::FieldRecord &GffStreamWriter::beginComplexField(Gff::FieldType type, std::string_view label) {
+    auto &field = appendField(type, label);
+    field.value = static_cast<uint32_t>(_data.size());
+    return field;
+}
+
+void GffStreamWriter::endComplexField(FieldRecord &field) {
+    field.dataSize = static_cast<uint32_t>(_data.size()) - field.value;
+}
+
+uint32_t GffStreamWriter::openStruct(uint32_t type, uint32_t parentList) {
+    auto structIdx = static_cast<uint32_t>(_structs.size());
+    auto &record = _structs.emplace_back();
+    record.type = type;
+    record.parentList = parentList;
+    _openStructs.push_back(structIdx);
+    return structIdx;
+}
+
+void GffStreamWriter::save(const std::filesystem::path &path) {
+    auto out = FileOutputStream(path);
+    save(out);
+}
+
+void GffStreamWriter::save(IOutputStream &out) {
+    if (_openStructs.size() > 1 || !_openLists.empty()) {
+        throw std::logic_error("GFF has open structs or lists");
+    }
+
+    // Group fields by struct, and list items by list, preserving order
+
+    std::vector<uint32_t> structFieldStart(_structs.size() + 1, 0);
+    for (size_t i = 0; i < _structs.size(); ++i) {
+        structFieldStart[i + 1] = structFieldStart[i] + _structs[i].numFields;
+    }
+    std::vector<uint32_t> structFields(_fields.size());
+    std::vector<uint32_t> cursors(structFieldStart.begin(), structFieldStart.end() - 1);
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        structFields[cursors[_fields[i].structIdx]++] = static_cast<uint32_t>(i);
+    }
+
+    std::vector<uint32_t> listItemStart(_fields.size(), 0);
+    uint32_t numListItems = 0;
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        if (_fields[i].type == static_cast<uint32_t>(Gff::FieldType::List)) {
+            listItemStart[i] = numListItems;
+            numListItems += _fields[i].value;
+        }
+    }
+    std::vector<uint32_t> listItems(numListItems);
+    cursors = listItemStart;
+    for (size_t i = 0; i < _structs.size(); ++i) {
+        if (_structs[i].parentList != kNone) {
+            listItems[cursors[_structs[i].parentList]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    // Lay out structs breadth-first, same as GffWriter
+
+    std::vector<uint32_t> outStructs;
+    std::vector<uint32_t> outFields;
+    std::vector<uint32_t> outLabels;
+    std::vector<uint32_t> labelToOutLabel(_labels.size(), kNone);
+    ByteBuffer outData;
+    std::vector<uint32_t> outFieldIndices;
+    std::vector<uint32_t> outListIndices;
+    outStructs.reserve(3 * _structs.size());
+    outFields.reserve(3 * _fields.size());
+    outData.reserve(_data.size());
+
+    std::queue<uint32_t> structQueue;
+    structQueue.push(0);
+    uint32_t numStructs = 0;
+    while (!structQueue.empty()) {
+        auto structIdx = structQueue.front();
+        structQueue.pop();
+        auto &record = _structs[structIdx];
+        auto firstOutField = static_cast<uint32_t>(outFields.size() / 3);
+
+        for (auto i = structFieldStart[structIdx]; i < structFieldStart[structIdx + 1]; ++i) {
+            auto &field = _fields[structFields[i]];
+            auto &outLabel = labelToOutLabel[field.labelIdx];
+            if (outLabel == kNone) {
+                outLabel = static_cast<uint32_t>(outLabels.size());
+                outLabels.push_back(field.labelIdx);
+            }
+            uint32_t dataOrDataOffset;
+            switch (static_cast<Gff::FieldType>(field.type)) {
+            case Gff::FieldType::Struct:
+                dataOrDataOffset = ++numStructs;
+                structQueue.push(field.value);
+                break;
+            case Gff::FieldType::List: {
+                dataOrDataOffset = static_cast<uint32_t>(4 * outListIndices.size());
+                outListIndices.push_back(field.value);
+                auto start = listItemStart[structFields[i]];
+                for (uint32_t j = 0; j < field.value; ++j) {
+                    outListIndices.push_back(++numStructs);
+                    structQueue.push(listItems[start + j]);
+                }
+                break;
+            }
+            default:
+                if (isComplex(field.type)) {
+                    dataOrDataOffset = static_cast<uint32_t>(outData.size());
+                    outData.insert(outData.end(), _data.begin() + field.value, _data.begin() + field.value + field.dataSize);
+                } else {
+                    dataOrDataOffset = field.value;
+                }
+                break;
+            }
+            outFields.push_back(field.type);
+            outFields.push_back(outLabel);
+            outFields.push_back(dataOrDataOffset);
+        }
+
+        uint32_t dataOrDataOffset;
+        if (record.numFields == 1) {
+            dataOrDataOffset = firstOutField;
+        } else {
+            dataOrDataOffset = static_cast<uint32_t>(4 * outFieldIndices.size());
+            for (uint32_t i = 0; i < record.numFields; ++i) {
+                outFieldIndices.push_back(firstOutField + i);
+            }
+        }
+        outStructs.push_back(record.type);
+        outStructs.push_back(dataOrDataOffset);
+        outStructs.push_back(record.numFields);
+    }
+
+    // Write sections
+
+    uint32_t sizeStructs = static_cast<uint32_t>(outStructs.size() * sizeof(uint32_t));
+    uint32_t sizeFields = static_cast<uint32_t>(outFields.size() * sizeof(uint32_t));
+    uint32_t sizeLabels = static_cast<uint32_t>(outLabels.size() * 16);
+    uint32_t sizeFieldData = static_cast<uint32_t>(outData.size());
+    uint32_t sizeFieldIndices = static_cast<uint32_t>(outFieldIndices.size() * sizeof(uint32_t));
+    uint32_t sizeListIndices = static_cast<uint32_t>(outListIndices.size() * sizeof(uint32_t));
+
+    uint32_t offStructs = 0x38;
+    uint32_t offFields = offStructs + sizeStructs;
+    uint32_t offLabels = offFields + sizeFields;
+    uint32_t offFieldData = offLabels + sizeLabels;
+    uint32_t offFieldIndices = offFieldData + sizeFieldData;
+    uint32_t offListIndices = offFieldIndices + sizeFieldIndices;
+
+    auto writer = BinaryWriter(out);
+    writer.writeString(g_signatures.at(_resType));
+    writer.writeString(" V3.2");
+    writer.writeUint32(offStructs);                                    // struct array offset
+    writer.writeUint32(static_cast<uint32_t>(outStructs.size() / 3)); // number of structs
+    writer.writeUint32(offFields);                                     // field array offset
+    writer.writeUint32(static_cast<uint32_t>(outFields.size() / 3));  // number of fields
+    writer.writeUint32(offLabels);                                     // label array offset
+    writer.writeUint32(static_cast<uint32_t>(outLabels.size()));      // number of labels
+    writer.writeUint32(offFieldData);                                  // field data array offset
+    writer.writeUint32(sizeFieldData);                                 // number of bytes in field data
+    writer.writeUint32(offFieldIndices);                               // field indices array offset
+    writer.writeUint32(sizeFieldIndices);                              // number of bytes in field indices array
+    writer.writeUint32(offListIndices);                                // list indices array offset
+    writer.writeUint32(sizeListIndices);                               // number of bytes in list indices array
+
+    writeUint32Array(writer, outStructs);
+    writeUint32Array(writer, outFields);
+    for (auto labelIdx : outLabels) {
+        auto label = std::string(16, '\0');
+        strncpy(&label[0], _labels[labelIdx].c_str(), 16);
+        writer.writeString(label);
+    }
+    writer.write(outData);
+    writeUint32Array(writer, outFieldIndices);
+    writeUint32Array(writer, outListIndices);
+}
+
+} // namespace resource
+
+} // namespace reone
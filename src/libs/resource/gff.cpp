@@ -17,6 +17,9 @@
 
 #include "reone/resource/gff.h"
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "reone/system/exception/validation.h"
 #include "reone/system/logutil.h"
 
@@ -24,249 +27,375 @@ namespace reone {
 
 namespace resource {
 
-bool Gff::readByte(uint8_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+static constexpr size_t kMinIndexedFields = 16;
+
+static std::mutex g_indexMutex;
+
+namespace {
+
+struct LabelTable {
+    std::shared_mutex mutex;
+    std::unordered_map<std::string, uint32_t> labelToId {{"", 0}};
+    std::deque<std::string> labels {""};
+};
+
+} // namespace
+
+// Constructed on first use, so that labels can be interned during static
+// initialization
+static LabelTable &labelTable() {
+    static LabelTable table;
+    return table;
+}
+
+uint32_t GffLabel::intern(std::string_view name) {
+    auto &table = labelTable();
+    auto key = std::string(name);
+    {
+        std::shared_lock<std::shared_mutex> lock {table.mutex};
+        auto it = table.labelToId.find(key);
+        if (it != table.labelToId.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock {table.mutex};
+    auto [it, inserted] = table.labelToId.insert(std::make_pair(key, static_cast<uint32_t>(table.labels.size())));
+    if (inserted) {
+        table.labels.push_back(std::move(key));
+    }
+    return it->second;
+}
+
+std::optional<GffLabel> GffLabel::find(std::string_view name) {
+    auto &table = labelTable();
+    std::shared_lock<std::shared_mutex> lock {table.mutex};
+    auto it = table.labelToId.find(std::string(name));
+    if (it == table.labelToId.end()) {
+        return std::nullopt;
+    }
+    auto label = GffLabel();
+    label._id = it->second;
+    return label;
+}
+
+const std::string &GffLabel::name() const {
+    auto &table = labelTable();
+    std::shared_lock<std::shared_mutex> lock {table.mutex};
+    return table.labels[_id];
+}
+
+bool Gff::readByte(uint8_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->uintValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readChar(int8_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readChar(int8_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->intValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readWord(uint16_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readWord(uint16_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->uintValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readShort(int16_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readShort(int16_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->intValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readDword(uint32_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readDword(uint32_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->uintValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readInt(int32_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readInt(int32_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->intValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readDword64(uint64_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readDword64(uint64_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->uint64Value;
         return true;
     }
     return false;
 }
 
-bool Gff::readInt64(int64_t &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readInt64(int64_t &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->int64Value;
         return true;
     }
     return false;
 }
 
-bool Gff::readFloat(float &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readFloat(float &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->floatValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readDouble(double &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readDouble(double &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->doubleValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readVector(glm::vec3 &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readVector(glm::vec3 &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->vecValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readOrientation(glm::quat &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readOrientation(glm::quat &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->quatValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readString(std::string &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readString(std::string &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = field->strValue;
         return true;
     }
     return false;
 }
 
-bool Gff::readResRef(std::string &val, std::string_view label) const {
-    if (const Field *field = get(label)) {
+bool Gff::readResRef(std::string &val, const FieldKey &key) const {
+    if (const Field *field = get(key)) {
         val = boost::to_lower_copy(field->strValue);
         return true;
     }
     return false;
 }
 
-bool Gff::readLocString(LocString &val, std::string_view label, IStrings &strings) const {
-    if (const Field *field = get(label)) {
+bool Gff::readLocString(LocString &val, const FieldKey &key, IStrings &strings) const {
+    if (const Field *field = get(key)) {
         val = LocString(field->intValue, field->strValue, strings);
         return true;
     }
     return false;
 }
 
-bool Gff::readStrRef(StrRef &val, std::string_view label, IStrings &strings) const {
-    if (const Field *field = get(label)) {
+bool Gff::readStrRef(StrRef &val, const FieldKey &key, IStrings &strings) const {
+    if (const Field *field = get(key)) {
         val = StrRef(field->intValue, strings);
         return true;
     }
     return false;
 }
 
-bool Gff::getBool(const std::string &name, bool defValue) const {
-    const Field *field = get(name);
-    if (!field)
-        return defValue;
+void Gff::reindex() {
+    buildIndex();
+    _indexDirty.store(false, std::memory_order_release);
+}
 
-    return field->intValue != 0;
+void Gff::buildIndex() const {
+    _index.clear();
+    _nameIndex.clear();
+    if (_fields.size() < kMinIndexedFields) {
+        return;
+    }
+    _index.reserve(_fields.size());
+    _nameIndex.reserve(_fields.size());
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        _index.push_back(IndexEntry {_fields[i].symbol().id(), static_cast<uint32_t>(i)});
+        _nameIndex.push_back(NameIndexEntry {std::hash<std::string_view>()(_fields[i].label()), static_cast<uint32_t>(i)});
+    }
+    // Stable sort keeps the first of duplicate labels first, same as linear lookup
+    std::stable_sort(_index.begin(), _index.end(), [](auto &lhs, auto &rhs) { return lhs.labelId < rhs.labelId; });
+    std::stable_sort(_nameIndex.begin(), _nameIndex.end(), [](auto &lhs, auto &rhs) { return lhs.nameHash < rhs.nameHash; });
+}
+
+const Gff::Field *Gff::get(const FieldKey &key) const {
+    if (_indexDirty.load(std::memory_order_acquire)) {
+        // Structs are mutated on a single thread, but may be looked up from
+        // several threads afterwards, so that the rebuild must be guarded
+        std::lock_guard<std::mutex> lock {g_indexMutex};
+        if (_indexDirty.load(std::memory_order_relaxed)) {
+            buildIndex();
+            _indexDirty.store(false, std::memory_order_release);
+        }
+    }
+    return key.isSymbol() ? getBySymbol(key.symbol()) : getByName(key.name());
+}
+
+const Gff::Field *Gff::getByName(std::string_view name) const {
+    // Names are hashed rather than interned, so that lookup by name needs
+    // neither the global label table, nor a temporary string
+    if (_nameIndex.empty()) {
+        auto maybeField = std::find_if(
+            _fields.begin(),
+            _fields.end(),
+            [&](auto &f) { return f.label() == name; });
+        return maybeField != _fields.end() ? &*maybeField : nullptr;
+    }
+    size_t nameHash = std::hash<std::string_view>()(name);
+    auto maybeEntry = std::lower_bound(
+        _nameIndex.begin(),
+        _nameIndex.end(),
+        nameHash,
+        [](auto &entry, size_t hash) { return entry.nameHash < hash; });
+    for (; maybeEntry != _nameIndex.end() && maybeEntry->nameHash == nameHash; ++maybeEntry) {
+        if (_fields[maybeEntry->fieldIdx].label() == name) {
+            return &_fields[maybeEntry->fieldIdx];
+        }
+    }
+    return nullptr;
 }
 
-const Gff::Field *Gff::get(std::string_view name) const {
-    auto maybeField = std::find_if(
-        _fields.begin(),
-        _fields.end(),
-        [&](auto &f) { return f.label == name; });
+const Gff::Field *Gff::getBySymbol(GffLabel symbol) const {
+    if (_index.empty()) {
+        auto maybeField = std::find_if(
+            _fields.begin(),
+            _fields.end(),
+            [&](auto &f) { return f.symbol() == symbol; });
+        return maybeField != _fields.end() ? &*maybeField : nullptr;
+    }
+    auto maybeEntry = std::lower_bound(
+        _index.begin(),
+        _index.end(),
+        symbol.id(),
+        [](auto &entry, uint32_t id) { return entry.labelId < id; });
+    if (maybeEntry == _index.end() || maybeEntry->labelId != symbol.id()) {
+        return nullptr;
+    }
+    return &_fields[maybeEntry->fieldIdx];
+}
 
-    return maybeField != _fields.end() ? &*maybeField : nullptr;
+bool Gff::getBool(const FieldKey &key, bool defValue) const {
+    const Field *field = get(key);
+    if (!field)
+        return defValue;
+
+    return field->intValue != 0;
 }
 
-int Gff::getInt(const std::string &name, int defValue) const {
-    const Field *field = get(name);
+int32_t Gff::getInt(const FieldKey &key, int32_t defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->intValue;
 }
 
-int64_t Gff::getInt64(const std::string &name, int64_t defValue) const {
-    const Field *field = get(name);
+int64_t Gff::getInt64(const FieldKey &key, int64_t defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->int64Value;
 }
 
-uint32_t Gff::getUint(const std::string &name, uint32_t defValue) const {
-    const Field *field = get(name);
+uint32_t Gff::getUint(const FieldKey &key, uint32_t defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->uintValue;
 }
 
-uint64_t Gff::getUint64(const std::string &name, uint64_t defValue) const {
-    const Field *field = get(name);
+uint64_t Gff::getUint64(const FieldKey &key, uint64_t defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->uint64Value;
 }
 
-glm::vec3 Gff::getColor(const std::string &name, glm::vec3 defValue) const {
-    const Field *field = get(name);
+glm::vec3 Gff::getColor(const FieldKey &key, glm::vec3 defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return colorFromUint32(field->uintValue);
 }
 
-float Gff::getFloat(const std::string &name, float defValue) const {
-    const Field *field = get(name);
+float Gff::getFloat(const FieldKey &key, float defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->floatValue;
 }
 
-double Gff::getDouble(const std::string &name, double defValue) const {
-    const Field *field = get(name);
+double Gff::getDouble(const FieldKey &key, double defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->doubleValue;
 }
 
-std::string Gff::getString(const std::string &name, std::string defValue) const {
-    const Field *field = get(name);
+std::string Gff::getString(const FieldKey &key, std::string defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->strValue;
 }
 
-glm::vec3 Gff::getVector(const std::string &name, glm::vec3 defValue) const {
-    const Field *field = get(name);
+glm::vec3 Gff::getVector(const FieldKey &key, glm::vec3 defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->vecValue;
 }
 
-glm::quat Gff::getOrientation(const std::string &name, glm::quat defValue) const {
-    const Field *field = get(name);
+glm::quat Gff::getOrientation(const FieldKey &key, glm::quat defValue) const {
+    const Field *field = get(key);
     if (!field)
         return defValue;
 
     return field->quatValue;
 }
 
-std::vector<std::shared_ptr<Gff>> Gff::getList(const std::string &name) const {
-    const Field *field = get(name);
+std::vector<std::shared_ptr<Gff>> Gff::getList(const FieldKey &key) const {
+    const Field *field = get(key);
     if (!field)
         return std::vector<std::shared_ptr<Gff>>();
 
     return field->children;
 }
 
-ByteBuffer Gff::getData(const std::string &name) const {
-    const Field *field = get(name);
+ByteBuffer Gff::getData(const FieldKey &key) const {
+    const Field *field = get(key);
     if (!field)
         return ByteBuffer();
 
     return field->data;
 }
 
-std::shared_ptr<Gff> Gff::findStruct(std::string_view name) const {
-    const Field *field = get(name);
+std::shared_ptr<Gff> Gff::findStruct(const FieldKey &key) const {
+    const Field *field = get(key);
     if (!field)
         return nullptr;
 
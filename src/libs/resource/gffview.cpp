@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "reone/resource/gffview.h"
+
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr uint32_t kHeaderSize = 56;
+static constexpr uint32_t kStructSize = 12;
+static constexpr uint32_t kFieldSize = 12;
+static constexpr uint32_t kLabelSize = 16;
+
+static std::string_view nullTerminated(const char *data, size_t maxLen) {
+    auto end = std::find(data, data + maxLen, '\0');
+    return std::string_view(data, end - data);
+}
+
+const char *GffView::File::bytes(uint32_t offset, uint32_t size) const {
+    if (static_cast<uint64_t>(offset) + size > buffer->size()) {
+        throw ValidationException("GFF data out of bounds: " + std::to_string(offset));
+    }
+    return buffer->data() + offset;
+}
+
+uint32_t GffView::File::readUint32(uint32_t offset) const {
+    uint32_t val;
+    std::memcpy(&val, bytes(offset, sizeof(uint32_t)), sizeof(uint32_t));
+    return boost::endian::little_to_native(val);
+}
+
+GffView GffView::load(std::shared_ptr<const ByteBuffer> buffer) {
+    if (buffer->size() < kHeaderSize) {
+        throw ValidationException("Invalid GFF size: " + std::to_string(buffer->size()));
+    }
+    auto file = std::make_shared<File>();
+    file->buffer = std::move(buffer);
+    file->structOffset = file->readUint32(8);
+    file->structCount = file->readUint32(12);
+    file->fieldOffset = file->readUint32(16);
+    file->fieldCount = file->readUint32(20);
+    file->labelOffset = file->readUint32(24);
+    file->labelCount = file->readUint32(28);
+    file->fieldDataOffset = file->readUint32(32);
+    file->fieldDataSize = file->readUint32(36);
+    file->fieldIndicesOffset = file->readUint32(40);
+    file->fieldIndicesSize = file->readUint32(44);
+    file->listIndicesOffset = file->readUint32(48);
+    file->listIndicesSize = file->readUint32(52);
+
+    if (file->structCount == 0) {
+        throw ValidationException("GFF has no structs");
+    }
+    file->bytes(file->structOffset, kStructSize * file->structCount);
+    file->bytes(file->fieldOffset, kFieldSize * file->fieldCount);
+    file->bytes(file->labelOffset, kLabelSize * file->labelCount);
+    file->bytes(file->fieldDataOffset, file->fieldDataSize);
+    file->bytes(file->fieldIndicesOffset, file->fieldIndicesSize);
+    file->bytes(file->listIndicesOffset, file->listIndicesSize);
+
+    return GffView(std::move(file), 0);
+}
+
+GffView::GffView(std::shared_ptr<const File> file, uint32_t structIndex) :
+    _file(std::move(file)),
+    _structIndex(structIndex) {
+    if (_structIndex >= _file->structCount) {
+        throw ValidationException("GFF struct index out of bounds: " + std::to_string(_structIndex));
+    }
+    auto offset = _file->structOffset + kStructSize * _structIndex;
+    _type = _file->readUint32(offset);
+    _fieldsOrFieldIndicesOffset = _file->readUint32(offset + 4);
+    _fieldCount = _file->readUint32(offset + 8);
+}
+
+bool GffView::readByte(uint8_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<uint8_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readChar(int8_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<int8_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readWord(uint16_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<uint16_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readShort(int16_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<int16_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readDword(uint32_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<uint32_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readInt(int32_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<int32_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readDword64(uint64_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = value(*field);
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readInt64(int64_t &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = static_cast<int64_t>(value(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readFloat(float &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        auto bits = static_cast<uint32_t>(value(*field));
+        std::memcpy(&val, &bits, sizeof(float));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readDouble(double &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        auto bits = value(*field);
+        std::memcpy(&val, &bits, sizeof(double));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readVector(glm::vec3 &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = vectorValue(*field);
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readOrientation(glm::quat &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = orientationValue(*field);
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readString(std::string &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = std::string(stringValue(*field));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readResRef(std::string &val, std::string_view label) const {
+    if (auto field = find(label)) {
+        val = boost::to_lower_copy(std::string(stringValue(*field)));
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readLocString(LocString &val, std::string_view label, IStrings &strings) const {
+    if (auto field = find(label)) {
+        val = LocString(static_cast<int32_t>(value(*field)), std::string(stringValue(*field)), strings);
+        return true;
+    }
+    return false;
+}
+
+bool GffView::readStrRef(StrRef &val, std::string_view label, IStrings &strings) const {
+    if (auto field = find(label)) {
+        val = StrRef(static_cast<int32_t>(value(*field)), strings);
+        return true;
+    }
+    return false;
+}
+
+bool GffView::getBool(std::string_view name, bool defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return static_cast<int32_t>(value(*field)) != 0;
+}
+
+int32_t GffView::getInt(std::string_view name, int32_t defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return static_cast<int32_t>(value(*field));
+}
+
+int64_t GffView::getInt64(std::string_view name, int64_t defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return static_cast<int64_t>(value(*field));
+}
+
+uint32_t GffView::getUint(std::string_view name, uint32_t defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return static_cast<uint32_t>(value(*field));
+}
+
+uint64_t GffView::getUint64(std::string_view name, uint64_t defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return value(*field);
+}
+
+glm::vec3 GffView::getColor(std::string_view name, glm::vec3 defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return Gff::colorFromUint32(static_cast<uint32_t>(value(*field)));
+}
+
+float GffView::getFloat(std::string_view name, float defValue) const {
+    float val;
+    return readFloat(val, name) ? val : defValue;
+}
+
+double GffView::getDouble(std::string_view name, double defValue) const {
+    double val;
+    return readDouble(val, name) ? val : defValue;
+}
+
+std::string GffView::getString(std::string_view name, std::string defValue) const {
+    auto field = find(name);
+    if (!field)
+        return defValue;
+
+    return std::string(stringValue(*field));
+}
+
+std::string_view GffView::getStringView(std::string_view name) const {
+    auto field = find(name);
+    if (!field)
+        return std::string_view();
+
+    return stringValue(*field);
+}
+
+glm::vec3 GffView::getVector(std::string_view name, glm::vec3 defValue) const {
+    glm::vec3 val;
+    return readVector(val, name) ? val : defValue;
+}
+
+glm::quat GffView::getOrientation(std::string_view name, glm::quat defValue) const {
+    glm::quat val;
+    return readOrientation(val, name) ? val : defValue;
+}
+
+std::vector<GffView> GffView::getList(std::string_view name) const {
+    auto field = find(name);
+    if (!field)
+        return std::vector<GffView>();
+
+    return children(*field);
+}
+
+ByteBuffer GffView::getData(std::string_view name) const {
+    auto field = find(name);
+    if (!field || field->type != Gff::FieldType::Void)
+        return ByteBuffer();
+
+    auto size = _file->readUint32(_file->fieldDataOffset + field->dataOrDataOffset);
+    auto data = fieldData(field->dataOrDataOffset + 4, size);
+    return ByteBuffer(data, data + size);
+}
+
+GffView GffView::findStruct(std::string_view name) const {
+    auto field = find(name);
+    if (!field)
+        return GffView();
+
+    auto structs = children(*field);
+    return !structs.empty() ? structs.front() : GffView();
+}
+
+std::shared_ptr<Gff> GffView::materialize() const {
+    std::vector<Gff::Field> fields;
+    fields.reserve(_fieldCount);
+    for (uint32_t i = 0; i < _fieldCount; ++i) {
+        fields.push_back(materializeField(fieldEntry(fieldIndex(i))));
+    }
+    auto gff = std::make_shared<Gff>(_type, std::move(fields));
+    if (_structIndex == 0) {
+        gff->setSignature(std::string(signature()));
+    }
+    return gff;
+}
+
+std::string_view GffView::signature() const {
+    return nullTerminated(_file->bytes(0, 8), 8);
+}
+
+uint32_t GffView::type() const {
+    return _type;
+}
+
+int GffView::numFields() const {
+    return static_cast<int>(_fieldCount);
+}
+
+Gff::FieldType GffView::fieldType(int index) const {
+    return fieldEntry(fieldIndex(index)).type;
+}
+
+std::string_view GffView::fieldLabel(int index) const {
+    return label(fieldEntry(fieldIndex(index)).labelIndex);
+}
+
+uint32_t GffView::fieldIndex(int index) const {
+    if (index < 0 || static_cast<uint32_t>(index) >= _fieldCount) {
+        throw std::out_of_range("index");
+    }
+    if (_fieldCount == 1) {
+        return _fieldsOrFieldIndicesOffset;
+    }
+    return _file->readUint32(_file->fieldIndicesOffset + _fieldsOrFieldIndicesOffset + 4 * index);
+}
+
+GffView::FieldEntry GffView::fieldEntry(uint32_t fieldIndex) const {
+    if (fieldIndex >= _file->fieldCount) {
+        throw ValidationException("GFF field index out of bounds: " + std::to_string(fieldIndex));
+    }
+    auto offset = _file->fieldOffset + kFieldSize * fieldIndex;
+    auto entry = FieldEntry();
+    entry.type = static_cast<Gff::FieldType>(_file->readUint32(offset));
+    entry.labelIndex = _file->readUint32(offset + 4);
+    entry.dataOrDataOffset = _file->readUint32(offset + 8);
+    return entry;
+}
+
+std::string_view GffView::label(uint32_t labelIndex) const {
+    if (labelIndex >= _file->labelCount) {
+        throw ValidationException("GFF label index out of bounds: " + std::to_string(labelIndex));
+    }
+    return nullTerminated(_file->bytes(_file->labelOffset + kLabelSize * labelIndex, kLabelSize), kLabelSize);
+}
+
+std::optional<GffView::FieldEntry> GffView::find(std::string_view name) const {
+    if (!_file) {
+        return std::nullopt;
+    }
+    for (uint32_t i = 0; i < _fieldCount; ++i) {
+        auto entry = fieldEntry(fieldIndex(i));
+        if (label(entry.labelIndex) == name) {
+            return entry;
+        }
+    }
+    return std::nullopt;
+}
+
+uint64_t GffView::value(const FieldEntry &field) const {
+    // Mirrors the value union of Gff::Field
+    switch (field.type) {
+    case Gff::FieldType::Byte:
+    case Gff::FieldType::Char:
+    case Gff::FieldType::Word:
+    case Gff::FieldType::Short:
+    case Gff::FieldType::Dword:
+    case Gff::FieldType::Int:
+    case Gff::FieldType::Float:
+        return field.dataOrDataOffset;
+    case Gff::FieldType::Dword64:
+    case Gff::FieldType::Int64:
+    case Gff::FieldType::Double: {
+        uint64_t val;
+        std::memcpy(&val, fieldData(field.dataOrDataOffset, sizeof(uint64_t)), sizeof(uint64_t));
+        return boost::endian::little_to_native(val);
+    }
+    case Gff::FieldType::CExoLocString:
+    case Gff::FieldType::StrRef:
+        return _file->readUint32(_file->fieldDataOffset + field.dataOrDataOffset + 4);
+    default:
+        return 0;
+    }
+}
+
+std::string_view GffView::stringValue(const FieldEntry &field) const {
+    switch (field.type) {
+    case Gff::FieldType::CExoString: {
+        auto size = _file->readUint32(_file->fieldDataOffset + field.dataOrDataOffset);
+        return nullTerminated(fieldData(field.dataOrDataOffset + 4, size), size);
+    }
+    case Gff::FieldType::ResRef: {
+        auto size = static_cast<uint8_t>(*fieldData(field.dataOrDataOffset, 1));
+        return nullTerminated(fieldData(field.dataOrDataOffset + 1, size), size);
+    }
+    case Gff::FieldType::CExoLocString: {
+        auto count = _file->readUint32(_file->fieldDataOffset + field.dataOrDataOffset + 8);
+        if (count != 1) {
+            if (count > 1) {
+                warn("GFF: more than one substring in CExoLocString, ignoring");
+            }
+            return std::string_view();
+        }
+        auto size = _file->readUint32(_file->fieldDataOffset + field.dataOrDataOffset + 16);
+        return nullTerminated(fieldData(field.dataOrDataOffset + 20, size), size);
+    }
+    default:
+        return std::string_view();
+    }
+}
+
+glm::vec3 GffView::vectorValue(const FieldEntry &field) const {
+    if (field.type != Gff::FieldType::Vector) {
+        return glm::vec3(0.0f);
+    }
+    float floats[3];
+    std::memcpy(floats, fieldData(field.dataOrDataOffset, sizeof(floats)), sizeof(floats));
+    return glm::make_vec3(floats);
+}
+
+glm::quat GffView::orientationValue(const FieldEntry &field) const {
+    if (field.type != Gff::FieldType::Orientation) {
+        return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    }
+    float floats[4];
+    std::memcpy(floats, fieldData(field.dataOrDataOffset, sizeof(floats)), sizeof(floats));
+    return glm::quat(floats[0], floats[1], floats[2], floats[3]);
+}
+
+const char *GffView::fieldData(uint32_t offset, uint32_t size) const {
+    if (static_cast<uint64_t>(offset) + size > _file->fieldDataSize) {
+        throw ValidationException("GFF field data out of bounds: " + std::to_string(offset));
+    }
+    return _file->bytes(_file->fieldDataOffset + offset, size);
+}
+
+std::vector<GffView> GffView::children(const FieldEntry &field) const {
+    std::vector<GffView> structs;
+    if (field.type == Gff::FieldType::Struct) {
+        structs.push_back(GffView(_file, field.dataOrDataOffset));
+    } else if (field.type == Gff::FieldType::List) {
+        auto offset = _file->listIndicesOffset + field.dataOrDataOffset;
+        auto count = _file->readUint32(offset);
+        structs.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            structs.push_back(GffView(_file, _file->readUint32(offset + 4 * (i + 1))));
+        }
+    }
+    return structs;
+}
+
+Gff::Field GffView::materializeField(const FieldEntry &field) const {
+    auto materialized = Gff::Field(field.type, std::string(label(field.labelIndex)));
+    switch (field.type) {
+    case Gff::FieldType::Byte:
+    case Gff::FieldType::Word:
+    case Gff::FieldType::Dword:
+    case Gff::FieldType::Char:
+    case Gff::FieldType::Short:
+    case Gff::FieldType::Int:
+    case Gff::FieldType::Float:
+    case Gff::FieldType::Dword64:
+    case Gff::FieldType::Int64:
+    case Gff::FieldType::Double:
+    case Gff::FieldType::StrRef:
+        materialized.uint64Value = value(field);
+        break;
+    case Gff::FieldType::CExoString:
+    case Gff::FieldType::ResRef:
+        materialized.strValue = std::string(stringValue(field));
+        break;
+    case Gff::FieldType::CExoLocString:
+        materialized.uint64Value = value(field);
+        materialized.strValue = std::string(stringValue(field));
+        break;
+    case Gff::FieldType::Void: {
+        auto size = _file->readUint32(_file->fieldDataOffset + field.dataOrDataOffset);
+        auto data = fieldData(field.dataOrDataOffset + 4, size);
+        materialized.data = ByteBuffer(data, data + size);
+        break;
+    }
+    case Gff::FieldType::Struct:
+    case Gff::FieldType::List:
+        for (auto &child : children(field)) {
+            materialized.children.push_back(child.materialize());
+        }
+        break;
+    case Gff::FieldType::Orientation:
+        materialized.quatValue = orientationValue(field);
+        break;
+    case Gff::FieldType::Vector:
+        materialized.vecValue = vectorValue(field);
+        break;
+    default:
+        throw ValidationException("Unsupported field type: " + std::to_string(static_cast<int>(field.type)));
+    }
+    return materialized;
+}
+
+} // namespace resource
+
+} // namespace reone
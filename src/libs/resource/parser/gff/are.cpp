@@ -25,180 +25,355 @@ namespace resource {
 
 namespace generated {
 
+namespace labels {
+
+static const GffLabel Accel_Secs {"Accel_Secs"};
+static const GffLabel AlphaTest {"AlphaTest"};
+static const GffLabel AmbientScale {"AmbientScale"};
+static const GffLabel AxisX {"AxisX"};
+static const GffLabel AxisY {"AxisY"};
+static const GffLabel BankID {"BankID"};
+static const GffLabel Bullet {"Bullet"};
+static const GffLabel Bullet_Model {"Bullet_Model"};
+static const GffLabel Bump_Damage {"Bump_Damage"};
+static const GffLabel Bump_Plane {"Bump_Plane"};
+static const GffLabel Camera {"Camera"};
+static const GffLabel CameraRotate {"CameraRotate"};
+static const GffLabel CameraStyle {"CameraStyle"};
+static const GffLabel CameraViewAngle {"CameraViewAngle"};
+static const GffLabel ChanceLightning {"ChanceLightning"};
+static const GffLabel ChanceRain {"ChanceRain"};
+static const GffLabel ChanceSnow {"ChanceSnow"};
+static const GffLabel Collision_Sound {"Collision_Sound"};
+static const GffLabel Comments {"Comments"};
+static const GffLabel Creator_ID {"Creator_ID"};
+static const GffLabel DOF {"DOF"};
+static const GffLabel Damage {"Damage"};
+static const GffLabel DayNightCycle {"DayNightCycle"};
+static const GffLabel Death {"Death"};
+static const GffLabel DefaultEnvMap {"DefaultEnvMap"};
+static const GffLabel DirtyARGBOne {"DirtyARGBOne"};
+static const GffLabel DirtyARGBThree {"DirtyARGBThree"};
+static const GffLabel DirtyARGBTwo {"DirtyARGBTwo"};
+static const GffLabel DirtyFormulaOne {"DirtyFormulaOne"};
+static const GffLabel DirtyFormulaThre {"DirtyFormulaThre"};
+static const GffLabel DirtyFormulaTwo {"DirtyFormulaTwo"};
+static const GffLabel DirtyFuncOne {"DirtyFuncOne"};
+static const GffLabel DirtyFuncThree {"DirtyFuncThree"};
+static const GffLabel DirtyFuncTwo {"DirtyFuncTwo"};
+static const GffLabel DirtySizeOne {"DirtySizeOne"};
+static const GffLabel DirtySizeThree {"DirtySizeThree"};
+static const GffLabel DirtySizeTwo {"DirtySizeTwo"};
+static const GffLabel DisableTransit {"DisableTransit"};
+static const GffLabel DisableWeather {"DisableWeather"};
+static const GffLabel DoBumping {"DoBumping"};
+static const GffLabel DynAmbientColor {"DynAmbientColor"};
+static const GffLabel Enemies {"Enemies"};
+static const GffLabel Engine {"Engine"};
+static const GffLabel EnvAudio {"EnvAudio"};
+static const GffLabel Far_Clip {"Far_Clip"};
+static const GffLabel Fire_Sound {"Fire_Sound"};
+static const GffLabel Flags {"Flags"};
+static const GffLabel FlipAxisX {"FlipAxisX"};
+static const GffLabel FlipAxisY {"FlipAxisY"};
+static const GffLabel ForceRating {"ForceRating"};
+static const GffLabel Grass_Ambient {"Grass_Ambient"};
+static const GffLabel Grass_Density {"Grass_Density"};
+static const GffLabel Grass_Diffuse {"Grass_Diffuse"};
+static const GffLabel Grass_Emissive {"Grass_Emissive"};
+static const GffLabel Grass_Prob_LL {"Grass_Prob_LL"};
+static const GffLabel Grass_Prob_LR {"Grass_Prob_LR"};
+static const GffLabel Grass_Prob_UL {"Grass_Prob_UL"};
+static const GffLabel Grass_Prob_UR {"Grass_Prob_UR"};
+static const GffLabel Grass_QuadSize {"Grass_QuadSize"};
+static const GffLabel Grass_TexName {"Grass_TexName"};
+static const GffLabel Gun_Banks {"Gun_Banks"};
+static const GffLabel Gun_Model {"Gun_Model"};
+static const GffLabel Hit_Points {"Hit_Points"};
+static const GffLabel Horiz_Spread {"Horiz_Spread"};
+static const GffLabel ID {"ID"};
+static const GffLabel Inaccuracy {"Inaccuracy"};
+static const GffLabel Invince_Period {"Invince_Period"};
+static const GffLabel IsNight {"IsNight"};
+static const GffLabel LateralAccel {"LateralAccel"};
+static const GffLabel Lifespan {"Lifespan"};
+static const GffLabel LightingScheme {"LightingScheme"};
+static const GffLabel LoadScreenID {"LoadScreenID"};
+static const GffLabel Map {"Map"};
+static const GffLabel MapPt1X {"MapPt1X"};
+static const GffLabel MapPt1Y {"MapPt1Y"};
+static const GffLabel MapPt2X {"MapPt2X"};
+static const GffLabel MapPt2Y {"MapPt2Y"};
+static const GffLabel MapResX {"MapResX"};
+static const GffLabel MapZoom {"MapZoom"};
+static const GffLabel Max_HPs {"Max_HPs"};
+static const GffLabel Maximum_Speed {"Maximum_Speed"};
+static const GffLabel MiniGame {"MiniGame"};
+static const GffLabel Minimum_Speed {"Minimum_Speed"};
+static const GffLabel ModListenCheck {"ModListenCheck"};
+static const GffLabel ModSpotCheck {"ModSpotCheck"};
+static const GffLabel Model {"Model"};
+static const GffLabel Models {"Models"};
+static const GffLabel MoonAmbientColor {"MoonAmbientColor"};
+static const GffLabel MoonDiffuseColor {"MoonDiffuseColor"};
+static const GffLabel MoonFogColor {"MoonFogColor"};
+static const GffLabel MoonFogFar {"MoonFogFar"};
+static const GffLabel MoonFogNear {"MoonFogNear"};
+static const GffLabel MoonFogOn {"MoonFogOn"};
+static const GffLabel MoonShadows {"MoonShadows"};
+static const GffLabel Mouse {"Mouse"};
+static const GffLabel MovementPerSec {"MovementPerSec"};
+static const GffLabel Music {"Music"};
+static const GffLabel Name {"Name"};
+static const GffLabel Near_Clip {"Near_Clip"};
+static const GffLabel NoHangBack {"NoHangBack"};
+static const GffLabel NoRest {"NoRest"};
+static const GffLabel NorthAxis {"NorthAxis"};
+static const GffLabel Num_Loops {"Num_Loops"};
+static const GffLabel Obstacles {"Obstacles"};
+static const GffLabel OnAccelerate {"OnAccelerate"};
+static const GffLabel OnAnimEvent {"OnAnimEvent"};
+static const GffLabel OnBrake {"OnBrake"};
+static const GffLabel OnCreate {"OnCreate"};
+static const GffLabel OnDamage {"OnDamage"};
+static const GffLabel OnDeath {"OnDeath"};
+static const GffLabel OnEnter {"OnEnter"};
+static const GffLabel OnExit {"OnExit"};
+static const GffLabel OnFire {"OnFire"};
+static const GffLabel OnHeartbeat {"OnHeartbeat"};
+static const GffLabel OnHitBullet {"OnHitBullet"};
+static const GffLabel OnHitFollower {"OnHitFollower"};
+static const GffLabel OnHitObstacle {"OnHitObstacle"};
+static const GffLabel OnHitWorld {"OnHitWorld"};
+static const GffLabel OnTrackLoop {"OnTrackLoop"};
+static const GffLabel OnUserDefined {"OnUserDefined"};
+static const GffLabel Player {"Player"};
+static const GffLabel PlayerOnly {"PlayerOnly"};
+static const GffLabel PlayerVsPlayer {"PlayerVsPlayer"};
+static const GffLabel Rate_Of_Fire {"Rate_Of_Fire"};
+static const GffLabel RoomName {"RoomName"};
+static const GffLabel Rooms {"Rooms"};
+static const GffLabel RotatingModel {"RotatingModel"};
+static const GffLabel Scripts {"Scripts"};
+static const GffLabel Sensing_Radius {"Sensing_Radius"};
+static const GffLabel ShadowOpacity {"ShadowOpacity"};
+static const GffLabel Sounds {"Sounds"};
+static const GffLabel Speed {"Speed"};
+static const GffLabel Sphere_Radius {"Sphere_Radius"};
+static const GffLabel Start_Offset_X {"Start_Offset_X"};
+static const GffLabel Start_Offset_Y {"Start_Offset_Y"};
+static const GffLabel Start_Offset_Z {"Start_Offset_Z"};
+static const GffLabel StealthXPEnabled {"StealthXPEnabled"};
+static const GffLabel StealthXPLoss {"StealthXPLoss"};
+static const GffLabel StealthXPMax {"StealthXPMax"};
+static const GffLabel SunAmbientColor {"SunAmbientColor"};
+static const GffLabel SunDiffuseColor {"SunDiffuseColor"};
+static const GffLabel SunFogColor {"SunFogColor"};
+static const GffLabel SunFogFar {"SunFogFar"};
+static const GffLabel SunFogNear {"SunFogNear"};
+static const GffLabel SunFogOn {"SunFogOn"};
+static const GffLabel SunShadows {"SunShadows"};
+static const GffLabel Tag {"Tag"};
+static const GffLabel Target_Offset_X {"Target_Offset_X"};
+static const GffLabel Target_Offset_Y {"Target_Offset_Y"};
+static const GffLabel Target_Offset_Z {"Target_Offset_Z"};
+static const GffLabel Target_Type {"Target_Type"};
+static const GffLabel Track {"Track"};
+static const GffLabel Trigger {"Trigger"};
+static const GffLabel TunnelInfinite {"TunnelInfinite"};
+static const GffLabel TunnelXNeg {"TunnelXNeg"};
+static const GffLabel TunnelXPos {"TunnelXPos"};
+static const GffLabel TunnelYNeg {"TunnelYNeg"};
+static const GffLabel TunnelYPos {"TunnelYPos"};
+static const GffLabel TunnelZNeg {"TunnelZNeg"};
+static const GffLabel TunnelZPos {"TunnelZPos"};
+static const GffLabel Type {"Type"};
+static const GffLabel Unescapable {"Unescapable"};
+static const GffLabel UseInertia {"UseInertia"};
+static const GffLabel Version {"Version"};
+static const GffLabel Vert_Spread {"Vert_Spread"};
+static const GffLabel WindPower {"WindPower"};
+static const GffLabel WorldPt1X {"WorldPt1X"};
+static const GffLabel WorldPt1Y {"WorldPt1Y"};
+static const GffLabel WorldPt2X {"WorldPt2X"};
+static const GffLabel WorldPt2Y {"WorldPt2Y"};
+
+} // namespace labels
+
 static ARE_MiniGame_Player_Gun_Banks_Bullet parseARE_MiniGame_Player_Gun_Banks_Bullet(const Gff &gff) {
     ARE_MiniGame_Player_Gun_Banks_Bullet strct;
-    strct.Bullet_Model = gff.getString("Bullet_Model");
-    strct.Collision_Sound = gff.getString("Collision_Sound");
-    strct.Damage = gff.getUint("Damage");
-    strct.Lifespan = gff.getFloat("Lifespan");
-    strct.Rate_Of_Fire = gff.getFloat("Rate_Of_Fire");
-    strct.Speed = gff.getFloat("Speed");
-    strct.Target_Type = gff.getUint("Target_Type");
+    strct.Bullet_Model = gff.getString(labels::Bullet_Model);
+    strct.Collision_Sound = gff.getString(labels::Collision_Sound);
+    strct.Damage = gff.getUint(labels::Damage);
+    strct.Lifespan = gff.getFloat(labels::Lifespan);
+    strct.Rate_Of_Fire = gff.getFloat(labels::Rate_Of_Fire);
+    strct.Speed = gff.getFloat(labels::Speed);
+    strct.Target_Type = gff.getUint(labels::Target_Type);
     return strct;
 }
 
 static ARE_MiniGame_Enemies_Gun_Banks_Bullet parseARE_MiniGame_Enemies_Gun_Banks_Bullet(const Gff &gff) {
     ARE_MiniGame_Enemies_Gun_Banks_Bullet strct;
-    strct.Bullet_Model = gff.getString("Bullet_Model");
-    strct.Collision_Sound = gff.getString("Collision_Sound");
-    strct.Damage = gff.getUint("Damage");
-    strct.Lifespan = gff.getFloat("Lifespan");
-    strct.Rate_Of_Fire = gff.getFloat("Rate_Of_Fire");
-    strct.Speed = gff.getFloat("Speed");
-    strct.Target_Type = gff.getUint("Target_Type");
+    strct.Bullet_Model = gff.getString(labels::Bullet_Model);
+    strct.Collision_Sound = gff.getString(labels::Collision_Sound);
+    strct.Damage = gff.getUint(labels::Damage);
+    strct.Lifespan = gff.getFloat(labels::Lifespan);
+    strct.Rate_Of_Fire = gff.getFloat(labels::Rate_Of_Fire);
+    strct.Speed = gff.getFloat(labels::Speed);
+    strct.Target_Type = gff.getUint(labels::Target_Type);
     return strct;
 }
 
 static ARE_MiniGame_Player_Sounds parseARE_MiniGame_Player_Sounds(const Gff &gff) {
     ARE_MiniGame_Player_Sounds strct;
-    strct.Death = gff.getString("Death");
-    strct.Engine = gff.getString("Engine");
+    strct.Death = gff.getString(labels::Death);
+    strct.Engine = gff.getString(labels::Engine);
     return strct;
 }
 
 static ARE_MiniGame_Player_Scripts parseARE_MiniGame_Player_Scripts(const Gff &gff) {
     ARE_MiniGame_Player_Scripts strct;
-    strct.OnAccelerate = gff.getString("OnAccelerate");
-    strct.OnAnimEvent = gff.getString("OnAnimEvent");
-    strct.OnBrake = gff.getString("OnBrake");
-    strct.OnCreate = gff.getString("OnCreate");
-    strct.OnDamage = gff.getString("OnDamage");
-    strct.OnDeath = gff.getString("OnDeath");
-    strct.OnFire = gff.getString("OnFire");
-    strct.OnHeartbeat = gff.getString("OnHeartbeat");
-    strct.OnHitBullet = gff.getString("OnHitBullet");
-    strct.OnHitFollower = gff.getString("OnHitFollower");
-    strct.OnHitObstacle = gff.getString("OnHitObstacle");
-    strct.OnHitWorld = gff.getString("OnHitWorld");
-    strct.OnTrackLoop = gff.getString("OnTrackLoop");
+    strct.OnAccelerate = gff.getString(labels::OnAccelerate);
+    strct.OnAnimEvent = gff.getString(labels::OnAnimEvent);
+    strct.OnBrake = gff.getString(labels::OnBrake);
+    strct.OnCreate = gff.getString(labels::OnCreate);
+    strct.OnDamage = gff.getString(labels::OnDamage);
+    strct.OnDeath = gff.getString(labels::OnDeath);
+    strct.OnFire = gff.getString(labels::OnFire);
+    strct.OnHeartbeat = gff.getString(labels::OnHeartbeat);
+    strct.OnHitBullet = gff.getString(labels::OnHitBullet);
+    strct.OnHitFollower = gff.getString(labels::OnHitFollower);
+    strct.OnHitObstacle = gff.getString(labels::OnHitObstacle);
+    strct.OnHitWorld = gff.getString(labels::OnHitWorld);
+    strct.OnTrackLoop = gff.getString(labels::OnTrackLoop);
     return strct;
 }
 
 static ARE_MiniGame_Player_Models parseARE_MiniGame_Player_Models(const Gff &gff) {
     ARE_MiniGame_Player_Models strct;
-    strct.Model = gff.getString("Model");
-    strct.RotatingModel = gff.getUint("RotatingModel");
+    strct.Model = gff.getString(labels::Model);
+    strct.RotatingModel = gff.getUint(labels::RotatingModel);
     return strct;
 }
 
 static ARE_MiniGame_Player_Gun_Banks parseARE_MiniGame_Player_Gun_Banks(const Gff &gff) {
     ARE_MiniGame_Player_Gun_Banks strct;
-    strct.BankID = gff.getUint("BankID");
-    auto Bullet = gff.findStruct("Bullet");
+    strct.BankID = gff.getUint(labels::BankID);
+    auto Bullet = gff.findStruct(labels::Bullet);
     if (Bullet) {
         strct.Bullet = parseARE_MiniGame_Player_Gun_Banks_Bullet(*Bullet);
     }
-    strct.Fire_Sound = gff.getString("Fire_Sound");
-    strct.Gun_Model = gff.getString("Gun_Model");
+    strct.Fire_Sound = gff.getString(labels::Fire_Sound);
+    strct.Gun_Model = gff.getString(labels::Gun_Model);
     return strct;
 }
 
 static ARE_MiniGame_Obstacles_Scripts parseARE_MiniGame_Obstacles_Scripts(const Gff &gff) {
     ARE_MiniGame_Obstacles_Scripts strct;
-    strct.OnAnimEvent = gff.getString("OnAnimEvent");
-    strct.OnCreate = gff.getString("OnCreate");
-    strct.OnHeartbeat = gff.getString("OnHeartbeat");
-    strct.OnHitBullet = gff.getString("OnHitBullet");
-    strct.OnHitFollower = gff.getString("OnHitFollower");
+    strct.OnAnimEvent = gff.getString(labels::OnAnimEvent);
+    strct.OnCreate = gff.getString(labels::OnCreate);
+    strct.OnHeartbeat = gff.getString(labels::OnHeartbeat);
+    strct.OnHitBullet = gff.getString(labels::OnHitBullet);
+    strct.OnHitFollower = gff.getString(labels::OnHitFollower);
     return strct;
 }
 
 static ARE_MiniGame_Enemies_Sounds parseARE_MiniGame_Enemies_Sounds(const Gff &gff) {
     ARE_MiniGame_Enemies_Sounds strct;
-    strct.Death = gff.getString("Death");
-    strct.Engine = gff.getString("Engine");
+    strct.Death = gff.getString(labels::Death);
+    strct.Engine = gff.getString(labels::Engine);
     return strct;
 }
 
 static ARE_MiniGame_Enemies_Scripts parseARE_MiniGame_Enemies_Scripts(const Gff &gff) {
     ARE_MiniGame_Enemies_Scripts strct;
-    strct.OnAccelerate = gff.getString("OnAccelerate");
-    strct.OnAnimEvent = gff.getString("OnAnimEvent");
-    strct.OnBrake = gff.getString("OnBrake");
-    strct.OnCreate = gff.getString("OnCreate");
-    strct.OnDamage = gff.getString("OnDamage");
-    strct.OnDeath = gff.getString("OnDeath");
-    strct.OnFire = gff.getString("OnFire");
-    strct.OnHeartbeat = gff.getString("OnHeartbeat");
-    strct.OnHitBullet = gff.getString("OnHitBullet");
-    strct.OnHitFollower = gff.getString("OnHitFollower");
-    strct.OnHitObstacle = gff.getString("OnHitObstacle");
-    strct.OnHitWorld = gff.getString("OnHitWorld");
-    strct.OnTrackLoop = gff.getString("OnTrackLoop");
+    strct.OnAccelerate = gff.getString(labels::OnAccelerate);
+    strct.OnAnimEvent = gff.getString(labels::OnAnimEvent);
+    strct.OnBrake = gff.getString(labels::OnBrake);
+    strct.OnCreate = gff.getString(labels::OnCreate);
+    strct.OnDamage = gff.getString(labels::OnDamage);
+    strct.OnDeath = gff.getString(labels::OnDeath);
+    strct.OnFire = gff.getString(labels::OnFire);
+    strct.OnHeartbeat = gff.getString(labels::OnHeartbeat);
+    strct.OnHitBullet = gff.getString(labels::OnHitBullet);
+    strct.OnHitFollower = gff.getString(labels::OnHitFollower);
+    strct.OnHitObstacle = gff.getString(labels::OnHitObstacle);
+    strct.OnHitWorld = gff.getString(labels::OnHitWorld);
+    strct.OnTrackLoop = gff.getString(labels::OnTrackLoop);
     return strct;
 }
 
 static ARE_MiniGame_Enemies_Models parseARE_MiniGame_Enemies_Models(const Gff &gff) {
     ARE_MiniGame_Enemies_Models strct;
-    strct.Model = gff.getString("Model");
-    strct.RotatingModel = gff.getUint("RotatingModel");
+    strct.Model = gff.getString(labels::Model);
+    strct.RotatingModel = gff.getUint(labels::RotatingModel);
     return strct;
 }
 
 static ARE_MiniGame_Enemies_Gun_Banks parseARE_MiniGame_Enemies_Gun_Banks(const Gff &gff) {
     ARE_MiniGame_Enemies_Gun_Banks strct;
-    strct.BankID = gff.getUint("BankID");
-    auto Bullet = gff.findStruct("Bullet");
+    strct.BankID = gff.getUint(labels::BankID);
+    auto Bullet = gff.findStruct(labels::Bullet);
     if (Bullet) {
         strct.Bullet = parseARE_MiniGame_Enemies_Gun_Banks_Bullet(*Bullet);
     }
-    strct.Fire_Sound = gff.getString("Fire_Sound");
-    strct.Gun_Model = gff.getString("Gun_Model");
-    strct.Horiz_Spread = gff.getFloat("Horiz_Spread");
-    strct.Inaccuracy = gff.getFloat("Inaccuracy");
-    strct.Sensing_Radius = gff.getFloat("Sensing_Radius");
-    strct.Vert_Spread = gff.getFloat("Vert_Spread");
+    strct.Fire_Sound = gff.getString(labels::Fire_Sound);
+    strct.Gun_Model = gff.getString(labels::Gun_Model);
+    strct.Horiz_Spread = gff.getFloat(labels::Horiz_Spread);
+    strct.Inaccuracy = gff.getFloat(labels::Inaccuracy);
+    strct.Sensing_Radius = gff.getFloat(labels::Sensing_Radius);
+    strct.Vert_Spread = gff.getFloat(labels::Vert_Spread);
     return strct;
 }
 
 static ARE_MiniGame_Player parseARE_MiniGame_Player(const Gff &gff) {
     ARE_MiniGame_Player strct;
-    strct.Accel_Secs = gff.getFloat("Accel_Secs");
-    strct.Bump_Damage = gff.getInt("Bump_Damage");
-    strct.Camera = gff.getString("Camera");
-    strct.CameraRotate = gff.getUint("CameraRotate");
-    for (auto &item : gff.getList("Gun_Banks")) {
+    strct.Accel_Secs = gff.getFloat(labels::Accel_Secs);
+    strct.Bump_Damage = gff.getInt(labels::Bump_Damage);
+    strct.Camera = gff.getString(labels::Camera);
+    strct.CameraRotate = gff.getUint(labels::CameraRotate);
+    for (auto &item : gff.getList(labels::Gun_Banks)) {
         strct.Gun_Banks.push_back(parseARE_MiniGame_Player_Gun_Banks(*item));
     }
-    strct.Hit_Points = gff.getUint("Hit_Points");
-    strct.Invince_Period = gff.getFloat("Invince_Period");
-    strct.Max_HPs = gff.getUint("Max_HPs");
-    strct.Maximum_Speed = gff.getFloat("Maximum_Speed");
-    strct.Minimum_Speed = gff.getFloat("Minimum_Speed");
-    for (auto &item : gff.getList("Models")) {
+    strct.Hit_Points = gff.getUint(labels::Hit_Points);
+    strct.Invince_Period = gff.getFloat(labels::Invince_Period);
+    strct.Max_HPs = gff.getUint(labels::Max_HPs);
+    strct.Maximum_Speed = gff.getFloat(labels::Maximum_Speed);
+    strct.Minimum_Speed = gff.getFloat(labels::Minimum_Speed);
+    for (auto &item : gff.getList(labels::Models)) {
         strct.Models.push_back(parseARE_MiniGame_Player_Models(*item));
     }
-    strct.Num_Loops = gff.getInt("Num_Loops");
-    auto Scripts = gff.findStruct("Scripts");
+    strct.Num_Loops = gff.getInt(labels::Num_Loops);
+    auto Scripts = gff.findStruct(labels::Scripts);
     if (Scripts) {
         strct.Scripts = parseARE_MiniGame_Player_Scripts(*Scripts);
     }
-    auto Sounds = gff.findStruct("Sounds");
+    auto Sounds = gff.findStruct(labels::Sounds);
     if (Sounds) {
         strct.Sounds = parseARE_MiniGame_Player_Sounds(*Sounds);
     }
-    strct.Sphere_Radius = gff.getFloat("Sphere_Radius");
-    strct.Start_Offset_X = gff.getFloat("Start_Offset_X");
-    strct.Start_Offset_Y = gff.getFloat("Start_Offset_Y");
-    strct.Start_Offset_Z = gff.getFloat("Start_Offset_Z");
-    strct.Target_Offset_X = gff.getFloat("Target_Offset_X");
-    strct.Target_Offset_Y = gff.getFloat("Target_Offset_Y");
-    strct.Target_Offset_Z = gff.getFloat("Target_Offset_Z");
-    strct.Track = gff.getString("Track");
-    strct.TunnelInfinite = gff.getVector("TunnelInfinite");
-    strct.TunnelXNeg = gff.getFloat("TunnelXNeg");
-    strct.TunnelXPos = gff.getFloat("TunnelXPos");
-    strct.TunnelYNeg = gff.getFloat("TunnelYNeg");
-    strct.TunnelYPos = gff.getFloat("TunnelYPos");
-    strct.TunnelZNeg = gff.getFloat("TunnelZNeg");
-    strct.TunnelZPos = gff.getFloat("TunnelZPos");
+    strct.Sphere_Radius = gff.getFloat(labels::Sphere_Radius);
+    strct.Start_Offset_X = gff.getFloat(labels::Start_Offset_X);
+    strct.Start_Offset_Y = gff.getFloat(labels::Start_Offset_Y);
+    strct.Start_Offset_Z = gff.getFloat(labels::Start_Offset_Z);
+    strct.Target_Offset_X = gff.getFloat(labels::Target_Offset_X);
+    strct.Target_Offset_Y = gff.getFloat(labels::Target_Offset_Y);
+    strct.Target_Offset_Z = gff.getFloat(labels::Target_Offset_Z);
+    strct.Track = gff.getString(labels::Track);
+    strct.TunnelInfinite = gff.getVector(labels::TunnelInfinite);
+    strct.TunnelXNeg = gff.getFloat(labels::TunnelXNeg);
+    strct.TunnelXPos = gff.getFloat(labels::TunnelXPos);
+    strct.TunnelYNeg = gff.getFloat(labels::TunnelYNeg);
+    strct.TunnelYPos = gff.getFloat(labels::TunnelYPos);
+    strct.TunnelZNeg = gff.getFloat(labels::TunnelZNeg);
+    strct.TunnelZPos = gff.getFloat(labels::TunnelZPos);
     return strct;
 }
 
 static ARE_MiniGame_Obstacles parseARE_MiniGame_Obstacles(const Gff &gff) {
     ARE_MiniGame_Obstacles strct;
-    strct.Name = gff.getString("Name");
-    auto Scripts = gff.findStruct("Scripts");
+    strct.Name = gff.getString(labels::Name);
+    auto Scripts = gff.findStruct(labels::Scripts);
     if (Scripts) {
         strct.Scripts = parseARE_MiniGame_Obstacles_Scripts(*Scripts);
     }
@@ -207,180 +382,180 @@ static ARE_MiniGame_Obstacles parseARE_MiniGame_Obstacles(const Gff &gff) {
 
 static ARE_MiniGame_Mouse parseARE_MiniGame_Mouse(const Gff &gff) {
     ARE_MiniGame_Mouse strct;
-    strct.AxisX = gff.getUint("AxisX");
-    strct.AxisY = gff.getUint("AxisY");
-    strct.FlipAxisX = gff.getUint("FlipAxisX");
-    strct.FlipAxisY = gff.getUint("FlipAxisY");
+    strct.AxisX = gff.getUint(labels::AxisX);
+    strct.AxisY = gff.getUint(labels::AxisY);
+    strct.FlipAxisX = gff.getUint(labels::FlipAxisX);
+    strct.FlipAxisY = gff.getUint(labels::FlipAxisY);
     return strct;
 }
 
 static ARE_MiniGame_Enemies parseARE_MiniGame_Enemies(const Gff &gff) {
     ARE_MiniGame_Enemies strct;
-    strct.Bump_Damage = gff.getInt("Bump_Damage");
-    for (auto &item : gff.getList("Gun_Banks")) {
+    strct.Bump_Damage = gff.getInt(labels::Bump_Damage);
+    for (auto &item : gff.getList(labels::Gun_Banks)) {
         strct.Gun_Banks.push_back(parseARE_MiniGame_Enemies_Gun_Banks(*item));
     }
-    strct.Hit_Points = gff.getUint("Hit_Points");
-    strct.Invince_Period = gff.getFloat("Invince_Period");
-    strct.Max_HPs = gff.getUint("Max_HPs");
-    for (auto &item : gff.getList("Models")) {
+    strct.Hit_Points = gff.getUint(labels::Hit_Points);
+    strct.Invince_Period = gff.getFloat(labels::Invince_Period);
+    strct.Max_HPs = gff.getUint(labels::Max_HPs);
+    for (auto &item : gff.getList(labels::Models)) {
         strct.Models.push_back(parseARE_MiniGame_Enemies_Models(*item));
     }
-    strct.Num_Loops = gff.getInt("Num_Loops");
-    auto Scripts = gff.findStruct("Scripts");
+    strct.Num_Loops = gff.getInt(labels::Num_Loops);
+    auto Scripts = gff.findStruct(labels::Scripts);
     if (Scripts) {
         strct.Scripts = parseARE_MiniGame_Enemies_Scripts(*Scripts);
     }
-    auto Sounds = gff.findStruct("Sounds");
+    auto Sounds = gff.findStruct(labels::Sounds);
     if (Sounds) {
         strct.Sounds = parseARE_MiniGame_Enemies_Sounds(*Sounds);
     }
-    strct.Sphere_Radius = gff.getFloat("Sphere_Radius");
-    strct.Track = gff.getString("Track");
-    strct.Trigger = gff.getUint("Trigger");
+    strct.Sphere_Radius = gff.getFloat(labels::Sphere_Radius);
+    strct.Track = gff.getString(labels::Track);
+    strct.Trigger = gff.getUint(labels::Trigger);
     return strct;
 }
 
 static ARE_Rooms parseARE_Rooms(const Gff &gff) {
     ARE_Rooms strct;
-    strct.AmbientScale = gff.getFloat("AmbientScale");
-    strct.DisableWeather = gff.getUint("DisableWeather");
-    strct.EnvAudio = gff.getInt("EnvAudio");
-    strct.ForceRating = gff.getInt("ForceRating");
-    strct.RoomName = gff.getString("RoomName");
+    strct.AmbientScale = gff.getFloat(labels::AmbientScale);
+    strct.DisableWeather = gff.getUint(labels::DisableWeather);
+    strct.EnvAudio = gff.getInt(labels::EnvAudio);
+    strct.ForceRating = gff.getInt(labels::ForceRating);
+    strct.RoomName = gff.getString(labels::RoomName);
     return strct;
 }
 
 static ARE_MiniGame parseARE_MiniGame(const Gff &gff) {
     ARE_MiniGame strct;
-    strct.Bump_Plane = gff.getUint("Bump_Plane");
-    strct.CameraViewAngle = gff.getFloat("CameraViewAngle");
-    strct.DOF = gff.getUint("DOF");
-    strct.DoBumping = gff.getUint("DoBumping");
-    for (auto &item : gff.getList("Enemies")) {
+    strct.Bump_Plane = gff.getUint(labels::Bump_Plane);
+    strct.CameraViewAngle = gff.getFloat(labels::CameraViewAngle);
+    strct.DOF = gff.getUint(labels::DOF);
+    strct.DoBumping = gff.getUint(labels::DoBumping);
+    for (auto &item : gff.getList(labels::Enemies)) {
         strct.Enemies.push_back(parseARE_MiniGame_Enemies(*item));
     }
-    strct.Far_Clip = gff.getFloat("Far_Clip");
-    strct.LateralAccel = gff.getFloat("LateralAccel");
-    auto Mouse = gff.findStruct("Mouse");
+    strct.Far_Clip = gff.getFloat(labels::Far_Clip);
+    strct.LateralAccel = gff.getFloat(labels::LateralAccel);
+    auto Mouse = gff.findStruct(labels::Mouse);
     if (Mouse) {
         strct.Mouse = parseARE_MiniGame_Mouse(*Mouse);
     }
-    strct.MovementPerSec = gff.getFloat("MovementPerSec");
-    strct.Music = gff.getString("Music");
-    strct.Near_Clip = gff.getFloat("Near_Clip");
-    for (auto &item : gff.getList("Obstacles")) {
+    strct.MovementPerSec = gff.getFloat(labels::MovementPerSec);
+    strct.Music = gff.getString(labels::Music);
+    strct.Near_Clip = gff.getFloat(labels::Near_Clip);
+    for (auto &item : gff.getList(labels::Obstacles)) {
         strct.Obstacles.push_back(parseARE_MiniGame_Obstacles(*item));
     }
-    auto Player = gff.findStruct("Player");
+    auto Player = gff.findStruct(labels::Player);
     if (Player) {
         strct.Player = parseARE_MiniGame_Player(*Player);
     }
-    strct.Type = gff.getUint("Type");
-    strct.UseInertia = gff.getUint("UseInertia");
+    strct.Type = gff.getUint(labels::Type);
+    strct.UseInertia = gff.getUint(labels::UseInertia);
     return strct;
 }
 
 static ARE_Map parseARE_Map(const Gff &gff) {
     ARE_Map strct;
-    strct.MapPt1X = gff.getFloat("MapPt1X");
-    strct.MapPt1Y = gff.getFloat("MapPt1Y");
-    strct.MapPt2X = gff.getFloat("MapPt2X");
-    strct.MapPt2Y = gff.getFloat("MapPt2Y");
-    strct.MapResX = gff.getInt("MapResX");
-    strct.MapZoom = gff.getInt("MapZoom");
-    strct.NorthAxis = gff.getInt("NorthAxis");
-    strct.WorldPt1X = gff.getFloat("WorldPt1X");
-    strct.WorldPt1Y = gff.getFloat("WorldPt1Y");
-    strct.WorldPt2X = gff.getFloat("WorldPt2X");
-    strct.WorldPt2Y = gff.getFloat("WorldPt2Y");
+    strct.MapPt1X = gff.getFloat(labels::MapPt1X);
+    strct.MapPt1Y = gff.getFloat(labels::MapPt1Y);
+    strct.MapPt2X = gff.getFloat(labels::MapPt2X);
+    strct.MapPt2Y = gff.getFloat(labels::MapPt2Y);
+    strct.MapResX = gff.getInt(labels::MapResX);
+    strct.MapZoom = gff.getInt(labels::MapZoom);
+    strct.NorthAxis = gff.getInt(labels::NorthAxis);
+    strct.WorldPt1X = gff.getFloat(labels::WorldPt1X);
+    strct.WorldPt1Y = gff.getFloat(labels::WorldPt1Y);
+    strct.WorldPt2X = gff.getFloat(labels::WorldPt2X);
+    strct.WorldPt2Y = gff.getFloat(labels::WorldPt2Y);
     return strct;
 }
 
 ARE parseARE(const Gff &gff) {
     ARE strct;
-    strct.AlphaTest = gff.getFloat("AlphaTest");
-    strct.CameraStyle = gff.getInt("CameraStyle");
-    strct.ChanceLightning = gff.getInt("ChanceLightning");
-    strct.ChanceRain = gff.getInt("ChanceRain");
-    strct.ChanceSnow = gff.getInt("ChanceSnow");
-    strct.Comments = gff.getString("Comments");
-    strct.Creator_ID = gff.getInt("Creator_ID");
-    strct.DayNightCycle = gff.getUint("DayNightCycle");
-    strct.DefaultEnvMap = gff.getString("DefaultEnvMap");
-    strct.DirtyARGBOne = gff.getInt("DirtyARGBOne");
-    strct.DirtyARGBThree = gff.getInt("DirtyARGBThree");
-    strct.DirtyARGBTwo = gff.getInt("DirtyARGBTwo");
-    strct.DirtyFormulaOne = gff.getInt("DirtyFormulaOne");
-    strct.DirtyFormulaThre = gff.getInt("DirtyFormulaThre");
-    strct.DirtyFormulaTwo = gff.getInt("DirtyFormulaTwo");
-    strct.DirtyFuncOne = gff.getInt("DirtyFuncOne");
-    strct.DirtyFuncThree = gff.getInt("DirtyFuncThree");
-    strct.DirtyFuncTwo = gff.getInt("DirtyFuncTwo");
-    strct.DirtySizeOne = gff.getInt("DirtySizeOne");
-    strct.DirtySizeThree = gff.getInt("DirtySizeThree");
-    strct.DirtySizeTwo = gff.getInt("DirtySizeTwo");
-    strct.DisableTransit = gff.getUint("DisableTransit");
-    strct.DynAmbientColor = gff.getUint("DynAmbientColor");
-    strct.Flags = gff.getUint("Flags");
-    strct.Grass_Ambient = gff.getUint("Grass_Ambient");
-    strct.Grass_Density = gff.getFloat("Grass_Density");
-    strct.Grass_Diffuse = gff.getUint("Grass_Diffuse");
-    strct.Grass_Emissive = gff.getUint("Grass_Emissive");
-    strct.Grass_Prob_LL = gff.getFloat("Grass_Prob_LL");
-    strct.Grass_Prob_LR = gff.getFloat("Grass_Prob_LR");
-    strct.Grass_Prob_UL = gff.getFloat("Grass_Prob_UL");
-    strct.Grass_Prob_UR = gff.getFloat("Grass_Prob_UR");
-    strct.Grass_QuadSize = gff.getFloat("Grass_QuadSize");
-    strct.Grass_TexName = gff.getString("Grass_TexName");
-    strct.ID = gff.getInt("ID");
-    strct.IsNight = gff.getUint("IsNight");
-    strct.LightingScheme = gff.getUint("LightingScheme");
-    strct.LoadScreenID = gff.getUint("LoadScreenID");
-    auto Map = gff.findStruct("Map");
+    strct.AlphaTest = gff.getFloat(labels::AlphaTest);
+    strct.CameraStyle = gff.getInt(labels::CameraStyle);
+    strct.ChanceLightning = gff.getInt(labels::ChanceLightning);
+    strct.ChanceRain = gff.getInt(labels::ChanceRain);
+    strct.ChanceSnow = gff.getInt(labels::ChanceSnow);
+    strct.Comments = gff.getString(labels::Comments);
+    strct.Creator_ID = gff.getInt(labels::Creator_ID);
+    strct.DayNightCycle = gff.getUint(labels::DayNightCycle);
+    strct.DefaultEnvMap = gff.getString(labels::DefaultEnvMap);
+    strct.DirtyARGBOne = gff.getInt(labels::DirtyARGBOne);
+    strct.DirtyARGBThree = gff.getInt(labels::DirtyARGBThree);
+    strct.DirtyARGBTwo = gff.getInt(labels::DirtyARGBTwo);
+    strct.DirtyFormulaOne = gff.getInt(labels::DirtyFormulaOne);
+    strct.DirtyFormulaThre = gff.getInt(labels::DirtyFormulaThre);
+    strct.DirtyFormulaTwo = gff.getInt(labels::DirtyFormulaTwo);
+    strct.DirtyFuncOne = gff.getInt(labels::DirtyFuncOne);
+    strct.DirtyFuncThree = gff.getInt(labels::DirtyFuncThree);
+    strct.DirtyFuncTwo = gff.getInt(labels::DirtyFuncTwo);
+    strct.DirtySizeOne = gff.getInt(labels::DirtySizeOne);
+    strct.DirtySizeThree = gff.getInt(labels::DirtySizeThree);
+    strct.DirtySizeTwo = gff.getInt(labels::DirtySizeTwo);
+    strct.DisableTransit = gff.getUint(labels::DisableTransit);
+    strct.DynAmbientColor = gff.getUint(labels::DynAmbientColor);
+    strct.Flags = gff.getUint(labels::Flags);
+    strct.Grass_Ambient = gff.getUint(labels::Grass_Ambient);
+    strct.Grass_Density = gff.getFloat(labels::Grass_Density);
+    strct.Grass_Diffuse = gff.getUint(labels::Grass_Diffuse);
+    strct.Grass_Emissive = gff.getUint(labels::Grass_Emissive);
+    strct.Grass_Prob_LL = gff.getFloat(labels::Grass_Prob_LL);
+    strct.Grass_Prob_LR = gff.getFloat(labels::Grass_Prob_LR);
+    strct.Grass_Prob_UL = gff.getFloat(labels::Grass_Prob_UL);
+    strct.Grass_Prob_UR = gff.getFloat(labels::Grass_Prob_UR);
+    strct.Grass_QuadSize = gff.getFloat(labels::Grass_QuadSize);
+    strct.Grass_TexName = gff.getString(labels::Grass_TexName);
+    strct.ID = gff.getInt(labels::ID);
+    strct.IsNight = gff.getUint(labels::IsNight);
+    strct.LightingScheme = gff.getUint(labels::LightingScheme);
+    strct.LoadScreenID = gff.getUint(labels::LoadScreenID);
+    auto Map = gff.findStruct(labels::Map);
     if (Map) {
         strct.Map = parseARE_Map(*Map);
     }
-    auto MiniGame = gff.findStruct("MiniGame");
+    auto MiniGame = gff.findStruct(labels::MiniGame);
     if (MiniGame) {
         strct.MiniGame = parseARE_MiniGame(*MiniGame);
     }
-    strct.ModListenCheck = gff.getInt("ModListenCheck");
-    strct.ModSpotCheck = gff.getInt("ModSpotCheck");
-    strct.MoonAmbientColor = gff.getUint("MoonAmbientColor");
-    strct.MoonDiffuseColor = gff.getUint("MoonDiffuseColor");
-    strct.MoonFogColor = gff.getUint("MoonFogColor");
-    strct.MoonFogFar = gff.getFloat("MoonFogFar");
-    strct.MoonFogNear = gff.getFloat("MoonFogNear");
-    strct.MoonFogOn = gff.getUint("MoonFogOn");
-    strct.MoonShadows = gff.getUint("MoonShadows");
-    strct.Name = std::make_pair(gff.getInt("Name"), gff.getString("Name"));
-    strct.NoHangBack = gff.getUint("NoHangBack");
-    strct.NoRest = gff.getUint("NoRest");
-    strct.OnEnter = gff.getString("OnEnter");
-    strct.OnExit = gff.getString("OnExit");
-    strct.OnHeartbeat = gff.getString("OnHeartbeat");
-    strct.OnUserDefined = gff.getString("OnUserDefined");
-    strct.PlayerOnly = gff.getUint("PlayerOnly");
-    strct.PlayerVsPlayer = gff.getUint("PlayerVsPlayer");
-    for (auto &item : gff.getList("Rooms")) {
+    strct.ModListenCheck = gff.getInt(labels::ModListenCheck);
+    strct.ModSpotCheck = gff.getInt(labels::ModSpotCheck);
+    strct.MoonAmbientColor = gff.getUint(labels::MoonAmbientColor);
+    strct.MoonDiffuseColor = gff.getUint(labels::MoonDiffuseColor);
+    strct.MoonFogColor = gff.getUint(labels::MoonFogColor);
+    strct.MoonFogFar = gff.getFloat(labels::MoonFogFar);
+    strct.MoonFogNear = gff.getFloat(labels::MoonFogNear);
+    strct.MoonFogOn = gff.getUint(labels::MoonFogOn);
+    strct.MoonShadows = gff.getUint(labels::MoonShadows);
+    strct.Name = std::make_pair(gff.getInt(labels::Name), gff.getString(labels::Name));
+    strct.NoHangBack = gff.getUint(labels::NoHangBack);
+    strct.NoRest = gff.getUint(labels::NoRest);
+    strct.OnEnter = gff.getString(labels::OnEnter);
+    strct.OnExit = gff.getString(labels::OnExit);
+    strct.OnHeartbeat = gff.getString(labels::OnHeartbeat);
+    strct.OnUserDefined = gff.getString(labels::OnUserDefined);
+    strct.PlayerOnly = gff.getUint(labels::PlayerOnly);
+    strct.PlayerVsPlayer = gff.getUint(labels::PlayerVsPlayer);
+    for (auto &item : gff.getList(labels::Rooms)) {
         strct.Rooms.push_back(parseARE_Rooms(*item));
     }
-    strct.ShadowOpacity = gff.getUint("ShadowOpacity");
-    strct.StealthXPEnabled = gff.getUint("StealthXPEnabled");
-    strct.StealthXPLoss = gff.getUint("StealthXPLoss");
-    strct.StealthXPMax = gff.getUint("StealthXPMax");
-    strct.SunAmbientColor = gff.getUint("SunAmbientColor");
-    strct.SunDiffuseColor = gff.getUint("SunDiffuseColor");
-    strct.SunFogColor = gff.getUint("SunFogColor");
-    strct.SunFogFar = gff.getFloat("SunFogFar");
-    strct.SunFogNear = gff.getFloat("SunFogNear");
-    strct.SunFogOn = gff.getUint("SunFogOn");
-    strct.SunShadows = gff.getUint("SunShadows");
-    strct.Tag = gff.getString("Tag");
-    strct.Unescapable = gff.getUint("Unescapable");
-    strct.Version = gff.getUint("Version");
-    strct.WindPower = gff.getInt("WindPower");
+    strct.ShadowOpacity = gff.getUint(labels::ShadowOpacity);
+    strct.StealthXPEnabled = gff.getUint(labels::StealthXPEnabled);
+    strct.StealthXPLoss = gff.getUint(labels::StealthXPLoss);
+    strct.StealthXPMax = gff.getUint(labels::StealthXPMax);
+    strct.SunAmbientColor = gff.getUint(labels::SunAmbientColor);
+    strct.SunDiffuseColor = gff.getUint(labels::SunDiffuseColor);
+    strct.SunFogColor = gff.getUint(labels::SunFogColor);
+    strct.SunFogFar = gff.getFloat(labels::SunFogFar);
+    strct.SunFogNear = gff.getFloat(labels::SunFogNear);
+    strct.SunFogOn = gff.getUint(labels::SunFogOn);
+    strct.SunShadows = gff.getUint(labels::SunShadows);
+    strct.Tag = gff.getString(labels::Tag);
+    strct.Unescapable = gff.getUint(labels::Unescapable);
+    strct.Version = gff.getUint(labels::Version);
+    strct.WindPower = gff.getInt(labels::WindPower);
     return strct;
 }
 
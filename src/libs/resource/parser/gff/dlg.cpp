@@ -25,142 +25,246 @@ namespace resource {
 
 namespace generated {
 
+namespace labels {
+
+static const GffLabel ActionParam1 {"ActionParam1"};
+static const GffLabel ActionParam1b {"ActionParam1b"};
+static const GffLabel ActionParam2 {"ActionParam2"};
+static const GffLabel ActionParam2b {"ActionParam2b"};
+static const GffLabel ActionParam3 {"ActionParam3"};
+static const GffLabel ActionParam3b {"ActionParam3b"};
+static const GffLabel ActionParam4 {"ActionParam4"};
+static const GffLabel ActionParam4b {"ActionParam4b"};
+static const GffLabel ActionParam5 {"ActionParam5"};
+static const GffLabel ActionParam5b {"ActionParam5b"};
+static const GffLabel ActionParamStrA {"ActionParamStrA"};
+static const GffLabel ActionParamStrB {"ActionParamStrB"};
+static const GffLabel Active {"Active"};
+static const GffLabel Active2 {"Active2"};
+static const GffLabel AlienRaceNode {"AlienRaceNode"};
+static const GffLabel AlienRaceOwner {"AlienRaceOwner"};
+static const GffLabel AmbientTrack {"AmbientTrack"};
+static const GffLabel AnimList {"AnimList"};
+static const GffLabel AnimatedCut {"AnimatedCut"};
+static const GffLabel Animation {"Animation"};
+static const GffLabel CamFieldOfView {"CamFieldOfView"};
+static const GffLabel CamHeightOffset {"CamHeightOffset"};
+static const GffLabel CamVidEffect {"CamVidEffect"};
+static const GffLabel CameraAngle {"CameraAngle"};
+static const GffLabel CameraAnimation {"CameraAnimation"};
+static const GffLabel CameraID {"CameraID"};
+static const GffLabel CameraModel {"CameraModel"};
+static const GffLabel Changed {"Changed"};
+static const GffLabel Comment {"Comment"};
+static const GffLabel ComputerType {"ComputerType"};
+static const GffLabel ConversationType {"ConversationType"};
+static const GffLabel Delay {"Delay"};
+static const GffLabel DelayEntry {"DelayEntry"};
+static const GffLabel DelayReply {"DelayReply"};
+static const GffLabel DeletedVOFiles {"DeletedVOFiles"};
+static const GffLabel EditorInfo {"EditorInfo"};
+static const GffLabel Emotion {"Emotion"};
+static const GffLabel EndConverAbort {"EndConverAbort"};
+static const GffLabel EndConversation {"EndConversation"};
+static const GffLabel EntriesList {"EntriesList"};
+static const GffLabel EntryList {"EntryList"};
+static const GffLabel FacialAnim {"FacialAnim"};
+static const GffLabel FadeColor {"FadeColor"};
+static const GffLabel FadeDelay {"FadeDelay"};
+static const GffLabel FadeLength {"FadeLength"};
+static const GffLabel FadeType {"FadeType"};
+static const GffLabel Index {"Index"};
+static const GffLabel IsChild {"IsChild"};
+static const GffLabel LinkComment {"LinkComment"};
+static const GffLabel Listener {"Listener"};
+static const GffLabel Logic {"Logic"};
+static const GffLabel NextNodeID {"NextNodeID"};
+static const GffLabel NodeID {"NodeID"};
+static const GffLabel NodeUnskippable {"NodeUnskippable"};
+static const GffLabel Not {"Not"};
+static const GffLabel Not2 {"Not2"};
+static const GffLabel NumWords {"NumWords"};
+static const GffLabel OldHitCheck {"OldHitCheck"};
+static const GffLabel Param1 {"Param1"};
+static const GffLabel Param1b {"Param1b"};
+static const GffLabel Param2 {"Param2"};
+static const GffLabel Param2b {"Param2b"};
+static const GffLabel Param3 {"Param3"};
+static const GffLabel Param3b {"Param3b"};
+static const GffLabel Param4 {"Param4"};
+static const GffLabel Param4b {"Param4b"};
+static const GffLabel Param5 {"Param5"};
+static const GffLabel Param5b {"Param5b"};
+static const GffLabel ParamStrA {"ParamStrA"};
+static const GffLabel ParamStrB {"ParamStrB"};
+static const GffLabel Participant {"Participant"};
+static const GffLabel PlotIndex {"PlotIndex"};
+static const GffLabel PlotXPPercentage {"PlotXPPercentage"};
+static const GffLabel PostProcNode {"PostProcNode"};
+static const GffLabel PostProcOwner {"PostProcOwner"};
+static const GffLabel Quest {"Quest"};
+static const GffLabel QuestEntry {"QuestEntry"};
+static const GffLabel RecordNoVO {"RecordNoVO"};
+static const GffLabel RecordNoVOOverri {"RecordNoVOOverri"};
+static const GffLabel RecordVO {"RecordVO"};
+static const GffLabel RepliesList {"RepliesList"};
+static const GffLabel ReplyList {"ReplyList"};
+static const GffLabel Script {"Script"};
+static const GffLabel Script2 {"Script2"};
+static const GffLabel Skippable {"Skippable"};
+static const GffLabel Sound {"Sound"};
+static const GffLabel SoundExists {"SoundExists"};
+static const GffLabel Speaker {"Speaker"};
+static const GffLabel StartingList {"StartingList"};
+static const GffLabel StuntList {"StuntList"};
+static const GffLabel StuntModel {"StuntModel"};
+static const GffLabel TarHeightOffset {"TarHeightOffset"};
+static const GffLabel Text {"Text"};
+static const GffLabel UnequipHItem {"UnequipHItem"};
+static const GffLabel UnequipItems {"UnequipItems"};
+static const GffLabel VOTextChanged {"VOTextChanged"};
+static const GffLabel VO_ID {"VO_ID"};
+static const GffLabel VO_ResRef {"VO_ResRef"};
+static const GffLabel WaitFlags {"WaitFlags"};
+
+} // namespace labels
+
 static DLG_EntryReplyList_EntriesRepliesList parseDLG_EntryReplyList_EntriesRepliesList(const Gff &gff) {
     DLG_EntryReplyList_EntriesRepliesList strct;
-    strct.Active = gff.getString("Active");
-    strct.Active2 = gff.getString("Active2");
-    strct.Index = gff.getUint("Index");
-    strct.IsChild = gff.getUint("IsChild");
-    strct.LinkComment = gff.getString("LinkComment");
-    strct.Logic = gff.getInt("Logic");
-    strct.Not = gff.getUint("Not");
-    strct.Not2 = gff.getUint("Not2");
-    strct.Param1 = gff.getInt("Param1");
-    strct.Param1b = gff.getInt("Param1b");
-    strct.Param2 = gff.getInt("Param2");
-    strct.Param2b = gff.getInt("Param2b");
-    strct.Param3 = gff.getInt("Param3");
-    strct.Param3b = gff.getInt("Param3b");
-    strct.Param4 = gff.getInt("Param4");
-    strct.Param4b = gff.getInt("Param4b");
-    strct.Param5 = gff.getInt("Param5");
-    strct.Param5b = gff.getInt("Param5b");
-    strct.ParamStrA = gff.getString("ParamStrA");
-    strct.ParamStrB = gff.getString("ParamStrB");
+    strct.Active = gff.getString(labels::Active);
+    strct.Active2 = gff.getString(labels::Active2);
+    strct.Index = gff.getUint(labels::Index);
+    strct.IsChild = gff.getUint(labels::IsChild);
+    strct.LinkComment = gff.getString(labels::LinkComment);
+    strct.Logic = gff.getInt(labels::Logic);
+    strct.Not = gff.getUint(labels::Not);
+    strct.Not2 = gff.getUint(labels::Not2);
+    strct.Param1 = gff.getInt(labels::Param1);
+    strct.Param1b = gff.getInt(labels::Param1b);
+    strct.Param2 = gff.getInt(labels::Param2);
+    strct.Param2b = gff.getInt(labels::Param2b);
+    strct.Param3 = gff.getInt(labels::Param3);
+    strct.Param3b = gff.getInt(labels::Param3b);
+    strct.Param4 = gff.getInt(labels::Param4);
+    strct.Param4b = gff.getInt(labels::Param4b);
+    strct.Param5 = gff.getInt(labels::Param5);
+    strct.Param5b = gff.getInt(labels::Param5b);
+    strct.ParamStrA = gff.getString(labels::ParamStrA);
+    strct.ParamStrB = gff.getString(labels::ParamStrB);
     return strct;
 }
 
 static DLG_EntryReplyList_AnimList parseDLG_EntryReplyList_AnimList(const Gff &gff) {
     DLG_EntryReplyList_AnimList strct;
-    strct.Animation = gff.getUint("Animation");
-    strct.Participant = gff.getString("Participant");
+    strct.Animation = gff.getUint(labels::Animation);
+    strct.Participant = gff.getString(labels::Participant);
     return strct;
 }
 
 static DLG_StuntList parseDLG_StuntList(const Gff &gff) {
     DLG_StuntList strct;
-    strct.Participant = gff.getString("Participant");
-    strct.StuntModel = gff.getString("StuntModel");
+    strct.Participant = gff.getString(labels::Participant);
+    strct.StuntModel = gff.getString(labels::StuntModel);
     return strct;
 }
 
 static DLG_EntryReplyList parseDLG_EntryReplyList(const Gff &gff) {
     DLG_EntryReplyList strct;
-    strct.ActionParam1 = gff.getInt("ActionParam1");
-    strct.ActionParam1b = gff.getInt("ActionParam1b");
-    strct.ActionParam2 = gff.getInt("ActionParam2");
-    strct.ActionParam2b = gff.getInt("ActionParam2b");
-    strct.ActionParam3 = gff.getInt("ActionParam3");
-    strct.ActionParam3b = gff.getInt("ActionParam3b");
-    strct.ActionParam4 = gff.getInt("ActionParam4");
-    strct.ActionParam4b = gff.getInt("ActionParam4b");
-    strct.ActionParam5 = gff.getInt("ActionParam5");
-    strct.ActionParam5b = gff.getInt("ActionParam5b");
-    strct.ActionParamStrA = gff.getString("ActionParamStrA");
-    strct.ActionParamStrB = gff.getString("ActionParamStrB");
-    strct.AlienRaceNode = gff.getInt("AlienRaceNode");
-    for (auto &item : gff.getList("AnimList")) {
+    strct.ActionParam1 = gff.getInt(labels::ActionParam1);
+    strct.ActionParam1b = gff.getInt(labels::ActionParam1b);
+    strct.ActionParam2 = gff.getInt(labels::ActionParam2);
+    strct.ActionParam2b = gff.getInt(labels::ActionParam2b);
+    strct.ActionParam3 = gff.getInt(labels::ActionParam3);
+    strct.ActionParam3b = gff.getInt(labels::ActionParam3b);
+    strct.ActionParam4 = gff.getInt(labels::ActionParam4);
+    strct.ActionParam4b = gff.getInt(labels::ActionParam4b);
+    strct.ActionParam5 = gff.getInt(labels::ActionParam5);
+    strct.ActionParam5b = gff.getInt(labels::ActionParam5b);
+    strct.ActionParamStrA = gff.getString(labels::ActionParamStrA);
+    strct.ActionParamStrB = gff.getString(labels::ActionParamStrB);
+    strct.AlienRaceNode = gff.getInt(labels::AlienRaceNode);
+    for (auto &item : gff.getList(labels::AnimList)) {
         strct.AnimList.push_back(parseDLG_EntryReplyList_AnimList(*item));
     }
-    strct.CamFieldOfView = gff.getFloat("CamFieldOfView");
-    strct.CamHeightOffset = gff.getFloat("CamHeightOffset");
-    strct.CamVidEffect = gff.getInt("CamVidEffect");
-    strct.CameraAngle = gff.getUint("CameraAngle");
-    strct.CameraAnimation = gff.getUint("CameraAnimation");
-    strct.CameraID = gff.getInt("CameraID");
-    strct.Changed = gff.getUint("Changed");
-    strct.Comment = gff.getString("Comment");
-    strct.Delay = gff.getUint("Delay");
-    strct.Emotion = gff.getInt("Emotion");
-    for (auto &item : gff.getList("EntriesList")) {
+    strct.CamFieldOfView = gff.getFloat(labels::CamFieldOfView);
+    strct.CamHeightOffset = gff.getFloat(labels::CamHeightOffset);
+    strct.CamVidEffect = gff.getInt(labels::CamVidEffect);
+    strct.CameraAngle = gff.getUint(labels::CameraAngle);
+    strct.CameraAnimation = gff.getUint(labels::CameraAnimation);
+    strct.CameraID = gff.getInt(labels::CameraID);
+    strct.Changed = gff.getUint(labels::Changed);
+    strct.Comment = gff.getString(labels::Comment);
+    strct.Delay = gff.getUint(labels::Delay);
+    strct.Emotion = gff.getInt(labels::Emotion);
+    for (auto &item : gff.getList(labels::EntriesList)) {
         strct.EntriesList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(*item));
     }
-    strct.FacialAnim = gff.getInt("FacialAnim");
-    strct.FadeColor = gff.getVector("FadeColor");
-    strct.FadeDelay = gff.getFloat("FadeDelay");
-    strct.FadeLength = gff.getFloat("FadeLength");
-    strct.FadeType = gff.getUint("FadeType");
-    strct.Listener = gff.getString("Listener");
-    strct.NodeID = gff.getInt("NodeID");
-    strct.NodeUnskippable = gff.getInt("NodeUnskippable");
-    strct.PlotIndex = gff.getInt("PlotIndex");
-    strct.PlotXPPercentage = gff.getFloat("PlotXPPercentage");
-    strct.PostProcNode = gff.getInt("PostProcNode");
-    strct.Quest = gff.getString("Quest");
-    strct.QuestEntry = gff.getUint("QuestEntry");
-    strct.RecordNoVOOverri = gff.getInt("RecordNoVOOverri");
-    strct.RecordVO = gff.getInt("RecordVO");
-    for (auto &item : gff.getList("RepliesList")) {
+    strct.FacialAnim = gff.getInt(labels::FacialAnim);
+    strct.FadeColor = gff.getVector(labels::FadeColor);
+    strct.FadeDelay = gff.getFloat(labels::FadeDelay);
+    strct.FadeLength = gff.getFloat(labels::FadeLength);
+    strct.FadeType = gff.getUint(labels::FadeType);
+    strct.Listener = gff.getString(labels::Listener);
+    strct.NodeID = gff.getInt(labels::NodeID);
+    strct.NodeUnskippable = gff.getInt(labels::NodeUnskippable);
+    strct.PlotIndex = gff.getInt(labels::PlotIndex);
+    strct.PlotXPPercentage = gff.getFloat(labels::PlotXPPercentage);
+    strct.PostProcNode = gff.getInt(labels::PostProcNode);
+    strct.Quest = gff.getString(labels::Quest);
+    strct.QuestEntry = gff.getUint(labels::QuestEntry);
+    strct.RecordNoVOOverri = gff.getInt(labels::RecordNoVOOverri);
+    strct.RecordVO = gff.getInt(labels::RecordVO);
+    for (auto &item : gff.getList(labels::RepliesList)) {
         strct.RepliesList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(*item));
     }
-    strct.Script = gff.getString("Script");
-    strct.Script2 = gff.getString("Script2");
-    strct.Sound = gff.getString("Sound");
-    strct.SoundExists = gff.getUint("SoundExists");
-    strct.Speaker = gff.getString("Speaker");
-    strct.TarHeightOffset = gff.getFloat("TarHeightOffset");
-    strct.Text = std::make_pair(gff.getInt("Text"), gff.getString("Text"));
-    strct.VOTextChanged = gff.getUint("VOTextChanged");
-    strct.VO_ResRef = gff.getString("VO_ResRef");
-    strct.WaitFlags = gff.getUint("WaitFlags");
+    strct.Script = gff.getString(labels::Script);
+    strct.Script2 = gff.getString(labels::Script2);
+    strct.Sound = gff.getString(labels::Sound);
+    strct.SoundExists = gff.getUint(labels::SoundExists);
+    strct.Speaker = gff.getString(labels::Speaker);
+    strct.TarHeightOffset = gff.getFloat(labels::TarHeightOffset);
+    strct.Text = std::make_pair(gff.getInt(labels::Text), gff.getString(labels::Text));
+    strct.VOTextChanged = gff.getUint(labels::VOTextChanged);
+    strct.VO_ResRef = gff.getString(labels::VO_ResRef);
+    strct.WaitFlags = gff.getUint(labels::WaitFlags);
     return strct;
 }
 
 DLG parseDLG(const Gff &gff) {
     DLG strct;
-    strct.AlienRaceOwner = gff.getInt("AlienRaceOwner");
-    strct.AmbientTrack = gff.getString("AmbientTrack");
-    strct.AnimatedCut = gff.getUint("AnimatedCut");
-    strct.CameraModel = gff.getString("CameraModel");
-    strct.ComputerType = gff.getUint("ComputerType");
-    strct.ConversationType = gff.getInt("ConversationType");
-    strct.DelayEntry = gff.getUint("DelayEntry");
-    strct.DelayReply = gff.getUint("DelayReply");
-    strct.DeletedVOFiles = gff.getString("DeletedVOFiles");
-    strct.EditorInfo = gff.getString("EditorInfo");
-    strct.EndConverAbort = gff.getString("EndConverAbort");
-    strct.EndConversation = gff.getString("EndConversation");
-    for (auto &item : gff.getList("EntryList")) {
+    strct.AlienRaceOwner = gff.getInt(labels::AlienRaceOwner);
+    strct.AmbientTrack = gff.getString(labels::AmbientTrack);
+    strct.AnimatedCut = gff.getUint(labels::AnimatedCut);
+    strct.CameraModel = gff.getString(labels::CameraModel);
+    strct.ComputerType = gff.getUint(labels::ComputerType);
+    strct.ConversationType = gff.getInt(labels::ConversationType);
+    strct.DelayEntry = gff.getUint(labels::DelayEntry);
+    strct.DelayReply = gff.getUint(labels::DelayReply);
+    strct.DeletedVOFiles = gff.getString(labels::DeletedVOFiles);
+    strct.EditorInfo = gff.getString(labels::EditorInfo);
+    strct.EndConverAbort = gff.getString(labels::EndConverAbort);
+    strct.EndConversation = gff.getString(labels::EndConversation);
+    for (auto &item : gff.getList(labels::EntryList)) {
         strct.EntryList.push_back(parseDLG_EntryReplyList(*item));
     }
-    strct.NextNodeID = gff.getInt("NextNodeID");
-    strct.NumWords = gff.getUint("NumWords");
-    strct.OldHitCheck = gff.getUint("OldHitCheck");
-    strct.PostProcOwner = gff.getInt("PostProcOwner");
-    strct.RecordNoVO = gff.getInt("RecordNoVO");
-    for (auto &item : gff.getList("ReplyList")) {
+    strct.NextNodeID = gff.getInt(labels::NextNodeID);
+    strct.NumWords = gff.getUint(labels::NumWords);
+    strct.OldHitCheck = gff.getUint(labels::OldHitCheck);
+    strct.PostProcOwner = gff.getInt(labels::PostProcOwner);
+    strct.RecordNoVO = gff.getInt(labels::RecordNoVO);
+    for (auto &item : gff.getList(labels::ReplyList)) {
         strct.ReplyList.push_back(parseDLG_EntryReplyList(*item));
     }
-    strct.Skippable = gff.getUint("Skippable");
-    for (auto &item : gff.getList("StartingList")) {
+    strct.Skippable = gff.getUint(labels::Skippable);
+    for (auto &item : gff.getList(labels::StartingList)) {
         strct.StartingList.push_back(parseDLG_EntryReplyList_EntriesRepliesList(*item));
     }
-    for (auto &item : gff.getList("StuntList")) {
+    for (auto &item : gff.getList(labels::StuntList)) {
         strct.StuntList.push_back(parseDLG_StuntList(*item));
     }
-    strct.UnequipHItem = gff.getUint("UnequipHItem");
-    strct.UnequipItems = gff.getUint("UnequipItems");
-    strct.VO_ID = gff.getString("VO_ID");
+    strct.UnequipHItem = gff.getUint(labels::UnequipHItem);
+    strct.UnequipItems = gff.getUint(labels::UnequipItems);
+    strct.VO_ID = gff.getString(labels::VO_ID);
     return strct;
 }
 
@@ -25,204 +25,267 @@ namespace resource {
 
 namespace generated {
 
+namespace labels {
+
+static const GffLabel AmbientSndDay {"AmbientSndDay"};
+static const GffLabel AmbientSndDayVol {"AmbientSndDayVol"};
+static const GffLabel AmbientSndNight {"AmbientSndNight"};
+static const GffLabel AmbientSndNitVol {"AmbientSndNitVol"};
+static const GffLabel Appearance {"Appearance"};
+static const GffLabel AreaProperties {"AreaProperties"};
+static const GffLabel Bearing {"Bearing"};
+static const GffLabel CameraID {"CameraID"};
+static const GffLabel CameraList {"CameraList"};
+static const GffLabel Creature_List {"Creature List"};
+static const GffLabel Description {"Description"};
+static const GffLabel Door_List {"Door List"};
+static const GffLabel Encounter_List {"Encounter List"};
+static const GffLabel EnvAudio {"EnvAudio"};
+static const GffLabel FieldOfView {"FieldOfView"};
+static const GffLabel GeneratedType {"GeneratedType"};
+static const GffLabel Geometry {"Geometry"};
+static const GffLabel HasMapNote {"HasMapNote"};
+static const GffLabel Height {"Height"};
+static const GffLabel LinkedTo {"LinkedTo"};
+static const GffLabel LinkedToFlags {"LinkedToFlags"};
+static const GffLabel LinkedToModule {"LinkedToModule"};
+static const GffLabel LocalizedName {"LocalizedName"};
+static const GffLabel MapNote {"MapNote"};
+static const GffLabel MapNoteEnabled {"MapNoteEnabled"};
+static const GffLabel MicRange {"MicRange"};
+static const GffLabel MusicBattle {"MusicBattle"};
+static const GffLabel MusicDay {"MusicDay"};
+static const GffLabel MusicDelay {"MusicDelay"};
+static const GffLabel MusicNight {"MusicNight"};
+static const GffLabel Orientation {"Orientation"};
+static const GffLabel Pitch {"Pitch"};
+static const GffLabel Placeable_List {"Placeable List"};
+static const GffLabel PointX {"PointX"};
+static const GffLabel PointY {"PointY"};
+static const GffLabel PointZ {"PointZ"};
+static const GffLabel Position {"Position"};
+static const GffLabel ResRef {"ResRef"};
+static const GffLabel SoundList {"SoundList"};
+static const GffLabel SpawnPointList {"SpawnPointList"};
+static const GffLabel StoreList {"StoreList"};
+static const GffLabel Tag {"Tag"};
+static const GffLabel TemplateResRef {"TemplateResRef"};
+static const GffLabel TransitionDestin {"TransitionDestin"};
+static const GffLabel TriggerList {"TriggerList"};
+static const GffLabel TweakColor {"TweakColor"};
+static const GffLabel UseTemplates {"UseTemplates"};
+static const GffLabel UseTweakColor {"UseTweakColor"};
+static const GffLabel WaypointList {"WaypointList"};
+static const GffLabel X {"X"};
+static const GffLabel XOrientation {"XOrientation"};
+static const GffLabel XPosition {"XPosition"};
+static const GffLabel Y {"Y"};
+static const GffLabel YOrientation {"YOrientation"};
+static const GffLabel YPosition {"YPosition"};
+static const GffLabel Z {"Z"};
+static const GffLabel ZOrientation {"ZOrientation"};
+static const GffLabel ZPosition {"ZPosition"};
+
+} // namespace labels
+
 static GIT_TriggerList_Geometry parseGIT_TriggerList_Geometry(const Gff &gff) {
     GIT_TriggerList_Geometry strct;
-    strct.PointX = gff.getFloat("PointX");
-    strct.PointY = gff.getFloat("PointY");
-    strct.PointZ = gff.getFloat("PointZ");
+    strct.PointX = gff.getFloat(labels::PointX);
+    strct.PointY = gff.getFloat(labels::PointY);
+    strct.PointZ = gff.getFloat(labels::PointZ);
     return strct;
 }
 
 static GIT_Encounter_List_SpawnPointList parseGIT_Encounter_List_SpawnPointList(const Gff &gff) {
     GIT_Encounter_List_SpawnPointList strct;
-    strct.Orientation = gff.getFloat("Orientation");
-    strct.X = gff.getFloat("X");
-    strct.Y = gff.getFloat("Y");
-    strct.Z = gff.getFloat("Z");
+    strct.Orientation = gff.getFloat(labels::Orientation);
+    strct.X = gff.getFloat(labels::X);
+    strct.Y = gff.getFloat(labels::Y);
+    strct.Z = gff.getFloat(labels::Z);
     return strct;
 }
 
 static GIT_Encounter_List_Geometry parseGIT_Encounter_List_Geometry(const Gff &gff) {
     GIT_Encounter_List_Geometry strct;
-    strct.X = gff.getFloat("X");
-    strct.Y = gff.getFloat("Y");
-    strct.Z = gff.getFloat("Z");
+    strct.X = gff.getFloat(labels::X);
+    strct.Y = gff.getFloat(labels::Y);
+    strct.Z = gff.getFloat(labels::Z);
     return strct;
 }
 
 static GIT_WaypointList parseGIT_WaypointList(const Gff &gff) {
     GIT_WaypointList strct;
-    strct.Appearance = gff.getUint("Appearance");
-    strct.Description = std::make_pair(gff.getInt("Description"), gff.getString("Description"));
-    strct.HasMapNote = gff.getUint("HasMapNote");
-    strct.LinkedTo = gff.getString("LinkedTo");
-    strct.LocalizedName = std::make_pair(gff.getInt("LocalizedName"), gff.getString("LocalizedName"));
-    strct.MapNote = std::make_pair(gff.getInt("MapNote"), gff.getString("MapNote"));
-    strct.MapNoteEnabled = gff.getUint("MapNoteEnabled");
-    strct.Tag = gff.getString("Tag");
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.XOrientation = gff.getFloat("XOrientation");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YOrientation = gff.getFloat("YOrientation");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.Appearance = gff.getUint(labels::Appearance);
+    strct.Description = std::make_pair(gff.getInt(labels::Description), gff.getString(labels::Description));
+    strct.HasMapNote = gff.getUint(labels::HasMapNote);
+    strct.LinkedTo = gff.getString(labels::LinkedTo);
+    strct.LocalizedName = std::make_pair(gff.getInt(labels::LocalizedName), gff.getString(labels::LocalizedName));
+    strct.MapNote = std::make_pair(gff.getInt(labels::MapNote), gff.getString(labels::MapNote));
+    strct.MapNoteEnabled = gff.getUint(labels::MapNoteEnabled);
+    strct.Tag = gff.getString(labels::Tag);
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.XOrientation = gff.getFloat(labels::XOrientation);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YOrientation = gff.getFloat(labels::YOrientation);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_TriggerList parseGIT_TriggerList(const Gff &gff) {
     GIT_TriggerList strct;
-    for (auto &item : gff.getList("Geometry")) {
+    for (auto &item : gff.getList(labels::Geometry)) {
         strct.Geometry.push_back(parseGIT_TriggerList_Geometry(*item));
     }
-    strct.LinkedTo = gff.getString("LinkedTo");
-    strct.LinkedToFlags = gff.getUint("LinkedToFlags");
-    strct.LinkedToModule = gff.getString("LinkedToModule");
-    strct.Tag = gff.getString("Tag");
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.TransitionDestin = std::make_pair(gff.getInt("TransitionDestin"), gff.getString("TransitionDestin"));
-    strct.XOrientation = gff.getFloat("XOrientation");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YOrientation = gff.getFloat("YOrientation");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZOrientation = gff.getFloat("ZOrientation");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.LinkedTo = gff.getString(labels::LinkedTo);
+    strct.LinkedToFlags = gff.getUint(labels::LinkedToFlags);
+    strct.LinkedToModule = gff.getString(labels::LinkedToModule);
+    strct.Tag = gff.getString(labels::Tag);
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.TransitionDestin = std::make_pair(gff.getInt(labels::TransitionDestin), gff.getString(labels::TransitionDestin));
+    strct.XOrientation = gff.getFloat(labels::XOrientation);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YOrientation = gff.getFloat(labels::YOrientation);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZOrientation = gff.getFloat(labels::ZOrientation);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_StoreList parseGIT_StoreList(const Gff &gff) {
     GIT_StoreList strct;
-    strct.ResRef = gff.getString("ResRef");
-    strct.XOrientation = gff.getFloat("XOrientation");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YOrientation = gff.getFloat("YOrientation");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.ResRef = gff.getString(labels::ResRef);
+    strct.XOrientation = gff.getFloat(labels::XOrientation);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YOrientation = gff.getFloat(labels::YOrientation);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_SoundList parseGIT_SoundList(const Gff &gff) {
     GIT_SoundList strct;
-    strct.GeneratedType = gff.getUint("GeneratedType");
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.GeneratedType = gff.getUint(labels::GeneratedType);
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_Placeable_List parseGIT_Placeable_List(const Gff &gff) {
     GIT_Placeable_List strct;
-    strct.Bearing = gff.getFloat("Bearing");
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.TweakColor = gff.getUint("TweakColor");
-    strct.UseTweakColor = gff.getUint("UseTweakColor");
-    strct.X = gff.getFloat("X");
-    strct.Y = gff.getFloat("Y");
-    strct.Z = gff.getFloat("Z");
+    strct.Bearing = gff.getFloat(labels::Bearing);
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.TweakColor = gff.getUint(labels::TweakColor);
+    strct.UseTweakColor = gff.getUint(labels::UseTweakColor);
+    strct.X = gff.getFloat(labels::X);
+    strct.Y = gff.getFloat(labels::Y);
+    strct.Z = gff.getFloat(labels::Z);
     return strct;
 }
 
 static GIT_Encounter_List parseGIT_Encounter_List(const Gff &gff) {
     GIT_Encounter_List strct;
-    for (auto &item : gff.getList("Geometry")) {
+    for (auto &item : gff.getList(labels::Geometry)) {
         strct.Geometry.push_back(parseGIT_Encounter_List_Geometry(*item));
     }
-    for (auto &item : gff.getList("SpawnPointList")) {
+    for (auto &item : gff.getList(labels::SpawnPointList)) {
         strct.SpawnPointList.push_back(parseGIT_Encounter_List_SpawnPointList(*item));
     }
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_Door_List parseGIT_Door_List(const Gff &gff) {
     GIT_Door_List strct;
-    strct.Bearing = gff.getFloat("Bearing");
-    strct.LinkedTo = gff.getString("LinkedTo");
-    strct.LinkedToFlags = gff.getUint("LinkedToFlags");
-    strct.LinkedToModule = gff.getString("LinkedToModule");
-    strct.Tag = gff.getString("Tag");
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.TransitionDestin = std::make_pair(gff.getInt("TransitionDestin"), gff.getString("TransitionDestin"));
-    strct.TweakColor = gff.getUint("TweakColor");
-    strct.UseTweakColor = gff.getUint("UseTweakColor");
-    strct.X = gff.getFloat("X");
-    strct.Y = gff.getFloat("Y");
-    strct.Z = gff.getFloat("Z");
+    strct.Bearing = gff.getFloat(labels::Bearing);
+    strct.LinkedTo = gff.getString(labels::LinkedTo);
+    strct.LinkedToFlags = gff.getUint(labels::LinkedToFlags);
+    strct.LinkedToModule = gff.getString(labels::LinkedToModule);
+    strct.Tag = gff.getString(labels::Tag);
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.TransitionDestin = std::make_pair(gff.getInt(labels::TransitionDestin), gff.getString(labels::TransitionDestin));
+    strct.TweakColor = gff.getUint(labels::TweakColor);
+    strct.UseTweakColor = gff.getUint(labels::UseTweakColor);
+    strct.X = gff.getFloat(labels::X);
+    strct.Y = gff.getFloat(labels::Y);
+    strct.Z = gff.getFloat(labels::Z);
     return strct;
 }
 
 static GIT_Creature_List parseGIT_Creature_List(const Gff &gff) {
     GIT_Creature_List strct;
-    strct.TemplateResRef = gff.getString("TemplateResRef");
-    strct.XOrientation = gff.getFloat("XOrientation");
-    strct.XPosition = gff.getFloat("XPosition");
-    strct.YOrientation = gff.getFloat("YOrientation");
-    strct.YPosition = gff.getFloat("YPosition");
-    strct.ZPosition = gff.getFloat("ZPosition");
+    strct.TemplateResRef = gff.getString(labels::TemplateResRef);
+    strct.XOrientation = gff.getFloat(labels::XOrientation);
+    strct.XPosition = gff.getFloat(labels::XPosition);
+    strct.YOrientation = gff.getFloat(labels::YOrientation);
+    strct.YPosition = gff.getFloat(labels::YPosition);
+    strct.ZPosition = gff.getFloat(labels::ZPosition);
     return strct;
 }
 
 static GIT_CameraList parseGIT_CameraList(const Gff &gff) {
     GIT_CameraList strct;
-    strct.CameraID = gff.getInt("CameraID");
-    strct.FieldOfView = gff.getFloat("FieldOfView");
-    strct.Height = gff.getFloat("Height");
-    strct.MicRange = gff.getFloat("MicRange");
-    strct.Orientation = gff.getOrientation("Orientation");
-    strct.Pitch = gff.getFloat("Pitch");
-    strct.Position = gff.getVector("Position");
+    strct.CameraID = gff.getInt(labels::CameraID);
+    strct.FieldOfView = gff.getFloat(labels::FieldOfView);
+    strct.Height = gff.getFloat(labels::Height);
+    strct.MicRange = gff.getFloat(labels::MicRange);
+    strct.Orientation = gff.getOrientation(labels::Orientation);
+    strct.Pitch = gff.getFloat(labels::Pitch);
+    strct.Position = gff.getVector(labels::Position);
     return strct;
 }
 
 static GIT_AreaProperties parseGIT_AreaProperties(const Gff &gff) {
     GIT_AreaProperties strct;
-    strct.AmbientSndDay = gff.getInt("AmbientSndDay");
-    strct.AmbientSndDayVol = gff.getInt("AmbientSndDayVol");
-    strct.AmbientSndNight = gff.getInt("AmbientSndNight");
-    strct.AmbientSndNitVol = gff.getInt("AmbientSndNitVol");
-    strct.EnvAudio = gff.getInt("EnvAudio");
-    strct.MusicBattle = gff.getInt("MusicBattle");
-    strct.MusicDay = gff.getInt("MusicDay");
-    strct.MusicDelay = gff.getInt("MusicDelay");
-    strct.MusicNight = gff.getInt("MusicNight");
+    strct.AmbientSndDay = gff.getInt(labels::AmbientSndDay);
+    strct.AmbientSndDayVol = gff.getInt(labels::AmbientSndDayVol);
+    strct.AmbientSndNight = gff.getInt(labels::AmbientSndNight);
+    strct.AmbientSndNitVol = gff.getInt(labels::AmbientSndNitVol);
+    strct.EnvAudio = gff.getInt(labels::EnvAudio);
+    strct.MusicBattle = gff.getInt(labels::MusicBattle);
+    strct.MusicDay = gff.getInt(labels::MusicDay);
+    strct.MusicDelay = gff.getInt(labels::MusicDelay);
+    strct.MusicNight = gff.getInt(labels::MusicNight);
     return strct;
 }
 
 GIT parseGIT(const Gff &gff) {
     GIT strct;
-    auto AreaProperties = gff.findStruct("AreaProperties");
+    auto AreaProperties = gff.findStruct(labels::AreaProperties);
     if (AreaProperties) {
         strct.AreaProperties = parseGIT_AreaProperties(*AreaProperties);
     }
-    for (auto &item : gff.getList("CameraList")) {
+    for (auto &item : gff.getList(labels::CameraList)) {
         strct.CameraList.push_back(parseGIT_CameraList(*item));
     }
-    for (auto &item : gff.getList("Creature List")) {
+    for (auto &item : gff.getList(labels::Creature_List)) {
         strct.Creature_List.push_back(parseGIT_Creature_List(*item));
     }
-    for (auto &item : gff.getList("Door List")) {
+    for (auto &item : gff.getList(labels::Door_List)) {
         strct.Door_List.push_back(parseGIT_Door_List(*item));
     }
-    for (auto &item : gff.getList("Encounter List")) {
+    for (auto &item : gff.getList(labels::Encounter_List)) {
         strct.Encounter_List.push_back(parseGIT_Encounter_List(*item));
     }
-    for (auto &item : gff.getList("Placeable List")) {
+    for (auto &item : gff.getList(labels::Placeable_List)) {
         strct.Placeable_List.push_back(parseGIT_Placeable_List(*item));
     }
-    for (auto &item : gff.getList("SoundList")) {
+    for (auto &item : gff.getList(labels::SoundList)) {
         strct.SoundList.push_back(parseGIT_SoundList(*item));
     }
-    for (auto &item : gff.getList("StoreList")) {
+    for (auto &item : gff.getList(labels::StoreList)) {
         strct.StoreList.push_back(parseGIT_StoreList(*item));
     }
-    for (auto &item : gff.getList("TriggerList")) {
+    for (auto &item : gff.getList(labels::TriggerList)) {
         strct.TriggerList.push_back(parseGIT_TriggerList(*item));
     }
-    strct.UseTemplates = gff.getUint("UseTemplates");
-    for (auto &item : gff.getList("WaypointList")) {
+    strct.UseTemplates = gff.getUint(labels::UseTemplates);
+    for (auto &item : gff.getList(labels::WaypointList)) {
         strct.WaypointList.push_back(parseGIT_WaypointList(*item));
     }
     return strct;
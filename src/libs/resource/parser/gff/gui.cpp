@@ -25,107 +25,164 @@ namespace resource {
 
 namespace generated {
 
+namespace labels {
+
+static const GffLabel ALIGNMENT {"ALIGNMENT"};
+static const GffLabel ALPHA {"ALPHA"};
+static const GffLabel BORDER {"BORDER"};
+static const GffLabel COLOR {"COLOR"};
+static const GffLabel CONTROLS {"CONTROLS"};
+static const GffLabel CONTROLTYPE {"CONTROLTYPE"};
+static const GffLabel CORNER {"CORNER"};
+static const GffLabel CURVALUE {"CURVALUE"};
+static const GffLabel DIMENSION {"DIMENSION"};
+static const GffLabel DIR {"DIR"};
+static const GffLabel DOWN {"DOWN"};
+static const GffLabel DRAWMODE {"DRAWMODE"};
+static const GffLabel DRAWSTYLE {"DRAWSTYLE"};
+static const GffLabel EDGE {"EDGE"};
+static const GffLabel EXTENT {"EXTENT"};
+static const GffLabel FILL {"FILL"};
+static const GffLabel FILLSTYLE {"FILLSTYLE"};
+static const GffLabel FLIPSTYLE {"FLIPSTYLE"};
+static const GffLabel FONT {"FONT"};
+static const GffLabel HEIGHT {"HEIGHT"};
+static const GffLabel HILIGHT {"HILIGHT"};
+static const GffLabel HILIGHTSELECTED {"HILIGHTSELECTED"};
+static const GffLabel ID {"ID"};
+static const GffLabel IMAGE {"IMAGE"};
+static const GffLabel INNEROFFSET {"INNEROFFSET"};
+static const GffLabel INNEROFFSETY {"INNEROFFSETY"};
+static const GffLabel ISSELECTED {"ISSELECTED"};
+static const GffLabel LEFT {"LEFT"};
+static const GffLabel LEFTSCROLLBAR {"LEFTSCROLLBAR"};
+static const GffLabel LOOPING {"LOOPING"};
+static const GffLabel MAXVALUE {"MAXVALUE"};
+static const GffLabel MOVETO {"MOVETO"};
+static const GffLabel Obj_Locked {"Obj_Locked"};
+static const GffLabel Obj_Parent {"Obj_Parent"};
+static const GffLabel Obj_ParentID {"Obj_ParentID"};
+static const GffLabel PADDING {"PADDING"};
+static const GffLabel PROGRESS {"PROGRESS"};
+static const GffLabel PROTOITEM {"PROTOITEM"};
+static const GffLabel PULSING {"PULSING"};
+static const GffLabel RIGHT {"RIGHT"};
+static const GffLabel ROTATE {"ROTATE"};
+static const GffLabel SCROLLBAR {"SCROLLBAR"};
+static const GffLabel SELECTED {"SELECTED"};
+static const GffLabel STARTFROMLEFT {"STARTFROMLEFT"};
+static const GffLabel STRREF {"STRREF"};
+static const GffLabel TAG {"TAG"};
+static const GffLabel TEXT {"TEXT"};
+static const GffLabel THUMB {"THUMB"};
+static const GffLabel TOP {"TOP"};
+static const GffLabel UP {"UP"};
+static const GffLabel VISIBLEVALUE {"VISIBLEVALUE"};
+static const GffLabel WIDTH {"WIDTH"};
+
+} // namespace labels
+
 static GUI_EXTENT parseGUI_EXTENT(const Gff &gff) {
     GUI_EXTENT strct;
-    strct.HEIGHT = gff.getInt("HEIGHT");
-    strct.LEFT = gff.getInt("LEFT");
-    strct.TOP = gff.getInt("TOP");
-    strct.WIDTH = gff.getInt("WIDTH");
+    strct.HEIGHT = gff.getInt(labels::HEIGHT);
+    strct.LEFT = gff.getInt(labels::LEFT);
+    strct.TOP = gff.getInt(labels::TOP);
+    strct.WIDTH = gff.getInt(labels::WIDTH);
     return strct;
 }
 
 static GUI_BORDER parseGUI_BORDER(const Gff &gff) {
     GUI_BORDER strct;
-    strct.COLOR = gff.getVector("COLOR");
-    strct.CORNER = gff.getString("CORNER");
-    strct.DIMENSION = gff.getInt("DIMENSION");
-    strct.EDGE = gff.getString("EDGE");
-    strct.FILL = gff.getString("FILL");
-    strct.FILLSTYLE = gff.getInt("FILLSTYLE");
-    strct.INNEROFFSET = gff.getInt("INNEROFFSET");
-    strct.INNEROFFSETY = gff.getInt("INNEROFFSETY");
-    strct.PULSING = gff.getUint("PULSING");
+    strct.COLOR = gff.getVector(labels::COLOR);
+    strct.CORNER = gff.getString(labels::CORNER);
+    strct.DIMENSION = gff.getInt(labels::DIMENSION);
+    strct.EDGE = gff.getString(labels::EDGE);
+    strct.FILL = gff.getString(labels::FILL);
+    strct.FILLSTYLE = gff.getInt(labels::FILLSTYLE);
+    strct.INNEROFFSET = gff.getInt(labels::INNEROFFSET);
+    strct.INNEROFFSETY = gff.getInt(labels::INNEROFFSETY);
+    strct.PULSING = gff.getUint(labels::PULSING);
     return strct;
 }
 
 static GUI_TEXT parseGUI_TEXT(const Gff &gff) {
     GUI_TEXT strct;
-    strct.ALIGNMENT = gff.getInt("ALIGNMENT");
-    strct.COLOR = gff.getVector("COLOR");
-    strct.FONT = gff.getString("FONT");
-    strct.PULSING = gff.getUint("PULSING");
-    strct.STRREF = gff.getUint("STRREF");
-    strct.TEXT = gff.getString("TEXT");
+    strct.ALIGNMENT = gff.getInt(labels::ALIGNMENT);
+    strct.COLOR = gff.getVector(labels::COLOR);
+    strct.FONT = gff.getString(labels::FONT);
+    strct.PULSING = gff.getUint(labels::PULSING);
+    strct.STRREF = gff.getUint(labels::STRREF);
+    strct.TEXT = gff.getString(labels::TEXT);
     return strct;
 }
 
 static GUI_CONTROLS_SCROLLBAR_DIRTHUMB parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(const Gff &gff) {
     GUI_CONTROLS_SCROLLBAR_DIRTHUMB strct;
-    strct.ALIGNMENT = gff.getInt("ALIGNMENT");
-    strct.DRAWSTYLE = gff.getInt("DRAWSTYLE");
-    strct.FLIPSTYLE = gff.getInt("FLIPSTYLE");
-    strct.IMAGE = gff.getString("IMAGE");
-    strct.ROTATE = gff.getFloat("ROTATE");
+    strct.ALIGNMENT = gff.getInt(labels::ALIGNMENT);
+    strct.DRAWSTYLE = gff.getInt(labels::DRAWSTYLE);
+    strct.FLIPSTYLE = gff.getInt(labels::FLIPSTYLE);
+    strct.IMAGE = gff.getString(labels::IMAGE);
+    strct.ROTATE = gff.getFloat(labels::ROTATE);
     return strct;
 }
 
 static GUI_CONTROLS_SCROLLBAR parseGUI_CONTROLS_SCROLLBAR(const Gff &gff) {
     GUI_CONTROLS_SCROLLBAR strct;
-    auto BORDER = gff.findStruct("BORDER");
+    auto BORDER = gff.findStruct(labels::BORDER);
     if (BORDER) {
         strct.BORDER = parseGUI_BORDER(*BORDER);
     }
-    strct.CONTROLTYPE = gff.getInt("CONTROLTYPE");
-    strct.CURVALUE = gff.getInt("CURVALUE");
-    auto DIR = gff.findStruct("DIR");
+    strct.CONTROLTYPE = gff.getInt(labels::CONTROLTYPE);
+    strct.CURVALUE = gff.getInt(labels::CURVALUE);
+    auto DIR = gff.findStruct(labels::DIR);
     if (DIR) {
         strct.DIR = parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(*DIR);
     }
-    strct.DRAWMODE = gff.getUint("DRAWMODE");
-    auto EXTENT = gff.findStruct("EXTENT");
+    strct.DRAWMODE = gff.getUint(labels::DRAWMODE);
+    auto EXTENT = gff.findStruct(labels::EXTENT);
     if (EXTENT) {
         strct.EXTENT = parseGUI_EXTENT(*EXTENT);
     }
-    strct.MAXVALUE = gff.getInt("MAXVALUE");
-    strct.Obj_Parent = gff.getString("Obj_Parent");
-    strct.Obj_ParentID = gff.getInt("Obj_ParentID");
-    strct.TAG = gff.getString("TAG");
-    auto THUMB = gff.findStruct("THUMB");
+    strct.MAXVALUE = gff.getInt(labels::MAXVALUE);
+    strct.Obj_Parent = gff.getString(labels::Obj_Parent);
+    strct.Obj_ParentID = gff.getInt(labels::Obj_ParentID);
+    strct.TAG = gff.getString(labels::TAG);
+    auto THUMB = gff.findStruct(labels::THUMB);
     if (THUMB) {
         strct.THUMB = parseGUI_CONTROLS_SCROLLBAR_DIRTHUMB(*THUMB);
     }
-    strct.VISIBLEVALUE = gff.getInt("VISIBLEVALUE");
+    strct.VISIBLEVALUE = gff.getInt(labels::VISIBLEVALUE);
     return strct;
 }
 
 static GUI_CONTROLS_PROTOITEM parseGUI_CONTROLS_PROTOITEM(const Gff &gff) {
     GUI_CONTROLS_PROTOITEM strct;
-    auto BORDER = gff.findStruct("BORDER");
+    auto BORDER = gff.findStruct(labels::BORDER);
     if (BORDER) {
         strct.BORDER = parseGUI_BORDER(*BORDER);
     }
-    strct.CONTROLTYPE = gff.getInt("CONTROLTYPE");
-    auto EXTENT = gff.findStruct("EXTENT");
+    strct.CONTROLTYPE = gff.getInt(labels::CONTROLTYPE);
+    auto EXTENT = gff.findStruct(labels::EXTENT);
     if (EXTENT) {
         strct.EXTENT = parseGUI_EXTENT(*EXTENT);
     }
-    auto HILIGHT = gff.findStruct("HILIGHT");
+    auto HILIGHT = gff.findStruct(labels::HILIGHT);
     if (HILIGHT) {
         strct.HILIGHT = parseGUI_BORDER(*HILIGHT);
     }
-    auto HILIGHTSELECTED = gff.findStruct("HILIGHTSELECTED");
+    auto HILIGHTSELECTED = gff.findStruct(labels::HILIGHTSELECTED);
     if (HILIGHTSELECTED) {
         strct.HILIGHTSELECTED = parseGUI_BORDER(*HILIGHTSELECTED);
     }
-    strct.ISSELECTED = gff.getUint("ISSELECTED");
-    strct.Obj_Parent = gff.getString("Obj_Parent");
-    strct.Obj_ParentID = gff.getInt("Obj_ParentID");
-    auto SELECTED = gff.findStruct("SELECTED");
+    strct.ISSELECTED = gff.getUint(labels::ISSELECTED);
+    strct.Obj_Parent = gff.getString(labels::Obj_Parent);
+    strct.Obj_ParentID = gff.getInt(labels::Obj_ParentID);
+    auto SELECTED = gff.findStruct(labels::SELECTED);
     if (SELECTED) {
         strct.SELECTED = parseGUI_BORDER(*SELECTED);
     }
-    strct.TAG = gff.getString("TAG");
-    auto TEXT = gff.findStruct("TEXT");
+    strct.TAG = gff.getString(labels::TAG);
+    auto TEXT = gff.findStruct(labels::TEXT);
     if (TEXT) {
         strct.TEXT = parseGUI_TEXT(*TEXT);
     }
@@ -134,57 +191,57 @@ static GUI_CONTROLS_PROTOITEM parseGUI_CONTROLS_PROTOITEM(const Gff &gff) {
 
 static GUI_CONTROLS_MOVETO parseGUI_CONTROLS_MOVETO(const Gff &gff) {
     GUI_CONTROLS_MOVETO strct;
-    strct.DOWN = gff.getInt("DOWN");
-    strct.LEFT = gff.getInt("LEFT");
-    strct.RIGHT = gff.getInt("RIGHT");
-    strct.UP = gff.getInt("UP");
+    strct.DOWN = gff.getInt(labels::DOWN);
+    strct.LEFT = gff.getInt(labels::LEFT);
+    strct.RIGHT = gff.getInt(labels::RIGHT);
+    strct.UP = gff.getInt(labels::UP);
     return strct;
 }
 
 static GUI_CONTROLS parseGUI_CONTROLS(const Gff &gff) {
     GUI_CONTROLS strct;
-    auto BORDER = gff.findStruct("BORDER");
+    auto BORDER = gff.findStruct(labels::BORDER);
     if (BORDER) {
         strct.BORDER = parseGUI_BORDER(*BORDER);
     }
-    strct.COLOR = gff.getVector("COLOR");
-    strct.CONTROLTYPE = gff.getInt("CONTROLTYPE");
-    strct.CURVALUE = gff.getInt("CURVALUE");
-    auto EXTENT = gff.findStruct("EXTENT");
+    strct.COLOR = gff.getVector(labels::COLOR);
+    strct.CONTROLTYPE = gff.getInt(labels::CONTROLTYPE);
+    strct.CURVALUE = gff.getInt(labels::CURVALUE);
+    auto EXTENT = gff.findStruct(labels::EXTENT);
     if (EXTENT) {
         strct.EXTENT = parseGUI_EXTENT(*EXTENT);
     }
-    auto HILIGHT = gff.findStruct("HILIGHT");
+    auto HILIGHT = gff.findStruct(labels::HILIGHT);
     if (HILIGHT) {
         strct.HILIGHT = parseGUI_BORDER(*HILIGHT);
     }
-    strct.ID = gff.getInt("ID");
-    strct.LEFTSCROLLBAR = gff.getUint("LEFTSCROLLBAR");
-    strct.LOOPING = gff.getUint("LOOPING");
-    strct.MAXVALUE = gff.getInt("MAXVALUE");
-    auto MOVETO = gff.findStruct("MOVETO");
+    strct.ID = gff.getInt(labels::ID);
+    strct.LEFTSCROLLBAR = gff.getUint(labels::LEFTSCROLLBAR);
+    strct.LOOPING = gff.getUint(labels::LOOPING);
+    strct.MAXVALUE = gff.getInt(labels::MAXVALUE);
+    auto MOVETO = gff.findStruct(labels::MOVETO);
     if (MOVETO) {
         strct.MOVETO = parseGUI_CONTROLS_MOVETO(*MOVETO);
     }
-    strct.Obj_Locked = gff.getUint("Obj_Locked");
-    strct.Obj_Parent = gff.getString("Obj_Parent");
-    strct.Obj_ParentID = gff.getInt("Obj_ParentID");
-    strct.PADDING = gff.getInt("PADDING");
-    auto PROGRESS = gff.findStruct("PROGRESS");
+    strct.Obj_Locked = gff.getUint(labels::Obj_Locked);
+    strct.Obj_Parent = gff.getString(labels::Obj_Parent);
+    strct.Obj_ParentID = gff.getInt(labels::Obj_ParentID);
+    strct.PADDING = gff.getInt(labels::PADDING);
+    auto PROGRESS = gff.findStruct(labels::PROGRESS);
     if (PROGRESS) {
         strct.PROGRESS = parseGUI_BORDER(*PROGRESS);
     }
-    auto PROTOITEM = gff.findStruct("PROTOITEM");
+    auto PROTOITEM = gff.findStruct(labels::PROTOITEM);
     if (PROTOITEM) {
         strct.PROTOITEM = parseGUI_CONTROLS_PROTOITEM(*PROTOITEM);
     }
-    auto SCROLLBAR = gff.findStruct("SCROLLBAR");
+    auto SCROLLBAR = gff.findStruct(labels::SCROLLBAR);
     if (SCROLLBAR) {
         strct.SCROLLBAR = parseGUI_CONTROLS_SCROLLBAR(*SCROLLBAR);
     }
-    strct.STARTFROMLEFT = gff.getUint("STARTFROMLEFT");
-    strct.TAG = gff.getString("TAG");
-    auto TEXT = gff.findStruct("TEXT");
+    strct.STARTFROMLEFT = gff.getUint(labels::STARTFROMLEFT);
+    strct.TAG = gff.getString(labels::TAG);
+    auto TEXT = gff.findStruct(labels::TEXT);
     if (TEXT) {
         strct.TEXT = parseGUI_TEXT(*TEXT);
     }
@@ -193,23 +250,23 @@ static GUI_CONTROLS parseGUI_CONTROLS(const Gff &gff) {
 
 GUI parseGUI(const Gff &gff) {
     GUI strct;
-    strct.ALPHA = gff.getFloat("ALPHA");
-    auto BORDER = gff.findStruct("BORDER");
+    strct.ALPHA = gff.getFloat(labels::ALPHA);
+    auto BORDER = gff.findStruct(labels::BORDER);
     if (BORDER) {
         strct.BORDER = parseGUI_BORDER(*BORDER);
     }
-    strct.COLOR = gff.getVector("COLOR");
-    for (auto &item : gff.getList("CONTROLS")) {
+    strct.COLOR = gff.getVector(labels::COLOR);
+    for (auto &item : gff.getList(labels::CONTROLS)) {
         strct.CONTROLS.push_back(parseGUI_CONTROLS(*item));
     }
-    strct.CONTROLTYPE = gff.getInt("CONTROLTYPE");
-    auto EXTENT = gff.findStruct("EXTENT");
+    strct.CONTROLTYPE = gff.getInt(labels::CONTROLTYPE);
+    auto EXTENT = gff.findStruct(labels::EXTENT);
     if (EXTENT) {
         strct.EXTENT = parseGUI_EXTENT(*EXTENT);
     }
-    strct.Obj_Locked = gff.getUint("Obj_Locked");
-    strct.Obj_ParentID = gff.getInt("Obj_ParentID");
-    strct.TAG = gff.getString("TAG");
+    strct.Obj_Locked = gff.getUint(labels::Obj_Locked);
+    strct.Obj_ParentID = gff.getInt(labels::Obj_ParentID);
+    strct.TAG = gff.getString(labels::TAG);
     return strct;
 }
 
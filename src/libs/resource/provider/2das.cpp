@@ -26,11 +26,14 @@ namespace reone {
 namespace resource {
 
 std::shared_ptr<TwoDA> TwoDAs::get(const std::string &resRef) {
-    return _cache.getOrAdd(resRef, [this, &resRef]() {
-        auto res = _resources.find(ResourceId(resRef, ResType::TwoDA));
+    auto key = ResRef(resRef);
+    return _cache.getOrAdd(key, [this, &key]() {
+        auto resId = ResourceId(key, ResType::TwoDA);
+        auto res = _resources.find(resId);
         if (!res) {
             return std::shared_ptr<TwoDA>();
         }
+        ScopedDecodeTimer timer(_resources.accessRecorder(), resId);
         MemoryInputStream stream(res->data);
         TwoDAReader reader(stream);
         reader.load();
@@ -29,12 +29,52 @@ namespace reone {
 
 namespace resource {
 
+void AudioClips::clear() {
+    _objects.clear();
+    _lru.clear();
+    _stats.residentBytes = 0;
+}
+
+std::shared_ptr<AudioClip> AudioClips::get(const std::string &key) {
+    auto maybeEntry = _objects.find(key);
+    if (maybeEntry != _objects.end()) {
+        auto &entry = maybeEntry->second;
+        _lru.splice(_lru.begin(), _lru, entry.lruIt);
+        ++_stats.hits;
+        return entry.clip;
+    }
+    ++_stats.misses;
+    auto clip = doGet(key);
+    if (clip && _backend && clip->getFrameCount() == 1 && clip->size() <= kMaxSharedBufferSize) {
+        clip->upload(*_backend);
+    }
+    Entry entry;
+    entry.clip = clip;
+    entry.size = clip ? clip->size() : 0;
+    entry.lruIt = _lru.insert(_lru.begin(), key);
+    _stats.residentBytes += entry.size;
+    _objects.insert(std::make_pair(key, std::move(entry)));
+    evict();
+    return clip;
+}
+
+void AudioClips::evict() {
+    // Never evict the most recently used clip, even if it exceeds the budget
+    while (_stats.residentBytes > _budget && _lru.size() > 1) {
+        auto maybeEntry = _objects.find(_lru.back());
+        _stats.residentBytes -= maybeEntry->second.size;
+        ++_stats.evictions;
+        _objects.erase(maybeEntry);
+        _lru.pop_back();
+    }
+}
+
 std::shared_ptr<AudioClip> AudioClips::doGet(std::string resRef) {
     std::shared_ptr<AudioClip> clip;
     auto m3pRes = _resources.find(ResourceId(resRef, ResType::Mp3));
     if (m3pRes) {
         auto stream = MemoryInputStream(m3pRes->data);
-        auto reader = Mp3Reader();
+        auto reader = Mp3Reader(true);
         reader.load(stream);
         clip = reader.stream();
     }
@@ -42,7 +82,7 @@ std::shared_ptr<AudioClip> AudioClips::doGet(std::string resRef) {
         auto wavRes = _resources.find(ResourceId(resRef, ResType::Wav));
         if (wavRes) {
             auto stream = MemoryInputStream(wavRes->data);
-            auto mp3ReaderFactory = Mp3ReaderFactory();
+            auto mp3ReaderFactory = Mp3ReaderFactory(true);
             auto reader = WavReader(stream, mp3ReaderFactory);
             reader.load();
             clip = reader.stream();
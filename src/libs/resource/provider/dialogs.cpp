@@ -17,6 +17,7 @@
 
 #include "reone/resource/provider/dialogs.h"
 
+#include "reone/resource/accessrecorder.h"
 #include "reone/resource/provider/gffs.h"
 #include "reone/resource/strings.h"
 
@@ -24,6 +25,24 @@ namespace reone {
 
 namespace resource {
 
+std::shared_ptr<Dialog> Dialogs::get(const std::string &key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto maybeObject = _objects.find(key);
+        if (maybeObject != _objects.end()) {
+            if (auto recorder = _gffs.accessRecorder()) {
+                recorder->recordCacheHit(ResourceId(key, ResType::Dlg));
+            }
+            return maybeObject->second;
+        }
+    }
+    // Parse unlocked, so that a warm-up job does not block other loads.
+    // Whichever thread inserts first wins.
+    auto object = doGet(key);
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objects.insert(make_pair(key, std::move(object))).first->second;
+}
+
 std::shared_ptr<Dialog> Dialogs::doGet(std::string resRef) {
     auto dlg = _gffs.get(resRef, ResType::Dlg);
     if (!dlg) {
@@ -27,16 +27,33 @@ namespace resource {
 
 std::shared_ptr<Gff> Gffs::get(const std::string &resRef, ResType type) {
     ResourceId resId(resRef, type);
-    return _cache.getOrAdd(resId, [this, &resId]() {
-        auto res = _resources.find(resId);
-        if (!res) {
-            return std::shared_ptr<Gff>();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto maybeObject = _objects.find(resId);
+        if (maybeObject != _objects.end()) {
+            if (auto recorder = _resources.accessRecorder()) {
+                recorder->recordCacheHit(resId);
+            }
+            return maybeObject->second;
         }
+    }
+    // Parse unlocked, so that a warm-up job does not block other loads.
+    // Whichever thread inserts first wins.
+    std::shared_ptr<Gff> object;
+    auto res = _resources.find(resId);
+    if (res) {
+        ScopedDecodeTimer timer(_resources.accessRecorder(), resId);
         MemoryInputStream stream(res->data);
         GffReader reader(stream);
         reader.load();
-        return reader.root();
-    });
+        object = reader.root();
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objects.insert(make_pair(resId, std::move(object))).first->second;
+}
+
+ResourceAccessRecorder *Gffs::accessRecorder() {
+    return _resources.accessRecorder();
 }
 
 } // namespace resource
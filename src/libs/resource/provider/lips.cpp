@@ -28,6 +28,24 @@ namespace reone {
 
 namespace resource {
 
+std::shared_ptr<LipAnimation> Lips::get(const std::string &key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto maybeObject = _objects.find(key);
+        if (maybeObject != _objects.end()) {
+            if (auto recorder = _resources.accessRecorder()) {
+                recorder->recordCacheHit(ResourceId(key, ResType::Lip));
+            }
+            return maybeObject->second;
+        }
+    }
+    // Parse unlocked, so that a warm-up job does not block other loads.
+    // Whichever thread inserts first wins.
+    auto object = doGet(key);
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objects.insert(make_pair(key, std::move(object))).first->second;
+}
+
 std::shared_ptr<LipAnimation> Lips::doGet(std::string resRef) {
     auto res = _resources.find(ResourceId(resRef, ResType::Lip));
     if (!res) {
@@ -39,19 +39,20 @@ std::shared_ptr<Model> Models::get(const std::string &resRef) {
     if (resRef.empty()) {
         return nullptr;
     }
-    auto lcResRef = boost::to_lower_copy(resRef);
-    auto maybeModel = _cache.find(lcResRef);
+    auto key = ResRef(resRef);
+    auto maybeModel = _cache.find(key);
     if (maybeModel != _cache.end()) {
         return maybeModel->second;
     }
-    auto inserted = _cache.insert(std::make_pair(lcResRef, doGet(lcResRef)));
+    auto inserted = _cache.insert(std::make_pair(key, doGet(key)));
     return inserted.first->second;
 }
 
-std::shared_ptr<Model> Models::doGet(const std::string &resRef) {
-    debug("Load model " + resRef, LogChannel::Graphics);
+std::shared_ptr<Model> Models::doGet(const ResRef &resRef) {
+    debug("Load model " + resRef.value(), LogChannel::Graphics);
 
-    auto mdlRes = _resources.find(ResourceId(resRef, ResType::Mdl));
+    auto mdlId = ResourceId(resRef, ResType::Mdl);
+    auto mdlRes = _resources.find(mdlId);
     auto mdxRes = _resources.find(ResourceId(resRef, ResType::Mdx));
     std::shared_ptr<Model> model;
 
@@ -60,7 +61,10 @@ std::shared_ptr<Model> Models::doGet(const std::string &resRef) {
         auto mdx = MemoryInputStream(mdxRes->data);
         auto reader = MdlMdxReader(mdl, mdx, _statistic);
         try {
-            reader.load();
+            {
+                auto timer = ScopedDecodeTimer(_resources.accessRecorder(), mdlId);
+                reader.load();
+            }
             model = reader.model();
             if (!model->superModelName().empty()) {
                 auto superModel = get(model->superModelName());
@@ -68,7 +72,7 @@ std::shared_ptr<Model> Models::doGet(const std::string &resRef) {
             }
             model->init();
         } catch (const ValidationException &e) {
-            error(str(boost::format("Error loading model %s: %s") % resRef % std::string(e.what())), LogChannel::Graphics);
+            error(str(boost::format("Error loading model %s: %s") % resRef.value() % std::string(e.what())), LogChannel::Graphics);
         }
     }
 
@@ -17,6 +17,7 @@
 
 #include "reone/resource/provider/paths.h"
 
+#include "reone/resource/accessrecorder.h"
 #include "reone/resource/provider/gffs.h"
 
 using namespace reone::resource;
@@ -25,6 +26,24 @@ namespace reone {
 
 namespace resource {
 
+std::shared_ptr<Path> Paths::get(const std::string &key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto maybeObject = _objects.find(key);
+        if (maybeObject != _objects.end()) {
+            if (auto recorder = _gffs.accessRecorder()) {
+                recorder->recordCacheHit(ResourceId(key, ResType::Pth));
+            }
+            return maybeObject->second;
+        }
+    }
+    // Parse unlocked, so that a warm-up job does not block other loads.
+    // Whichever thread inserts first wins.
+    auto object = doGet(key);
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objects.insert(make_pair(key, std::move(object))).first->second;
+}
+
 std::shared_ptr<Path> Paths::doGet(std::string resRef) {
     auto pth = _gffs.get(resRef, ResType::Pth);
     if (!pth) {
@@ -26,6 +26,24 @@ namespace reone {
 
 namespace resource {
 
+std::shared_ptr<ScriptProgram> Scripts::get(const std::string &key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto maybeObject = _objects.find(key);
+        if (maybeObject != _objects.end()) {
+            if (auto recorder = _resources.accessRecorder()) {
+                recorder->recordCacheHit(ResourceId(key, ResType::Ncs));
+            }
+            return maybeObject->second;
+        }
+    }
+    // Parse unlocked, so that a warm-up job does not block other loads.
+    // Whichever thread inserts first wins.
+    auto object = doGet(key);
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _objects.insert(make_pair(key, std::move(object))).first->second;
+}
+
 std::shared_ptr<ScriptProgram> Scripts::doGet(std::string resRef) {
     auto res = _resources.find(ResourceId(resRef, ResType::Ncs));
     if (!res) {
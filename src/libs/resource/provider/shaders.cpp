@@ -76,6 +76,7 @@ static const std::string kFragPostSharpen = "f_pp_sharpen";
 static const std::string kFragText = "f_text";
 static const std::string kFragTexture = "f_texture";
 static const std::string kFragTextureNoPerspective = "f_texnoper";
+static const std::string kFragTextureYUV = "f_texyuv";
 static const std::string kFragPBRIrradiance = "f_pbr_irradiance";
 static const std::string kFragPBRBRDF = "f_pbr_brdf";
 static const std::string kFragPBRPrefilter = "f_pbr_prefilter";
@@ -130,6 +131,7 @@ void Shaders::init() {
     auto fragText = initShader(ShaderType::Fragment, kFragText);
     auto fragTexture = initShader(ShaderType::Fragment, kFragTexture);
     auto fragTextureNoPerspective = initShader(ShaderType::Fragment, kFragTextureNoPerspective);
+    auto fragTextureYUV = initShader(ShaderType::Fragment, kFragTextureYUV);
     auto fragIrradiance = initShader(ShaderType::Fragment, kFragPBRIrradiance);
     auto fragPBRBRDF = initShader(ShaderType::Fragment, kFragPBRBRDF);
     auto fragPBRPrefilter = initShader(ShaderType::Fragment, kFragPBRPrefilter);
@@ -153,6 +155,7 @@ void Shaders::init() {
     _shaderRegistry.add(ShaderProgramId::mvpColor, initShaderProgram({vertMVP, fragColor}));
     _shaderRegistry.add(ShaderProgramId::mvpTexture, initShaderProgram({vertMVP, fragTexture}));
     _shaderRegistry.add(ShaderProgramId::ndcTexture, initShaderProgram({vertPassthrough, fragTextureNoPerspective}));
+    _shaderRegistry.add(ShaderProgramId::ndcTextureYUV, initShaderProgram({vertPassthrough, fragTextureYUV}));
     _shaderRegistry.add(ShaderProgramId::oitBlend, initShaderProgram({vertPassthrough, fragOITBlend}));
     _shaderRegistry.add(ShaderProgramId::oitModel, initShaderProgram({vertModel, fragOITModel}));
     _shaderRegistry.add(ShaderProgramId::oitParticles, initShaderProgram({vertParticles, fragOITParticles}));
@@ -234,6 +237,9 @@ std::shared_ptr<Shader> Shaders::initShader(ShaderType type, std::string resRef)
 std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::shared_ptr<Shader>> shaders) {
     auto program = std::make_unique<ShaderProgram>(std::move(shaders));
     program->init();
+    if (_graphicsOpt.headless) {
+        return program;
+    }
     program->use();
 
     // Samplers
@@ -257,6 +263,8 @@ std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::share
     program->setUniform("sBRDFLUT", TextureUnits::brdfLUT);
     program->setUniform("sIrradianceMapArray", TextureUnits::irradianceMapArray);
     program->setUniform("sPrefilteredEnvMapArray", TextureUnits::prefilteredEnvMapArray);
+    program->setUniform("sChromaU", TextureUnits::chromaU);
+    program->setUniform("sChromaV", TextureUnits::chromaV);
 
     // Uniform Blocks
     program->bindUniformBlock("Globals", UniformBlockBindingPoints::globals);
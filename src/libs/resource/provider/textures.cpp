@@ -47,17 +47,17 @@ std::shared_ptr<Texture> Textures::get(const std::string &resRef, TextureUsage u
     if (resRef.empty()) {
         return nullptr;
     }
-    auto maybeTexture = _cache.find(resRef);
+    auto key = ResRef(resRef);
+    auto maybeTexture = _cache.find(key);
     if (maybeTexture != _cache.end()) {
         return maybeTexture->second;
     }
-    std::string lcResRef(boost::to_lower_copy(resRef));
-    auto inserted = _cache.insert(std::make_pair(lcResRef, doGet(lcResRef, usage)));
+    auto inserted = _cache.insert(std::make_pair(key, doGet(key, usage)));
 
     return inserted.first->second;
 }
 
-std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage usage) {
+std::shared_ptr<Texture> Textures::doGet(const ResRef &resRef, TextureUsage usage) {
     std::shared_ptr<Texture> texture;
     std::optional<Texture::Features> features;
 
@@ -69,10 +69,12 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
         features = txiReader.features();
     }
 
-    auto tgaRes = _resources.find(ResourceId(resRef, ResType::Tga));
+    auto tgaId = ResourceId(resRef, ResType::Tga);
+    auto tgaRes = _resources.find(tgaId);
     if (tgaRes) {
+        auto timer = ScopedDecodeTimer(_resources.accessRecorder(), tgaId);
         auto tga = MemoryInputStream(tgaRes->data);
-        auto tgaReader = TgaReader(tga, resRef, usage);
+        auto tgaReader = TgaReader(tga, resRef.value(), usage);
         tgaReader.load();
         texture = tgaReader.texture();
         if (texture && features) {
@@ -81,10 +83,12 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
     }
 
     if (!texture) {
-        auto tpcRes = _resources.find(ResourceId(resRef, ResType::Tpc));
+        auto tpcId = ResourceId(resRef, ResType::Tpc);
+        auto tpcRes = _resources.find(tpcId);
         if (tpcRes) {
+            auto timer = ScopedDecodeTimer(_resources.accessRecorder(), tpcId);
             auto tpc = MemoryInputStream(tpcRes->data);
-            auto tpcReader = TpcReader(tpc, resRef, usage);
+            auto tpcReader = TpcReader(tpc, resRef.value(), usage);
             tpcReader.load();
             texture = tpcReader.texture();
             if (texture) {
@@ -107,7 +111,7 @@ std::shared_ptr<Texture> Textures::doGet(const std::string &resRef, TextureUsage
         texture->setAnisotropy(anisotropy);
         texture->init();
     } else {
-        warn("Texture not found: " + resRef, LogChannel::Graphics);
+        warn("Texture not found: " + resRef.value(), LogChannel::Graphics);
     }
 
     return texture;
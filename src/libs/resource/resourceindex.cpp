@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/resourceindex.h"
+
+#include "reone/system/binarywriter.h"
+#include "reone/system/checkutil.h"
+#include "reone/system/logutil.h"
+#include "reone/system/mappedfile.h"
+#include "reone/system/stream/fileoutput.h"
+
+namespace reone {
+
+namespace resource {
+
+static const std::string kSignature {"RIDX V2 "};
+
+namespace {
+
+class IndexReader {
+public:
+    IndexReader(const char *data, size_t size) :
+        _data(data),
+        _size(size) {
+    }
+
+    uint16_t readUint16() { return read<uint16_t>(); }
+    uint32_t readUint32() { return read<uint32_t>(); }
+    int64_t readInt64() { return read<int64_t>(); }
+
+    std::string readString() {
+        uint16_t len = readUint16();
+        return std::string(bytes(len), len);
+    }
+
+    std::string readString(size_t len) {
+        return std::string(bytes(len), len);
+    }
+
+private:
+    const char *_data;
+    size_t _size;
+    size_t _pos {0};
+
+    const char *bytes(size_t count) {
+        checkThat(count <= _size - _pos, "Resource index is truncated");
+        auto data = _data + _pos;
+        _pos += count;
+        return data;
+    }
+
+    template <class T>
+    T read() {
+        T val;
+        std::memcpy(&val, bytes(sizeof(T)), sizeof(T));
+        return boost::endian::little_to_native(val);
+    }
+};
+
+} // namespace
+
+static void writeString(BinaryWriter &writer, const std::string &str) {
+    writer.writeUint16(static_cast<uint16_t>(str.size()));
+    writer.writeString(str);
+}
+
+void ResourceIndex::load() {
+    _records.clear();
+    if (!std::filesystem::exists(_path)) {
+        return;
+    }
+    try {
+        auto file = MappedFile(_path);
+        auto reader = IndexReader(file.data(), file.size());
+        checkEqual("Resource index signature", reader.readString(kSignature.size()), kSignature);
+        uint32_t numRecords = reader.readUint32();
+        for (uint32_t i = 0; i < numRecords; ++i) {
+            auto container = reader.readString();
+            auto record = Record();
+            uint32_t numStamps = reader.readUint32();
+            for (uint32_t j = 0; j < numStamps; ++j) {
+                auto stamp = FileStamp();
+                stamp.path = reader.readString();
+                stamp.size = static_cast<uint64_t>(reader.readInt64());
+                stamp.modified = reader.readInt64();
+                if (j > 0) {
+                    record.snapshot.dependencies.emplace_back(stamp.path);
+                }
+                record.stamps.push_back(std::move(stamp));
+            }
+            uint32_t numFiles = reader.readUint32();
+            for (uint32_t j = 0; j < numFiles; ++j) {
+                record.snapshot.files.emplace_back(reader.readString());
+            }
+            uint32_t numEntries = reader.readUint32();
+            record.snapshot.entries.reserve(numEntries);
+            for (uint32_t j = 0; j < numEntries; ++j) {
+                auto entry = Entry();
+                auto resRef = reader.readString();
+                auto resType = static_cast<ResType>(reader.readUint16());
+                entry.id = ResourceId(std::move(resRef), resType);
+                entry.file = reader.readUint32();
+                entry.offset = reader.readUint32();
+                entry.size = reader.readUint32();
+                entry.modified = reader.readInt64();
+                checkThat(entry.file < numFiles || numFiles == 0, "Resource index entry file out of range");
+                record.snapshot.entries.push_back(std::move(entry));
+            }
+            _records[container] = std::move(record);
+        }
+    } catch (const std::exception &ex) {
+        warn("Resource index ignored: " + std::string(ex.what()));
+        _records.clear();
+    }
+}
+
+void ResourceIndex::save() {
+    if (!_dirty) {
+        return;
+    }
+    auto tmpPath = _path;
+    tmpPath += ".tmp";
+    try {
+        if (_path.has_parent_path()) {
+            std::filesystem::create_directories(_path.parent_path());
+        }
+        {
+            auto stream = FileOutputStream(tmpPath);
+            auto writer = BinaryWriter(stream);
+            writer.writeString(kSignature);
+            uint32_t numUsed = 0;
+            for (auto &[_, record] : _records) {
+                numUsed += record.used ? 1 : 0;
+            }
+            writer.writeUint32(numUsed);
+            for (auto &[container, record] : _records) {
+                if (!record.used) {
+                    continue;
+                }
+                writeString(writer, container);
+                writer.writeUint32(static_cast<uint32_t>(record.stamps.size()));
+                for (auto &stamp : record.stamps) {
+                    writeString(writer, stamp.path);
+                    writer.writeInt64(static_cast<int64_t>(stamp.size));
+                    writer.writeInt64(stamp.modified);
+                }
+                writer.writeUint32(static_cast<uint32_t>(record.snapshot.files.size()));
+                for (auto &file : record.snapshot.files) {
+                    writeString(writer, file.string());
+                }
+                writer.writeUint32(static_cast<uint32_t>(record.snapshot.entries.size()));
+                for (auto &entry : record.snapshot.entries) {
+                    writeString(writer, entry.id.resRef.value());
+                    writer.writeUint16(static_cast<uint16_t>(entry.id.type));
+                    writer.writeUint32(entry.file);
+                    writer.writeUint32(entry.offset);
+                    writer.writeUint32(entry.size);
+                    writer.writeInt64(entry.modified);
+                }
+            }
+        }
+        std::filesystem::rename(tmpPath, _path);
+        _dirty = false;
+    } catch (const std::exception &ex) {
+        warn("Resource index not saved: " + std::string(ex.what()));
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+    }
+}
+
+const ResourceIndex::Snapshot *ResourceIndex::find(const std::filesystem::path &container) {
+    auto it = _records.find(container.string());
+    if (it == _records.end()) {
+        ++_numMisses;
+        return nullptr;
+    }
+    auto &record = it->second;
+    try {
+        for (auto &stamp : record.stamps) {
+            if (!(this->stamp(stamp.path) == stamp)) {
+                ++_numMisses;
+                return nullptr;
+            }
+        }
+    } catch (const std::filesystem::filesystem_error &) {
+        ++_numMisses;
+        return nullptr;
+    }
+    record.used = true;
+    ++_numHits;
+    return &record.snapshot;
+}
+
+void ResourceIndex::put(const std::filesystem::path &container, Snapshot snapshot) {
+    auto record = Record();
+    record.stamps.push_back(stamp(container));
+    for (auto &dependency : snapshot.dependencies) {
+        record.stamps.push_back(stamp(dependency));
+    }
+    record.snapshot = std::move(snapshot);
+    record.used = true;
+    _records[container.string()] = std::move(record);
+    _dirty = true;
+}
+
+ResourceIndex::FileStamp ResourceIndex::stamp(const std::filesystem::path &path) {
+    auto stamp = FileStamp();
+    stamp.path = path.string();
+    stamp.size = std::filesystem::is_directory(path) ? 0 : std::filesystem::file_size(path);
+    stamp.modified = static_cast<int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+    return stamp;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -23,51 +23,67 @@
 #include "reone/resource/container/keybif.h"
 #include "reone/resource/container/rim.h"
 #include "reone/resource/exception/notfound.h"
+#include "reone/system/trace.h"
 
 namespace reone {
 
 namespace resource {
 
+template <class T>
+static void initContainer(T &container, const std::filesystem::path &path, ContainerKind kind, ResourceIndex *index) {
+    if (!index || kind != ContainerKind::Global) {
+        container.init();
+        return;
+    }
+    auto snapshot = index->find(path);
+    if (snapshot) {
+        container.init(*snapshot);
+        return;
+    }
+    container.init();
+    index->put(path, container.snapshot());
+}
+
 void Resources::addKEY(const std::filesystem::path &path) {
-    auto provider = std::make_unique<KeyBifResourceContainer>(path);
-    provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), ContainerKind::Global});
+    auto provider = std::make_unique<KeyBifResourceContainer>(path, _fileHandles);
+    initContainer(*provider, path, ContainerKind::Global, _index.get());
+    add(std::move(provider), ContainerKind::Global, path.filename().string());
 }
 
 void Resources::addERF(const std::filesystem::path &path, ContainerKind kind) {
     auto provider = std::make_unique<ErfResourceContainer>(path);
-    provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    initContainer(*provider, path, kind, _index.get());
+    add(std::move(provider), kind, path.filename().string());
 }
 
 void Resources::addMemERF(ByteBuffer buffer, ContainerKind kind) {
     auto provider = std::make_unique<ErfResourceContainer>(std::move(buffer));
     provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    add(std::move(provider), kind);
 }
 
 void Resources::addRIM(const std::filesystem::path &path, ContainerKind kind) {
     auto provider = std::make_unique<RimResourceContainer>(path);
-    provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    initContainer(*provider, path, kind, _index.get());
+    add(std::move(provider), kind, path.filename().string());
 }
 
 void Resources::addMemRIM(ByteBuffer buffer, ContainerKind kind) {
     auto provider = std::make_unique<RimResourceContainer>(buffer);
     provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    add(std::move(provider), kind);
 }
 
 void Resources::addEXE(const std::filesystem::path &path) {
     auto provider = std::make_unique<ExeResourceContainer>(path);
     provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), ContainerKind::Global});
+    add(std::move(provider), ContainerKind::Global, path.filename().string());
 }
 
 void Resources::addFolder(const std::filesystem::path &path, ContainerKind kind) {
-    auto provider = std::make_unique<FolderResourceContainer>(path);
-    provider->init();
-    _containers.push_front(ResourceContainerPair {std::move(provider), kind});
+    auto provider = std::make_unique<FolderResourceContainer>(path, _fileHandles);
+    initContainer(*provider, path, kind, _index.get());
+    add(std::move(provider), kind, path.filename().string());
 }
 
 Resource Resources::get(const ResourceId &id) {
@@ -79,10 +95,17 @@ Resource Resources::get(const ResourceId &id) {
 }
 
 std::optional<Resource> Resources::find(const ResourceId &id) {
-    for (auto &[provider, kind] : _containers) {
+    R_TRACE_ZONE("resource find");
+    // Lookups share the lock: containers that read from a shared stream
+    // serialize reads themselves.
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    for (auto &[provider, kind, name] : _containers) {
         auto data = provider->findResourceData(id);
         if (data) {
-            return Resource {*data};
+            if (_accessRecorder) {
+                _accessRecorder->recordAccess(id, name, data->size());
+            }
+            return Resource {std::move(*data)};
         }
     }
     return std::nullopt;
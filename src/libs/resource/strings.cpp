@@ -20,64 +20,78 @@
 #include "reone/resource/exception/notfound.h"
 #include "reone/resource/talktable.h"
 #include "reone/system/fileutil.h"
-#include "reone/system/stream/fileinput.h"
+#include "reone/system/mappedfile.h"
 
 namespace reone {
 
 namespace resource {
 
+static const std::string kEmptyString;
+
+static bool hasDeveloperNotes(const std::string &str) {
+    size_t openBracketIdx = str.find('{');
+    return openBracketIdx != std::string::npos && str.find('}', openBracketIdx + 1) != std::string::npos;
+}
+
+static std::string stripDeveloperNotes(const std::string &str) {
+    std::string stripped;
+    stripped.reserve(str.size());
+    size_t pos = 0;
+    while (pos < str.size()) {
+        size_t openBracketIdx = str.find('{', pos);
+        if (openBracketIdx == std::string::npos) {
+            break;
+        }
+        size_t closeBracketIdx = str.find('}', openBracketIdx + 1);
+        if (closeBracketIdx == std::string::npos) {
+            break;
+        }
+        stripped.append(str, pos, openBracketIdx - pos);
+        pos = closeBracketIdx + 1;
+    }
+    if (pos < str.size()) {
+        stripped.append(str, pos, std::string::npos);
+    }
+    return stripped;
+}
+
 void Strings::init(const std::filesystem::path &gameDir) {
     auto tlkPath = findFileIgnoreCase(gameDir, "dialog.tlk");
     if (!tlkPath) {
         return;
     }
-    auto tlk = FileInputStream(*tlkPath);
-    auto tlkReader = TlkReader(tlk);
-    tlkReader.load();
-    _table = tlkReader.table();
+    setTalkTable(std::make_shared<TalkTable>(std::make_shared<MappedFile>(*tlkPath)));
 }
 
-std::string Strings::getText(int strRef) {
-    if (!_table || strRef < 0 || strRef >= _table->getStringCount())
-        return "";
-
-    std::string text(_table->getString(strRef).text);
-    process(text);
-
-    return text;
+void Strings::setTalkTable(std::shared_ptr<TalkTable> table) {
+    _table = std::move(table);
+    _texts = std::vector<std::atomic<const std::string *>>(_table ? _table->getStringCount() : 0);
+    _processedTexts.clear();
 }
 
-std::string Strings::getSound(int strRef) {
+const std::string &Strings::getText(int strRef) {
     if (!_table || strRef < 0 || strRef >= _table->getStringCount())
-        return "";
+        return kEmptyString;
 
-    return _table->getString(strRef).soundResRef;
-}
-
-void Strings::process(std::string &str) {
-    stripDeveloperNotes(str);
+    auto text = _texts[strRef].load(std::memory_order_acquire);
+    if (text) {
+        return *text;
+    }
+    std::lock_guard<std::mutex> lock {_processMutex};
+    text = _texts[strRef].load(std::memory_order_relaxed);
+    if (!text) {
+        auto &raw = _table->getString(strRef).text;
+        text = hasDeveloperNotes(raw) ? &_processedTexts.emplace_back(stripDeveloperNotes(raw)) : &raw;
+        _texts[strRef].store(text, std::memory_order_release);
+    }
+    return *text;
 }
 
-void Strings::stripDeveloperNotes(std::string &str) {
-    do {
-        size_t openBracketIdx = str.find_first_of('{', 0);
-        if (openBracketIdx == -1)
-            break;
-
-        size_t closeBracketIdx = str.find_first_of('}', static_cast<int64_t>(openBracketIdx) + 1);
-        if (closeBracketIdx == -1)
-            break;
-
-        int textLen = static_cast<int>(str.size());
-        size_t noteLen = closeBracketIdx - openBracketIdx + 1;
-
-        for (size_t i = openBracketIdx; i + noteLen < textLen; ++i) {
-            str[i] = str[i + noteLen];
-        }
-
-        str.resize(textLen - noteLen);
+const std::string &Strings::getSound(int strRef) {
+    if (!_table || strRef < 0 || strRef >= _table->getStringCount())
+        return kEmptyString;
 
-    } while (true);
+    return _table->getString(strRef).soundResRef;
 }
 
 } // namespace resource
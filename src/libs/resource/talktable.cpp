@@ -17,19 +17,89 @@
 
 #include "reone/resource/talktable.h"
 
+#include "reone/system/checkutil.h"
+#include "reone/system/mappedfile.h"
+
 namespace reone {
 
 namespace resource {
 
+static constexpr int kHeaderSize = 20;
+static constexpr int kEntrySize = 40;
+static constexpr int kSoundResRefSize = 16;
+
+struct StringFlags {
+    static constexpr int textPresent = 1;
+};
+
+static uint32_t readUint32(const char *data) {
+    uint32_t val;
+    std::memcpy(&val, data, sizeof(uint32_t));
+    return boost::endian::little_to_native(val);
+}
+
+TalkTable::TalkTable(std::vector<String> strings) :
+    _strings(std::move(strings)),
+    _stringCount(static_cast<int>(_strings.size())) {
+}
+
+TalkTable::TalkTable(std::shared_ptr<MappedFile> tlk) :
+    _tlk(std::move(tlk)) {
+
+    checkThat(_tlk->size() >= kHeaderSize, "TLK header is truncated");
+    checkEqual("TLK signature", std::string(_tlk->data(), 8), std::string("TLK V3.0", 8));
+    uint32_t stringCount = readUint32(_tlk->data() + 12);
+    _stringsOffset = readUint32(_tlk->data() + 16);
+    checkThat(kHeaderSize + static_cast<uint64_t>(stringCount) * kEntrySize <= _tlk->size(), "TLK string entries are truncated");
+
+    _stringCount = static_cast<int>(stringCount);
+    _decoded = std::vector<std::atomic<const String *>>(_stringCount);
+}
+
+TalkTable::~TalkTable() = default;
+
 int TalkTable::getStringCount() const {
-    return static_cast<int>(_strings.size());
+    return _stringCount;
 }
 
 const TalkTable::String &TalkTable::getString(int index) const {
-    if (index < 0 || index >= static_cast<int>(_strings.size())) {
+    if (index < 0 || index >= _stringCount) {
         throw std::out_of_range("index is out of range");
     }
-    return _strings[index];
+    if (!_tlk) {
+        return _strings[index];
+    }
+    auto decoded = _decoded[index].load(std::memory_order_acquire);
+    if (decoded) {
+        return *decoded;
+    }
+    std::lock_guard<std::mutex> lock {_decodeMutex};
+    decoded = _decoded[index].load(std::memory_order_relaxed);
+    if (!decoded) {
+        decoded = &_decodedStrings.emplace_back(decode(index));
+        _decoded[index].store(decoded, std::memory_order_release);
+    }
+    return *decoded;
+}
+
+TalkTable::String TalkTable::decode(int index) const {
+    const char *entry = _tlk->data() + kHeaderSize + static_cast<size_t>(index) * kEntrySize;
+    uint32_t flags = readUint32(entry);
+
+    const char *soundResRef = entry + 4;
+    auto string = String();
+    string.soundResRef = boost::to_lower_copy(std::string(soundResRef, strnlen(soundResRef, kSoundResRefSize)));
+
+    if (flags & StringFlags::textPresent) {
+        uint32_t offset = readUint32(entry + 28);
+        uint32_t size = readUint32(entry + 32);
+        uint64_t start = static_cast<uint64_t>(_stringsOffset) + offset;
+        checkThat(start + size <= _tlk->size(), "TLK string out of bounds: " + std::to_string(index));
+        const char *text = _tlk->data() + start;
+        string.text = std::string(text, strnlen(text, size));
+    }
+
+    return string;
 }
 
 } // namespace resource
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/workingset.h"
+
+#include "reone/resource/typeutil.h"
+#include "reone/system/logutil.h"
+#include "reone/system/textreader.h"
+#include "reone/system/textwriter.h"
+
+namespace reone {
+
+namespace resource {
+
+static std::optional<ResourceId> parseResourceId(const std::string &s) {
+    auto dotIdx = s.find_last_of('.');
+    if (dotIdx == std::string::npos || dotIdx == 0) {
+        return std::nullopt;
+    }
+    auto type = getResTypeByExt(s.substr(dotIdx + 1), false);
+    if (type == ResType::Invalid) {
+        return std::nullopt;
+    }
+    return ResourceId(std::string_view(s).substr(0, dotIdx), type);
+}
+
+void WorkingSetManifest::addAccessLog(IInputStream &log) {
+    auto reader = TextReader(log);
+    while (auto line = reader.readLine()) {
+        boost::trim_right(*line);
+        if (line->empty()) {
+            continue;
+        }
+        std::vector<std::string> tokens;
+        boost::split(tokens, *line, boost::is_any_of("\t"));
+        if (tokens.size() != 6 || tokens[0] == "-") {
+            continue;
+        }
+        auto id = parseResourceId(tokens[1]);
+        if (!id) {
+            warn("Invalid resource in access log: " + tokens[1], LogChannel::Resources);
+            continue;
+        }
+        auto access = Access();
+        access.frame = static_cast<uint32_t>(std::stoul(tokens[5]));
+        auto &accesses = _moduleToAccesses[tokens[0]];
+        access.order = accesses.size();
+        auto [it, inserted] = accesses.insert({*id, access});
+        if (!inserted) {
+            it->second.frame = std::min(it->second.frame, access.frame);
+        }
+    }
+    sortModules();
+}
+
+void WorkingSetManifest::sortModules() {
+    _modules.clear();
+    for (auto &[module, accesses] : _moduleToAccesses) {
+        std::vector<std::pair<std::pair<uint32_t, size_t>, ResourceId>> ordered;
+        ordered.reserve(accesses.size());
+        for (auto &[id, access] : accesses) {
+            ordered.push_back({{access.frame, access.order}, id});
+        }
+        std::sort(ordered.begin(), ordered.end(), [](auto &lhs, auto &rhs) {
+            return lhs.first < rhs.first;
+        });
+        auto &ids = _modules[module];
+        ids.reserve(ordered.size());
+        for (auto &[_, id] : ordered) {
+            ids.push_back(id);
+        }
+    }
+}
+
+void WorkingSetManifest::load(IInputStream &stream) {
+    _moduleToAccesses.clear();
+    std::unordered_map<ResourceId, Access> *accesses = nullptr;
+    auto reader = TextReader(stream);
+    while (auto line = reader.readLine()) {
+        boost::trim(*line);
+        if (line->empty()) {
+            continue;
+        }
+        if (line->front() == '[' && line->back() == ']') {
+            accesses = &_moduleToAccesses[line->substr(1, line->size() - 2)];
+            continue;
+        }
+        auto id = parseResourceId(*line);
+        if (!accesses || !id) {
+            warn("Invalid working set manifest line: " + *line, LogChannel::Resources);
+            continue;
+        }
+        auto access = Access();
+        access.order = accesses->size();
+        accesses->insert({*id, access});
+    }
+    sortModules();
+}
+
+void WorkingSetManifest::save(IOutputStream &stream) const {
+    auto writer = TextWriter(stream);
+    for (auto &[module, ids] : _modules) {
+        writer.writeLine("[" + module + "]");
+        for (auto &id : ids) {
+            writer.writeLine(id.string());
+        }
+    }
+}
+
+const std::vector<ResourceId> &WorkingSetManifest::moduleResources(const std::string &module) const {
+    static const std::vector<ResourceId> kEmpty;
+    auto it = _modules.find(module);
+    return it != _modules.end() ? it->second : kEmpty;
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -41,6 +41,7 @@
 #include "reone/scene/node/walkmesh.h"
 #include "reone/scene/render/pipeline.h"
 #include "reone/system/logutil.h"
+#include "reone/system/trace.h"
 
 using namespace reone::graphics;
 
@@ -148,7 +149,9 @@ void SceneGraph::removeRoot(SoundSceneNode &node) {
 }
 
 void SceneGraph::update(float dt) {
+    R_TRACE_ZONE("scene update");
     if (_updateRoots) {
+        R_TRACE_ZONE("scene update roots");
         for (auto &root : _modelRoots) {
             root->update(dt);
         }
@@ -162,14 +165,23 @@ void SceneGraph::update(float dt) {
     if (!_activeCamera) {
         return;
     }
-    cullRoots();
-    refresh();
-    updateLighting();
-    updateShadowLight(dt);
-    updateFlareLights();
+    {
+        R_TRACE_ZONE("scene cull");
+        cullRoots();
+        refresh();
+    }
+    {
+        R_TRACE_ZONE("scene lighting");
+        updateLighting();
+        updateShadowLight(dt);
+        updateFlareLights();
+    }
     updateSounds();
-    prepareOpaqueLeafs();
-    prepareTransparentLeafs();
+    {
+        R_TRACE_ZONE("scene prepare leafs");
+        prepareOpaqueLeafs();
+        prepareTransparentLeafs();
+    }
 }
 
 void SceneGraph::cullRoots() {
@@ -454,6 +466,7 @@ void SceneGraph::prepareTransparentLeafs() {
 }
 
 Texture &SceneGraph::render(const glm::ivec2 &dim) {
+    R_TRACE_ZONE("scene render");
     if (!_renderPipeline) {
         auto rendererType = _graphicsOpt.pbr ? RendererType::PBR : RendererType::Retro;
         _renderPipeline = _renderPipelineFactory.create(rendererType, dim);
@@ -518,25 +531,31 @@ Texture &SceneGraph::render(const glm::ivec2 &dim) {
                                 ? RenderPassName::DirLightShadowsPass
                                 : RenderPassName::PointLightShadows;
             pipeline.inRenderPass(passName, [this](auto &pass) {
+                R_TRACE_ZONE("shadows pass");
                 renderShadows(pass);
             });
         }
         pipeline.inRenderPass(RenderPassName::OpaqueGeometry, [this](auto &pass) {
+            R_TRACE_ZONE("opaque pass");
             renderOpaque(pass);
         });
         pipeline.inRenderPass(RenderPassName::TransparentGeometry, [this](auto &pass) {
+            R_TRACE_ZONE("transparent pass");
             renderTransparent(pass);
         });
         pipeline.inRenderPass(RenderPassName::PostProcessing, [this, &camera](auto &pass) {
+            R_TRACE_ZONE("post-processing pass");
             if (!_flareLights.empty()) {
                 renderLensFlares(pass);
             }
         });
         pipeline.inRenderPass(RenderPassName::Debug, [this, &camera](auto &pass) {
+            R_TRACE_ZONE("debug pass");
             renderDrawDebug(pass, _graphicsSvc, _resourceSvc, name());
         });
     }
 
+    R_TRACE_ZONE("render pipeline");
     return pipeline.render();
 }
 
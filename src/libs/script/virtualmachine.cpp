@@ -25,6 +25,7 @@
 #include "reone/script/variable.h"
 #include "reone/system/logger.h"
 #include "reone/system/logutil.h"
+#include "reone/system/trace.h"
 
 namespace reone {
 
@@ -37,7 +38,7 @@ VirtualMachine::VirtualMachine(std::shared_ptr<ScriptProgram> program, std::uniq
     _context(std::move(context)),
     _program(std::move(program)) {
 
-    _logEnabled = Logger::instance.isChannelEnabled(LogChannel::Script3);
+    _logEnabled = Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Script3);
 
     static std::unordered_map<InstructionType, std::function<void(VirtualMachine *, const Instruction &)>> g_handlers {
         {InstructionType::CPDOWNSP, &VirtualMachine::executeCPDOWNSP},
@@ -197,6 +198,7 @@ void VirtualMachine::logJump(JumpType type) {
 }
 
 int VirtualMachine::run() {
+    R_TRACE_ZONE("script run");
     uint32_t insOff = kStartInstructionOffset;
 
     if (_context->savedState) {
@@ -210,7 +212,7 @@ int VirtualMachine::run() {
         insOff = _context->savedState->insOffset;
     }
 
-    if (Logger::instance.isChannelEnabled(LogChannel::Script)) {
+    if (Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Script)) {
         std::stringstream ss;
         ss << boost::format("Run '%s': Offset=%04x") %
                   _program->name() %
@@ -222,7 +224,7 @@ int VirtualMachine::run() {
                 ss << var.toString();
             }
         }
-        debug(ss.str());
+        debug(ss.str(), LogChannel::Script);
     }
 
     while (insOff < _program->length()) {
@@ -244,14 +246,14 @@ int VirtualMachine::run() {
             halt = true;
         }
 
-        if (Logger::instance.isChannelEnabled(LogChannel::Script3)) {
-            debug(str(boost::format("Instruction: %s %s") % describeInstruction(ins, *_context->routines) % _logStream.str()), LogChannel::Script3);
+        if (_logEnabled) {
+            Logger::instance.appendFormat(LogChannel::Script3, LogSeverity::Debug, "Instruction: %s %s", describeInstruction(ins, *_context->routines), _logStream.str());
             _logStream.str("");
             _logStream.clear();
         }
 
         if (halt) {
-            debug(str(boost::format("Halt '%s'") % _program->name()), LogChannel::Script);
+            R_DEBUG(LogChannel::Script, "Halt '%s'", _program->name());
             return -1;
         }
 
@@ -404,13 +406,13 @@ void VirtualMachine::executeACTION(const Instruction &ins) {
     }
 
     Variable retValue = routine.invoke(args, *_context);
-    if (Logger::instance.isChannelEnabled(LogChannel::Script2)) {
+    if (Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Script2)) {
         std::vector<std::string> argStrings;
         for (auto &arg : args) {
             argStrings.push_back(arg.toString());
         }
         std::string argsString(boost::join(argStrings, ", "));
-        debug(str(boost::format("Action: %04x %s(%s) -> %s") % ins.offset % routine.name() % argsString % retValue.toString()), LogChannel::Script2);
+        Logger::instance.appendFormat(LogChannel::Script2, LogSeverity::Debug, "Action: %04x %s(%s) -> %s", ins.offset, routine.name(), argsString, retValue.toString());
     }
     switch (routine.returnType()) {
     case VariableType::Void: {
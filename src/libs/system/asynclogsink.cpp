@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/asynclogsink.h"
+
+namespace reone {
+
+static constexpr std::chrono::milliseconds kWriterInterval {10};
+static constexpr int kCrashDrainSpins = 1 << 20;
+
+void AsyncLogSink::start() {
+    if (_running) {
+        return;
+    }
+    _running = true;
+    _writer = std::thread(&AsyncLogSink::writerThreadFunc, this);
+}
+
+void AsyncLogSink::stop() {
+    if (_running.exchange(false)) {
+        wakeWriter();
+        _writer.join();
+    }
+    // Records may have been pushed after the writer thread exited
+    drainSync();
+    notifyFlushed();
+}
+
+bool AsyncLogSink::push(std::string record) {
+    if (_records.push(std::move(record))) {
+        // Wake writer early when queue is filling up faster than it polls.
+        // Records are counted after they are queued, so the writer may have
+        // counted more records than were pushed so far.
+        size_t numPushed = ++_numPushed;
+        size_t numWritten = _numWritten;
+        if (numPushed > numWritten && numPushed - numWritten > _records.capacity() / 2) {
+            wakeWriter();
+        }
+        return true;
+    }
+    if (_overflowPolicy == LogOverflowPolicy::Block) {
+        while (_running) {
+            wakeWriter();
+            std::this_thread::yield();
+            if (_records.push(std::move(record))) {
+                ++_numPushed;
+                return true;
+            }
+        }
+    }
+    ++_numDropped;
+    return false;
+}
+
+void AsyncLogSink::flush() {
+    size_t target = _numPushed;
+    if (!_running) {
+        drainSync();
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _wakeRequested = true;
+    _writerCondVar.notify_one();
+    _flushedCondVar.wait(lock, [this, &target]() { return _numWritten >= target || !_running; });
+}
+
+void AsyncLogSink::drainOnCrash() {
+    for (int i = 0; i < kCrashDrainSpins; ++i) {
+        if (!_consuming.test_and_set(std::memory_order_acquire)) {
+            drain();
+            _consuming.clear(std::memory_order_release);
+            return;
+        }
+    }
+}
+
+void AsyncLogSink::writerThreadFunc() {
+    while (true) {
+        bool running = _running;
+        if (!_consuming.test_and_set(std::memory_order_acquire)) {
+            size_t numWritten = drain();
+            _consuming.clear(std::memory_order_release);
+            if (numWritten > 0) {
+                notifyFlushed();
+            }
+        }
+        if (!running) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _writerCondVar.wait_for(lock, kWriterInterval, [this]() { return !_running || _wakeRequested; });
+        _wakeRequested = false;
+    }
+}
+
+size_t AsyncLogSink::drain() {
+    if (!_stream) {
+        return 0;
+    }
+    // Bound the batch, so that busy producers cannot keep the writer from
+    // flushing the stream
+    size_t numWritten = 0;
+    std::string record;
+    while (numWritten < _records.capacity() && _records.pop(record)) {
+        _stream->write(record.data(), record.size());
+        ++numWritten;
+    }
+    bool reportDropped = false;
+    if (_overflowPolicy == LogOverflowPolicy::Count) {
+        size_t numDropped = _numDropped;
+        if (numDropped > _numDroppedReported) {
+            *_stream << " WARN [log] " << (numDropped - _numDroppedReported) << " log records dropped\n";
+            _numDroppedReported = numDropped;
+            reportDropped = true;
+        }
+    }
+    if (numWritten > 0 || reportDropped) {
+        _stream->flush();
+        _numWritten += numWritten;
+    }
+    return numWritten;
+}
+
+void AsyncLogSink::drainSync() {
+    while (_consuming.test_and_set(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    while (drain() > 0) {
+    }
+    _consuming.clear(std::memory_order_release);
+}
+
+void AsyncLogSink::wakeWriter() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _wakeRequested = true;
+    }
+    _writerCondVar.notify_one();
+}
+
+void AsyncLogSink::notifyFlushed() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+    }
+    _flushedCondVar.notify_all();
+}
+
+} // namespace reone
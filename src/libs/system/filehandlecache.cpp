@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/filehandlecache.h"
+
+#include "reone/system/exception/filenotfound.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace reone {
+
+#ifdef _WIN32
+
+FileHandleCache::File::File(const std::filesystem::path &path) {
+    HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw FileNotFoundException("Cannot open file: " + path.string());
+    }
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!GetFileInformationByHandle(handle, &info)) {
+        CloseHandle(handle);
+        throw FileNotFoundException("Cannot get file size: " + path.string());
+    }
+    _handle = reinterpret_cast<intptr_t>(handle);
+    _size = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+    _modified = static_cast<int64_t>((static_cast<uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime);
+}
+
+FileHandleCache::File::~File() {
+    CloseHandle(reinterpret_cast<HANDLE>(_handle));
+}
+
+size_t FileHandleCache::File::read(uint64_t offset, char *buf, size_t len) const {
+    size_t total = 0;
+    while (total < len) {
+        OVERLAPPED overlapped {};
+        uint64_t pos = offset + total;
+        overlapped.Offset = static_cast<DWORD>(pos & 0xffffffff);
+        overlapped.OffsetHigh = static_cast<DWORD>(pos >> 32);
+        DWORD numRead = 0;
+        auto toRead = static_cast<DWORD>(std::min<size_t>(len - total, 0x7fffffff));
+        if (!ReadFile(reinterpret_cast<HANDLE>(_handle), buf + total, toRead, &numRead, &overlapped) || numRead == 0) {
+            break;
+        }
+        total += numRead;
+    }
+    return total;
+}
+
+bool FileHandleCache::File::isCurrent(const std::filesystem::path &path) const {
+    // File index is not available without opening the file
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) {
+        return false;
+    }
+    uint64_t size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    auto modified = static_cast<int64_t>((static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime);
+    return size == _size && modified == _modified;
+}
+
+#else
+
+static int64_t getModifiedNanos(const struct stat &st) {
+#ifdef __APPLE__
+    return static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    return static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+}
+
+FileHandleCache::File::File(const std::filesystem::path &path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        throw FileNotFoundException("Cannot open file: " + path.string());
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        throw FileNotFoundException("Cannot get file size: " + path.string());
+    }
+    _handle = fd;
+    _size = static_cast<uint64_t>(st.st_size);
+    _modified = getModifiedNanos(st);
+    _fileId = static_cast<uint64_t>(st.st_ino);
+}
+
+FileHandleCache::File::~File() {
+    close(static_cast<int>(_handle));
+}
+
+size_t FileHandleCache::File::read(uint64_t offset, char *buf, size_t len) const {
+    size_t total = 0;
+    while (total < len) {
+        ssize_t numRead = pread(static_cast<int>(_handle), buf + total, len - total, static_cast<off_t>(offset + total));
+        if (numRead == -1 && errno == EINTR) {
+            continue;
+        }
+        if (numRead <= 0) {
+            break;
+        }
+        total += static_cast<size_t>(numRead);
+    }
+    return total;
+}
+
+bool FileHandleCache::File::isCurrent(const std::filesystem::path &path) const {
+    struct stat st;
+    if (stat(path.c_str(), &st) == -1) {
+        return false;
+    }
+    return static_cast<uint64_t>(st.st_ino) == _fileId &&
+           static_cast<uint64_t>(st.st_size) == _size &&
+           getModifiedNanos(st) == _modified;
+}
+
+#endif
+
+std::shared_ptr<FileHandleCache::File> FileHandleCache::get(const std::filesystem::path &path) {
+    auto key = path.string();
+    if (auto file = findFile(key)) {
+        return file;
+    }
+    return openFile(std::move(key), path);
+}
+
+std::shared_ptr<FileHandleCache::File> FileHandleCache::getCurrent(const std::filesystem::path &path) {
+    auto key = path.string();
+    auto file = findFile(key);
+    if (file) {
+        if (file->isCurrent(path)) {
+            return file;
+        }
+        // File was replaced, truncated or removed since it was opened
+        std::lock_guard<std::mutex> lock {_mutex};
+        --_stats.numHits;
+        auto it = _pathToFile.find(key);
+        if (it != _pathToFile.end() && it->second->second == file) {
+            _files.erase(it->second);
+            _pathToFile.erase(it);
+            ++_stats.numCloses;
+        }
+    }
+    return openFile(std::move(key), path);
+}
+
+std::shared_ptr<FileHandleCache::File> FileHandleCache::findFile(const std::string &key) {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto it = _pathToFile.find(key);
+    if (it == _pathToFile.end()) {
+        return nullptr;
+    }
+    _files.splice(_files.begin(), _files, it->second);
+    ++_stats.numHits;
+    return it->second->second;
+}
+
+std::shared_ptr<FileHandleCache::File> FileHandleCache::openFile(std::string key, const std::filesystem::path &path) {
+    auto file = std::make_shared<File>(path);
+    std::vector<std::shared_ptr<File>> evicted; // closed after unlocking
+    std::lock_guard<std::mutex> lock {_mutex};
+    ++_stats.numOpens;
+    auto it = _pathToFile.find(key);
+    if (it != _pathToFile.end()) {
+        // Opened by another thread in the meantime
+        _files.splice(_files.begin(), _files, it->second);
+        ++_stats.numCloses;
+        evicted.push_back(std::move(file));
+        return it->second->second;
+    }
+    _files.emplace_front(key, file);
+    _pathToFile[std::move(key)] = _files.begin();
+    while (static_cast<int>(_files.size()) > _capacity) {
+        evicted.push_back(std::move(_files.back().second));
+        _pathToFile.erase(_files.back().first);
+        _files.pop_back();
+        ++_stats.numCloses;
+    }
+    return file;
+}
+
+FileHandleCache::Stats FileHandleCache::stats() const {
+    std::lock_guard<std::mutex> lock {_mutex};
+    auto stats = _stats;
+    stats.numHandles = static_cast<int>(_files.size());
+    return stats;
+}
+
+} // namespace reone
@@ -57,4 +57,35 @@ std::optional<std::filesystem::path> findFileIgnoreCase(const std::filesystem::p
     return std::nullopt;
 }
 
+std::filesystem::path getUserCacheDirectory() {
+#if defined(_WIN32)
+    if (const char *localAppData = std::getenv("LOCALAPPDATA")) {
+        return std::filesystem::path(localAppData) / "reone";
+    }
+#elif defined(__APPLE__)
+    if (const char *home = std::getenv("HOME")) {
+        return std::filesystem::path(home) / "Library" / "Caches" / "reone";
+    }
+#else
+    const char *cacheHome = std::getenv("XDG_CACHE_HOME");
+    if (cacheHome && *cacheHome) {
+        return std::filesystem::path(cacheHome) / "reone";
+    }
+    if (const char *home = std::getenv("HOME")) {
+        return std::filesystem::path(home) / ".cache" / "reone";
+    }
+#endif
+    std::error_code ec;
+    return std::filesystem::temp_directory_path(ec) / "reone";
+}
+
+std::filesystem::path getGameCacheFilePath(const std::filesystem::path &gamePath, std::string_view prefix, std::string_view extension) {
+    auto absGamePath = std::filesystem::absolute(gamePath).lexically_normal();
+    if (!absGamePath.has_filename()) {
+        absGamePath = absGamePath.parent_path(); // trailing separator
+    }
+    auto hash = std::hash<std::string>()(absGamePath.string());
+    return getUserCacheDirectory() / str(boost::format("%s_%016x%s") % prefix % hash % extension);
+}
+
 } // namespace reone
@@ -18,104 +18,124 @@
 #include "reone/system/logger.h"
 #include "reone/system/threadutil.h"
 
+#include <csignal>
+
 namespace reone {
 
-static const std::unordered_map<LogSeverity, std::string> kSeverityToName {
-    {LogSeverity::Error, "ERROR"},
-    {LogSeverity::Warn, "WARN"},
-    {LogSeverity::Info, "INFO"},
-    {LogSeverity::Debug, "DEBUG"}};
+// Indexed by severity, right-aligned to five characters
+static constexpr std::array<std::string_view, kNumLogSeverities> kSeverityNames {
+    "DEBUG",
+    " INFO",
+    " WARN",
+    "ERROR"};
 
-static const std::unordered_map<LogChannel, std::string> kChannelToName {
-    {LogChannel::Global, "global"},
-    {LogChannel::Resources, "resources"},
-    {LogChannel::Resources2, "resources"},
-    {LogChannel::Graphics, "graphics"},
-    {LogChannel::Audio, "audio"},
-    {LogChannel::GUI, "gui"},
-    {LogChannel::Perception, "perception"},
-    {LogChannel::Conversation, "conversation"},
-    {LogChannel::Combat, "combat"},
-    {LogChannel::Script, "script"},
-    {LogChannel::Script2, "script"},
-    {LogChannel::Script3, "script"}};
+static std::string_view channelName(LogChannel channel) {
+    switch (channel) {
+    case LogChannel::Global:
+        return "global";
+    case LogChannel::Resources:
+    case LogChannel::Resources2:
+        return "resources";
+    case LogChannel::Graphics:
+        return "graphics";
+    case LogChannel::Audio:
+        return "audio";
+    case LogChannel::GUI:
+        return "gui";
+    case LogChannel::Perception:
+        return "perception";
+    case LogChannel::Conversation:
+        return "conversation";
+    case LogChannel::Combat:
+        return "combat";
+    case LogChannel::Script:
+    case LogChannel::Script2:
+    case LogChannel::Script3:
+        return "script";
+    default:
+        return "unknown";
+    }
+}
 
-static constexpr int kBufferSize = 512;
+static void onCrashSignal(int sig) {
+    Logger::instance.drainOnCrash();
+    std::signal(sig, SIG_DFL);
+    std::raise(sig);
+}
 
 Logger Logger::instance;
-thread_local std::optional<std::reference_wrapper<std::ostringstream>> Logger::buffer;
 
 void Logger::init(LogSeverity minSeverity,
                   std::set<LogChannel> enabledChannels,
-                  std::optional<std::string> filename) {
+                  std::optional<std::string> filename,
+                  LogOverflowPolicy overflowPolicy) {
     checkThat(!_inited, "Logger already initialized");
-    _minSeverity = minSeverity;
-    _enabledChannels = std::move(enabledChannels);
+    uint32_t channelMask = 0;
+    for (auto channel : enabledChannels) {
+        channelMask |= static_cast<uint32_t>(channel);
+    }
+    std::unique_ptr<std::ostream> stream;
     if (filename) {
-        _stream = std::make_unique<std::ofstream>(*filename);
+        stream = std::make_unique<std::ofstream>(*filename);
     } else {
-        _stream = std::make_unique<std::ostream>(std::clog.rdbuf());
+        stream = std::make_unique<std::ostream>(std::clog.rdbuf());
     }
+    _sink = std::make_unique<AsyncLogSink>(std::move(stream), overflowPolicy);
+    _sink->start();
     _inited = true;
+    for (int severity = 0; severity < kNumLogSeverities; ++severity) {
+        _channelMasks[severity] = severity >= static_cast<int>(minSeverity) ? channelMask : 0;
+    }
 }
 
 void Logger::deinit() {
     if (!_inited) {
         return;
     }
-    std::lock_guard<std::mutex> lock {_buffersMutex};
-    for (auto &buffer : _buffers) {
-        flush(buffer);
-    }
+    _channelMasks.fill(0);
+    _sink->stop();
     _inited = false;
 }
 
-void Logger::append(std::string message,
-                    LogChannel channel,
-                    LogSeverity severity) {
-    if (!_inited) {
-        return;
-    }
-    if (static_cast<int>(severity) < static_cast<int>(_minSeverity)) {
-        return;
-    }
-    if (_enabledChannels.count(channel) == 0) {
-        return;
-    }
-    auto formatted = str(boost::format("%1$5s [%2%][%3%] %4%\n") %
-                         kSeverityToName.at(severity) %
-                         threadName() %
-                         kChannelToName.at(channel) %
-                         message);
-    if (!buffer) {
-        std::lock_guard<std::mutex> lock {_buffersMutex};
-        buffer = _buffers.emplace_back();
+void Logger::installCrashHandlers() {
+    for (auto sig : {SIGSEGV, SIGABRT, SIGFPE, SIGILL}) {
+        std::signal(sig, &onCrashSignal);
     }
-    auto &buf = buffer->get();
-    buf.write(&formatted[0], formatted.length());
-    if (buf.tellp() >= kBufferSize) {
-        flush(buf);
+}
+
+void Logger::drainOnCrash() {
+    if (_inited) {
+        _sink->drainOnCrash();
     }
 }
 
-void Logger::flush() {
-    if (!_inited || !buffer) {
+void Logger::append(std::string message,
+                    LogChannel channel,
+                    LogSeverity severity) {
+    if (!_inited || !isEnabled(severity, channel)) {
         return;
     }
-    flush(buffer->get());
+    auto severityName = kSeverityNames[static_cast<int>(severity)];
+    auto name = channelName(channel);
+    auto &thread = threadName();
+    std::string formatted;
+    formatted.reserve(severityName.size() + thread.size() + name.size() + message.size() + 7);
+    formatted.append(severityName);
+    formatted.append(" [");
+    formatted.append(thread);
+    formatted.append("][");
+    formatted.append(name);
+    formatted.append("] ");
+    formatted.append(message);
+    formatted.append("\n");
+    _sink->push(std::move(formatted));
 }
 
-void Logger::flush(std::ostringstream &buffer) {
-    if (!_stream) {
+void Logger::flush() {
+    if (!_inited) {
         return;
     }
-    auto str = buffer.str();
-    {
-        std::lock_guard<std::mutex> lock {_streamMutex};
-        _stream->write(&str[0], str.length());
-        _stream->flush();
-    }
-    buffer.str("");
+    _sink->flush();
 }
 
 } // namespace reone
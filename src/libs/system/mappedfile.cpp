@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/mappedfile.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+using namespace boost::interprocess;
+
+namespace reone {
+
+struct MappedFile::Mapping {
+    file_mapping file;
+    mapped_region region;
+};
+
+MappedFile::MappedFile(const std::filesystem::path &path) {
+    if (std::filesystem::file_size(path) == 0) {
+        return;
+    }
+    _mapping = std::make_unique<Mapping>();
+    _mapping->file = file_mapping(path.string().c_str(), read_only);
+    _mapping->region = mapped_region(_mapping->file, read_only);
+    _data = static_cast<const char *>(_mapping->region.get_address());
+    _size = _mapping->region.get_size();
+}
+
+MappedFile::~MappedFile() = default;
+
+} // namespace reone
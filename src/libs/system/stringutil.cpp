@@ -43,4 +43,32 @@ std::string_view string_strip(std::string_view s, std::string_view trimChars) {
     return string_rstrip(string_lstrip(s, trimChars), trimChars);
 }
 
+std::string string_json_quote(std::string_view s) {
+    std::string quoted;
+    quoted.reserve(s.size() + 2);
+    quoted += '"';
+    for (char ch : s) {
+        switch (ch) {
+        case '"':
+            quoted += "\\\"";
+            break;
+        case '\\':
+            quoted += "\\\\";
+            break;
+        case '\n':
+            quoted += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                quoted += ' ';
+            } else {
+                quoted += ch;
+            }
+            break;
+        }
+    }
+    quoted += '"';
+    return quoted;
+}
+
 } // namespace reone
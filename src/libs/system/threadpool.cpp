@@ -19,22 +19,87 @@
 
 namespace reone {
 
+static constexpr std::chrono::microseconds kHelpWaitTimeout {500};
+static constexpr size_t kRangesPerThread = 4;
+
+static thread_local const ThreadPool *tlsPool = nullptr;
+static thread_local int tlsWorkerIdx = -1;
+
+void Task::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCondVar.wait(lock, [this]() { return _done.load(); });
+    if (_error) {
+        std::rethrow_exception(_error);
+    }
+}
+
+bool Task::waitFor(std::chrono::microseconds timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _doneCondVar.wait_for(lock, timeout, [this]() { return _done.load(); });
+}
+
+void Task::operator()() {
+    try {
+        _func(_canceled);
+    } catch (...) {
+        _error = std::current_exception();
+    }
+}
+
+bool IThreadPool::addDependencies(const std::shared_ptr<Task> &task, const std::vector<std::shared_ptr<Task>> &dependencies) {
+    for (auto &dependency : dependencies) {
+        if (!dependency) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(dependency->_mutex);
+        if (dependency->_done) {
+            continue;
+        }
+        dependency->_dependents.push_back(task);
+        ++task->_numPendingDeps;
+    }
+    return --task->_numPendingDeps == 0;
+}
+
+std::vector<std::shared_ptr<Task>> IThreadPool::runTask(Task &task) {
+    task();
+
+    std::vector<std::shared_ptr<Task>> dependents;
+    {
+        std::lock_guard<std::mutex> lock(task._mutex);
+        task._done = true;
+        dependents.swap(task._dependents);
+    }
+    task._doneCondVar.notify_all();
+
+    std::vector<std::shared_ptr<Task>> ready;
+    for (auto &dependent : dependents) {
+        if (--dependent->_numPendingDeps == 0) {
+            ready.push_back(std::move(dependent));
+        }
+    }
+    return ready;
+}
+
 void ThreadPool::init() {
     if (_numThreads == -1) {
         _numThreads = static_cast<int>(std::thread::hardware_concurrency());
     }
     _running = true;
     for (auto i = 0; i < _numThreads; ++i) {
-        _threads.emplace_back(std::bind(&ThreadPool::workerThreadFunc, this));
+        _workerQueues.push_back(std::make_unique<Queues>());
+    }
+    for (auto i = 0; i < _numThreads; ++i) {
+        _threads.emplace_back(std::bind(&ThreadPool::workerThreadFunc, this, i));
     }
 }
 
 void ThreadPool::deinit() {
     {
-        std::lock_guard<std::mutex> lock(_mutex);
+        std::lock_guard<std::mutex> lock(_idleMutex);
         _running = false;
     }
-    _condVar.notify_all();
+    _idleCondVar.notify_all();
 
     for (auto &thread : _threads) {
         if (thread.joinable()) {
@@ -42,6 +107,153 @@ void ThreadPool::deinit() {
         }
     }
     _threads.clear();
+    _workerQueues.clear();
+}
+
+std::shared_ptr<Task> ThreadPool::enqueue(TaskFunc func, JobPriority priority, const std::vector<std::shared_ptr<Task>> &dependencies) {
+    auto task = std::make_shared<Task>(std::move(func), priority);
+    if (addDependencies(task, dependencies)) {
+        schedule(task);
+    }
+    return task;
+}
+
+void ThreadPool::wait(Task &task) {
+    while (!task.isDone()) {
+        if (runNext()) {
+            continue;
+        }
+        task.waitFor(kHelpWaitTimeout);
+    }
+    task.wait();
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grain, const RangeFunc &func, JobPriority priority) {
+    if (begin >= end) {
+        return;
+    }
+    size_t count = end - begin;
+    if (grain == 0) {
+        grain = std::max<size_t>(1, count / (std::max<size_t>(1, _threads.size()) * kRangesPerThread));
+    }
+    if (count <= grain || _threads.empty()) {
+        for (size_t rangeBegin = begin; rangeBegin < end; rangeBegin += std::min(grain, end - rangeBegin)) {
+            func(rangeBegin, rangeBegin + std::min(grain, end - rangeBegin));
+        }
+        return;
+    }
+
+    // Calling thread processes the first range itself, then helps with the
+    // rest while waiting
+    std::vector<std::shared_ptr<Task>> tasks;
+    tasks.reserve(count / grain);
+    for (size_t rangeBegin = begin + grain; rangeBegin < end; rangeBegin += grain) {
+        size_t rangeEnd = rangeBegin + std::min(grain, end - rangeBegin);
+        tasks.push_back(enqueue([&func, rangeBegin, rangeEnd](auto &) { func(rangeBegin, rangeEnd); }, priority));
+    }
+    std::exception_ptr error;
+    try {
+        func(begin, begin + grain);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto &task : tasks) {
+        try {
+            wait(*task);
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::workerThreadFunc(int workerIdx) {
+    tlsPool = this;
+    tlsWorkerIdx = workerIdx;
+    while (_running) {
+        if (runNext()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(_idleMutex);
+        _idleCondVar.wait(lock, [this]() { return !_running || _numQueued > 0; });
+    }
+}
+
+void ThreadPool::schedule(std::shared_ptr<Task> task) {
+    auto &queues = (tlsPool == this) ? *_workerQueues[tlsWorkerIdx] : _sharedQueues;
+    auto priority = static_cast<int>(task->priority());
+    {
+        std::lock_guard<std::mutex> lock(queues.mutex);
+        queues.jobs[priority].push_back(std::move(task));
+    }
+    ++_numQueued;
+    {
+        // Synchronize with idle workers, so that the notification is not lost
+        std::lock_guard<std::mutex> lock(_idleMutex);
+    }
+    _idleCondVar.notify_one();
+}
+
+void ThreadPool::execute(Task &task) {
+    for (auto &dependent : runTask(task)) {
+        schedule(std::move(dependent));
+    }
+}
+
+bool ThreadPool::runNext() {
+    if (_numQueued == 0) {
+        return false;
+    }
+    int ownIdx = (tlsPool == this) ? tlsWorkerIdx : -1;
+    int numWorkers = static_cast<int>(_workerQueues.size());
+    for (int priority = 0; priority < kNumJobPriorities; ++priority) {
+        std::shared_ptr<Task> task;
+        if (ownIdx != -1) {
+            task = popOwn(ownIdx, priority);
+        }
+        if (!task) {
+            task = steal(_sharedQueues, priority);
+        }
+        for (int i = 1; !task && i <= numWorkers; ++i) {
+            int victimIdx = (ownIdx + i) % numWorkers;
+            if (victimIdx != ownIdx) {
+                task = steal(*_workerQueues[victimIdx], priority);
+            }
+        }
+        if (task) {
+            --_numQueued;
+            execute(*task);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<Task> ThreadPool::popOwn(int workerIdx, int priority) {
+    auto &queues = *_workerQueues[workerIdx];
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    auto &jobs = queues.jobs[priority];
+    if (jobs.empty()) {
+        return nullptr;
+    }
+    auto task = std::move(jobs.back());
+    jobs.pop_back();
+    return task;
+}
+
+std::shared_ptr<Task> ThreadPool::steal(Queues &queues, int priority) {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    auto &jobs = queues.jobs[priority];
+    if (jobs.empty()) {
+        return nullptr;
+    }
+    auto task = std::move(jobs.front());
+    jobs.pop_front();
+    return task;
 }
 
 } // namespace reone
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/trace.h"
+
+#include "reone/system/stringutil.h"
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+struct ThreadBufferCache {
+    uint32_t recorderId {0};
+    void *buffer {nullptr};
+};
+
+static std::atomic<uint32_t> g_nextRecorderId {1};
+static thread_local ThreadBufferCache g_threadBufferCache;
+
+TraceRecorder TraceRecorder::instance;
+
+TraceRecorder::TraceRecorder(size_t eventsPerThread) :
+    _eventsPerThread(eventsPerThread),
+    _id(g_nextRecorderId++),
+    _epoch(std::chrono::steady_clock::now()) {
+    if (eventsPerThread == 0) {
+        throw std::invalid_argument("eventsPerThread must not be zero");
+    }
+}
+
+void TraceRecorder::recordZone(const char *name, uint64_t start, uint64_t end, uint32_t frame) {
+    TraceEvent event;
+    event.type = TraceEventType::Zone;
+    event.name = name;
+    event.timestamp = start;
+    event.duration = end - start;
+    event.frame = frame;
+    record(event);
+}
+
+void TraceRecorder::recordCounter(const char *name, int64_t value) {
+    TraceEvent event;
+    event.type = TraceEventType::Counter;
+    event.name = name;
+    event.timestamp = now();
+    event.value = value;
+    event.frame = this->frame();
+    record(event);
+}
+
+void TraceRecorder::markFrame() {
+    uint32_t frame = ++_frame;
+    if (!isEnabled()) {
+        return;
+    }
+    TraceEvent event;
+    event.type = TraceEventType::Frame;
+    event.name = "frame";
+    event.timestamp = now();
+    event.value = frame;
+    event.frame = frame;
+    record(event);
+}
+
+void TraceRecorder::record(const TraceEvent &event) {
+    auto &buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock {buffer.mutex};
+    auto &slot = buffer.events[buffer.next];
+    slot = event;
+    buffer.next = (buffer.next + 1) % _eventsPerThread;
+    buffer.size = std::min(buffer.size + 1, _eventsPerThread);
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::threadBuffer() {
+    auto &cache = g_threadBufferCache;
+    if (cache.recorderId == _id) {
+        return *static_cast<ThreadBuffer *>(cache.buffer);
+    }
+    auto threadId = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock {_threadsMutex};
+    auto it = std::find_if(_threads.begin(), _threads.end(), [&threadId](auto &buffer) {
+        return buffer.threadId == threadId;
+    });
+    ThreadBuffer *buffer;
+    if (it != _threads.end()) {
+        buffer = &*it;
+    } else {
+        buffer = &_threads.emplace_back();
+        buffer->threadId = threadId;
+        buffer->id = static_cast<uint32_t>(_threads.size());
+        buffer->name = threadName();
+        buffer->events.resize(_eventsPerThread);
+    }
+    cache.recorderId = _id;
+    cache.buffer = buffer;
+    return *buffer;
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock {_threadsMutex};
+    for (auto &buffer : _threads) {
+        std::lock_guard<std::mutex> bufferLock {buffer.mutex};
+        buffer.next = 0;
+        buffer.size = 0;
+    }
+}
+
+std::vector<TraceEvent> TraceRecorder::takeEvents() {
+    std::vector<TraceEvent> events;
+    std::lock_guard<std::mutex> lock {_threadsMutex};
+    for (auto &buffer : _threads) {
+        std::lock_guard<std::mutex> bufferLock {buffer.mutex};
+        size_t begin = (buffer.next + _eventsPerThread - buffer.size) % _eventsPerThread;
+        for (size_t i = 0; i < buffer.size; ++i) {
+            events.push_back(buffer.events[(begin + i) % _eventsPerThread]);
+        }
+        buffer.next = 0;
+        buffer.size = 0;
+    }
+    return events;
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream &stream,
+                                     std::optional<std::pair<uint32_t, uint32_t>> frames) {
+    static constexpr int kPid = 1;
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto beginEvent = [&stream, &first](const char *name, const char *phase, uint64_t timestamp, uint32_t tid) {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "{\"name\":";
+        stream << string_json_quote(name);
+        stream << ",\"ph\":\"" << phase << "\",\"ts\":" << timestamp << ",\"pid\":" << kPid << ",\"tid\":" << tid;
+    };
+
+    std::lock_guard<std::mutex> lock {_threadsMutex};
+    for (auto &buffer : _threads) {
+        std::lock_guard<std::mutex> bufferLock {buffer.mutex};
+
+        beginEvent("thread_name", "M", 0, buffer.id);
+        stream << ",\"args\":{\"name\":";
+        stream << string_json_quote(buffer.name.empty() ? "thread " + std::to_string(buffer.id) : buffer.name);
+        stream << "}}";
+
+        size_t begin = (buffer.next + _eventsPerThread - buffer.size) % _eventsPerThread;
+        for (size_t i = 0; i < buffer.size; ++i) {
+            auto &event = buffer.events[(begin + i) % _eventsPerThread];
+            if (frames && (event.frame < frames->first || event.frame > frames->second)) {
+                continue;
+            }
+            switch (event.type) {
+            case TraceEventType::Zone:
+                beginEvent(event.name, "X", event.timestamp, buffer.id);
+                stream << ",\"dur\":" << event.duration << ",\"args\":{\"frame\":" << event.frame << "}}";
+                break;
+            case TraceEventType::Counter:
+                beginEvent(event.name, "C", event.timestamp, buffer.id);
+                stream << ",\"args\":{\"value\":" << event.value << "}}";
+                break;
+            case TraceEventType::Frame:
+                beginEvent(event.name, "i", event.timestamp, buffer.id);
+                stream << ",\"s\":\"g\",\"args\":{\"frame\":" << event.value << "}}";
+                break;
+            }
+        }
+    }
+    stream << "\n]}\n";
+}
+
+void TraceRecorder::saveChromeTrace(const std::filesystem::path &path,
+                                    std::optional<std::pair<uint32_t, uint32_t>> frames) {
+    std::ofstream stream {path};
+    if (!stream) {
+        throw std::runtime_error("Failed to open trace file: " + path.string());
+    }
+    writeChromeTrace(stream, std::move(frames));
+}
+
+} // namespace reone
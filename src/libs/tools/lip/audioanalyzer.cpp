@@ -23,31 +23,71 @@ using namespace reone::audio;
 
 namespace reone {
 
+static constexpr float kSilenceStep = 0.001f;
+static constexpr int kNumLanes = 8;
+static constexpr int kEnvelopeBlockSize = 1024;
+
+/**
+ * Finds a frame, whose span contains the specified time. Frame spans are
+ * contiguous, so given non-decreasing times the cursor only moves forward.
+ *
+ * @return frame index, or -1 if no frame contains the time
+ */
+static int findFrame(const std::vector<TimeSpan> &frameSpans, float time, size_t &cursor) {
+    while (cursor < frameSpans.size() && frameSpans[cursor].endExclusive <= time) {
+        ++cursor;
+    }
+    if (cursor == frameSpans.size() || !frameSpans[cursor].contains(time)) {
+        return -1;
+    }
+    return static_cast<int>(cursor);
+}
+
+/**
+ * Accumulates sum of squares and peak of absolute values. Independent lanes
+ * let the compiler vectorise the loop without reassociating float sums.
+ */
+static void accumulateEnvelope(const float *samples, size_t count, float &sumSquares, float &peak) {
+    float laneSums[kNumLanes] {0.0f};
+    float lanePeaks[kNumLanes] {0.0f};
+    size_t i = 0;
+    for (; i + kNumLanes <= count; i += kNumLanes) {
+        for (int lane = 0; lane < kNumLanes; ++lane) {
+            float sample = samples[i + lane];
+            laneSums[lane] += sample * sample;
+            lanePeaks[lane] = std::max(lanePeaks[lane], std::fabs(sample));
+        }
+    }
+    for (; i < count; ++i) {
+        laneSums[0] += samples[i] * samples[i];
+        lanePeaks[0] = std::max(lanePeaks[0], std::fabs(samples[i]));
+    }
+    for (int lane = 0; lane < kNumLanes; ++lane) {
+        sumSquares += laneSums[lane];
+        peak = std::max(peak, lanePeaks[lane]);
+    }
+}
+
 std::vector<TimeSpan> AudioAnalyzer::silentSpans(const AudioClip &clip,
                                                  float minSilenceDuration,
                                                  float maxSilenceAmplitude) {
+    auto env = envelope(clip, kSilenceStep);
+
+    // Silence detection
     std::vector<TimeSpan> silentSpans;
-    auto frameSpans = computeFrameSpans(clip);
     float silenceStart = 0.0f;
     bool silentSpan = false;
-    for (float t = 0.0f; t < clip.duration(); t += 0.001f) {
-        for (int i = 0; i < clip.getFrameCount(); ++i) {
-            if (!frameSpans[i].contains(t)) {
-                continue;
-            }
-            float sampleTime = t - frameSpans[i].startInclusive;
-            float sample = sampleNormalized(clip.getFrame(i), sampleTime);
-            bool silent = std::fabs(sample) <= maxSilenceAmplitude;
-            if (silent && !silentSpan) {
-                silenceStart = t;
-                silentSpan = true;
-            } else if (!silent && silentSpan) {
-                if (t - silenceStart >= minSilenceDuration) {
-                    silentSpans.push_back(TimeSpan {silenceStart, t});
-                }
-                silentSpan = false;
+    for (size_t i = 0; i < env.peak.size(); ++i) {
+        float t = i * kSilenceStep;
+        bool silent = env.peak[i] <= maxSilenceAmplitude;
+        if (silent && !silentSpan) {
+            silenceStart = t;
+            silentSpan = true;
+        } else if (!silent && silentSpan) {
+            if (t - silenceStart >= minSilenceDuration) {
+                silentSpans.push_back(TimeSpan {silenceStart, t});
             }
-            break;
+            silentSpan = false;
         }
     }
     if (silentSpan && clip.duration() - silenceStart >= minSilenceDuration) {
@@ -59,22 +99,70 @@ std::vector<TimeSpan> AudioAnalyzer::silentSpans(const AudioClip &clip,
 std::vector<float> AudioAnalyzer::waveform(const AudioClip &clip, int resolution) {
     auto frameSpans = computeFrameSpans(clip);
     std::vector<float> waveform;
+    waveform.reserve(resolution);
+    size_t cursor = 0;
     for (int x = 0; x < resolution; ++x) {
         float waveformTime = (x / static_cast<float>(resolution)) * clip.duration();
-        for (int i = 0; i < clip.getFrameCount(); ++i) {
-            if (!frameSpans[i].contains(waveformTime)) {
-                continue;
-            }
-            float sampleTime = waveformTime - frameSpans[i].startInclusive;
-            waveform.push_back(sampleNormalized(clip.getFrame(i), sampleTime));
-            break;
+        int frameIdx = findFrame(frameSpans, waveformTime, cursor);
+        if (frameIdx == -1) {
+            continue;
         }
+        float sampleTime = waveformTime - frameSpans[frameIdx].startInclusive;
+        waveform.push_back(sampleNormalized(clip.getFrame(frameIdx), sampleTime));
     }
     return waveform;
 }
 
+AudioAnalyzer::Envelope AudioAnalyzer::envelope(const AudioClip &clip, float windowDuration) {
+    if (windowDuration <= 0.0f) {
+        throw std::invalid_argument("windowDuration must be greater than zero");
+    }
+    auto numWindows = static_cast<size_t>(std::ceil(clip.duration() / windowDuration));
+    Envelope envelope;
+    envelope.windowDuration = windowDuration;
+    envelope.peak.resize(numWindows, 0.0f);
+    envelope.rms.resize(numWindows, 0.0f);
+    if (numWindows == 0) {
+        return envelope;
+    }
+    std::vector<float> sumSquares(numWindows, 0.0f);
+    std::vector<int> sampleCounts(numWindows, 0);
+    std::vector<float> block(kEnvelopeBlockSize);
+
+    auto frameSpans = computeFrameSpans(clip);
+    for (int i = 0; i < clip.getFrameCount(); ++i) {
+        const auto &frame = clip.getFrame(i);
+        float frameStart = frameSpans[i].startInclusive;
+        int numSamples = static_cast<int>(frame.samples.size() / frame.stride());
+        int sampleIdx = 0;
+        while (sampleIdx < numSamples) {
+            float time = frameStart + sampleIdx / static_cast<float>(frame.sampleRate);
+            size_t window = std::min(static_cast<size_t>(time / windowDuration), numWindows - 1);
+            float windowEnd = (window + 1) * windowDuration;
+            int windowEndIdx = static_cast<int>(std::ceil((windowEnd - frameStart) * frame.sampleRate));
+            int count = std::min({numSamples, windowEndIdx, sampleIdx + kEnvelopeBlockSize}) - sampleIdx;
+            count = std::max(count, 1);
+            normalizeSamples(frame, sampleIdx, count, &block[0]);
+            accumulateEnvelope(&block[0], count, sumSquares[window], envelope.peak[window]);
+            sampleCounts[window] += count;
+            sampleIdx += count;
+        }
+    }
+    for (size_t i = 0; i < numWindows; ++i) {
+        if (sampleCounts[i] > 0) {
+            envelope.rms[i] = std::sqrt(sumSquares[i] / sampleCounts[i]);
+        } else if (i > 0) {
+            // Window is shorter than sample period: hold preceding amplitude
+            envelope.peak[i] = envelope.peak[i - 1];
+            envelope.rms[i] = envelope.rms[i - 1];
+        }
+    }
+    return envelope;
+}
+
 std::vector<TimeSpan> AudioAnalyzer::computeFrameSpans(const AudioClip &clip) {
     std::vector<TimeSpan> spans;
+    spans.reserve(clip.getFrameCount());
     float time = 0.0f;
     for (int i = 0; i < clip.getFrameCount(); ++i) {
         const auto &frame = clip.getFrame(i);
@@ -90,15 +178,41 @@ float AudioAnalyzer::sampleNormalized(const AudioClip::Frame &frame, float time)
     if (sampleIdx >= frame.samples.size() / frame.stride()) {
         sampleIdx = frame.samples.size() / frame.stride() - 1;
     }
+    float sample;
+    normalizeSamples(frame, sampleIdx, 1, &sample);
+    return sample;
+}
+
+void AudioAnalyzer::normalizeSamples(const AudioClip::Frame &frame, int sampleIdx, int count, float *samples) {
     switch (frame.format) {
-    case AudioFormat::Mono8:
-        return reinterpret_cast<const uint8_t *>(&frame.samples[0])[sampleIdx] / 255.0f * 2.0f - 1.0f;
-    case AudioFormat::Mono16:
-        return reinterpret_cast<const int16_t *>(&frame.samples[0])[sampleIdx] / 65535.0f * 2.0f;
-    case AudioFormat::Stereo8:
-        return reinterpret_cast<const uint8_t *>(&frame.samples[0])[2 * sampleIdx] / 255.0f * 2.0f - 1.0f;
-    case AudioFormat::Stereo16:
-        return reinterpret_cast<const int16_t *>(&frame.samples[0])[2 * sampleIdx] / 65535.0f * 2.0f;
+    case AudioFormat::Mono8: {
+        auto src = reinterpret_cast<const uint8_t *>(&frame.samples[0]) + sampleIdx;
+        for (int i = 0; i < count; ++i) {
+            samples[i] = src[i] / 255.0f * 2.0f - 1.0f;
+        }
+        break;
+    }
+    case AudioFormat::Mono16: {
+        auto src = reinterpret_cast<const int16_t *>(&frame.samples[0]) + sampleIdx;
+        for (int i = 0; i < count; ++i) {
+            samples[i] = src[i] / 65535.0f * 2.0f;
+        }
+        break;
+    }
+    case AudioFormat::Stereo8: {
+        auto src = reinterpret_cast<const uint8_t *>(&frame.samples[0]) + 2 * sampleIdx;
+        for (int i = 0; i < count; ++i) {
+            samples[i] = src[2 * i] / 255.0f * 2.0f - 1.0f;
+        }
+        break;
+    }
+    case AudioFormat::Stereo16: {
+        auto src = reinterpret_cast<const int16_t *>(&frame.samples[0]) + 2 * sampleIdx;
+        for (int i = 0; i < count; ++i) {
+            samples[i] = src[2 * i] / 65535.0f * 2.0f;
+        }
+        break;
+    }
     default:
         throw std::logic_error("Unsupported audio format: " + std::to_string(static_cast<int>(frame.format)));
     }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/tools/lip/batchcomposer.h"
+
+#include "reone/audio/clip.h"
+#include "reone/audio/format/mp3reader.h"
+#include "reone/audio/format/wavreader.h"
+#include "reone/graphics/lipanimation.h"
+#include "reone/system/stream/fileinput.h"
+
+using namespace reone::audio;
+using namespace reone::graphics;
+
+namespace reone {
+
+static std::shared_ptr<AudioClip> loadAudioClip(const std::filesystem::path &path) {
+    auto lowerExt = boost::to_lower_copy(path.extension().string());
+    auto stream = FileInputStream(path);
+    if (lowerExt == ".wav") {
+        auto mp3ReaderFactory = Mp3ReaderFactory();
+        auto reader = WavReader(stream, mp3ReaderFactory);
+        reader.load();
+        return reader.stream();
+    } else if (lowerExt == ".mp3") {
+        auto reader = Mp3Reader();
+        reader.load(stream);
+        return reader.stream();
+    } else {
+        throw std::invalid_argument("Unsupported audio file: " + path.string());
+    }
+}
+
+static std::string readText(const std::filesystem::path &path) {
+    auto stream = FileInputStream(path);
+    auto length = stream.length();
+    auto text = std::string(length, '\0');
+    stream.read(&text[0], length);
+    boost::trim(text);
+    return text;
+}
+
+std::vector<LipBatchComposer::Result> LipBatchComposer::compose(const std::vector<Line> &lines, ProgressCallback progress) {
+    std::vector<Result> results(lines.size());
+
+    Progress state;
+    state.numLines = static_cast<int>(lines.size());
+    std::mutex mutex;
+    std::condition_variable condVar;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < lines.size(); ++i) {
+        // Each task writes to its own result, so that order of completion
+        // does not affect the output
+        _threadPool.enqueue([this, &lines, &results, &state, &mutex, &condVar, i](auto & /* canceled */) {
+            results[i] = composeLine(lines[i]);
+            // Notify under lock, so that the waiting thread cannot return and
+            // destroy the condition variable in between
+            std::lock_guard<std::mutex> lock {mutex};
+            if (results[i].error.empty()) {
+                ++state.numComposed;
+            } else {
+                ++state.numFailed;
+            }
+            condVar.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock {mutex};
+    int numReported = -1;
+    while (true) {
+        condVar.wait(lock, [&]() { return state.numComposed + state.numFailed != numReported; });
+        numReported = state.numComposed + state.numFailed;
+        if (progress) {
+            state.elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+            progress(state);
+        }
+        if (numReported == state.numLines) {
+            break;
+        }
+    }
+    return results;
+}
+
+LipBatchComposer::Result LipBatchComposer::composeLine(const Line &line) {
+    auto result = Result();
+    result.name = line.name;
+    try {
+        auto clip = loadAudioClip(line.audioPath);
+        auto analyzer = AudioAnalyzer();
+        auto silentSpans = analyzer.silentSpans(*clip, _minSilenceDuration, _maxSilenceAmplitude);
+        auto composer = LipComposer(_dict);
+        result.animation = composer.compose(line.name, line.text, clip->duration(), std::move(silentSpans));
+    } catch (const std::exception &ex) {
+        result.error = ex.what();
+    }
+    return result;
+}
+
+std::vector<LipBatchComposer::Line> LipBatchComposer::findLines(const std::filesystem::path &dir) {
+    std::vector<Line> lines;
+    for (auto &entry : std::filesystem::directory_iterator(dir)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        auto &path = entry.path();
+        auto lowerExt = boost::to_lower_copy(path.extension().string());
+        if (lowerExt != ".wav" && lowerExt != ".mp3") {
+            continue;
+        }
+        auto textPath = path;
+        textPath.replace_extension(".txt");
+        if (!std::filesystem::exists(textPath)) {
+            continue;
+        }
+        auto line = Line();
+        line.name = path.stem().string();
+        line.audioPath = path;
+        line.text = readText(textPath);
+        lines.push_back(std::move(line));
+    }
+    std::sort(lines.begin(), lines.end(), [](auto &lhs, auto &rhs) { return lhs.name < rhs.name; });
+    return lines;
+}
+
+} // namespace reone
@@ -98,10 +98,51 @@ void PronouncingDictionary::load(IInputStream &stream) {
         for (auto &token : tokens) {
             boost::to_lower(token);
         }
-        _wordToPhonemes.insert({std::move(word), std::move(tokens)});
+        add(word, tokens);
     }
 }
 
+void PronouncingDictionary::add(const std::string &word, const std::vector<std::string> &phonemes) {
+    if (_wordToPhonemes.count(word) > 0) {
+        return;
+    }
+    auto range = PhonemeRange {static_cast<uint32_t>(_phonemeIndices.size()), static_cast<uint32_t>(phonemes.size())};
+    for (const auto &phoneme : phonemes) {
+        auto maybeIndex = _phonemeToIndex.find(phoneme);
+        if (maybeIndex != _phonemeToIndex.end()) {
+            _phonemeIndices.push_back(maybeIndex->second);
+            continue;
+        }
+        if (_phonemes.size() > std::numeric_limits<uint16_t>::max()) {
+            throw std::overflow_error("Too many distinct phonemes");
+        }
+        auto index = static_cast<uint16_t>(_phonemes.size());
+        _phonemes.push_back(phoneme);
+        _phonemeToIndex[phoneme] = index;
+        _phonemeIndices.push_back(index);
+    }
+    _wordToPhonemes.insert({word, range});
+}
+
+std::vector<std::string> PronouncingDictionary::phonemes(const std::string &word) const {
+    auto codePoints = codePointsFromUTF8(word);
+    for (auto &cp : codePoints) {
+        cp = codePointToLower(cp);
+    }
+    auto lowerWord = utf8FromCodePoints(codePoints);
+    auto maybeRange = _wordToPhonemes.find(lowerWord);
+    if (maybeRange == _wordToPhonemes.end()) {
+        throw WordPhonemesNotFoundException(lowerWord);
+    }
+    const auto &range = maybeRange->second;
+    std::vector<std::string> phonemes;
+    phonemes.reserve(range.count);
+    for (uint32_t i = 0; i < range.count; ++i) {
+        phonemes.push_back(_phonemes[_phonemeIndices[range.offset + i]]);
+    }
+    return phonemes;
+}
+
 std::unique_ptr<LipAnimation> LipComposer::compose(const std::string &name,
                                                    const std::string &u8Text,
                                                    float duration,
@@ -134,7 +175,7 @@ std::unique_ptr<LipAnimation> LipComposer::compose(const std::string &name,
                 groupPhonemeShapes.push_back(LipShape::Neutral);
                 continue;
             }
-            auto wordPhonemes = _dict.phonemes(word);
+            auto wordPhonemes = _dict->phonemes(word);
             for (const auto &phoneme : wordPhonemes) {
                 auto phonemeCopy = phoneme;
                 if (std::isdigit((*phonemeCopy.rbegin()))) {
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/audio/clip.h"
+#include "reone/audio/decoder.h"
+#include "reone/audio/format/mp3reader.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stringbuilder.h"
+
+using namespace reone;
+using namespace reone::audio;
+
+static std::string silentMp3(int numFrames) {
+    auto builder = StringBuilder();
+    for (int i = 0; i < numFrames; ++i) {
+        // MPEG-1 Layer III, 128 kbps, 44100 Hz, mono, 417 bytes
+        builder
+            .append("\xff\xfb\x90\xc0", 4) // header
+            .append('\x00', 413);          // side info and main data
+    }
+    return builder.string();
+}
+
+static ByteBuffer decodeAll(const AudioClip &clip, size_t chunkSize, AudioFormat &format, int &sampleRate) {
+    ByteBuffer pcm;
+    auto decoder = clip.createDecoder();
+    AudioClip::Frame chunk;
+    while (decoder->decode(chunk, chunkSize)) {
+        EXPECT_LE(chunk.samples.size(), chunkSize);
+        format = chunk.format;
+        sampleRate = chunk.sampleRate;
+        pcm.insert(pcm.end(), chunk.samples.begin(), chunk.samples.end());
+        chunk.samples.clear();
+    }
+    return pcm;
+}
+
+TEST(Mp3Reader, should_decode_streaming_clip_equivalent_to_whole_file_clip) {
+    // given
+    auto mp3Bytes = silentMp3(8);
+    auto mp3 = MemoryInputStream(mp3Bytes);
+    auto wholeReader = Mp3Reader();
+    wholeReader.load(mp3);
+    auto wholeClip = wholeReader.stream();
+
+    auto streamingMp3 = MemoryInputStream(mp3Bytes);
+    auto streamingReader = Mp3Reader(true);
+
+    // when
+    streamingReader.load(streamingMp3);
+
+    // then
+    auto streamingClip = streamingReader.stream();
+    EXPECT_FALSE(wholeClip->isStreaming());
+    EXPECT_TRUE(streamingClip->isStreaming());
+    EXPECT_EQ(0, streamingClip->getFrameCount());
+    ASSERT_GT(wholeClip->getFrameCount(), 0);
+    ByteBuffer expectedPcm;
+    for (int i = 0; i < wholeClip->getFrameCount(); ++i) {
+        auto &frame = wholeClip->getFrame(i);
+        EXPECT_EQ(static_cast<int>(AudioFormat::Mono16), static_cast<int>(frame.format));
+        EXPECT_EQ(44100, frame.sampleRate);
+        expectedPcm.insert(expectedPcm.end(), frame.samples.begin(), frame.samples.end());
+    }
+    auto format = AudioFormat::Stereo8;
+    int sampleRate = 0;
+    auto pcm = decodeAll(*streamingClip, 4096, format, sampleRate);
+    EXPECT_EQ(static_cast<int>(AudioFormat::Mono16), static_cast<int>(format));
+    EXPECT_EQ(44100, sampleRate);
+    EXPECT_EQ(expectedPcm, pcm);
+    EXPECT_NEAR(wholeClip->duration(), streamingClip->duration(), 1152 / 44100.0f);
+}
+
+TEST(Mp3Reader, should_rewind_streaming_decoder) {
+    // given
+    auto mp3Bytes = silentMp3(4);
+    auto mp3 = MemoryInputStream(mp3Bytes);
+    auto reader = Mp3Reader(true);
+    reader.load(mp3);
+    auto decoder = reader.stream()->createDecoder();
+    AudioClip::Frame chunk;
+    size_t numBytes = 0;
+    while (decoder->decode(chunk, 1000)) {
+        numBytes += chunk.samples.size();
+        chunk.samples.clear();
+    }
+
+    // when
+    decoder->rewind();
+
+    // then
+    size_t numBytesRewound = 0;
+    while (decoder->decode(chunk, 1000)) {
+        EXPECT_EQ(0u, chunk.samples.size() % 2);
+        numBytesRewound += chunk.samples.size();
+        chunk.samples.clear();
+    }
+    EXPECT_GT(numBytes, 0u);
+    EXPECT_EQ(numBytes, numBytesRewound);
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/audio/clip.h"
+#include "reone/audio/mixer.h"
+#include "reone/audio/options.h"
+
+#include "../fixtures/audio.h"
+
+using namespace reone;
+using namespace reone::audio;
+
+static std::shared_ptr<AudioClip> makeClip(int numFrames, int frameSize = 2304) {
+    auto clip = std::make_shared<AudioClip>();
+    for (int i = 0; i < numFrames; ++i) {
+        AudioClip::Frame frame;
+        frame.format = AudioFormat::Mono16;
+        frame.sampleRate = 44100;
+        frame.samples.resize(frameSize);
+        clip->add(std::move(frame));
+    }
+    return clip;
+}
+
+template <class Predicate>
+static bool waitUntil(Predicate pred) {
+    for (int i = 0; i < 10; ++i) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 << i));
+    }
+    return pred();
+}
+
+TEST(AudioMixer, should_start_sources_on_update) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+
+    // when
+    auto source = mixer.play(makeClip(50), AudioType::Music);
+    bool createdBeforeUpdate = !backend.sourceNames().empty();
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_FALSE(createdBeforeUpdate);
+    EXPECT_TRUE(source->isPlaying());
+    auto names = backend.sourceNames();
+    ASSERT_EQ(1ll, names.size());
+    EXPECT_TRUE(backend.source(names[0]).playing);
+}
+
+TEST(AudioMixer, should_reuse_sources_of_finished_voices) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto first = mixer.play(makeClip(1), AudioType::Sound);
+    mixer.update(0.0f);
+    backend.process();
+    mixer.update(0.0f);
+
+    // when
+    auto second = mixer.play(makeClip(1), AudioType::Sound);
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_FALSE(first->isPlaying());
+    EXPECT_TRUE(second->isPlaying());
+    EXPECT_EQ(1, backend.numCreatedSources());
+    EXPECT_EQ(1, mixer.numRealVoices());
+}
+
+TEST(AudioMixer, should_stop_sources_of_type) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto music = mixer.play(makeClip(50), AudioType::Music);
+    auto sound = mixer.play(makeClip(50), AudioType::Sound);
+    mixer.update(0.0f);
+
+    // when
+    mixer.stop(AudioType::Music);
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_FALSE(music->isPlaying());
+    EXPECT_TRUE(sound->isPlaying());
+}
+
+TEST(AudioMixer, should_refill_buffers_on_audio_thread) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    mixer.init();
+    auto source = mixer.play(makeClip(50), AudioType::Music);
+    bool started = waitUntil([&backend]() {
+        auto names = backend.sourceNames();
+        return !names.empty() && backend.source(names[0]).playing;
+    });
+    int numUploads = backend.numUploads();
+
+    // when
+    backend.process(2);
+    mixer.render();
+    bool refilled = waitUntil([&backend, &numUploads]() {
+        return backend.numUploads() == numUploads + 2;
+    });
+    mixer.deinit();
+
+    // then
+    EXPECT_TRUE(started);
+    EXPECT_EQ(4, numUploads);
+    EXPECT_TRUE(refilled);
+    EXPECT_FALSE(source->isPlaying());
+}
+
+TEST(AudioMixer, should_limit_voices_per_type) {
+    // given
+    auto options = AudioOptions();
+    options.maxSoundVoices = 2;
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    for (int i = 0; i < 3; ++i) {
+        mixer.play(makeClip(50), AudioType::Sound);
+    }
+    mixer.play(makeClip(50), AudioType::Music);
+
+    // when
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_EQ(3ll, backend.playingSourceNames().size());
+    EXPECT_EQ(3, mixer.numRealVoices());
+    EXPECT_EQ(1, mixer.numVirtualVoices());
+}
+
+TEST(AudioMixer, should_steal_voice_of_lower_priority) {
+    // given
+    auto options = AudioOptions();
+    options.maxSoundVoices = 1;
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto footstep = mixer.play(makeClip(50), AudioType::Sound, 1.0f, false, std::nullopt, AudioPriority::Low);
+    mixer.update(0.0f);
+
+    // when
+    auto scream = mixer.play(makeClip(50), AudioType::Sound, 0.5f, false, std::nullopt, AudioPriority::Normal);
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_TRUE(footstep->isPlaying());
+    EXPECT_TRUE(scream->isPlaying());
+    EXPECT_EQ(1ll, backend.playingSourceNames().size());
+    EXPECT_EQ(1, mixer.numRealVoices());
+    EXPECT_EQ(1, mixer.numVirtualVoices());
+    EXPECT_EQ(1, backend.numCreatedSources());
+}
+
+TEST(AudioMixer, should_prefer_voices_closer_to_listener) {
+    // given
+    auto options = AudioOptions();
+    options.maxSoundVoices = 1;
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    mixer.setListenerPosition(glm::vec3(10.0f, 0.0f, 0.0f));
+    mixer.play(makeClip(50), AudioType::Sound, 1.0f, false, glm::vec3(0.0f, 0.0f, 0.0f));
+    mixer.play(makeClip(50), AudioType::Sound, 1.0f, false, glm::vec3(12.0f, 0.0f, 0.0f));
+
+    // when
+    mixer.update(0.0f);
+
+    // then
+    auto names = backend.playingSourceNames();
+    ASSERT_EQ(1ll, names.size());
+    EXPECT_EQ(glm::vec3(12.0f, 0.0f, 0.0f), backend.source(names[0]).position);
+}
+
+TEST(AudioMixer, should_virtualize_inaudible_voices) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+
+    // when
+    auto source = mixer.play(makeClip(50), AudioType::Sound, 1.0f, true, glm::vec3(1000.0f, 0.0f, 0.0f));
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_TRUE(source->isPlaying());
+    EXPECT_TRUE(backend.sourceNames().empty());
+    EXPECT_EQ(0, mixer.numRealVoices());
+    EXPECT_EQ(1, mixer.numVirtualVoices());
+}
+
+TEST(AudioMixer, should_resume_virtual_voice_from_elapsed_time) {
+    // given
+    auto options = AudioOptions();
+    options.maxSoundVoices = 1;
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto ambient = mixer.play(makeClip(1, 88200), AudioType::Sound, 1.0f, true); // 1 second
+    mixer.update(0.0f);
+    auto scream = mixer.play(makeClip(50), AudioType::Sound, 1.0f, false, std::nullopt, AudioPriority::High);
+    mixer.update(0.5f);
+
+    // when
+    scream->stop();
+    mixer.update(0.75f);
+    mixer.update(0.0f);
+
+    // then
+    auto names = backend.playingSourceNames();
+    ASSERT_EQ(1ll, names.size());
+    EXPECT_NEAR(0.25f, backend.source(names[0]).offset, 1e-4f);
+    EXPECT_TRUE(ambient->isPlaying());
+}
+
+TEST(AudioMixer, should_drop_finished_virtual_voices) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto source = mixer.play(makeClip(1, 88200), AudioType::Sound, 1.0f, false, glm::vec3(1000.0f, 0.0f, 0.0f));
+    mixer.update(0.0f);
+
+    // when
+    mixer.update(1.5f);
+
+    // then
+    EXPECT_FALSE(source->isPlaying());
+    EXPECT_EQ(0, mixer.numVirtualVoices());
+}
+
+TEST(AudioMixer, should_drop_voice_whose_decoder_fails) {
+    // given
+    auto options = AudioOptions();
+    auto backend = TestAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto clip = std::make_shared<AudioClip>(
+        []() -> std::unique_ptr<IAudioDecoder> {
+            throw std::runtime_error("Corrupt stream");
+        },
+        1.0f);
+    auto source = mixer.play(clip, AudioType::Movie);
+
+    // when
+    mixer.update(0.0f);
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_FALSE(source->isPlaying());
+    EXPECT_EQ(0, mixer.numRealVoices());
+    EXPECT_EQ(0, mixer.numVirtualVoices());
+}
+
+TEST(AudioMixer, should_keep_streams_playing_on_null_backend) {
+    // given
+    auto options = AudioOptions();
+    auto backend = NullAudioBackend();
+    auto mixer = AudioMixer(options, backend);
+    auto sound = mixer.play(makeClip(1), AudioType::Sound);
+    auto music = mixer.play(makeClip(50), AudioType::Music);
+    mixer.update(0.0f);
+
+    // when
+    mixer.update(0.0f);
+
+    // then
+    EXPECT_FALSE(sound->isPlaying());
+    EXPECT_TRUE(music->isPlaying());
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/audio/clip.h"
+#include "reone/audio/source.h"
+
+#include "../fixtures/audio.h"
+
+using namespace reone;
+using namespace reone::audio;
+
+static std::shared_ptr<AudioClip> makeClip(int numFrames, int frameSize = 2304) {
+    auto clip = std::make_shared<AudioClip>();
+    for (int i = 0; i < numFrames; ++i) {
+        AudioClip::Frame frame;
+        frame.format = AudioFormat::Mono16;
+        frame.sampleRate = 44100;
+        frame.samples.resize(frameSize);
+        clip->add(std::move(frame));
+    }
+    return clip;
+}
+
+TEST(AudioSource, should_upload_single_frame_clip_into_static_buffer) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(1, 100));
+
+    // when
+    source.init();
+
+    // then
+    auto names = backend.sourceNames();
+    ASSERT_EQ(1ll, names.size());
+    auto alSource = backend.source(names[0]);
+    EXPECT_NE(0u, alSource.buffer);
+    EXPECT_TRUE(alSource.queue.empty());
+    EXPECT_EQ(100, backend.bufferSize(alSource.buffer));
+}
+
+TEST(AudioSource, should_queue_coalesced_chunks_of_configured_length) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(50), 1.0f, false, std::nullopt, 100);
+
+    // when
+    source.init();
+
+    // then
+    auto names = backend.sourceNames();
+    ASSERT_EQ(1ll, names.size());
+    auto alSource = backend.source(names[0]);
+    ASSERT_EQ(4ll, alSource.queue.size());
+    for (auto buffer : alSource.queue) {
+        EXPECT_EQ(8820, backend.bufferSize(buffer)); // 100 ms of 16-bit mono at 44100 Hz
+    }
+}
+
+TEST(AudioSource, should_refill_only_processed_buffers) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(50));
+    source.init();
+    source.play();
+    source.render();
+    int numUploads = backend.numUploads();
+
+    // when
+    backend.process(2);
+    source.render();
+
+    // then
+    EXPECT_EQ(numUploads + 2, backend.numUploads());
+    auto alSource = backend.source(backend.sourceNames()[0]);
+    EXPECT_EQ(4ll, alSource.queue.size());
+    EXPECT_EQ(0, alSource.numProcessed);
+    EXPECT_TRUE(alSource.playing);
+}
+
+TEST(AudioSource, should_stop_playing_when_clip_is_exhausted) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(50));
+    source.init();
+    source.play();
+    source.render();
+
+    // when
+    for (int i = 0; i < 100 && source.isPlaying(); ++i) {
+        backend.process(1);
+        source.render();
+    }
+
+    // then
+    EXPECT_FALSE(source.isPlaying());
+    EXPECT_EQ(14, backend.numUploads()); // 115200 bytes in 8820 byte chunks
+}
+
+TEST(AudioSource, should_apply_position_on_render) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(1), 1.0f, false, glm::vec3(1.0f, 2.0f, 3.0f));
+    source.init();
+
+    // when
+    source.setPosition(glm::vec3(4.0f, 5.0f, 6.0f));
+    auto positionBeforeRender = backend.source(backend.sourceNames()[0]).position;
+    source.render();
+
+    // then
+    EXPECT_EQ(glm::vec3(1.0f, 2.0f, 3.0f), positionBeforeRender);
+    EXPECT_EQ(glm::vec3(4.0f, 5.0f, 6.0f), backend.source(backend.sourceNames()[0]).position);
+}
+
+TEST(AudioSource, should_start_static_source_from_offset) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(1, 88200), 1.0f, true); // 1 second
+
+    // when
+    source.init(2.25f);
+
+    // then
+    auto alSource = backend.source(backend.sourceNames()[0]);
+    EXPECT_NEAR(0.25f, alSource.offset, 1e-4f);
+}
+
+TEST(AudioSource, should_start_streaming_source_from_offset) {
+    // given
+    auto backend = TestAudioBackend();
+    auto source = AudioSource(backend, makeClip(50));
+    source.play();
+
+    // when
+    source.init(0.5f);
+    for (int i = 0; i < 100 && source.isPlaying(); ++i) {
+        backend.process(1);
+        source.render();
+    }
+
+    // then
+    EXPECT_EQ(115200 - 44100, backend.numUploadedBytes());
+}
+
+TEST(AudioSource, should_play_shared_buffer_of_uploaded_clip) {
+    // given
+    auto backend = TestAudioBackend();
+    auto clip = makeClip(1, 100);
+    clip->upload(backend);
+    auto source1 = AudioSource(backend, clip);
+    auto source2 = AudioSource(backend, clip);
+
+    // when
+    source1.init();
+    source2.init();
+
+    // then
+    EXPECT_EQ(1, backend.numUploads());
+    EXPECT_EQ(1, backend.numBuffers());
+    for (auto name : backend.sourceNames()) {
+        EXPECT_EQ(clip->sharedBuffer(), backend.source(name).buffer);
+    }
+}
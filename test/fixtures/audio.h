@@ -19,6 +19,7 @@
 
 #include <gmock/gmock.h>
 
+#include "reone/audio/backend.h"
 #include "reone/audio/context.h"
 #include "reone/audio/di/services.h"
 #include "reone/audio/format/mp3reader.h"
@@ -48,7 +49,211 @@ public:
     MOCK_METHOD(void, render, (), (override));
     MOCK_METHOD(void, stop, (AudioType), (override));
     MOCK_METHOD(void, stopAll, (), (override));
-    MOCK_METHOD(std::shared_ptr<AudioSource>, play, (std::shared_ptr<AudioClip>, AudioType, float, bool, std::optional<glm::vec3>), (override));
+    MOCK_METHOD(void, setListenerPosition, (glm::vec3), (override));
+    MOCK_METHOD(std::shared_ptr<AudioSource>, play, (std::shared_ptr<AudioClip>, AudioType, float, bool, std::optional<glm::vec3>, AudioPriority), (override));
+};
+
+/**
+ * Stand-in for OpenAL: keeps track of sources, buffers and queues, and lets
+ * tests mark queued buffers as processed.
+ */
+class TestAudioBackend : public IAudioBackend, boost::noncopyable {
+public:
+    struct Source {
+        std::deque<uint32_t> queue;
+        int numProcessed {0};
+        uint32_t buffer {0};
+        float offset {0.0f};
+        glm::vec3 position {0.0f};
+        bool playing {false};
+        bool looping {false};
+    };
+
+    uint32_t createSource() override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        uint32_t source = _nextName++;
+        _sources[source] = Source();
+        ++_numCreatedSources;
+        return source;
+    }
+
+    void deleteSource(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.erase(source);
+    }
+
+    void createBuffers(int count, uint32_t *buffers) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        for (int i = 0; i < count; ++i) {
+            buffers[i] = _nextName++;
+            _bufferSizes[buffers[i]] = 0;
+        }
+    }
+
+    void deleteBuffers(int count, const uint32_t *buffers) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        for (int i = 0; i < count; ++i) {
+            _bufferSizes.erase(buffers[i]);
+        }
+    }
+
+    void setBufferData(uint32_t buffer, AudioFormat format, const void *data, int size, int sampleRate) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _bufferSizes[buffer] = size;
+        _numUploadedBytes += size;
+        ++_numUploads;
+    }
+
+    void setSourceGain(uint32_t source, float gain) override {
+    }
+
+    void setSourcePosition(uint32_t source, glm::vec3 position) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.at(source).position = position;
+    }
+
+    void setSourceRelative(uint32_t source, bool relative) override {
+    }
+
+    void setSourceLooping(uint32_t source, bool loop) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.at(source).looping = loop;
+    }
+
+    void setSourceBuffer(uint32_t source, uint32_t buffer) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        auto &src = _sources.at(source);
+        src.buffer = buffer;
+        src.queue.clear();
+        src.numProcessed = 0;
+    }
+
+    void setSourceOffset(uint32_t source, float seconds) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.at(source).offset = seconds;
+    }
+
+    void queueBuffers(uint32_t source, int count, const uint32_t *buffers) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        auto &queue = _sources.at(source).queue;
+        queue.insert(queue.end(), buffers, buffers + count);
+    }
+
+    void unqueueBuffers(uint32_t source, int count, uint32_t *buffers) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        auto &src = _sources.at(source);
+        for (int i = 0; i < count; ++i) {
+            buffers[i] = src.queue.front();
+            src.queue.pop_front();
+            --src.numProcessed;
+        }
+    }
+
+    int getProcessedBufferCount(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _sources.at(source).numProcessed;
+    }
+
+    int getQueuedBufferCount(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return static_cast<int>(_sources.at(source).queue.size());
+    }
+
+    bool isSourceStopped(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return !_sources.at(source).playing;
+    }
+
+    void playSource(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.at(source).playing = true;
+    }
+
+    void stopSource(uint32_t source) override {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _sources.at(source).playing = false;
+    }
+
+    /**
+     * Marks up to count queued buffers of every playing source as processed.
+     * Sources stop when all of their buffers are processed, static sources
+     * stop immediately.
+     */
+    void process(int count = 1) {
+        std::lock_guard<std::mutex> lock {_mutex};
+        for (auto &[_, source] : _sources) {
+            if (!source.playing) {
+                continue;
+            }
+            if (source.buffer != 0) {
+                source.playing = false;
+                continue;
+            }
+            source.numProcessed = std::min(source.numProcessed + count, static_cast<int>(source.queue.size()));
+            if (source.numProcessed == static_cast<int>(source.queue.size())) {
+                source.playing = false;
+            }
+        }
+    }
+
+    Source source(uint32_t name) {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _sources.at(name);
+    }
+
+    std::vector<uint32_t> sourceNames() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        std::vector<uint32_t> names;
+        for (auto &[name, _] : _sources) {
+            names.push_back(name);
+        }
+        return names;
+    }
+
+    int bufferSize(uint32_t buffer) {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _bufferSizes.at(buffer);
+    }
+
+    int numBuffers() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return static_cast<int>(_bufferSizes.size());
+    }
+
+    int numUploads() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _numUploads;
+    }
+
+    int numUploadedBytes() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _numUploadedBytes;
+    }
+
+    int numCreatedSources() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        return _numCreatedSources;
+    }
+
+    std::vector<uint32_t> playingSourceNames() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        std::vector<uint32_t> names;
+        for (auto &[name, source] : _sources) {
+            if (source.playing) {
+                names.push_back(name);
+            }
+        }
+        return names;
+    }
+
+private:
+    std::mutex _mutex;
+    uint32_t _nextName {1};
+    std::map<uint32_t, Source> _sources;
+    std::map<uint32_t, int> _bufferSizes;
+    int _numUploads {0};
+    int _numUploadedBytes {0};
+    int _numCreatedSources {0};
 };
 
 class TestAudioModule : boost::noncopyable {
@@ -71,8 +71,13 @@ public:
 
 class MockStrings : public IStrings, boost::noncopyable {
 public:
-    MOCK_METHOD(std::string, getText, (int strRef), (override));
-    MOCK_METHOD(std::string, getSound, (int strRef), (override));
+    MockStrings() {
+        ON_CALL(*this, getText(testing::_)).WillByDefault(testing::ReturnRefOfCopy(std::string()));
+        ON_CALL(*this, getSound(testing::_)).WillByDefault(testing::ReturnRefOfCopy(std::string()));
+    }
+
+    MOCK_METHOD(const std::string &, getText, (int strRef), (override));
+    MOCK_METHOD(const std::string &, getSound, (int strRef), (override));
 };
 
 class MockTwoDAs : public ITwoDAs, boost::noncopyable {
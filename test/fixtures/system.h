@@ -39,10 +39,49 @@ public:
     }
 };
 
+/**
+ * Deterministic thread pool that runs jobs inline on the calling thread, as
+ * soon as their dependencies have completed. Jobs that become ready at the
+ * same time run in order of enqueueing.
+ */
 class MockThreadPool : public IThreadPool, boost::noncopyable {
 public:
-    std::shared_ptr<Task> enqueue(TaskFunc func) override {
-        return nullptr;
+    std::shared_ptr<Task> enqueue(
+        TaskFunc func,
+        JobPriority priority = JobPriority::Background,
+        const std::vector<std::shared_ptr<Task>> &dependencies = {}) override {
+        auto task = std::make_shared<Task>(std::move(func), priority);
+        if (addDependencies(task, dependencies)) {
+            auto ready = std::deque<std::shared_ptr<Task>> {task};
+            while (!ready.empty()) {
+                for (auto &dependent : runTask(*ready.front())) {
+                    ready.push_back(std::move(dependent));
+                }
+                ready.pop_front();
+            }
+        }
+        return task;
+    }
+
+    void wait(Task &task) override {
+        if (!task.isDone()) {
+            throw std::logic_error("Task depends on jobs that never ran");
+        }
+        task.wait();
+    }
+
+    void parallelFor(
+        size_t begin,
+        size_t end,
+        size_t grain,
+        const RangeFunc &func,
+        JobPriority priority = JobPriority::FrameCritical) override {
+        if (grain == 0) {
+            grain = std::max<size_t>(1, end - begin);
+        }
+        for (size_t rangeBegin = begin; rangeBegin < end; rangeBegin += grain) {
+            func(rangeBegin, std::min(rangeBegin + grain, end));
+        }
     }
 };
 
@@ -151,19 +151,20 @@ protected:
 
     void startVoiced() {
         auto clip = makeOneSecondClip();
-        auto source = std::make_shared<AudioSource>(clip);
+        auto source = std::make_shared<AudioSource>(_audioBackend, clip);
 
         EXPECT_CALL(static_cast<resource::MockLips &>(_engine.services().resource.lips), get("test_voice"))
             .WillOnce(Return(nullptr));
         EXPECT_CALL(_engine.resourceModule().audioClips(), get("test_voice"))
             .WillOnce(Return(clip));
-        EXPECT_CALL(static_cast<audio::MockAudioMixer &>(_engine.services().audio.mixer), play(_, AudioType::Voice, _, _, _))
+        EXPECT_CALL(static_cast<audio::MockAudioMixer &>(_engine.services().audio.mixer), play(_, AudioType::Voice, _, _, _, _))
             .WillOnce(Return(source));
 
         _conversation->start(makeDialog(-1, true), nullptr);
     }
 
     TestEngine _engine;
+    audio::TestAudioBackend _audioBackend;
     StubConsole _console;
     std::unique_ptr<Game> _game;
     std::unique_ptr<TestConversation> _conversation;
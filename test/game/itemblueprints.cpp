@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../fixtures/engine.h"
+
+#include "reone/game/game.h"
+#include "reone/game/itemblueprints.h"
+#include "reone/game/object/item.h"
+#include "reone/resource/2da.h"
+#include "reone/resource/gff.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::resource;
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<TwoDA> makeBaseItemsTable() {
+    TwoDA::Builder builder;
+    builder.columns({"maxattackrange", "crithitmult", "critthreat", "damageflags", "dietoroll",
+                     "equipableslots", "itemclass", "numdice", "weapontype", "weaponwield",
+                     "ammunitiontype", "bodyvar"});
+    builder.row({"", "", "", "", "", "", "I_Credits", "", "", "", "", ""});
+    builder.row({"10", "2", "20", "1", "6", "0x10", "W_BlstrPstl", "1", "4", "5", "", ""});
+    return std::shared_ptr<TwoDA>(builder.build());
+}
+
+std::shared_ptr<Gff> makeProperty(ItemProperty property, int subtype) {
+    return Gff::Builder()
+        .field(Gff::Field::newWord("PropertyName", static_cast<int>(property)))
+        .field(Gff::Field::newWord("Subtype", subtype))
+        .build();
+}
+
+std::vector<Gff::Field> makeTemplateFields() {
+    return {
+        Gff::Field::newCExoString("Tag", "g_w_blstrpstl001"),
+        Gff::Field::newCExoLocString("LocalizedName", -1, "Blaster Pistol"),
+        Gff::Field::newCExoLocString("Description", -1, "A blaster pistol."),
+        Gff::Field::newInt("BaseItem", 1),
+        Gff::Field::newByte("ModelVariation", 1),
+        Gff::Field::newDword("Cost", 100),
+        Gff::Field::newByte("Identified", 1),
+        Gff::Field::newList("PropertiesList", {makeProperty(ItemProperty::ActivateItem, 7)})};
+}
+
+std::shared_ptr<Gff> makeTemplate() {
+    auto builder = Gff::Builder();
+    for (auto &field : makeTemplateFields()) {
+        builder.field(std::move(field));
+    }
+    return builder.build();
+}
+
+std::shared_ptr<Gff> makeInstance(std::string templateField, std::vector<Gff::Field> overrides = {}) {
+    auto builder = Gff::Builder();
+    builder.field(Gff::Field::newResRef(std::move(templateField), "g_w_blstrpstl001"));
+    for (auto &field : overrides) {
+        builder.field(std::move(field));
+    }
+    return builder.build();
+}
+
+void expectSameState(const Item &actual, const Item &expected) {
+    EXPECT_EQ(actual.tag(), expected.tag());
+    EXPECT_EQ(actual.localizedName(), expected.localizedName());
+    EXPECT_EQ(actual.description(), expected.description());
+    EXPECT_EQ(actual.baseItemType(), expected.baseItemType());
+    EXPECT_EQ(actual.itemClass(), expected.itemClass());
+    EXPECT_EQ(actual.modelVariation(), expected.modelVariation());
+    EXPECT_EQ(actual.attackRange(), expected.attackRange());
+    EXPECT_EQ(actual.numDice(), expected.numDice());
+    EXPECT_EQ(actual.dieToRoll(), expected.dieToRoll());
+    EXPECT_EQ(actual.weaponType(), expected.weaponType());
+    EXPECT_EQ(actual.weaponWield(), expected.weaponWield());
+    EXPECT_EQ(actual.isEquippable(), expected.isEquippable());
+    EXPECT_EQ(actual.activateSpell(), expected.activateSpell());
+    EXPECT_EQ(actual.stackSize(), expected.stackSize());
+    EXPECT_EQ(actual.isDropable(), expected.isDropable());
+    EXPECT_EQ(actual.isIdentified(), expected.isIdentified());
+    ASSERT_EQ(actual.properties().size(), expected.properties().size());
+    for (size_t i = 0; i < actual.properties().size(); ++i) {
+        EXPECT_EQ(actual.properties()[i].propertyName, expected.properties()[i].propertyName);
+        EXPECT_EQ(actual.properties()[i].subtype, expected.properties()[i].subtype);
+    }
+}
+
+class ItemBlueprintsTest : public Test {
+protected:
+    void SetUp() override {
+        _engine.init();
+        _game = std::make_unique<Game>(GameID::KotOR, std::filesystem::path {}, _engine.options(), _engine.services(), _console);
+
+        EXPECT_CALL(_engine.resourceModule().twoDas(), get("baseitems"))
+            .Times(AnyNumber())
+            .WillRepeatedly(Return(makeBaseItemsTable()));
+        EXPECT_CALL(_engine.resourceModule().textures(), get(_, _))
+            .Times(AnyNumber());
+    }
+
+    void expectTemplateLoads(int times) {
+        EXPECT_CALL(_engine.resourceModule().gffs(), get("g_w_blstrpstl001", ResType::Uti))
+            .Times(times)
+            .WillRepeatedly(Return(makeTemplate()));
+    }
+
+    TestEngine _engine;
+    StubConsole _console;
+    std::unique_ptr<Game> _game;
+};
+
+} // namespace
+
+TEST_F(ItemBlueprintsTest, should_parse_template_once_and_share_blueprint_between_items) {
+    // given
+    expectTemplateLoads(1);
+    auto first = _game->newItem();
+    auto second = _game->newItem();
+
+    // when
+    first->deserialize(*makeInstance("InventoryRes", {Gff::Field::newByte("Dropable", 1)}));
+    second->deserialize(*makeInstance("InventoryRes"));
+
+    // then
+    EXPECT_EQ(&first->blueprint(), &second->blueprint());
+    EXPECT_TRUE(first->isDropable());
+    EXPECT_FALSE(second->isDropable());
+    auto stats = _game->itemBlueprints().stats();
+    EXPECT_EQ(stats.numTemplates, 1);
+    EXPECT_EQ(stats.numParses, 1);
+    EXPECT_EQ(stats.numHits, 1);
+    EXPECT_EQ(stats.numCopies, 0);
+    EXPECT_GT(stats.residentBytes, sizeof(ItemBlueprint));
+}
+
+TEST_F(ItemBlueprintsTest, should_spawn_item_indistinguishable_from_one_deserialized_without_template) {
+    // given
+    expectTemplateLoads(1);
+    auto merged = makeTemplateFields();
+    merged.push_back(Gff::Field::newWord("StackSize", 3));
+    merged.push_back(Gff::Field::newByte("Dropable", 1));
+    auto builder = Gff::Builder();
+    for (auto &field : merged) {
+        builder.field(std::move(field));
+    }
+    auto standalone = builder.build();
+    auto expected = _game->newItem();
+    auto actual = _game->newItem();
+
+    // when
+    expected->deserialize(*standalone);
+    actual->deserialize(*makeInstance("InventoryRes", {Gff::Field::newWord("StackSize", 3), Gff::Field::newByte("Dropable", 1)}));
+
+    // then
+    expectSameState(*actual, *expected);
+    EXPECT_EQ(actual->itemClass(), "w_blstrpstl");
+    EXPECT_EQ(actual->activateSpell(), static_cast<SpellType>(7));
+}
+
+TEST_F(ItemBlueprintsTest, should_copy_blueprint_when_instance_overrides_template_fields) {
+    // given
+    expectTemplateLoads(1);
+    auto shared = _game->newItem();
+    auto overridden = _game->newItem();
+
+    // when
+    shared->deserialize(*makeInstance("InventoryRes"));
+    overridden->deserialize(*makeInstance("InventoryRes", {Gff::Field::newByte("ModelVariation", 3)}));
+
+    // then
+    EXPECT_NE(&shared->blueprint(), &overridden->blueprint());
+    EXPECT_EQ(shared->modelVariation(), 1);
+    EXPECT_EQ(overridden->modelVariation(), 3);
+    EXPECT_EQ(overridden->localizedName(), "Blaster Pistol");
+    EXPECT_EQ(_game->itemBlueprints().stats().numCopies, 1);
+}
+
+TEST_F(ItemBlueprintsTest, should_share_stacked_blueprint_of_self_referencing_template) {
+    // given
+    auto uti = makeTemplate();
+    uti->mutableFields().push_back(Gff::Field::newResRef("TemplateResRef", "g_w_blstrpstl001"));
+    uti->reindex();
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("g_w_blstrpstl001", ResType::Uti))
+        .Times(1)
+        .WillOnce(Return(uti));
+    auto first = _game->newItem();
+    auto second = _game->newItem();
+
+    // when
+    first->loadFromBlueprint("g_w_blstrpstl001");
+    second->loadFromBlueprint("g_w_blstrpstl001");
+
+    // then
+    EXPECT_EQ(&first->blueprint(), &second->blueprint());
+    EXPECT_EQ(first->localizedName(), "Blaster Pistol");
+    auto stats = _game->itemBlueprints().stats();
+    EXPECT_EQ(stats.numParses, 1);
+    EXPECT_EQ(stats.numStacked, 1);
+    EXPECT_EQ(stats.numCopies, 0);
+}
+
+TEST_F(ItemBlueprintsTest, should_reparse_templates_after_clear_and_keep_existing_items_intact) {
+    // given
+    expectTemplateLoads(2);
+    auto before = _game->newItem();
+    before->deserialize(*makeInstance("EquippedRes"));
+
+    // when
+    _game->itemBlueprints().clear();
+    auto after = _game->newItem();
+    after->deserialize(*makeInstance("EquippedRes"));
+
+    // then
+    EXPECT_NE(&before->blueprint(), &after->blueprint());
+    EXPECT_EQ(before->localizedName(), "Blaster Pistol");
+    expectSameState(*after, *before);
+    EXPECT_EQ(_game->itemBlueprints().stats().numParses, 1);
+}
+
+TEST_F(ItemBlueprintsTest, should_not_look_up_missing_templates_twice) {
+    // given
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("missing", ResType::Uti))
+        .Times(1)
+        .WillOnce(Return(nullptr));
+
+    // when
+    auto first = _game->itemBlueprints().get("missing");
+    auto second = _game->itemBlueprints().get("missing");
+
+    // then
+    EXPECT_FALSE(first);
+    EXPECT_FALSE(second);
+    EXPECT_EQ(_game->itemBlueprints().stats().numTemplates, 0);
+}
@@ -30,6 +30,7 @@ using namespace reone::resource;
 using testing::_;
 using testing::NiceMock;
 using testing::Return;
+using testing::ReturnRefOfCopy;
 
 class JournalTest : public ::testing::Test {
 protected:
@@ -147,12 +148,12 @@ TEST_F(JournalTest, should_derive_completion_from_current_entry_end_flag) {
 }
 
 TEST_F(JournalTest, should_resolve_quest_name_and_entry_text) {
-    EXPECT_CALL(_strings, getText(42)).WillOnce(Return("Test Quest"));
+    EXPECT_CALL(_strings, getText(42)).WillOnce(ReturnRefOfCopy(std::string("Test Quest")));
     EXPECT_EQ("Test Quest", _journal->getQuestName("test_plot"));
 
     EXPECT_EQ("first step", _journal->getEntryText("test_plot", 10));
 
-    EXPECT_CALL(_strings, getText(123)).WillOnce(Return("all done"));
+    EXPECT_CALL(_strings, getText(123)).WillOnce(ReturnRefOfCopy(std::string("all done")));
     EXPECT_EQ("all done", _journal->getEntryText("test_plot", 20));
 }
 
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../fixtures/engine.h"
+
+#include "reone/game/game.h"
+#include "reone/game/object/creature.h"
+#include "reone/game/object/placeable.h"
+#include "reone/resource/2da.h"
+#include "reone/resource/gff.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::resource;
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<TwoDA> makeTable(std::vector<std::string> columns, std::vector<std::string> values) {
+    TwoDA::Builder builder;
+    builder.columns(std::move(columns));
+    builder.row(std::move(values));
+    return std::shared_ptr<TwoDA>(builder.build());
+}
+
+std::shared_ptr<Gff> makeCreatureTemplate() {
+    return Gff::Builder()
+        .field(Gff::Field::newResRef("TemplateResRef", "n_commoner01"))
+        .field(Gff::Field::newCExoString("Tag", "Commoner01"))
+        .field(Gff::Field::newCExoLocString("FirstName", -1, "Commoner"))
+        .field(Gff::Field::newCExoLocString("LastName", -1, "Smith"))
+        .field(Gff::Field::newByte("Str", 14))
+        .field(Gff::Field::newByte("PerceptionRange", 0))
+        .build();
+}
+
+std::shared_ptr<Gff> makePlaceableTemplate() {
+    auto item = Gff::Builder()
+                    .field(Gff::Field::newCExoString("Tag", "g_i_credits001"))
+                    .build();
+    return Gff::Builder()
+        .field(Gff::Field::newResRef("TemplateResRef", "plc_footlker"))
+        .field(Gff::Field::newCExoString("Tag", "Footlocker"))
+        .field(Gff::Field::newCExoLocString("LocName", -1, "Footlocker"))
+        .field(Gff::Field::newCExoLocString("Description", -1, "A footlocker."))
+        .field(Gff::Field::newList("ItemList", {item}))
+        .build();
+}
+
+std::shared_ptr<Gff> makeInstance(std::string templateResRef, std::vector<Gff::Field> overrides = {}) {
+    auto builder = Gff::Builder();
+    builder.field(Gff::Field::newResRef("TemplateResRef", std::move(templateResRef)));
+    for (auto &field : overrides) {
+        builder.field(std::move(field));
+    }
+    return builder.build();
+}
+
+class ObjectBlueprintsTest : public Test {
+protected:
+    void SetUp() override {
+        _engine.init();
+        _game = std::make_unique<Game>(GameID::KotOR, std::filesystem::path {}, _engine.options(), _engine.services(), _console);
+
+        EXPECT_CALL(_engine.resourceModule().twoDas(), get("appearance"))
+            .Times(AnyNumber())
+            .WillRepeatedly(Return(makeTable({"modeltype", "race"}, {"S", ""})));
+        EXPECT_CALL(_engine.resourceModule().twoDas(), get("placeables"))
+            .Times(AnyNumber())
+            .WillRepeatedly(Return(makeTable({"modelname"}, {""})));
+        EXPECT_CALL(_engine.resourceModule().twoDas(), get("baseitems"))
+            .Times(AnyNumber())
+            .WillRepeatedly(Return(makeTable({"itemclass", "ammunitiontype"}, {"I_Credits", ""})));
+    }
+
+    TestEngine _engine;
+    StubConsole _console;
+    std::unique_ptr<Game> _game;
+};
+
+} // namespace
+
+TEST_F(ObjectBlueprintsTest, should_parse_creature_template_once_and_share_derived_state) {
+    // given
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("n_commoner01", ResType::Utc))
+        .Times(1)
+        .WillOnce(Return(makeCreatureTemplate()));
+    EXPECT_CALL(_engine.resourceModule().twoDas(), get("ranges"))
+        .Times(1)
+        .WillOnce(Return(makeTable({"primaryrange", "secondaryrange"}, {"10.0", "5.0"})));
+    auto first = _game->newCreature();
+    auto second = _game->newCreature();
+
+    // when
+    first->deserialize(*makeInstance("n_commoner01"));
+    second->deserialize(*makeInstance("n_commoner01", {Gff::Field::newByte("Str", 16)}));
+
+    // then
+    EXPECT_EQ(first->name(), "Commoner Smith");
+    EXPECT_EQ(second->name(), "Commoner Smith");
+    EXPECT_EQ(first->tag(), "commoner01");
+    EXPECT_EQ(first->perception().sightRange, 10.0f);
+    EXPECT_EQ(second->perception().hearingRange, 5.0f);
+    EXPECT_EQ(first->attributes().getAbilityScore(Ability::Strength), 14);
+    EXPECT_EQ(second->attributes().getAbilityScore(Ability::Strength), 16);
+    auto stats = _game->creatureBlueprints().stats();
+    EXPECT_EQ(stats.numTemplates, 1);
+    EXPECT_EQ(stats.numParses, 1);
+    EXPECT_EQ(stats.numHits, 1);
+    EXPECT_GT(stats.residentBytes, sizeof(Creature::Blueprint));
+}
+
+TEST_F(ObjectBlueprintsTest, should_spawn_creature_indistinguishable_from_one_deserialized_without_template) {
+    // given
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("n_commoner01", ResType::Utc))
+        .Times(1)
+        .WillOnce(Return(makeCreatureTemplate()));
+    EXPECT_CALL(_engine.resourceModule().twoDas(), get("ranges"))
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(makeTable({"primaryrange", "secondaryrange"}, {"10.0", "5.0"})));
+    auto expected = _game->newCreature();
+    auto actual = _game->newCreature();
+    auto standalone = makeCreatureTemplate();
+    standalone->mutableFields().erase(standalone->mutableFields().begin());
+    standalone->reindex();
+
+    // when
+    expected->deserialize(*standalone);
+    actual->loadFromBlueprint("n_commoner01");
+
+    // then
+    EXPECT_EQ(actual->name(), expected->name());
+    EXPECT_EQ(actual->tag(), expected->tag());
+    EXPECT_EQ(actual->perception().sightRange, expected->perception().sightRange);
+    EXPECT_EQ(actual->perception().hearingRange, expected->perception().hearingRange);
+    EXPECT_EQ(actual->attributes().getAbilityScore(Ability::Strength), expected->attributes().getAbilityScore(Ability::Strength));
+}
+
+TEST_F(ObjectBlueprintsTest, should_share_placeable_template_and_spawn_items_per_instance) {
+    // given
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("plc_footlker", ResType::Utp))
+        .Times(1)
+        .WillOnce(Return(makePlaceableTemplate()));
+    auto first = _game->newPlaceable();
+    auto second = _game->newPlaceable();
+
+    // when
+    first->deserialize(*makeInstance("plc_footlker"));
+    second->deserialize(*makeInstance("plc_footlker", {Gff::Field::newCExoLocString("LocName", -1, "Locked Footlocker")}));
+
+    // then
+    EXPECT_EQ(first->name(), "Footlocker");
+    EXPECT_EQ(second->name(), "Locked Footlocker");
+    EXPECT_EQ(first->tag(), "footlocker");
+    ASSERT_EQ(first->items().size(), 1);
+    ASSERT_EQ(second->items().size(), 1);
+    EXPECT_NE(first->items()[0], second->items()[0]);
+    EXPECT_EQ(first->items()[0]->tag(), "g_i_credits001");
+    auto stats = _game->placeableBlueprints().stats();
+    EXPECT_EQ(stats.numParses, 1);
+    EXPECT_EQ(stats.numHits, 1);
+    EXPECT_GT(stats.residentBytes, sizeof(Placeable::Blueprint));
+}
+
+TEST_F(ObjectBlueprintsTest, should_not_look_up_missing_templates_twice) {
+    // given
+    EXPECT_CALL(_engine.resourceModule().gffs(), get("missing", ResType::Utp))
+        .Times(1)
+        .WillOnce(Return(nullptr));
+    auto first = _game->newPlaceable();
+    auto second = _game->newPlaceable();
+
+    // when
+    first->loadFromBlueprint("missing");
+    second->loadFromBlueprint("missing");
+
+    // then
+    EXPECT_EQ(_game->placeableBlueprints().stats().numTemplates, 0);
+    EXPECT_EQ(_game->placeableBlueprints().stats().numHits, 1);
+}
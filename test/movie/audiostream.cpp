@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/movie/audiostream.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::movie;
+
+/**
+ * Stream of mono 16-bit frames, where each sample holds its index modulo 2^16.
+ * Counts decoded frames.
+ */
+class TestAudioStream : public IAudioStream, boost::noncopyable {
+public:
+    static constexpr int kSamplesPerFrame = 1000;
+
+    TestAudioStream(int numFrames, int &numDecodedFrames) :
+        _numFrames(numFrames),
+        _numDecodedFrames(numDecodedFrames) {
+    }
+
+    bool decodeFrame(AudioClip::Frame &frame) override {
+        if (_frameIdx == _numFrames) {
+            return false;
+        }
+        frame.format = AudioFormat::Mono16;
+        frame.sampleRate = 22050;
+        frame.samples.resize(2 * kSamplesPerFrame);
+        auto samples = reinterpret_cast<uint16_t *>(&frame.samples[0]);
+        for (int i = 0; i < kSamplesPerFrame; ++i) {
+            samples[i] = static_cast<uint16_t>(_frameIdx * kSamplesPerFrame + i);
+        }
+        ++_frameIdx;
+        ++_numDecodedFrames;
+        return true;
+    }
+
+    void rewind() override {
+        _frameIdx = 0;
+    }
+
+private:
+    int _numFrames;
+    int &_numDecodedFrames;
+    int _frameIdx {0};
+};
+
+static int countFramesDecodedForFirstChunk(int numFrames) {
+    int numDecodedFrames = 0;
+    auto decoder = AudioStreamDecoder(std::make_unique<TestAudioStream>(numFrames, numDecodedFrames));
+    auto chunk = AudioClip::Frame();
+    decoder.decode(chunk, 8192);
+    return numDecodedFrames;
+}
+
+TEST(AudioStreamDecoder, should_decode_first_chunk_independently_of_stream_length) {
+    // given
+    int shortStream = 10;
+    int longStream = 22050 * 3600 / TestAudioStream::kSamplesPerFrame; // one hour
+
+    // when
+    int shortFrames = countFramesDecodedForFirstChunk(shortStream);
+    int longFrames = countFramesDecodedForFirstChunk(longStream);
+
+    // then
+    EXPECT_EQ(5, shortFrames);
+    EXPECT_EQ(shortFrames, longFrames);
+}
+
+TEST(AudioStreamDecoder, should_split_frames_into_chunks) {
+    // given
+    int numDecodedFrames = 0;
+    auto decoder = AudioStreamDecoder(std::make_unique<TestAudioStream>(3, numDecodedFrames));
+    auto samples = std::vector<uint16_t>();
+
+    // when
+    int numChunks = 0;
+    auto chunk = AudioClip::Frame();
+    while (decoder.decode(chunk, 1501)) {
+        auto chunkSamples = reinterpret_cast<const uint16_t *>(&chunk.samples[0]);
+        samples.insert(samples.end(), chunkSamples, chunkSamples + chunk.samples.size() / 2);
+        chunk.samples.clear();
+        ++numChunks;
+    }
+
+    // then
+    EXPECT_EQ(4, numChunks);
+    ASSERT_EQ(3000ll, samples.size());
+    for (int i = 0; i < 3000; ++i) {
+        EXPECT_EQ(i, samples[i]) << i;
+    }
+    EXPECT_EQ(AudioFormat::Mono16, chunk.format);
+    EXPECT_EQ(22050, chunk.sampleRate);
+}
+
+TEST(AudioStreamDecoder, should_restart_after_rewind) {
+    // given
+    int numDecodedFrames = 0;
+    auto decoder = AudioStreamDecoder(std::make_unique<TestAudioStream>(1, numDecodedFrames));
+    auto chunk = AudioClip::Frame();
+    while (decoder.decode(chunk, 4096)) {
+        chunk.samples.clear();
+    }
+
+    // when
+    decoder.rewind();
+    bool decoded = decoder.decode(chunk, 4);
+
+    // then
+    EXPECT_TRUE(decoded);
+    ASSERT_EQ(4ll, chunk.samples.size());
+    EXPECT_EQ(0, reinterpret_cast<const uint16_t *>(&chunk.samples[0])[0]);
+    EXPECT_EQ(1, reinterpret_cast<const uint16_t *>(&chunk.samples[0])[1]);
+}
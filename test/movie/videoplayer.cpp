@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/movie/videoplayer.h"
+
+using namespace reone;
+using namespace reone::movie;
+
+/**
+ * Stream of 2x1 frames at 10 frames per second, where each luma sample holds
+ * the frame number. Decoding can be paused to simulate decoder stalls.
+ */
+class TestVideoStream : public IVideoStream, boost::noncopyable {
+public:
+    TestVideoStream(int numFrames) :
+        _numFrames(numFrames) {
+    }
+
+    int width() const override { return 2; }
+    int height() const override { return 1; }
+
+    bool decodeFrame(float &time) override {
+        std::unique_lock<std::mutex> lock {_mutex};
+        _condVar.wait(lock, [this]() { return !_paused; });
+        if (_frameIdx + 1 >= _numFrames) {
+            return false;
+        }
+        ++_frameIdx;
+        time = _frameIdx / 10.0f;
+        return true;
+    }
+
+    void copyFrame(uint8_t *y, uint8_t *u, uint8_t *v) override {
+        std::fill(y, y + 2, static_cast<uint8_t>(_frameIdx));
+        *u = 128;
+        *v = 128;
+    }
+
+    void setPaused(bool paused) {
+        {
+            std::lock_guard<std::mutex> lock {_mutex};
+            _paused = paused;
+        }
+        _condVar.notify_all();
+    }
+
+private:
+    int _numFrames;
+    int _frameIdx {-1};
+    bool _paused {false};
+
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+};
+
+template <class Predicate>
+static bool waitUntil(Predicate pred) {
+    for (int i = 0; i < 10; ++i) {
+        if (pred()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 << i));
+    }
+    return pred();
+}
+
+static int frameNumber(const VideoPlayer &player) {
+    auto frame = player.frame();
+    return frame ? static_cast<uint8_t>((*frame->planes[0])[0]) : -1;
+}
+
+TEST(VideoPlayer, should_select_frames_by_presentation_time) {
+    // given
+    auto stream = std::make_shared<TestVideoStream>(10);
+    auto player = VideoPlayer(stream);
+    player.init();
+    bool selectedFirst = waitUntil([&player]() { return player.update(0.0f); });
+    int first = frameNumber(player);
+
+    // when
+    bool selectedEarly = player.update(0.05f);
+    bool selectedSecond = waitUntil([&player]() { return player.update(0.1f); });
+    int second = frameNumber(player);
+    player.deinit();
+
+    // then
+    EXPECT_TRUE(selectedFirst);
+    EXPECT_EQ(0, first);
+    EXPECT_FALSE(selectedEarly);
+    EXPECT_TRUE(selectedSecond);
+    EXPECT_EQ(1, second);
+    EXPECT_EQ(0, player.numDroppedFrames());
+}
+
+TEST(VideoPlayer, should_drop_frames_superseded_before_selection) {
+    // given
+    auto stream = std::make_shared<TestVideoStream>(10);
+    auto player = VideoPlayer(stream);
+    player.init();
+    waitUntil([&player]() { return player.update(0.0f); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20)); // let decoder fill the ring
+
+    // when
+    bool selected = player.update(0.35f);
+    player.deinit();
+
+    // then
+    EXPECT_TRUE(selected);
+    EXPECT_EQ(3, frameNumber(player));
+    EXPECT_EQ(2, player.numDroppedFrames());
+}
+
+TEST(VideoPlayer, should_skip_late_frames) {
+    // given
+    auto stream = std::make_shared<TestVideoStream>(100);
+    auto player = VideoPlayer(stream);
+    player.init();
+    waitUntil([&player]() { return player.update(0.0f); });
+
+    // when
+    bool caughtUp = waitUntil([&player]() {
+        player.update(5.0f);
+        return frameNumber(player) == 50;
+    });
+    player.deinit();
+
+    // then
+    EXPECT_TRUE(caughtUp);
+    EXPECT_LT(0, player.numSkippedFrames());
+}
+
+TEST(VideoPlayer, should_not_wait_for_stalled_decoder) {
+    // given
+    auto stream = std::make_shared<TestVideoStream>(10);
+    auto player = VideoPlayer(stream);
+    player.init();
+    waitUntil([&player]() { return player.update(0.0f); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20)); // let decoder fill the ring
+    stream->setPaused(true);
+    waitUntil([&player]() { return player.update(0.1f); });
+    waitUntil([&player]() { return player.update(0.2f); });
+    waitUntil([&player]() { return player.update(0.3f); });
+
+    // when
+    auto start = std::chrono::steady_clock::now();
+    bool selected = player.update(0.9f);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    int current = frameNumber(player);
+    stream->setPaused(false);
+    player.deinit();
+
+    // then
+    EXPECT_FALSE(selected);
+    EXPECT_EQ(3, current);
+    EXPECT_GT(std::chrono::milliseconds(10), elapsed);
+}
+
+TEST(VideoPlayer, should_end_once_all_frames_are_selected) {
+    // given
+    auto stream = std::make_shared<TestVideoStream>(3);
+    auto player = VideoPlayer(stream);
+    player.init();
+
+    // when
+    bool ended = waitUntil([&player]() {
+        player.update(0.2f);
+        return player.hasEnded();
+    });
+    player.deinit();
+
+    // then
+    EXPECT_TRUE(ended);
+    EXPECT_EQ(2, frameNumber(player));
+}
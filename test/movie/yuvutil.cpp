@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/movie/yuvutil.h"
+
+using namespace reone;
+using namespace reone::movie;
+
+/**
+ * Floating point conversion, as implemented by glsl/f_texyuv.glsl.
+ */
+static glm::u8vec3 convertYUVToRGBReference(uint8_t y, uint8_t u, uint8_t v) {
+    float luma = 1.164383f * (y / 255.0f - 16.0f / 255.0f);
+    float cb = u / 255.0f - 128.0f / 255.0f;
+    float cr = v / 255.0f - 128.0f / 255.0f;
+    auto rgb = glm::clamp(
+        glm::vec3(
+            luma + 1.596027f * cr,
+            luma - 0.391762f * cb - 0.812968f * cr,
+            luma + 2.017232f * cb),
+        0.0f, 1.0f);
+    return glm::u8vec3(glm::round(255.0f * rgb));
+}
+
+TEST(YUVUtil, should_match_shader_conversion) {
+    // given
+    int maxDiff = 0;
+
+    // when
+    for (int y = 0; y < 256; y += 3) {
+        for (int u = 0; u < 256; u += 5) {
+            for (int v = 0; v < 256; v += 5) {
+                auto actual = convertYUVToRGB(y, u, v);
+                auto expected = convertYUVToRGBReference(y, u, v);
+                for (int i = 0; i < 3; ++i) {
+                    maxDiff = std::max(maxDiff, std::abs(actual[i] - expected[i]));
+                }
+            }
+        }
+    }
+
+    // then
+    EXPECT_GE(1, maxDiff);
+}
+
+TEST(YUVUtil, should_convert_black_and_white) {
+    // when
+    auto black = convertYUVToRGB(16, 128, 128);
+    auto white = convertYUVToRGB(235, 128, 128);
+
+    // then
+    EXPECT_EQ(glm::u8vec3(0, 0, 0), black);
+    EXPECT_EQ(glm::u8vec3(255, 255, 255), white);
+}
+
+TEST(YUVUtil, should_convert_yuv420_image_with_shared_chroma) {
+    // given
+    // 3x2 image: chroma planes are 2x1
+    auto y = std::vector<uint8_t> {16, 16, 235, 16, 16, 235};
+    auto u = std::vector<uint8_t> {128, 128};
+    auto v = std::vector<uint8_t> {128, 240};
+    auto rgb = std::vector<uint8_t>(3 * 6, 0);
+
+    // when
+    convertYUV420ToRGB(3, 2, y.data(), u.data(), v.data(), rgb.data());
+
+    // then
+    for (int i = 0; i < 6; ++i) {
+        auto expected = convertYUVToRGB(y[i], u[(i % 3) / 2], v[(i % 3) / 2]);
+        EXPECT_EQ(expected.r, rgb[3 * i + 0]) << i;
+        EXPECT_EQ(expected.g, rgb[3 * i + 1]) << i;
+        EXPECT_EQ(expected.b, rgb[3 * i + 2]) << i;
+    }
+    EXPECT_EQ(0, rgb[0]);
+    EXPECT_EQ(255, rgb[3 * 2 + 0]);
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/2da.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+TEST(TwoDA, should_get_typed_values_by_name_and_handle) {
+    // given
+    auto twoDa = TwoDA::Builder()
+                     .columns({"label", "int", "float", "hex"})
+                     .row({"first", "12", "1.5", "0x1f"})
+                     .row({"second", "****", "", "ff"})
+                     .row({"third", "-3", "abc", "****"})
+                     .build();
+
+    // when
+    auto intColumn = twoDa->column("int");
+    auto floatColumn = twoDa->column("float");
+    auto missingColumn = twoDa->column("missing");
+
+    // then
+    EXPECT_TRUE(intColumn.isValid());
+    EXPECT_FALSE(missingColumn.isValid());
+    EXPECT_TRUE(twoDa->hasColumn("hex"));
+    EXPECT_EQ(std::string("second"), twoDa->getString(1, "label"));
+    EXPECT_EQ(12, twoDa->getInt(0, "int"));
+    EXPECT_EQ(12, twoDa->getInt(0, intColumn));
+    EXPECT_EQ(-3, twoDa->getInt(2, intColumn));
+    EXPECT_EQ(7, twoDa->getInt(1, intColumn, 7));
+    EXPECT_TRUE(twoDa->getBool(0, intColumn));
+    EXPECT_EQ(1.5f, twoDa->getFloat(0, floatColumn));
+    EXPECT_FALSE(twoDa->getFloatOpt(1, floatColumn).has_value());
+    EXPECT_THROW(twoDa->getFloat(2, floatColumn), std::invalid_argument);
+    EXPECT_EQ(0x1fu, twoDa->getHexInt(0, "hex"));
+    EXPECT_EQ(0xffu, twoDa->getHexInt(1, "hex"));
+    EXPECT_EQ(5, twoDa->getInt(0, missingColumn, 5));
+    EXPECT_EQ(5, twoDa->getInt(3, intColumn, 5));
+    EXPECT_EQ(std::string("****"), twoDa->cell(1, 1));
+}
+
+TEST(TwoDA, should_index_rows_by_cell_value) {
+    // given
+    auto twoDa = TwoDA::Builder()
+                     .columns({"label", "value"})
+                     .row({"a", "1"})
+                     .row({"b", "2"})
+                     .row({"b", "3"})
+                     .build();
+
+    // when
+    auto label = twoDa->column("label");
+
+    // then
+    EXPECT_EQ(1, twoDa->indexByCellValue("label", "b"));
+    EXPECT_EQ(1, twoDa->indexByCellValue(label, "b"));
+    EXPECT_EQ(-1, twoDa->indexByCellValue(label, "c"));
+    EXPECT_EQ(-1, twoDa->indexByCellValue("missing", "a"));
+    EXPECT_EQ(2, twoDa->indexByCellValues({{"label", "b"}, {"value", "3"}}));
+}
+
+TEST(TwoDA, DISABLED_benchmark_lookup) {
+    // given: appearance.2da-sized table, looked up the way the previous
+    // implementation did, with a linear column search and parsing on every
+    // access
+    static constexpr int kNumRows = 700;
+    static constexpr int kNumColumns = 90;
+    static constexpr int kNumIterations = 50;
+    auto columns = std::vector<std::string>();
+    for (int i = 0; i < kNumColumns; ++i) {
+        columns.push_back("column" + std::to_string(i));
+    }
+    auto rows = std::vector<TwoDA::Row>();
+    for (int row = 0; row < kNumRows; ++row) {
+        auto values = std::vector<std::string>();
+        for (int col = 0; col < kNumColumns; ++col) {
+            values.push_back(std::to_string((row * col) % 97));
+        }
+        rows.push_back(TwoDA::newRow(std::move(values)));
+    }
+    auto twoDa = TwoDA(columns, rows);
+    auto lookedUp = std::vector<std::string> {"column3", "column45", "column80", "column89"};
+
+    // when
+    auto measure = [](auto lookup) {
+        auto start = std::chrono::steady_clock::now();
+        int64_t sum = 0;
+        for (int i = 0; i < kNumIterations; ++i) {
+            for (int row = 0; row < kNumRows; ++row) {
+                sum += lookup(row);
+            }
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(elapsed / (kNumIterations * kNumRows), sum);
+    };
+    auto linear = measure([&](int row) {
+        int sum = 0;
+        for (auto &name : lookedUp) {
+            int idx = static_cast<int>(std::distance(columns.begin(), std::find(columns.begin(), columns.end(), name)));
+            sum += stoi(rows[row].values[idx]);
+        }
+        return sum;
+    });
+    auto byName = measure([&](int row) {
+        int sum = 0;
+        for (auto &name : lookedUp) {
+            sum += twoDa.getInt(row, name);
+        }
+        return sum;
+    });
+    auto handles = std::vector<TwoDA::Column>();
+    for (auto &name : lookedUp) {
+        handles.push_back(twoDa.column(name));
+    }
+    auto byHandle = measure([&](int row) {
+        int sum = 0;
+        for (auto &column : handles) {
+            sum += twoDa.getInt(row, column);
+        }
+        return sum;
+    });
+
+    // then
+    std::cout << "Linear search and parse: " << linear.first << " ns/row" << std::endl;
+    std::cout << "TwoDA by name: " << byName.first << " ns/row" << std::endl;
+    std::cout << "TwoDA by handle: " << byHandle.first << " ns/row" << std::endl;
+    EXPECT_EQ(linear.second, byName.second);
+    EXPECT_EQ(linear.second, byHandle.second);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/accessrecorder.h"
+#include "reone/resource/container/memory.h"
+#include "reone/resource/provider/2das.h"
+#include "reone/resource/resources.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static ByteBuffer make2DA() {
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    stream.write("2DA V2.b\n", 9);
+    stream.write("label\t\0", 7);
+    stream.write("\x00\x00\x00\x00", 4);
+    stream.write("\x00\x00\x00\x00", 4);
+    return bytes;
+}
+
+TEST(ResourceAccessRecorder, should_record_first_access_of_resources_per_module) {
+    // given
+    auto resources = Resources();
+    auto container = std::make_unique<MemoryResourceContainer>();
+    container->add(ResourceId("appearance", ResType::TwoDA), make2DA());
+    container->add(ResourceId("end_trask", ResType::Utc), ByteBuffer(5, '\0'));
+    resources.add(std::move(container), ContainerKind::Global, "templates.bif");
+    auto twoDas = TwoDAs(resources);
+    auto recorder = ResourceAccessRecorder();
+    resources.setAccessRecorder(&recorder);
+
+    // when
+    recorder.beginModule("end_m01aa");
+    recorder.advanceFrame();
+    twoDas.get("appearance");
+    recorder.advanceFrame();
+    resources.find(ResourceId("end_trask", ResType::Utc));
+    resources.find(ResourceId("end_trask", ResType::Utc));
+    resources.find(ResourceId("missing", ResType::Utc));
+    recorder.beginModule("end_m01ab");
+    recorder.advanceFrame();
+    resources.find(ResourceId("end_trask", ResType::Utc));
+    resources.setAccessRecorder(nullptr);
+    resources.find(ResourceId("appearance", ResType::TwoDA));
+
+    // then
+    auto records = recorder.records();
+    ASSERT_EQ(3ll, records.size());
+    EXPECT_EQ("end_m01aa", records[0].module);
+    EXPECT_EQ(ResourceId("appearance", ResType::TwoDA), records[0].id);
+    EXPECT_EQ("templates.bif", records[0].container);
+    EXPECT_EQ(make2DA().size(), records[0].size);
+    EXPECT_LE(0, records[0].decodeMicros);
+    EXPECT_EQ(1, records[0].frame);
+    EXPECT_EQ("end_m01aa", records[1].module);
+    EXPECT_EQ(ResourceId("end_trask", ResType::Utc), records[1].id);
+    EXPECT_EQ(5, records[1].size);
+    EXPECT_EQ(2, records[1].frame);
+    EXPECT_EQ("end_m01ab", records[2].module);
+    EXPECT_EQ(ResourceId("end_trask", ResType::Utc), records[2].id);
+    EXPECT_EQ(3, records[2].frame);
+}
+
+TEST(ResourceAccessRecorder, should_save_records_as_tab_separated_lines) {
+    // given
+    auto recorder = ResourceAccessRecorder();
+    recorder.beginModule("end_m01aa");
+    recorder.advanceFrame();
+    recorder.recordAccess(ResourceId("end_trask", ResType::Utc), "end_m01aa_s.rim", 128);
+    recorder.recordDecode(ResourceId("end_trask", ResType::Utc), std::chrono::microseconds(42));
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+
+    // when
+    recorder.save(stream);
+
+    // then
+    EXPECT_EQ("end_m01aa\tend_trask.utc\tend_m01aa_s.rim\t128\t42\t1\n", std::string(bytes.begin(), bytes.end()));
+}
+
+TEST(ResourceAccessRecorder, should_record_warmed_up_resources_when_hit_in_cache) {
+    // given
+    auto resources = Resources();
+    auto container = std::make_unique<MemoryResourceContainer>();
+    container->add(ResourceId("end_trask", ResType::Utc), ByteBuffer(5, '\0'));
+    container->add(ResourceId("k_ai_master", ResType::Ncs), ByteBuffer(3, '\0'));
+    resources.add(std::move(container), ContainerKind::Global, "end_m01aa_s.rim");
+    auto recorder = ResourceAccessRecorder();
+    resources.setAccessRecorder(&recorder);
+    recorder.beginModule("end_m01aa");
+
+    // when
+    {
+        auto warmUp = ScopedWarmUp();
+        resources.find(ResourceId("end_trask", ResType::Utc));
+        resources.find(ResourceId("k_ai_master", ResType::Ncs));
+        recorder.recordCacheHit(ResourceId("end_trask", ResType::Utc));
+    }
+    recorder.advanceFrame();
+    recorder.recordCacheHit(ResourceId("end_trask", ResType::Utc));
+    recorder.recordCacheHit(ResourceId("end_trask", ResType::Utc));
+    recorder.recordCacheHit(ResourceId("missing", ResType::Utc));
+    resources.setAccessRecorder(nullptr);
+
+    // then
+    auto records = recorder.records();
+    ASSERT_EQ(1ll, records.size());
+    EXPECT_EQ(ResourceId("end_trask", ResType::Utc), records[0].id);
+    EXPECT_EQ("end_m01aa_s.rim", records[0].container);
+    EXPECT_EQ(5, records[0].size);
+    EXPECT_EQ(1, records[0].frame);
+}
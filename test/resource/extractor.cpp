@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/extractor.h"
+#include "reone/resource/format/erfwriter.h"
+#include "reone/resource/format/rimwriter.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static ByteBuffer readFile(const std::filesystem::path &path) {
+    auto stream = std::ifstream(path, std::ios::binary);
+    return ByteBuffer(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+static ByteBuffer makeData(size_t size, int seed) {
+    auto data = ByteBuffer(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>((i * 31 + seed) % 251);
+    }
+    return data;
+}
+
+TEST(ArchiveExtractor, should_extract_erf_resources_identically_regardless_of_task_count) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_extractor_erf");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directory(tmpDirPath);
+
+    std::map<std::string, ByteBuffer> expected;
+    auto writer = ErfWriter();
+    for (int i = 0; i < 24; ++i) {
+        // Every fifth resource is larger than the copy buffer
+        auto resRef = str(boost::format("res%02d") % i);
+        auto resType = (i % 2) ? ResType::Utc : ResType::Dlg;
+        auto data = makeData((i % 5 == 0) ? (1536 * 1024 + i) : (100 * i), i);
+        expected[ResourceId(resRef, resType).string()] = data;
+        writer.add(ErfWriter::Resource {resRef, resType, std::move(data)});
+    }
+    auto erfPath = tmpDirPath / "fixture.mod";
+    writer.save(ErfWriter::FileType::MOD, erfPath);
+
+    auto threadPool = ThreadPool(4);
+    threadPool.init();
+
+    // when
+    auto extractor = ArchiveExtractor(erfPath);
+    extractor.load();
+    extractor.extract(extractor.entries(), tmpDirPath / "single");
+    extractor.extract(extractor.entries(), tmpDirPath / "multi", &threadPool, 4);
+
+    // then
+    ASSERT_EQ(24ll, extractor.entries().size());
+    for (auto &[filename, data] : expected) {
+        EXPECT_EQ(data, readFile(tmpDirPath / "single" / filename)) << filename;
+        EXPECT_EQ(data, readFile(tmpDirPath / "multi" / filename)) << filename;
+    }
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(ArchiveExtractor, should_extract_filtered_rim_resources) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_extractor_rim");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto writer = RimWriter();
+    writer.add(RimWriter::Resource {"m01aa", ResType::Are, ByteBuffer {'A', 'r', 'e'}});
+    writer.add(RimWriter::Resource {"m01aa", ResType::Git, ByteBuffer {'G', 'i', 't'}});
+    writer.add(RimWriter::Resource {"n_guard", ResType::Utc, ByteBuffer {'U', 't', 'c'}});
+    auto rimPath = tmpDirPath / "fixture.rim";
+    writer.save(rimPath);
+
+    auto filter = ArchiveExtractor::Filter();
+    filter.types = {ResType::Are, ResType::Git};
+    filter.pattern = "M01*.?r?";
+
+    // when
+    auto extractor = ArchiveExtractor(rimPath);
+    extractor.load();
+    auto entries = extractor.entries(filter);
+    extractor.extract(entries, tmpDirPath / "out");
+
+    // then
+    ASSERT_EQ(1ll, entries.size());
+    EXPECT_EQ("m01aa.are", entries[0].resId.string());
+    EXPECT_EQ((ByteBuffer {'A', 'r', 'e'}), readFile(tmpDirPath / "out" / "m01aa.are"));
+    EXPECT_FALSE(std::filesystem::exists(tmpDirPath / "out" / "m01aa.git"));
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(ArchiveExtractor, should_match_glob_patterns) {
+    // expect
+    EXPECT_TRUE(matchesGlob("m01aa.are", "*"));
+    EXPECT_TRUE(matchesGlob("m01aa.are", "*.are"));
+    EXPECT_TRUE(matchesGlob("m01aa.are", "M01??.ARE"));
+    EXPECT_TRUE(matchesGlob("m01aa.are", "m*a*.a*e"));
+    EXPECT_FALSE(matchesGlob("m01aa.are", "*.git"));
+    EXPECT_FALSE(matchesGlob("m01aa.are", "m01?.are"));
+    EXPECT_FALSE(matchesGlob("m01aa.are", ""));
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffstreamwriter.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/system/stream/memoryoutput.h"
+#include "reone/system/stringbuilder.h"
+
+#include "../../checkutil.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::string saveTree(const Gff &root) {
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    GffWriter(ResType::Git, root).save(stream);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+static std::string saveStream(GffStreamWriter &writer) {
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    writer.save(stream);
+    return std::string(bytes.begin(), bytes.end());
+}
+
+static void writeCreature(GffStreamWriter &writer, int i) {
+    writer.beginListItem(4);
+    writer.writeResRef("TemplateResRef", "n_creature" + std::to_string(i % 10));
+    writer.writeFloat("XPosition", static_cast<float>(i));
+    writer.writeFloat("YPosition", static_cast<float>(2 * i));
+    writer.writeCExoLocString("LocName", -1, "Creature " + std::to_string(i));
+    writer.beginStruct("Stats", 7);
+    writer.writeByte("Str", i % 20);
+    writer.writeShort("HP", -i);
+    writer.endStruct();
+    writer.beginList("Items");
+    for (int j = 0; j < i % 3; ++j) {
+        writer.beginListItem(0);
+        writer.writeResRef("ItemResRef", "g_i_item" + std::to_string(j));
+        writer.endStruct();
+    }
+    writer.endList();
+    writer.endStruct();
+}
+
+static std::shared_ptr<Gff> makeCreature(int i) {
+    auto items = std::vector<std::shared_ptr<Gff>>();
+    for (int j = 0; j < i % 3; ++j) {
+        items.push_back(Gff::Builder()
+                            .field(Gff::Field::newResRef("ItemResRef", "g_i_item" + std::to_string(j)))
+                            .build());
+    }
+    return Gff::Builder()
+        .type(4)
+        .field(Gff::Field::newResRef("TemplateResRef", "n_creature" + std::to_string(i % 10)))
+        .field(Gff::Field::newFloat("XPosition", static_cast<float>(i)))
+        .field(Gff::Field::newFloat("YPosition", static_cast<float>(2 * i)))
+        .field(Gff::Field::newCExoLocString("LocName", -1, "Creature " + std::to_string(i)))
+        .field(Gff::Field::newStruct(
+            "Stats",
+            Gff::Builder()
+                .type(7)
+                .field(Gff::Field::newByte("Str", i % 20))
+                .field(Gff::Field::newShort("HP", -i))
+                .build()))
+        .field(Gff::Field::newList("Items", std::move(items)))
+        .build();
+}
+
+static std::shared_ptr<Gff> makeTree(int numCreatures) {
+    auto creatures = std::vector<std::shared_ptr<Gff>>();
+    for (int i = 0; i < numCreatures; ++i) {
+        creatures.push_back(makeCreature(i));
+    }
+    return Gff::Builder()
+        .type(0xffffffff)
+        .field(Gff::Field::newDword("Version", 3))
+        .field(Gff::Field::newList("Creature List", std::move(creatures)))
+        .field(Gff::Field::newDouble("Time", 1.5))
+        .field(Gff::Field::newVoid("Blob", ByteBuffer {1, 2, 3}))
+        .field(Gff::Field::newOrientation("Orientation", glm::quat(1.0f, 0.0f, 0.0f, 0.0f)))
+        .field(Gff::Field::newVector("Position", glm::vec3(1.0f, 2.0f, 3.0f)))
+        .field(Gff::Field::newInt64("Int64", -4))
+        .field(Gff::Field::newList("Empty List", {}))
+        .build();
+}
+
+static void writeTree(GffStreamWriter &writer, int numCreatures) {
+    writer.writeDword("Version", 3);
+    writer.beginList("Creature List");
+    for (int i = 0; i < numCreatures; ++i) {
+        writeCreature(writer, i);
+    }
+    writer.endList();
+    writer.writeDouble("Time", 1.5);
+    writer.writeVoid("Blob", ByteBuffer {1, 2, 3});
+    writer.writeOrientation("Orientation", glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    writer.writeVector("Position", glm::vec3(1.0f, 2.0f, 3.0f));
+    writer.writeInt64("Int64", -4);
+    writer.beginList("Empty List");
+    writer.endList();
+}
+
+/**
+ * Output of GffWriter for makeTree(2), captured before GffWriter was backed by
+ * GffStreamWriter.
+ */
+static std::string treeFixture() {
+    return StringBuilder()
+        // header
+        .append("GIT V3.2")
+        .append("\x38\x00\x00\x00", 4) // offset to structs
+        .append("\x06\x00\x00\x00", 4) // number of structs
+        .append("\x80\x00\x00\x00", 4) // offset to fields
+        .append("\x19\x00\x00\x00", 4) // number of fields
+        .append("\xac\x01\x00\x00", 4) // offset to labels
+        .append("\x11\x00\x00\x00", 4) // number of labels
+        .append("\xbc\x02\x00\x00", 4) // offset to field data
+        .append("\x91\x00\x00\x00", 4) // size of field data
+        .append("\x4d\x03\x00\x00", 4) // offset to field indices
+        .append("\x60\x00\x00\x00", 4) // size of field indices
+        .append("\xad\x03\x00\x00", 4) // offset to list indices
+        .append("\x1c\x00\x00\x00", 4) // size of list indices
+        // structs
+        .append("\xff\xff\xff\xff", 4) // 0: type
+        .append("\x00\x00\x00\x00", 4) // 0: data offset
+        .append("\x08\x00\x00\x00", 4) // 0: field count
+        .append("\x04\x00\x00\x00", 4) // 1: type
+        .append("\x20\x00\x00\x00", 4) // 1: data offset
+        .append("\x06\x00\x00\x00", 4) // 1: field count
+        .append("\x04\x00\x00\x00", 4) // 2: type
+        .append("\x38\x00\x00\x00", 4) // 2: data offset
+        .append("\x06\x00\x00\x00", 4) // 2: field count
+        .append("\x07\x00\x00\x00", 4) // 3: type
+        .append("\x50\x00\x00\x00", 4) // 3: data offset
+        .append("\x02\x00\x00\x00", 4) // 3: field count
+        .append("\x07\x00\x00\x00", 4) // 4: type
+        .append("\x58\x00\x00\x00", 4) // 4: data offset
+        .append("\x02\x00\x00\x00", 4) // 4: field count
+        .append("\x00\x00\x00\x00", 4) // 5: type
+        .append("\x18\x00\x00\x00", 4) // 5: data offset
+        .append("\x01\x00\x00\x00", 4) // 5: field count
+        // fields
+        .append("\x04\x00\x00\x00", 4) // 0: type
+        .append("\x00\x00\x00\x00", 4) // 0: label index
+        .append("\x03\x00\x00\x00", 4) // 0: data
+        .append("\x0f\x00\x00\x00", 4) // 1: type
+        .append("\x01\x00\x00\x00", 4) // 1: label index
+        .append("\x00\x00\x00\x00", 4) // 1: data
+        .append("\x09\x00\x00\x00", 4) // 2: type
+        .append("\x02\x00\x00\x00", 4) // 2: label index
+        .append("\x00\x00\x00\x00", 4) // 2: data
+        .append("\x0d\x00\x00\x00", 4) // 3: type
+        .append("\x03\x00\x00\x00", 4) // 3: label index
+        .append("\x08\x00\x00\x00", 4) // 3: data
+        .append("\x10\x00\x00\x00", 4) // 4: type
+        .append("\x04\x00\x00\x00", 4) // 4: label index
+        .append("\x0f\x00\x00\x00", 4) // 4: data
+        .append("\x11\x00\x00\x00", 4) // 5: type
+        .append("\x05\x00\x00\x00", 4) // 5: label index
+        .append("\x1f\x00\x00\x00", 4) // 5: data
+        .append("\x07\x00\x00\x00", 4) // 6: type
+        .append("\x06\x00\x00\x00", 4) // 6: label index
+        .append("\x2b\x00\x00\x00", 4) // 6: data
+        .append("\x0f\x00\x00\x00", 4) // 7: type
+        .append("\x07\x00\x00\x00", 4) // 7: label index
+        .append("\x0c\x00\x00\x00", 4) // 7: data
+        .append("\x0b\x00\x00\x00", 4) // 8: type
+        .append("\x08\x00\x00\x00", 4) // 8: label index
+        .append("\x33\x00\x00\x00", 4) // 8: data
+        .append("\x08\x00\x00\x00", 4) // 9: type
+        .append("\x09\x00\x00\x00", 4) // 9: label index
+        .append("\x00\x00\x00\x00", 4) // 9: data
+        .append("\x08\x00\x00\x00", 4) // 10: type
+        .append("\x0a\x00\x00\x00", 4) // 10: label index
+        .append("\x00\x00\x00\x00", 4) // 10: data
+        .append("\x0c\x00\x00\x00", 4) // 11: type
+        .append("\x0b\x00\x00\x00", 4) // 11: label index
+        .append("\x3f\x00\x00\x00", 4) // 11: data
+        .append("\x0e\x00\x00\x00", 4) // 12: type
+        .append("\x0c\x00\x00\x00", 4) // 12: label index
+        .append("\x03\x00\x00\x00", 4) // 12: data
+        .append("\x0f\x00\x00\x00", 4) // 13: type
+        .append("\x0d\x00\x00\x00", 4) // 13: label index
+        .append("\x10\x00\x00\x00", 4) // 13: data
+        .append("\x0b\x00\x00\x00", 4) // 14: type
+        .append("\x08\x00\x00\x00", 4) // 14: label index
+        .append("\x5d\x00\x00\x00", 4) // 14: data
+        .append("\x08\x00\x00\x00", 4) // 15: type
+        .append("\x09\x00\x00\x00", 4) // 15: label index
+        .append("\x00\x00\x80\x3f", 4) // 15: data
+        .append("\x08\x00\x00\x00", 4) // 16: type
+        .append("\x0a\x00\x00\x00", 4) // 16: label index
+        .append("\x00\x00\x00\x40", 4) // 16: data
+        .append("\x0c\x00\x00\x00", 4) // 17: type
+        .append("\x0b\x00\x00\x00", 4) // 17: label index
+        .append("\x69\x00\x00\x00", 4) // 17: data
+        .append("\x0e\x00\x00\x00", 4) // 18: type
+        .append("\x0c\x00\x00\x00", 4) // 18: label index
+        .append("\x04\x00\x00\x00", 4) // 18: data
+        .append("\x0f\x00\x00\x00", 4) // 19: type
+        .append("\x0d\x00\x00\x00", 4) // 19: label index
+        .append("\x14\x00\x00\x00", 4) // 19: data
+        .append("\x00\x00\x00\x00", 4) // 20: type
+        .append("\x0e\x00\x00\x00", 4) // 20: label index
+        .append("\x00\x00\x00\x00", 4) // 20: data
+        .append("\x03\x00\x00\x00", 4) // 21: type
+        .append("\x0f\x00\x00\x00", 4) // 21: label index
+        .append("\x00\x00\x00\x00", 4) // 21: data
+        .append("\x00\x00\x00\x00", 4) // 22: type
+        .append("\x0e\x00\x00\x00", 4) // 22: label index
+        .append("\x01\x00\x00\x00", 4) // 22: data
+        .append("\x03\x00\x00\x00", 4) // 23: type
+        .append("\x0f\x00\x00\x00", 4) // 23: label index
+        .append("\xff\xff\xff\xff", 4) // 23: data
+        .append("\x0b\x00\x00\x00", 4) // 24: type
+        .append("\x10\x00\x00\x00", 4) // 24: label index
+        .append("\x87\x00\x00\x00", 4) // 24: data
+        // labels
+        .append("Version\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Creature List\x00\x00\x00", 16)
+        .append("Time\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Blob\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Orientation\x00\x00\x00\x00\x00", 16)
+        .append("Position\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Int64\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Empty List\x00\x00\x00\x00\x00\x00", 16)
+        .append("TemplateResRef\x00\x00", 16)
+        .append("XPosition\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("YPosition\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("LocName\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Stats\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Items\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("Str\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("HP\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("ItemResRef\x00\x00\x00\x00\x00\x00", 16)
+        // field data
+        .append("\x00\x00\x00\x00\x00\x00\xf8\x3f", 8)
+        .append("\x03\x00\x00\x00\x01\x02\x03", 7)
+        .append("\x00\x00\x80\x3f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 16)
+        .append("\x00\x00\x80\x3f\x00\x00\x00\x40\x00\x00\x40\x40", 12)
+        .append("\xfc\xff\xff\xff\xff\xff\xff\xff", 8)
+        .append("\x0bn_creature0", 12)
+        .append("\x1a\x00\x00\x00\xff\xff\xff\xff\x01\x00\x00\x00\x00\x00\x00\x00\x0a\x00\x00\x00" "Creature 0", 30)
+        .append("\x0bn_creature1", 12)
+        .append("\x1a\x00\x00\x00\xff\xff\xff\xff\x01\x00\x00\x00\x00\x00\x00\x00\x0a\x00\x00\x00" "Creature 1", 30)
+        .append("\x09g_i_item0", 10)
+        // field indices
+        .append("\x00\x00\x00\x00", 4)
+        .append("\x01\x00\x00\x00", 4)
+        .append("\x02\x00\x00\x00", 4)
+        .append("\x03\x00\x00\x00", 4)
+        .append("\x04\x00\x00\x00", 4)
+        .append("\x05\x00\x00\x00", 4)
+        .append("\x06\x00\x00\x00", 4)
+        .append("\x07\x00\x00\x00", 4)
+        .append("\x08\x00\x00\x00", 4)
+        .append("\x09\x00\x00\x00", 4)
+        .append("\x0a\x00\x00\x00", 4)
+        .append("\x0b\x00\x00\x00", 4)
+        .append("\x0c\x00\x00\x00", 4)
+        .append("\x0d\x00\x00\x00", 4)
+        .append("\x0e\x00\x00\x00", 4)
+        .append("\x0f\x00\x00\x00", 4)
+        .append("\x10\x00\x00\x00", 4)
+        .append("\x11\x00\x00\x00", 4)
+        .append("\x12\x00\x00\x00", 4)
+        .append("\x13\x00\x00\x00", 4)
+        .append("\x14\x00\x00\x00", 4)
+        .append("\x15\x00\x00\x00", 4)
+        .append("\x16\x00\x00\x00", 4)
+        .append("\x17\x00\x00\x00", 4)
+        // list indices
+        .append("\x02\x00\x00\x00", 4)
+        .append("\x01\x00\x00\x00", 4)
+        .append("\x02\x00\x00\x00", 4)
+        .append("\x00\x00\x00\x00", 4)
+        .append("\x00\x00\x00\x00", 4)
+        .append("\x01\x00\x00\x00", 4)
+        .append("\x05\x00\x00\x00", 4)
+        .string();
+}
+
+TEST(GffStreamWriter, should_write_same_bytes_as_tree_based_gff_writer) {
+    // given
+    auto expectedOutput = treeFixture();
+    auto writer = GffStreamWriter(ResType::Git);
+    writeTree(writer, 2);
+
+    // when
+    auto actualOutput = saveStream(writer);
+
+    // then
+    EXPECT_EQ(expectedOutput, actualOutput) << notEqualMessage(expectedOutput, actualOutput);
+}
+
+TEST(GffStreamWriter, should_keep_gff_writer_output_unchanged) {
+    // given
+    auto expectedOutput = treeFixture();
+
+    // when
+    auto actualOutput = saveTree(*makeTree(2));
+
+    // then
+    EXPECT_EQ(expectedOutput, actualOutput) << notEqualMessage(expectedOutput, actualOutput);
+}
+
+TEST(GffStreamWriter, should_throw_on_unbalanced_structs_and_lists) {
+    // given
+    auto unclosed = GffStreamWriter(ResType::Git);
+    unclosed.beginList("List");
+    auto orphanItem = GffStreamWriter(ResType::Git);
+    auto extraEnd = GffStreamWriter(ResType::Git);
+
+    // when, then
+    EXPECT_THROW(saveStream(unclosed), std::logic_error);
+    EXPECT_THROW(orphanItem.beginListItem(0), std::logic_error);
+    EXPECT_THROW(extraEnd.endStruct(), std::logic_error);
+    EXPECT_THROW(extraEnd.endList(), std::logic_error);
+}
+
+TEST(GffStreamWriter, DISABLED_benchmark_save_time) {
+    // given
+    static constexpr int kNumCreatures = 20000;
+    static constexpr int kNumIterations = 10;
+
+    // when
+    auto measure = [](auto save) {
+        auto start = std::chrono::steady_clock::now();
+        size_t size = 0;
+        for (int i = 0; i < kNumIterations; ++i) {
+            size += save().size();
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(1000.0 * elapsed / kNumIterations, size);
+    };
+    auto tree = measure([]() {
+        return saveTree(*makeTree(kNumCreatures));
+    });
+    auto streamed = measure([]() {
+        auto writer = GffStreamWriter(ResType::Git);
+        writeTree(writer, kNumCreatures);
+        return saveStream(writer);
+    });
+
+    // then
+    std::cout << "Gff + GffWriter: " << tree.first << " ms" << std::endl;
+    std::cout << "GffStreamWriter: " << streamed.first << " ms" << std::endl;
+    EXPECT_EQ(tree.second, streamed.second);
+}
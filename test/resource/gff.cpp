@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::shared_ptr<Gff> makeStruct(int numFields) {
+    std::vector<Gff::Field> fields;
+    for (int i = 0; i < numFields; ++i) {
+        fields.push_back(Gff::Field::newInt(str(boost::format("Field%d") % i), i));
+    }
+    return std::make_shared<Gff>(0, std::move(fields));
+}
+
+TEST(GffLabel, should_intern_labels) {
+    // given
+    auto tag = GffLabel("Tag");
+
+    // expect
+    EXPECT_EQ(tag, GffLabel(std::string("Tag")));
+    EXPECT_NE(tag, GffLabel("tag"));
+    EXPECT_EQ("Tag", tag.name());
+    EXPECT_EQ(tag, GffLabel::find("Tag"));
+    EXPECT_FALSE(GffLabel::find("NeverInternedLabel"));
+    EXPECT_EQ(GffLabel(), GffLabel(""));
+}
+
+TEST(Gff, should_find_fields_by_name_and_label_in_small_and_large_structs) {
+    for (auto numFields : {4, 40}) {
+        // given
+        auto gff = makeStruct(numFields);
+        gff->mutableFields().push_back(Gff::Field::newInt("Field1", -1));
+        gff->reindex();
+
+        // expect
+        for (int i = 0; i < numFields; ++i) {
+            auto name = str(boost::format("Field%d") % i);
+            EXPECT_EQ(i, gff->getInt(name, -2)) << name;
+            EXPECT_EQ(i, gff->getInt(GffLabel(name), -2)) << name;
+        }
+        EXPECT_EQ(-2, gff->getInt("Missing", -2));
+        EXPECT_EQ(-2, gff->getInt(GffLabel("Missing"), -2));
+        EXPECT_EQ(-2, gff->getInt("NeverInternedLabel", -2));
+    }
+}
+
+TEST(Gff, should_find_fields_after_mutation) {
+    // given
+    auto gff = makeStruct(40);
+    EXPECT_EQ(3, gff->getInt("Field3", -1));
+
+    // when
+    gff->mutableFields()[3].setLabel("Renamed");
+    gff->mutableFields().push_back(Gff::Field::newInt("Appended", 100));
+
+    // then
+    EXPECT_EQ(3, gff->getInt("Renamed", -1));
+    EXPECT_EQ(3, gff->getInt(GffLabel("Renamed"), -1));
+    EXPECT_EQ(-1, gff->getInt("Field3", -1));
+    EXPECT_EQ(100, gff->getInt("Appended", -1));
+}
+
+static std::shared_ptr<Gff> makeCreatureBlueprint() {
+    // Top-level fields of a stock UTC, in the order the toolset writes them
+    std::vector<Gff::Field> fields;
+    fields.push_back(Gff::Field::newResRef("TemplateResRef", "n_commoner01"));
+    fields.push_back(Gff::Field::newByte("Race", 6));
+    fields.push_back(Gff::Field::newByte("SubraceIndex", 0));
+    fields.push_back(Gff::Field::newCExoLocString("FirstName", 12345, ""));
+    fields.push_back(Gff::Field::newCExoLocString("LastName", -1, ""));
+    fields.push_back(Gff::Field::newWord("Appearance_Type", 136));
+    fields.push_back(Gff::Field::newByte("Gender", 0));
+    fields.push_back(Gff::Field::newInt("Phenotype", 0));
+    fields.push_back(Gff::Field::newWord("PortraitId", 0));
+    fields.push_back(Gff::Field::newCExoLocString("Description", -1, ""));
+    fields.push_back(Gff::Field::newCExoString("Tag", "Commoner01"));
+    fields.push_back(Gff::Field::newResRef("Conversation", "commoner01"));
+    fields.push_back(Gff::Field::newByte("IsPC", 0));
+    fields.push_back(Gff::Field::newWord("FactionID", 5));
+    fields.push_back(Gff::Field::newByte("Disarmable", 1));
+    fields.push_back(Gff::Field::newCExoString("Subrace", ""));
+    fields.push_back(Gff::Field::newCExoString("Deity", ""));
+    fields.push_back(Gff::Field::newWord("SoundSetFile", 0));
+    fields.push_back(Gff::Field::newByte("Plot", 0));
+    fields.push_back(Gff::Field::newByte("Interruptable", 1));
+    fields.push_back(Gff::Field::newByte("NoPermDeath", 0));
+    fields.push_back(Gff::Field::newByte("NotReorienting", 0));
+    fields.push_back(Gff::Field::newByte("BodyVariation", 0));
+    fields.push_back(Gff::Field::newByte("TextureVar", 1));
+    fields.push_back(Gff::Field::newByte("Min1HP", 0));
+    fields.push_back(Gff::Field::newByte("PartyInteract", 0));
+    fields.push_back(Gff::Field::newInt("WalkRate", 7));
+    fields.push_back(Gff::Field::newByte("NaturalAC", 0));
+    fields.push_back(Gff::Field::newShort("HitPoints", 8));
+    fields.push_back(Gff::Field::newShort("CurrentHitPoints", 8));
+    fields.push_back(Gff::Field::newShort("MaxHitPoints", 8));
+    fields.push_back(Gff::Field::newShort("ForcePoints", 0));
+    fields.push_back(Gff::Field::newShort("CurrentForce", 0));
+    fields.push_back(Gff::Field::newShort("refbonus", 0));
+    fields.push_back(Gff::Field::newShort("willbonus", 0));
+    fields.push_back(Gff::Field::newShort("fortbonus", 0));
+    fields.push_back(Gff::Field::newByte("GoodEvil", 50));
+    fields.push_back(Gff::Field::newByte("LawfulChaotic", 0));
+    fields.push_back(Gff::Field::newFloat("ChallengeRating", 1.0f));
+    fields.push_back(Gff::Field::newByte("PerceptionRange", 11));
+    fields.push_back(Gff::Field::newResRef("ScriptHeartbeat", "k_def_heartbt01"));
+    fields.push_back(Gff::Field::newResRef("ScriptOnNotice", "k_def_percept01"));
+    fields.push_back(Gff::Field::newResRef("ScriptSpellAt", "k_def_spellat01"));
+    fields.push_back(Gff::Field::newResRef("ScriptAttacked", "k_def_attacked01"));
+    fields.push_back(Gff::Field::newResRef("ScriptDamaged", "k_def_damage01"));
+    fields.push_back(Gff::Field::newResRef("ScriptDisturbed", "k_def_disturb01"));
+    fields.push_back(Gff::Field::newResRef("ScriptEndRound", "k_def_combend01"));
+    fields.push_back(Gff::Field::newResRef("ScriptEndDialogu", ""));
+    fields.push_back(Gff::Field::newResRef("ScriptDialogue", "k_def_dialogue01"));
+    fields.push_back(Gff::Field::newResRef("ScriptSpawn", "k_def_spawn01"));
+    fields.push_back(Gff::Field::newResRef("ScriptRested", ""));
+    fields.push_back(Gff::Field::newResRef("ScriptDeath", "k_def_death01"));
+    fields.push_back(Gff::Field::newResRef("ScriptUserDefine", "k_def_userdef01"));
+    fields.push_back(Gff::Field::newResRef("ScriptOnBlocked", "k_def_blocked01"));
+    fields.push_back(Gff::Field::newByte("Str", 10));
+    fields.push_back(Gff::Field::newByte("Dex", 10));
+    fields.push_back(Gff::Field::newByte("Con", 10));
+    fields.push_back(Gff::Field::newByte("Int", 10));
+    fields.push_back(Gff::Field::newByte("Wis", 10));
+    fields.push_back(Gff::Field::newByte("Cha", 10));
+    fields.push_back(Gff::Field::newByte("BodyBag", 0));
+    fields.push_back(Gff::Field::newDword("Experience", 0));
+    fields.push_back(Gff::Field::newResRef("PaletteID", ""));
+    fields.push_back(Gff::Field::newCExoString("Comment", ""));
+    std::vector<std::shared_ptr<Gff>> classes;
+    classes.push_back(std::make_shared<Gff>(2, std::vector<Gff::Field> {Gff::Field::newInt("Class", 6), Gff::Field::newShort("ClassLevel", 1)}));
+    fields.push_back(Gff::Field::newList("ClassList", std::move(classes)));
+    std::vector<std::shared_ptr<Gff>> skills;
+    for (int i = 0; i < 8; ++i) {
+        skills.push_back(std::make_shared<Gff>(0, std::vector<Gff::Field> {Gff::Field::newByte("Rank", 0)}));
+    }
+    fields.push_back(Gff::Field::newList("SkillList", std::move(skills)));
+    fields.push_back(Gff::Field::newList("FeatList", {}));
+    fields.push_back(Gff::Field::newList("Equip_ItemList", {}));
+    fields.push_back(Gff::Field::newList("ItemList", {}));
+    return std::make_shared<Gff>(0xffffffff, std::move(fields));
+}
+
+TEST(Gff, DISABLED_benchmark_field_lookup) {
+    // given
+    auto utc = makeCreatureBlueprint();
+    auto bytes = ByteBuffer();
+    auto output = MemoryOutputStream(bytes);
+    GffWriter(ResType::Utc, *utc).save(output);
+    auto input = MemoryInputStream(bytes);
+    auto reader = GffReader(input);
+    reader.load();
+    const Gff &gff = *reader.root();
+
+    // Labels read by Object::deserialize and Creature::deserialize, including
+    // those only present in GIT instances and saved games
+    std::vector<std::string> names {
+        "Tag", "TemplateResRef", "Conversation", "ScriptHeartbeat", "ScriptUserDefine", "Min1HP", "Plot",
+        "Commandable", "Interruptable", "HitPoints", "MaxHitPoints", "CurrentHitPoints", "X", "XPosition",
+        "Y", "YPosition", "Z", "ZPosition", "XOrientation", "YOrientation", "Bearing", "ItemList",
+        "TemplateResRef", "Race", "SubraceIndex", "Appearance_Type", "PM_IsDisguised", "Gender", "PortraitId",
+        "IsPC", "FactionID", "Disarmable", "NoPermDeath", "NotReorienting", "BodyVariation", "TextureVar",
+        "PartyInteract", "WalkRate", "NaturalAC", "ForcePoints", "CurrentForce", "refbonus", "willbonus",
+        "fortbonus", "GoodEvil", "ChallengeRating", "Experience", "ScriptOnNotice", "ScriptSpellAt",
+        "ScriptAttacked", "ScriptDamaged", "ScriptDisturbed", "ScriptEndRound", "ScriptEndDialogu",
+        "ScriptDialogue", "ScriptSpawn", "ScriptDeath", "ScriptOnBlocked", "FirstName", "LastName",
+        "SoundSetFile", "BodyBag", "Str", "Dex", "Con", "Int", "Wis", "Cha", "ClassList", "SkillList",
+        "FeatList", "PerceptionRange", "Equip_ItemList"};
+    std::vector<GffLabel> labels;
+    for (auto &name : names) {
+        labels.push_back(GffLabel(name));
+    }
+    static constexpr int kNumIterations = 100000;
+
+    // when
+    auto measure = [](auto lookup) {
+        auto start = std::chrono::steady_clock::now();
+        uint32_t sum = 0;
+        for (int i = 0; i < kNumIterations; ++i) {
+            sum += lookup();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(elapsed / kNumIterations, sum);
+    };
+    auto linear = measure([&]() {
+        uint32_t sum = 0;
+        for (auto &name : names) {
+            auto it = std::find_if(gff.fields().begin(), gff.fields().end(), [&name](auto &f) { return f.label() == name; });
+            if (it != gff.fields().end()) {
+                sum += it->uintValue;
+            }
+        }
+        return sum;
+    });
+    auto byName = measure([&]() {
+        uint32_t sum = 0;
+        for (auto &name : names) {
+            uint32_t value = 0;
+            gff.readEnum(value, std::string_view(name));
+            sum += value;
+        }
+        return sum;
+    });
+    auto byLabel = measure([&]() {
+        uint32_t sum = 0;
+        for (auto &label : labels) {
+            uint32_t value = 0;
+            gff.readEnum(value, label);
+            sum += value;
+        }
+        return sum;
+    });
+
+    // then
+    std::cout << "Linear search: " << linear.first << " ns per creature" << std::endl;
+    std::cout << "Indexed by name: " << byName.first << " ns per creature" << std::endl;
+    std::cout << "Indexed by label: " << byLabel.first << " ns per creature" << std::endl;
+    EXPECT_EQ(linear.second, byName.second);
+    EXPECT_EQ(linear.second, byLabel.second);
+}
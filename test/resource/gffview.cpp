@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gffview.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::shared_ptr<Gff> makeCreature(int idx) {
+    return std::make_shared<Gff>(
+        4,
+        std::vector<Gff::Field> {
+            Gff::Field::newResRef("TemplateResRef", str(boost::format("N_Guard%03d") % idx)),
+            Gff::Field::newCExoString("Tag", str(boost::format("guard_%d") % idx)),
+            Gff::Field::newCExoLocString("FirstName", (idx % 3) ? -1 : 1000 + idx, "Guard"),
+            Gff::Field::newFloat("XPosition", 1.5f * idx),
+            Gff::Field::newFloat("YPosition", -0.5f * idx),
+            Gff::Field::newFloat("ZPosition", 0.0f),
+            Gff::Field::newVector("Position", glm::vec3(idx, idx + 1, idx + 2)),
+            Gff::Field::newByte("Commandable", idx % 2),
+            Gff::Field::newList(
+                "ItemList",
+                std::vector<std::shared_ptr<Gff>> {
+                    std::make_shared<Gff>(idx, std::vector<Gff::Field> {Gff::Field::newResRef("InventoryRes", "g_w_blstrpstl001")})})});
+}
+
+static std::shared_ptr<Gff> makeFixture(int numCreatures) {
+    std::vector<std::shared_ptr<Gff>> creatures;
+    for (int i = 0; i < numCreatures; ++i) {
+        creatures.push_back(makeCreature(i));
+    }
+    return std::make_shared<Gff>(
+        0xffffffff,
+        std::vector<Gff::Field> {
+            Gff::Field::newByte("Byte", 0xab),
+            Gff::Field::newChar("Char", -2),
+            Gff::Field::newWord("Word", 0xabcd),
+            Gff::Field::newShort("Short", -3),
+            Gff::Field::newInt("Int", -4),
+            Gff::Field::newDword("Dword", 0xdeadbeef),
+            Gff::Field::newInt64("Int64", -5),
+            Gff::Field::newDword64("Dword64", 0x123456789abcdefull),
+            Gff::Field::newFloat("Float", 1.25f),
+            Gff::Field::newDouble("Double", 2.5),
+            Gff::Field::newCExoString("CExoString", "John"),
+            Gff::Field::newResRef("ResRef", "Jane"),
+            Gff::Field::newCExoLocString("CExoLocString", 42, "Jill"),
+            Gff::Field::newVoid("Void", ByteBuffer {'\x01', '\x02', '\xff'}),
+            Gff::Field::newOrientation("Orientation", glm::quat(0.5f, 0.25f, 0.125f, 1.0f)),
+            Gff::Field::newVector("Vector", glm::vec3(1.0f, 2.0f, 3.0f)),
+            Gff::Field::newStrRef("StrRef", 7),
+            Gff::Field::newStruct(
+                "Struct",
+                std::make_shared<Gff>(1, std::vector<Gff::Field> {Gff::Field::newChar("Struct1Char", 1)})),
+            Gff::Field::newList("Creature List", std::move(creatures))});
+}
+
+static std::shared_ptr<ByteBuffer> save(const Gff &gff) {
+    auto bytes = std::make_shared<ByteBuffer>();
+    auto stream = MemoryOutputStream(*bytes);
+    auto writer = GffWriter(ResType::Git, gff);
+    writer.save(stream);
+    return bytes;
+}
+
+static std::shared_ptr<Gff> readEagerly(ByteBuffer &bytes) {
+    auto stream = MemoryInputStream(bytes);
+    auto reader = GffReader(stream);
+    reader.load();
+    return reader.root();
+}
+
+static void expectEqual(const Gff &expected, const Gff &actual) {
+    EXPECT_EQ(expected.type(), actual.type());
+    ASSERT_EQ(expected.fields().size(), actual.fields().size());
+    for (size_t i = 0; i < expected.fields().size(); ++i) {
+        auto &expectedField = expected.fields()[i];
+        auto &actualField = actual.fields()[i];
+        EXPECT_EQ(expectedField.label(), actualField.label());
+        EXPECT_EQ(expectedField.type, actualField.type);
+        if (expectedField.type == Gff::FieldType::Struct || expectedField.type == Gff::FieldType::List) {
+            ASSERT_EQ(expectedField.children.size(), actualField.children.size());
+            for (size_t j = 0; j < expectedField.children.size(); ++j) {
+                expectEqual(*expectedField.children[j], *actualField.children[j]);
+            }
+        } else {
+            EXPECT_TRUE(expectedField == actualField) << expectedField.label();
+        }
+    }
+}
+
+TEST(GffView, should_materialize_gff_identical_to_reader) {
+    // given
+    auto bytes = save(*makeFixture(8));
+    auto expected = readEagerly(*bytes);
+
+    // when
+    auto view = GffView::load(bytes);
+    auto actual = view.materialize();
+
+    // then
+    EXPECT_EQ(std::string("GIT V3.2"), std::string(view.signature()));
+    EXPECT_EQ(expected->signature(), actual->signature());
+    expectEqual(*expected, *actual);
+}
+
+TEST(GffView, should_read_values_identical_to_gff) {
+    // given
+    auto bytes = save(*makeFixture(8));
+    auto gff = readEagerly(*bytes);
+
+    // when
+    auto view = GffView::load(bytes);
+
+    // then
+    ASSERT_EQ(static_cast<int>(gff->fields().size()), view.numFields());
+    for (int i = 0; i < view.numFields(); ++i) {
+        auto &label = gff->fields()[i].label();
+        EXPECT_EQ(label, view.fieldLabel(i));
+        EXPECT_EQ(gff->fields()[i].type, view.fieldType(i));
+        EXPECT_EQ(gff->getInt(label), view.getInt(label)) << label;
+        EXPECT_EQ(gff->getUint(label), view.getUint(label)) << label;
+        EXPECT_EQ(gff->getInt64(label), view.getInt64(label)) << label;
+        EXPECT_EQ(gff->getUint64(label), view.getUint64(label)) << label;
+        EXPECT_EQ(gff->getBool(label), view.getBool(label)) << label;
+        EXPECT_EQ(gff->getString(label), view.getString(label)) << label;
+        EXPECT_EQ(gff->getVector(label), view.getVector(label)) << label;
+        EXPECT_EQ(gff->getOrientation(label), view.getOrientation(label)) << label;
+        EXPECT_EQ(gff->getData(label), view.getData(label)) << label;
+    }
+    EXPECT_EQ(1.25f, view.getFloat("Float"));
+    EXPECT_EQ(2.5, view.getDouble("Double"));
+    EXPECT_EQ(-5, view.getInt("Missing", -5));
+    EXPECT_FALSE(view.findStruct("Missing"));
+
+    auto structView = view.findStruct("Struct");
+    ASSERT_TRUE(structView);
+    EXPECT_EQ(1u, structView.type());
+    EXPECT_EQ(1, structView.getInt("Struct1Char"));
+
+    auto creatures = gff->getList("Creature List");
+    auto creatureViews = view.getList("Creature List");
+    ASSERT_EQ(creatures.size(), creatureViews.size());
+    for (size_t i = 0; i < creatures.size(); ++i) {
+        std::string expectedResRef;
+        std::string actualResRef;
+        EXPECT_TRUE(creatures[i]->readResRef(expectedResRef, "TemplateResRef"));
+        EXPECT_TRUE(creatureViews[i].readResRef(actualResRef, "TemplateResRef"));
+        EXPECT_EQ(expectedResRef, actualResRef);
+        EXPECT_EQ(creatures[i]->getString("Tag"), creatureViews[i].getStringView("Tag"));
+        EXPECT_EQ(creatures[i]->getInt("FirstName"), creatureViews[i].getInt("FirstName"));
+        EXPECT_EQ(creatures[i]->getFloat("XPosition"), creatureViews[i].getFloat("XPosition"));
+        auto items = creatureViews[i].getList("ItemList");
+        ASSERT_EQ(1ll, items.size());
+        EXPECT_EQ("g_w_blstrpstl001", items[0].getStringView("InventoryRes"));
+    }
+}
+
+TEST(GffView, should_throw_on_truncated_gff) {
+    // given
+    auto bytes = save(*makeFixture(1));
+    bytes->resize(bytes->size() / 2);
+
+    // expect
+    EXPECT_THROW(GffView::load(bytes), ValidationException);
+}
+
+TEST(GffView, DISABLED_benchmark_parse_throughput) {
+    // given
+    auto bytes = save(*makeFixture(5000));
+    static constexpr int kNumIterations = 20;
+
+    // when
+    auto measure = [&bytes](auto parse) {
+        auto start = std::chrono::steady_clock::now();
+        float checksum = 0.0f;
+        for (int i = 0; i < kNumIterations; ++i) {
+            checksum += parse();
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        auto megabytes = static_cast<double>(bytes->size()) * kNumIterations / (1024.0 * 1024.0);
+        return std::make_pair(megabytes / elapsed, checksum);
+    };
+    auto eager = measure([&bytes]() {
+        float sum = 0.0f;
+        for (auto &creature : readEagerly(*bytes)->getList("Creature List")) {
+            sum += creature->getFloat("XPosition");
+        }
+        return sum;
+    });
+    auto lazy = measure([&bytes]() {
+        float sum = 0.0f;
+        for (auto &creature : GffView::load(bytes).getList("Creature List")) {
+            sum += creature.getFloat("XPosition");
+        }
+        return sum;
+    });
+
+    // then
+    std::cout << "GffReader: " << eager.first << " MB/s" << std::endl;
+    std::cout << "GffView: " << lazy.first << " MB/s" << std::endl;
+    EXPECT_EQ(eager.second, lazy.second);
+}
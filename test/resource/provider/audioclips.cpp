@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/audio/clip.h"
+#include "reone/resource/container/memory.h"
+#include "reone/resource/provider/audioclips.h"
+#include "reone/resource/resources.h"
+#include "reone/system/stringbuilder.h"
+
+#include "../../fixtures/audio.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::resource;
+
+static ByteBuffer makeWav(uint32_t numBytes) {
+    auto dataSize = ByteBuffer(4, '\0');
+    std::memcpy(&dataSize[0], &numBytes, 4);
+    auto wav = StringBuilder()
+                   .append("RIFF")
+                   .append("\x00\x00\x00\x00", 4)
+                   .append("WAVE")
+                   .append("fmt ")
+                   .append("\x10\x00\x00\x00", 4)
+                   .append("\x01\x00", 2)         // PCM
+                   .append("\x01\x00", 2)         // mono
+                   .append("\x44\xac\x00\x00", 4) // 44100 Hz
+                   .append("\x88\x58\x01\x00", 4)
+                   .append("\x02\x00", 2)
+                   .append("\x10\x00", 2) // 16 bits per sample
+                   .append("data")
+                   .append(dataSize.data(), 4)
+                   .append('\x00', numBytes)
+                   .string();
+    return ByteBuffer(wav.begin(), wav.end());
+}
+
+static void addWav(MemoryResourceContainer &container, const std::string &resRef, uint32_t numBytes) {
+    container.add(ResourceId(resRef, ResType::Wav), makeWav(numBytes));
+}
+
+TEST(AudioClips, should_get_clip_with_caching) {
+    // given
+    auto container = std::make_unique<MemoryResourceContainer>();
+    addWav(*container, "sample", 1000);
+    auto resources = Resources();
+    resources.add(std::move(container));
+    auto audioClips = AudioClips(resources);
+
+    // when
+    auto clip1 = audioClips.get("sample");
+    auto clip2 = audioClips.get("sample");
+
+    // then
+    ASSERT_TRUE(static_cast<bool>(clip1));
+    EXPECT_EQ(clip1.get(), clip2.get());
+    EXPECT_EQ(1, audioClips.stats().hits);
+    EXPECT_EQ(1, audioClips.stats().misses);
+    EXPECT_EQ(0, audioClips.stats().evictions);
+    EXPECT_EQ(1000u, audioClips.stats().residentBytes);
+}
+
+TEST(AudioClips, should_evict_least_recently_used_clips_over_budget) {
+    // given
+    auto container = std::make_unique<MemoryResourceContainer>();
+    addWav(*container, "a", 1000);
+    addWav(*container, "b", 1000);
+    addWav(*container, "c", 1000);
+    auto resources = Resources();
+    resources.add(std::move(container));
+    auto audioClips = AudioClips(resources, nullptr, 2500);
+    auto a = audioClips.get("a");
+    auto b = audioClips.get("b");
+    audioClips.get("a");
+
+    // when
+    audioClips.get("c");
+    auto a2 = audioClips.get("a");
+    auto b2 = audioClips.get("b");
+
+    // then
+    EXPECT_EQ(a.get(), a2.get());
+    EXPECT_NE(b.get(), b2.get());
+    EXPECT_EQ(2, audioClips.stats().hits);
+    EXPECT_EQ(4, audioClips.stats().misses);
+    EXPECT_EQ(2, audioClips.stats().evictions); // b, then c
+    EXPECT_EQ(2000u, audioClips.stats().residentBytes);
+}
+
+TEST(AudioClips, should_upload_small_clips_into_shared_buffers) {
+    // given
+    auto container = std::make_unique<MemoryResourceContainer>();
+    addWav(*container, "small", 1000);
+    addWav(*container, "large", AudioClips::kMaxSharedBufferSize + 2);
+    auto resources = Resources();
+    resources.add(std::move(container));
+    auto backend = TestAudioBackend();
+    auto audioClips = std::make_unique<AudioClips>(resources, &backend);
+
+    // when
+    auto small = audioClips->get("small");
+    auto large = audioClips->get("large");
+
+    // then
+    EXPECT_NE(0u, small->sharedBuffer());
+    EXPECT_EQ(0u, large->sharedBuffer());
+    EXPECT_EQ(1, backend.numBuffers());
+    EXPECT_EQ(1000, backend.bufferSize(small->sharedBuffer()));
+    audioClips.reset();
+    small.reset();
+    EXPECT_EQ(0, backend.numBuffers());
+}
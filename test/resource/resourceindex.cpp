@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/erfwriter.h"
+#include "reone/resource/resourceindex.h"
+#include "reone/resource/resources.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/fileoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+class ResourceIndexTest : public ::testing::Test {
+protected:
+    std::filesystem::path _tmpDirPath;
+    std::filesystem::path _keyPath;
+    std::filesystem::path _erfPath;
+    std::filesystem::path _overridePath;
+    std::filesystem::path _indexPath;
+
+    void SetUp() override {
+        _tmpDirPath = std::filesystem::temp_directory_path();
+        _tmpDirPath.append("reone_test_resource_index");
+        std::filesystem::remove_all(_tmpDirPath);
+        std::filesystem::create_directories(_tmpDirPath / "data");
+        std::filesystem::create_directories(_tmpDirPath / "override" / "nested");
+
+        _keyPath = _tmpDirPath / "chitin.key";
+        {
+            auto key = FileOutputStream(_keyPath);
+            auto writer = BinaryWriter(key);
+            writer.writeString("KEY V1  ");
+            writer.writeUint32(1);  // number of BIFs
+            writer.writeUint32(1);  // number of keys
+            writer.writeUint32(64); // offset to files
+            writer.writeUint32(89); // offset to keys
+            writer.write(40, 0);
+            writer.writeUint32(41); // BIF size
+            writer.writeUint32(76); // offset to filename
+            writer.writeUint16(13); // filename size
+            writer.writeUint16(0);  // drives
+            writer.writeString("data\\test.bif");
+            writer.writeString(std::string("bifres\0\0\0\0\0\0\0\0\0\0", 16));
+            writer.writeUint16(static_cast<uint16_t>(ResType::Txt));
+            writer.writeUint32(0); // BIF 0, resource 0
+        }
+        {
+            auto bif = FileOutputStream(_tmpDirPath / "data" / "test.bif");
+            auto writer = BinaryWriter(bif);
+            writer.writeString("BIFFV1  ");
+            writer.writeUint32(1);  // number of variable resources
+            writer.writeUint32(0);  // number of fixed resources
+            writer.writeUint32(20); // offset to variable resources
+            writer.writeUint32(0);  // id
+            writer.writeUint32(36); // offset
+            writer.writeUint32(5);  // size
+            writer.writeUint32(static_cast<uint32_t>(ResType::Txt));
+            writer.writeString("hello");
+        }
+
+        _erfPath = _tmpDirPath / "patch.erf";
+        auto erf = ErfWriter();
+        erf.add(ErfWriter::Resource {"erfres", ResType::Txt, ByteBuffer {'e', 'r', 'f'}});
+        erf.save(ErfWriter::FileType::ERF, _erfPath);
+
+        _overridePath = _tmpDirPath / "override";
+        writeFile(_overridePath / "nested" / "folderres.txt", "folder");
+
+        _indexPath = _tmpDirPath / "resindex.bin";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_tmpDirPath);
+    }
+
+    void writeFile(const std::filesystem::path &path, const std::string &contents) {
+        auto stream = FileOutputStream(path);
+        stream.write(contents.c_str(), contents.size());
+    }
+
+    std::unique_ptr<Resources> loadResources(ResourceIndex **index = nullptr) {
+        auto resourceIndex = std::make_unique<ResourceIndex>(_indexPath);
+        resourceIndex->load();
+        if (index) {
+            *index = resourceIndex.get();
+        }
+        auto resources = std::make_unique<Resources>();
+        resources->setIndex(std::move(resourceIndex));
+        resources->addKEY(_keyPath);
+        resources->addERF(_erfPath);
+        resources->addFolder(_overridePath);
+        resources->saveIndex();
+        return resources;
+    }
+
+    static std::string findString(Resources &resources, const std::string &resRef) {
+        auto res = resources.find(ResourceId(resRef, ResType::Txt));
+        return res ? std::string(res->data.begin(), res->data.end()) : std::string();
+    }
+};
+
+TEST_F(ResourceIndexTest, should_restore_unchanged_containers_without_parsing_them) {
+    // given
+    ResourceIndex *index;
+    loadResources(&index);
+    EXPECT_EQ(0, index->numHits());
+    EXPECT_EQ(3, index->numMisses());
+
+    // corrupt KEY, keeping its size and modification time, to prove that it is not parsed again
+    auto keyModified = std::filesystem::last_write_time(_keyPath);
+    auto keySize = std::filesystem::file_size(_keyPath);
+    writeFile(_keyPath, std::string(keySize, 'x'));
+    std::filesystem::last_write_time(_keyPath, keyModified);
+
+    // when
+    auto resources = loadResources(&index);
+
+    // then
+    EXPECT_EQ(3, index->numHits());
+    EXPECT_EQ(0, index->numMisses());
+    EXPECT_EQ(std::string("hello"), findString(*resources, "bifres"));
+    EXPECT_EQ(std::string("erf"), findString(*resources, "erfres"));
+    EXPECT_EQ(std::string("folder"), findString(*resources, "folderres"));
+}
+
+TEST_F(ResourceIndexTest, should_rebuild_stale_snapshots) {
+    // given
+    loadResources();
+    writeFile(_overridePath / "nested" / "added.txt", "added");
+
+    // when
+    ResourceIndex *index;
+    auto resources = loadResources(&index);
+
+    // then
+    EXPECT_EQ(2, index->numHits());
+    EXPECT_EQ(1, index->numMisses());
+    EXPECT_EQ(std::string("added"), findString(*resources, "added"));
+    EXPECT_EQ(std::string("folder"), findString(*resources, "folderres"));
+}
+
+TEST_F(ResourceIndexTest, should_record_sizes_and_modification_times_of_folder_files) {
+    // given
+    loadResources();
+    auto filePath = _overridePath / "nested" / "folderres.txt";
+
+    // when
+    ResourceIndex *index;
+    auto resources = loadResources(&index);
+    auto snapshot = index->find(_overridePath);
+
+    // then
+    ASSERT_TRUE(snapshot);
+    ASSERT_EQ(1ll, snapshot->entries.size());
+    EXPECT_EQ(6, snapshot->entries[0].size);
+    EXPECT_EQ(std::filesystem::last_write_time(filePath).time_since_epoch().count(), snapshot->entries[0].modified);
+}
+
+TEST_F(ResourceIndexTest, should_ignore_malformed_index) {
+    // given
+    writeFile(_indexPath, "RIDX V2 \xff\xff\xff\xff");
+
+    // when
+    ResourceIndex *index;
+    auto resources = loadResources(&index);
+
+    // then
+    EXPECT_EQ(0, index->numHits());
+    EXPECT_EQ(std::string("hello"), findString(*resources, "bifres"));
+}
+
+TEST_F(ResourceIndexTest, should_create_missing_directories_when_saving) {
+    // given
+    _indexPath = _tmpDirPath / "cache" / "nested" / "resindex.bin";
+
+    // when
+    ResourceIndex *index;
+    loadResources(&index);
+    auto resources = loadResources(&index);
+
+    // then
+    EXPECT_TRUE(std::filesystem::exists(_indexPath));
+    EXPECT_EQ(3, index->numHits());
+}
+
+TEST_F(ResourceIndexTest, should_not_throw_when_index_cannot_be_saved) {
+    // given
+    writeFile(_tmpDirPath / "notadir", "");
+    _indexPath = _tmpDirPath / "notadir" / "resindex.bin";
+
+    // when
+    ResourceIndex *index;
+    auto resources = loadResources(&index);
+
+    // then
+    EXPECT_FALSE(std::filesystem::exists(_indexPath));
+    EXPECT_EQ(std::string("hello"), findString(*resources, "bifres"));
+}
+
+TEST_F(ResourceIndexTest, DISABLED_benchmark_folder_startup) {
+    // given
+    static constexpr int kNumDirectories = 50;
+    static constexpr int kNumFilesPerDirectory = 200;
+    auto folderPath = _tmpDirPath / "streamwaves";
+    for (int i = 0; i < kNumDirectories; ++i) {
+        auto dirPath = folderPath / ("dir" + std::to_string(i));
+        std::filesystem::create_directories(dirPath);
+        for (int j = 0; j < kNumFilesPerDirectory; ++j) {
+            writeFile(dirPath / ("file" + std::to_string(i) + "_" + std::to_string(j) + ".wav"), "RIFF");
+        }
+    }
+
+    // when
+    auto measure = [this, &folderPath]() {
+        auto start = std::chrono::steady_clock::now();
+        auto index = std::make_unique<ResourceIndex>(_indexPath);
+        index->load();
+        auto resources = Resources();
+        resources.setIndex(std::move(index));
+        resources.addFolder(folderPath);
+        resources.saveIndex();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    auto walk = measure();
+    auto indexed = measure();
+
+    // then
+    std::cout << "Directory walk: " << walk << " ms" << std::endl;
+    std::cout << "Index: " << indexed << " ms" << std::endl;
+}
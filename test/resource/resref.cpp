@@ -17,7 +17,7 @@
 
 #include <gtest/gtest.h>
 
-#include "reone/resource/resref.h"
+#include "reone/resource/id.h"
 
 using namespace reone;
 using namespace reone::resource;
@@ -50,3 +50,78 @@ TEST(ResRef, should_be_comparable) {
     EXPECT_GT(resRef3, resRef1);
     EXPECT_GT(resRef3, resRef2);
 }
+
+TEST(ResRef, should_hash_case_insensitively) {
+    // given
+    ResRef resRef1("N_Guard001");
+    ResRef resRef2(std::string_view("n_guard001"));
+    ResRef resRef3(std::string("n_guard002"));
+
+    // expect
+    EXPECT_EQ(resRef1.hash(), resRef2.hash());
+    EXPECT_NE(resRef1.hash(), resRef3.hash());
+    EXPECT_EQ(resRef1.view(), "n_guard001");
+    EXPECT_TRUE(ResRef().empty());
+    EXPECT_FALSE(resRef1.empty());
+}
+
+TEST(ResourceId, should_be_equatable_and_hashable) {
+    // given
+    auto id1 = ResourceId("P_BastilaBB", ResType::Mdl);
+    auto id2 = ResourceId(ResRef("p_bastilabb"), ResType::Mdl);
+    auto id3 = ResourceId("p_bastilabb", ResType::Mdx);
+
+    // expect
+    EXPECT_EQ(id1, id2);
+    EXPECT_EQ(id1.hash(), id2.hash());
+    EXPECT_NE(id1, id3);
+    EXPECT_NE(id1.hash(), id3.hash());
+}
+
+TEST(ResourceId, DISABLED_benchmark_lookup) {
+    // given
+    static constexpr int kNumResources = 20000;
+    static constexpr int kNumLookups = 2000000;
+    static const char *kPrefixes[] = {"n_", "p_", "c_", "w_", "g_w_", "lda_", "danm13_", "tar_m02aa_"};
+    static const ResType kTypes[] = {ResType::Mdl, ResType::Mdx, ResType::Tpc, ResType::Utc, ResType::Dlg, ResType::Ncs};
+
+    auto rng = std::mt19937(42);
+    std::vector<std::string> resRefs;
+    std::unordered_map<ResourceId, int> map;
+    std::unordered_map<std::pair<std::string, int>, int, boost::hash<std::pair<std::string, int>>> stringMap;
+    for (int i = 0; i < kNumResources; ++i) {
+        auto resRef = str(boost::format("%s%s%03d") % kPrefixes[rng() % 8] % (rng() % 2 ? "Guard" : "Lvl") % (i % 1000));
+        resRef = resRef.substr(0, kMaxResRefLength);
+        auto type = kTypes[rng() % 6];
+        map[ResourceId(resRef, type)] = i;
+        stringMap[{boost::to_lower_copy(resRef), static_cast<int>(type)}] = i;
+        resRefs.push_back(std::move(resRef));
+    }
+    // Zipf-like access: a small set of resources receives most lookups
+    std::vector<std::pair<const std::string *, ResType>> lookups;
+    lookups.reserve(kNumLookups);
+    for (int i = 0; i < kNumLookups; ++i) {
+        auto rank = static_cast<size_t>(std::pow(static_cast<double>(rng() % kNumResources + 1) / kNumResources, 4.0) * (kNumResources - 1));
+        lookups.push_back({&resRefs[rank], kTypes[rng() % 6]});
+    }
+
+    // when
+    int64_t stringHits = 0;
+    auto stringStart = std::chrono::steady_clock::now();
+    for (auto &[resRef, type] : lookups) {
+        stringHits += stringMap.count({boost::to_lower_copy(*resRef), static_cast<int>(type)});
+    }
+    auto stringTime = std::chrono::steady_clock::now() - stringStart;
+
+    int64_t hits = 0;
+    auto idStart = std::chrono::steady_clock::now();
+    for (auto &[resRef, type] : lookups) {
+        hits += map.count(ResourceId(*resRef, type));
+    }
+    auto idTime = std::chrono::steady_clock::now() - idStart;
+
+    // then
+    EXPECT_EQ(stringHits, hits);
+    std::cout << "String keys: " << std::chrono::duration_cast<std::chrono::milliseconds>(stringTime).count() << " ms" << std::endl;
+    std::cout << "ResourceId keys: " << std::chrono::duration_cast<std::chrono::milliseconds>(idTime).count() << " ms" << std::endl;
+}
@@ -17,9 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include "reone/resource/format/tlkreader.h"
+#include "reone/resource/format/tlkwriter.h"
 #include "reone/resource/strings.h"
+#include "reone/resource/talktable.h"
 #include "reone/system/binarywriter.h"
 #include "reone/system/logutil.h"
+#include "reone/system/stream/fileinput.h"
 #include "reone/system/stream/fileoutput.h"
 
 using namespace reone;
@@ -72,3 +76,114 @@ TEST(Strings, should_init_talktable_and_get_string_and_sound) {
 
     std::filesystem::remove_all(tmpDirPath);
 }
+
+TEST(Strings, should_strip_developer_notes_and_cache_text) {
+    // given
+    auto strings = Strings();
+    strings.setTalkTable(TalkTable::Builder()
+                             .string("Hello, {note}world{another note}!", "Some_Sound")
+                             .string("Plain")
+                             .string("Unclosed {note")
+                             .build());
+
+    // when
+    auto &text = strings.getText(0);
+    auto &cachedText = strings.getText(0);
+
+    // then
+    EXPECT_EQ(std::string("Hello, world!"), text);
+    EXPECT_EQ(&text, &cachedText);
+    EXPECT_EQ(std::string("Plain"), strings.getText(1));
+    EXPECT_EQ(std::string("Unclosed {note"), strings.getText(2));
+    EXPECT_EQ(std::string("Some_Sound"), strings.getSound(0));
+    EXPECT_EQ(std::string(), strings.getText(3));
+    EXPECT_EQ(std::string(), strings.getText(-1));
+}
+
+static size_t residentMemory() {
+    auto statm = std::ifstream("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    statm >> size >> resident;
+    return resident * 4096;
+}
+
+TEST(Strings, DISABLED_benchmark_talk_table_startup) {
+    // given
+    static constexpr int kNumStrings = 150000;
+    static constexpr int kNumAccessed = 1000;
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_strings_benchmark");
+    std::filesystem::create_directory(tmpDirPath);
+    auto tlkPath = tmpDirPath;
+    tlkPath.append("dialog.tlk");
+    {
+        auto text = [](int i) {
+            return "String number " + std::to_string(i) + ", long enough not to fit into a small string buffer {note}";
+        };
+        auto tlk = FileOutputStream(tlkPath);
+        auto writer = BinaryWriter(tlk);
+        writer.writeString("TLK V3.0");
+        writer.writeUint32(0);
+        writer.writeUint32(kNumStrings);
+        writer.writeUint32(20 + 40 * kNumStrings);
+        uint32_t offset = 0;
+        for (int i = 0; i < kNumStrings; ++i) {
+            auto sound = "snd" + std::to_string(i);
+            sound.resize(16, '\0');
+            auto size = static_cast<uint32_t>(text(i).size());
+            writer.writeUint32(1);
+            writer.writeString(sound);
+            writer.writeUint32(0);
+            writer.writeUint32(0);
+            writer.writeUint32(offset);
+            writer.writeUint32(size);
+            writer.writeFloat(0.0f);
+            offset += size;
+        }
+        for (int i = 0; i < kNumStrings; ++i) {
+            writer.writeString(text(i));
+        }
+    }
+
+    // when
+    auto measure = [](auto load) {
+        auto memoryBefore = residentMemory();
+        auto start = std::chrono::steady_clock::now();
+        auto loaded = load();
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        auto memory = (residentMemory() - memoryBefore) / (1024.0 * 1024.0);
+        return std::make_tuple(elapsed, memory, loaded);
+    };
+    auto mapped = measure([&tmpDirPath]() {
+        auto strings = std::make_shared<Strings>();
+        strings->init(tmpDirPath);
+        for (int i = 0; i < kNumAccessed; ++i) {
+            strings->getText(i);
+        }
+        return strings;
+    });
+    auto eager = measure([&tlkPath]() {
+        auto tlk = FileInputStream(tlkPath);
+        auto reader = TlkReader(tlk);
+        reader.load();
+        return reader.table();
+    });
+    auto start = std::chrono::steady_clock::now();
+    size_t length = 0;
+    for (int i = 0; i < 100; ++i) {
+        for (int j = 0; j < kNumAccessed; ++j) {
+            length += std::get<2>(mapped)->getText(j).size();
+        }
+    }
+    auto hitTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (100 * kNumAccessed);
+
+    // then
+    std::cout << "TlkReader: " << std::get<0>(eager) << " ms, " << std::get<1>(eager) << " MiB" << std::endl;
+    std::cout << "Strings (" << kNumAccessed << " strings accessed): " << std::get<0>(mapped) << " ms, " << std::get<1>(mapped) << " MiB" << std::endl;
+    std::cout << "Strings::getText hit: " << hitTime << " ns" << std::endl;
+    EXPECT_GT(length, 0);
+
+    // cleanup
+    std::filesystem::remove_all(tmpDirPath);
+}
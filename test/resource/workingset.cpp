@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/options.h"
+#include "reone/resource/director.h"
+#include "reone/resource/workingset.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+#include "reone/system/threadpool.h"
+
+#include "../fixtures/data.h"
+#include "../fixtures/graphics.h"
+#include "../fixtures/resource.h"
+#include "../fixtures/script.h"
+
+using namespace reone;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::script;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+static ByteBuffer toBytes(const std::string &s) {
+    return ByteBuffer(s.begin(), s.end());
+}
+
+TEST(WorkingSetManifest, should_build_from_access_logs_in_order_of_first_access) {
+    // given
+    auto log1 = toBytes(
+        "end_m01aa\tend_trask.utc\tend_m01aa_s.rim\t128\t42\t5\n"
+        "end_m01aa\tk_ai_master.ncs\tscripts.bif\t64\t0\t1\n"
+        "end_m01aa\tbadresource\tscripts.bif\t64\t0\t1\n"
+        "-\tappearance.2da\t2da.bif\t1024\t10\t0\n");
+    auto log2 = toBytes(
+        "end_m01aa\tend_trask.utc\tend_m01aa_s.rim\t128\t42\t0\r\n"
+        "end_m01ab\tend_trask.dlg\tend_m01ab_s.rim\t256\t12\t3\n");
+    auto stream1 = MemoryInputStream(log1);
+    auto stream2 = MemoryInputStream(log2);
+    auto manifest = WorkingSetManifest();
+
+    // when
+    manifest.addAccessLog(stream1);
+    manifest.addAccessLog(stream2);
+
+    // then
+    auto &modules = manifest.modules();
+    ASSERT_EQ(2ll, modules.size());
+    auto &aa = manifest.moduleResources("end_m01aa");
+    ASSERT_EQ(2ll, aa.size());
+    EXPECT_EQ(ResourceId("end_trask", ResType::Utc), aa[0]);
+    EXPECT_EQ(ResourceId("k_ai_master", ResType::Ncs), aa[1]);
+    auto &ab = manifest.moduleResources("end_m01ab");
+    ASSERT_EQ(1ll, ab.size());
+    EXPECT_EQ(ResourceId("end_trask", ResType::Dlg), ab[0]);
+    EXPECT_TRUE(manifest.moduleResources("unknown").empty());
+}
+
+TEST(WorkingSetManifest, should_save_and_load) {
+    // given
+    auto log = toBytes(
+        "end_m01aa\tk_ai_master.ncs\tscripts.bif\t64\t0\t1\n"
+        "end_m01aa\tend_trask.utc\tend_m01aa_s.rim\t128\t42\t2\n");
+    auto logStream = MemoryInputStream(log);
+    auto manifest = WorkingSetManifest();
+    manifest.addAccessLog(logStream);
+    auto bytes = ByteBuffer();
+    auto output = MemoryOutputStream(bytes);
+
+    // when
+    manifest.save(output);
+    auto input = MemoryInputStream(bytes);
+    auto loaded = WorkingSetManifest();
+    loaded.load(input);
+
+    // then
+    EXPECT_EQ("[end_m01aa]\nk_ai_master.ncs\nend_trask.utc\n", std::string(bytes.begin(), bytes.end()));
+    EXPECT_EQ(manifest.modules(), loaded.modules());
+}
+
+TEST(ResourceDirector, should_warm_up_working_set_on_module_load) {
+    // given
+    auto gameData = TestGameData();
+    gameData.init();
+    auto graphicsOpt = GraphicsOptions();
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+    auto scriptModule = TestScriptModule();
+    scriptModule.init();
+    auto dialogs = testing::NiceMock<MockDialogs>();
+    auto gffs = testing::NiceMock<MockGffs>();
+    auto lips = testing::NiceMock<MockLips>();
+    auto paths = testing::NiceMock<MockPaths>();
+    auto resources = testing::NiceMock<MockResources>();
+    auto scripts = testing::NiceMock<MockScripts>();
+    auto director = ResourceDirector(
+        GameID::KotOR,
+        gameData.gamePath(),
+        graphicsOpt,
+        graphicsModule.services(),
+        scriptModule.services(),
+        dialogs,
+        gffs,
+        lips,
+        paths,
+        resources,
+        scripts);
+
+    auto manifestBytes = toBytes(
+        "[end_m01aa]\n"
+        "end_trask.utc\n"
+        "k_ai_master.ncs\n"
+        "end_trask.dlg\n"
+        "end_m01aa.tga\n"
+        "[end_m01ab]\n"
+        "k_ai_other.ncs\n");
+    auto manifestStream = MemoryInputStream(manifestBytes);
+    auto manifest = WorkingSetManifest();
+    manifest.load(manifestStream);
+    director.setWorkingSet(&manifest);
+
+    auto recorder = ResourceAccessRecorder();
+    director.setAccessRecorder(&recorder);
+
+    // expect
+    EXPECT_CALL(resources, clearLocal());
+    EXPECT_CALL(gffs, get("end_trask", ResType::Utc)).WillOnce(Return(nullptr));
+    EXPECT_CALL(scripts, get("k_ai_master")).WillOnce(Return(nullptr));
+    EXPECT_CALL(scripts, get("k_ai_other")).Times(0);
+    EXPECT_CALL(dialogs, get("end_trask")).WillOnce(Return(nullptr));
+
+    // when
+    director.onModuleLoad("end_m01aa");
+    recorder.recordAccess(ResourceId("end_trask", ResType::Utc), "end_m01aa_s.rim", 128);
+
+    // then
+    auto records = recorder.records();
+    ASSERT_EQ(1ll, records.size());
+    EXPECT_EQ("end_m01aa", records[0].module);
+}
+
+TEST(ResourceDirector, should_warm_up_working_set_on_thread_pool_before_next_module_load) {
+    // given
+    auto gameData = TestGameData();
+    gameData.init();
+    auto graphicsOpt = GraphicsOptions();
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+    auto scriptModule = TestScriptModule();
+    scriptModule.init();
+    auto dialogs = testing::NiceMock<MockDialogs>();
+    auto gffs = testing::NiceMock<MockGffs>();
+    auto lips = testing::NiceMock<MockLips>();
+    auto paths = testing::NiceMock<MockPaths>();
+    auto resources = testing::NiceMock<MockResources>();
+    auto scripts = testing::NiceMock<MockScripts>();
+    auto threadPool = ThreadPool(1);
+    threadPool.init();
+    auto director = std::make_unique<ResourceDirector>(
+        GameID::KotOR,
+        gameData.gamePath(),
+        graphicsOpt,
+        graphicsModule.services(),
+        scriptModule.services(),
+        dialogs,
+        gffs,
+        lips,
+        paths,
+        resources,
+        scripts);
+
+    auto manifestBytes = toBytes(
+        "[end_m01aa]\n"
+        "end_trask.utc\n"
+        "k_ai_master.ncs\n"
+        "[end_m01ab]\n"
+        "k_ai_other.ncs\n");
+    auto manifestStream = MemoryInputStream(manifestBytes);
+    auto manifest = WorkingSetManifest();
+    manifest.load(manifestStream);
+    director->setWorkingSet(&manifest);
+    director->setThreadPool(&threadPool);
+
+    auto callerThreadId = std::this_thread::get_id();
+    auto warmUpThreadIds = std::vector<std::thread::id>();
+    auto mutex = std::mutex();
+    auto recordThread = [&warmUpThreadIds, &mutex](auto &...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        warmUpThreadIds.push_back(std::this_thread::get_id());
+        return nullptr;
+    };
+    // next module load cancels warm-up that has not started yet
+    auto waitForWarmUp = [&warmUpThreadIds, &mutex](size_t count) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (warmUpThreadIds.size() >= count) {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    // expect
+    testing::InSequence sequence;
+    EXPECT_CALL(resources, clearLocal());
+    EXPECT_CALL(gffs, get("end_trask", ResType::Utc)).WillOnce(Invoke(recordThread));
+    EXPECT_CALL(scripts, get("k_ai_master")).WillOnce(Invoke(recordThread));
+    EXPECT_CALL(resources, clearLocal());
+    EXPECT_CALL(scripts, get("k_ai_other")).WillOnce(Invoke(recordThread));
+
+    // when
+    director->onModuleLoad("end_m01aa");
+    waitForWarmUp(2);
+    director->onModuleLoad("end_m01ab");
+    waitForWarmUp(3);
+    director.reset();
+
+    // then
+    ASSERT_EQ(3ll, warmUpThreadIds.size());
+    for (auto &threadId : warmUpThreadIds) {
+        EXPECT_NE(callerThreadId, threadId);
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/asynclogsink.h"
+
+using namespace reone;
+
+static std::vector<std::string> splitLines(const std::string &text) {
+    std::vector<std::string> lines;
+    std::istringstream stream {text};
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+TEST(AsyncLogSink, should_write_records_of_each_thread_in_order) {
+    // given
+    static constexpr int kNumThreads = 4;
+    static constexpr int kNumRecordsPerThread = 5000;
+    auto stream = std::make_unique<std::ostringstream>();
+    auto &output = *stream;
+    AsyncLogSink sink {std::move(stream), LogOverflowPolicy::Block, 256};
+    sink.start();
+
+    // when
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&sink, t]() {
+            for (int i = 0; i < kNumRecordsPerThread; ++i) {
+                sink.push(std::to_string(t) + " " + std::to_string(i) + "\n");
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    sink.flush();
+
+    // then
+    auto lines = splitLines(output.str());
+    EXPECT_EQ(kNumThreads * kNumRecordsPerThread, static_cast<int>(lines.size()));
+    std::vector<int> nextByThread(kNumThreads, 0);
+    bool ordered = true;
+    for (auto &line : lines) {
+        std::istringstream lineStream {line};
+        int thread, index;
+        lineStream >> thread >> index;
+        if (index != nextByThread[thread]) {
+            ordered = false;
+        }
+        nextByThread[thread] = index + 1;
+    }
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(0, sink.numDropped());
+}
+
+TEST(AsyncLogSink, should_drop_records_when_queue_is_full) {
+    // given
+    auto stream = std::make_unique<std::ostringstream>();
+    auto &output = *stream;
+    AsyncLogSink sink {std::move(stream), LogOverflowPolicy::Drop, 4};
+
+    // when
+    int numAccepted = 0;
+    for (int i = 0; i < 10; ++i) {
+        if (sink.push(std::to_string(i) + "\n")) {
+            ++numAccepted;
+        }
+    }
+    sink.flush();
+
+    // then
+    EXPECT_EQ(4, numAccepted);
+    EXPECT_EQ(6, sink.numDropped());
+    EXPECT_EQ("0\n1\n2\n3\n", output.str());
+}
+
+TEST(AsyncLogSink, should_report_number_of_dropped_records_when_counting) {
+    // given
+    auto stream = std::make_unique<std::ostringstream>();
+    auto &output = *stream;
+    AsyncLogSink sink {std::move(stream), LogOverflowPolicy::Count, 2};
+
+    // when
+    for (int i = 0; i < 5; ++i) {
+        sink.push(std::to_string(i) + "\n");
+    }
+    sink.flush();
+    sink.push("5\n");
+    sink.flush();
+
+    // then
+    EXPECT_EQ(3, sink.numDropped());
+    EXPECT_EQ("0\n1\n WARN [log] 3 log records dropped\n5\n", output.str());
+}
+
+TEST(AsyncLogSink, should_write_queued_records_on_stop) {
+    // given
+    auto stream = std::make_unique<std::ostringstream>();
+    auto &output = *stream;
+    AsyncLogSink sink {std::move(stream)};
+    sink.start();
+    sink.push("first\n");
+    sink.push("second\n");
+
+    // when
+    sink.stop();
+
+    // then
+    EXPECT_EQ("first\nsecond\n", output.str());
+}
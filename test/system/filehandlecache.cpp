@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/exception/filenotfound.h"
+#include "reone/system/filehandlecache.h"
+#include "reone/system/stream/fileinput.h"
+
+using namespace reone;
+
+namespace {
+
+class FileHandleCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _dir = std::filesystem::temp_directory_path() / "reone_test_file_handle_cache";
+        std::filesystem::remove_all(_dir);
+        std::filesystem::create_directories(_dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_dir);
+    }
+
+    std::filesystem::path writeFile(const std::string &name, const std::string &contents) {
+        auto path = _dir / name;
+        auto file = std::ofstream(path, std::ios::binary);
+        file.write(contents.data(), contents.size());
+        return path;
+    }
+
+    std::filesystem::path _dir;
+};
+
+} // namespace
+
+TEST_F(FileHandleCacheTest, should_read_file_at_offset) {
+    // given
+    auto path = writeFile("a.bin", "Hello, world!");
+    auto cache = FileHandleCache();
+    auto buf = std::string(5, '\0');
+    auto tail = std::string(16, '\0');
+
+    // when
+    auto file = cache.get(path);
+    auto numRead = file->read(7, &buf[0], buf.size());
+    auto numReadTail = file->read(7, &tail[0], tail.size());
+
+    // then
+    EXPECT_EQ(13, file->size());
+    EXPECT_EQ(5, numRead);
+    EXPECT_EQ("world", buf);
+    EXPECT_EQ(6, numReadTail);
+    EXPECT_EQ("world!", tail.substr(0, numReadTail));
+}
+
+TEST_F(FileHandleCacheTest, should_evict_least_recently_used_handles) {
+    // given
+    auto pathA = writeFile("a.bin", "A");
+    auto pathB = writeFile("b.bin", "B");
+    auto pathC = writeFile("c.bin", "C");
+    auto cache = FileHandleCache(2);
+
+    // when
+    auto fileA = cache.get(pathA);
+    cache.get(pathB);
+    auto fileA2 = cache.get(pathA);
+    cache.get(pathC);
+    cache.get(pathB);
+    auto stats = cache.stats();
+
+    // then
+    EXPECT_EQ(fileA.get(), fileA2.get());
+    EXPECT_EQ(2, stats.numHandles);
+    EXPECT_EQ(4, stats.numOpens);
+    EXPECT_EQ(2, stats.numCloses);
+    EXPECT_EQ(1, stats.numHits);
+
+    char c = '\0';
+    EXPECT_EQ(1, fileA->read(0, &c, 1));
+    EXPECT_EQ('A', c);
+}
+
+TEST_F(FileHandleCacheTest, should_reopen_replaced_file_when_getting_current) {
+    // given
+    auto path = writeFile("a.bin", "Old");
+    auto cache = FileHandleCache();
+    auto oldFile = cache.getCurrent(path);
+    auto sameFile = cache.getCurrent(path);
+    auto replacement = writeFile("a.tmp", "New contents");
+    std::filesystem::rename(replacement, path);
+    auto buf = std::string(12, '\0');
+
+    // when
+    auto newFile = cache.getCurrent(path);
+    auto numRead = newFile->read(0, &buf[0], buf.size());
+
+    // then
+    EXPECT_EQ(oldFile.get(), sameFile.get());
+    EXPECT_NE(oldFile.get(), newFile.get());
+    EXPECT_EQ(12, newFile->size());
+    EXPECT_EQ(12, numRead);
+    EXPECT_EQ("New contents", buf);
+    EXPECT_EQ(1, cache.stats().numHandles);
+}
+
+TEST_F(FileHandleCacheTest, should_throw_when_file_not_found) {
+    // given
+    auto cache = FileHandleCache();
+
+    // when, then
+    EXPECT_THROW(cache.get(_dir / "missing.bin"), FileNotFoundException);
+    EXPECT_EQ(0, cache.stats().numHandles);
+}
+
+TEST_F(FileHandleCacheTest, DISABLED_benchmark_reads) {
+    // given
+    static constexpr int kNumFiles = 32;
+    static constexpr int kNumPasses = 200;
+    std::vector<std::filesystem::path> paths;
+    for (int i = 0; i < kNumFiles; ++i) {
+        paths.push_back(writeFile(std::to_string(i) + ".bin", std::string(4096, static_cast<char>('a' + i % 26))));
+    }
+    auto cache = FileHandleCache();
+    size_t streamTotal = 0;
+    size_t cacheTotal = 0;
+
+    // when
+    auto streamStart = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+        for (auto &path : paths) {
+            auto stream = FileInputStream(path);
+            auto buf = ByteBuffer(stream.length());
+            stream.read(&buf[0], buf.size());
+            streamTotal += buf.size();
+        }
+    }
+    auto streamTime = std::chrono::steady_clock::now() - streamStart;
+
+    auto cacheStart = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+        for (auto &path : paths) {
+            auto file = cache.get(path);
+            auto buf = ByteBuffer(file->size());
+            cacheTotal += file->read(0, &buf[0], buf.size());
+        }
+    }
+    auto cacheTime = std::chrono::steady_clock::now() - cacheStart;
+
+    // then
+    EXPECT_EQ(streamTotal, cacheTotal);
+    auto stats = cache.stats();
+    std::cout << "FileInputStream: " << std::chrono::duration_cast<std::chrono::milliseconds>(streamTime).count() << " ms" << std::endl;
+    std::cout << "FileHandleCache: " << std::chrono::duration_cast<std::chrono::milliseconds>(cacheTime).count() << " ms"
+              << " (" << stats.numOpens << " opens, " << stats.numHits << " hits)" << std::endl;
+}
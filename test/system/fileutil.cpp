@@ -45,3 +45,42 @@ TEST(FileUtilities, should_find_file_ignoring_case) {
     // cleanup
     std::filesystem::remove_all(tmpDirPath);
 }
+
+TEST(FileUtilities, should_key_game_cache_files_by_game_path) {
+    // when
+    auto kotorLog = getGameCacheFilePath("/games/kotor", "resaccess", ".log");
+    auto kotorManifest = getGameCacheFilePath("/games/kotor/", "workingset", ".txt");
+    auto tslLog = getGameCacheFilePath("/games/tsl", "resaccess", ".log");
+
+    // then
+    EXPECT_EQ(getUserCacheDirectory(), kotorLog.parent_path());
+    EXPECT_EQ(0, kotorLog.filename().string().rfind("resaccess_", 0));
+    EXPECT_EQ(".log", kotorLog.extension());
+    EXPECT_NE(kotorLog, tslLog);
+    EXPECT_EQ(kotorLog.stem().string().substr(std::string("resaccess_").size()),
+              kotorManifest.stem().string().substr(std::string("workingset_").size()));
+}
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+
+TEST(FileUtilities, should_put_user_cache_directory_under_xdg_cache_home) {
+    // given
+    const char *prevCacheHome = std::getenv("XDG_CACHE_HOME");
+    auto prev = prevCacheHome ? std::optional<std::string>(prevCacheHome) : std::nullopt;
+    setenv("XDG_CACHE_HOME", "/tmp/reone_test_cache", 1);
+
+    // when
+    auto path = getUserCacheDirectory();
+
+    // then
+    EXPECT_EQ(std::filesystem::path("/tmp/reone_test_cache/reone"), path);
+
+    // cleanup
+    if (prev) {
+        setenv("XDG_CACHE_HOME", prev->c_str(), 1);
+    } else {
+        unsetenv("XDG_CACHE_HOME");
+    }
+}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/logutil.h"
+#include "reone/system/threadutil.h"
+
+using namespace reone;
+
+TEST(Logger, should_not_evaluate_arguments_of_disabled_statements) {
+    // given
+    int numEvaluated = 0;
+    auto evaluate = [&numEvaluated]() {
+        ++numEvaluated;
+        return std::string("value");
+    };
+
+    // when
+    R_DEBUG(LogChannel::Perception, "%s %s", evaluate(), evaluate());
+    R_INFO(LogChannel::Script3, "%s", evaluate());
+
+    // then
+    EXPECT_FALSE(Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Perception));
+    EXPECT_EQ(0, numEvaluated);
+}
+
+TEST(Logger, should_write_enabled_statements_to_file) {
+    // given
+    auto logPath = std::filesystem::temp_directory_path() / "reone_test_logger.log";
+    Logger::instance.deinit();
+    Logger::instance.init(LogSeverity::Info, {LogChannel::Global, LogChannel::Perception}, logPath.string());
+
+    // when
+    R_INFO(LogChannel::Perception, "%s seen by %s", "n_commoner001", "n_commoner002");
+    R_DEBUG(LogChannel::Perception, "%s", "suppressed by severity");
+    warn("suppressed by channel", LogChannel::Script);
+    error("error", LogChannel::Global);
+    Logger::instance.deinit();
+
+    // then
+    auto log = std::ifstream(logPath);
+    auto contents = std::string(std::istreambuf_iterator<char>(log), std::istreambuf_iterator<char>());
+    auto expectedContents = " INFO [" + threadName() + "][perception] n_commoner001 seen by n_commoner002\n" +
+                            "ERROR [" + threadName() + "][global] error\n";
+    EXPECT_EQ(expectedContents, contents);
+
+    // cleanup
+    // file stays open until the logger is initialized again
+    log.close();
+    std::error_code ec;
+    std::filesystem::remove(logPath, ec);
+}
+
+TEST(Logger, DISABLED_benchmark_disabled_statements) {
+    // given
+    static constexpr int kNumIterations = 1000000;
+    auto tag = std::string("n_commoner001");
+
+    // when
+    auto measure = [](auto statement) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kNumIterations; ++i) {
+            statement(i);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kNumIterations;
+    };
+    auto eager = measure([&tag](int i) {
+        debug(str(boost::format("%s %s %d") % tag % "seen by" % i), LogChannel::Perception);
+    });
+    auto deferred = measure([&tag](int i) {
+        R_DEBUG(LogChannel::Perception, "%s %s %d", tag, "seen by", i);
+    });
+
+    // then
+    std::cout << "eager formatting: " << eager << " ns per statement" << std::endl;
+    std::cout << "deferred formatting: " << deferred << " ns per statement" << std::endl;
+}
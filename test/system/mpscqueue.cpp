@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/mpscqueue.h"
+
+using namespace reone;
+
+TEST(MpscQueue, should_pop_values_in_order_of_push) {
+    // given
+    MpscQueue<int> queue(4);
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    // when
+    int first = 0, second = 0, third = 0, fourth = 0;
+    bool poppedFirst = queue.pop(first);
+    bool poppedSecond = queue.pop(second);
+    bool poppedThird = queue.pop(third);
+    bool poppedFourth = queue.pop(fourth);
+
+    // then
+    EXPECT_TRUE(poppedFirst);
+    EXPECT_TRUE(poppedSecond);
+    EXPECT_TRUE(poppedThird);
+    EXPECT_FALSE(poppedFourth);
+    EXPECT_EQ(1, first);
+    EXPECT_EQ(2, second);
+    EXPECT_EQ(3, third);
+}
+
+TEST(MpscQueue, should_reject_push_when_full_without_consuming_value) {
+    // given
+    MpscQueue<std::string> queue(2);
+    queue.push("first");
+    queue.push("second");
+    std::string third {"third"};
+
+    // when
+    bool pushed = queue.push(std::move(third));
+
+    // then
+    EXPECT_FALSE(pushed);
+    EXPECT_EQ("third", third);
+    std::string value;
+    queue.pop(value);
+    EXPECT_EQ("first", value);
+    EXPECT_TRUE(queue.push(std::move(third)));
+}
+
+TEST(MpscQueue, should_throw_when_capacity_is_not_power_of_two) {
+    // expect
+    EXPECT_THROW(MpscQueue<int>(3), std::invalid_argument);
+    EXPECT_THROW(MpscQueue<int>(0), std::invalid_argument);
+}
+
+TEST(MpscQueue, should_preserve_order_of_each_producer) {
+    // given
+    static constexpr int kNumProducers = 4;
+    static constexpr int kNumValuesPerProducer = 20000;
+    MpscQueue<int> queue(64);
+
+    // when
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kNumProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < kNumValuesPerProducer; ++i) {
+                int value = i;
+                while (!queue.push((p << 24) | value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<int> nextByProducer(kNumProducers, 0);
+    bool ordered = true;
+    int numPopped = 0;
+    while (numPopped < kNumProducers * kNumValuesPerProducer) {
+        int value;
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int producer = value >> 24;
+        int index = value & 0xffffff;
+        if (index != nextByProducer[producer]) {
+            ordered = false;
+        }
+        nextByProducer[producer] = index + 1;
+        ++numPopped;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    // then
+    EXPECT_TRUE(ordered);
+    for (int p = 0; p < kNumProducers; ++p) {
+        EXPECT_EQ(kNumValuesPerProducer, nextByProducer[p]);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/spscqueue.h"
+
+using namespace reone;
+
+TEST(SpscQueue, should_pop_values_in_order_of_push) {
+    // given
+    SpscQueue<int, 4> queue;
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    // when
+    int first = 0, second = 0, third = 0, fourth = 0;
+    bool poppedFirst = queue.pop(first);
+    bool poppedSecond = queue.pop(second);
+    bool poppedThird = queue.pop(third);
+    bool poppedFourth = queue.pop(fourth);
+
+    // then
+    EXPECT_TRUE(poppedFirst);
+    EXPECT_TRUE(poppedSecond);
+    EXPECT_TRUE(poppedThird);
+    EXPECT_FALSE(poppedFourth);
+    EXPECT_EQ(1, first);
+    EXPECT_EQ(2, second);
+    EXPECT_EQ(3, third);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueue, should_peek_front_without_popping) {
+    // given
+    SpscQueue<int, 4> queue;
+    const int *emptyFront = queue.front();
+    queue.push(1);
+    queue.push(2);
+
+    // when
+    const int *front = queue.front();
+    int value = 0;
+    queue.pop(value);
+    const int *nextFront = queue.front();
+
+    // then
+    EXPECT_EQ(nullptr, emptyFront);
+    ASSERT_NE(nullptr, front);
+    EXPECT_EQ(1, value);
+    ASSERT_NE(nullptr, nextFront);
+    EXPECT_EQ(2, *nextFront);
+}
+
+TEST(SpscQueue, should_reject_push_when_full) {
+    // given
+    SpscQueue<int, 2> queue;
+    queue.push(1);
+    queue.push(2);
+
+    // when
+    bool pushed = queue.push(3);
+
+    // then
+    EXPECT_FALSE(pushed);
+    int value = 0;
+    queue.pop(value);
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(queue.push(3));
+}
+
+TEST(SpscQueue, should_transfer_values_between_threads) {
+    // given
+    static constexpr int kNumValues = 100000;
+    SpscQueue<int, 64> queue;
+
+    // when
+    std::thread producer([&queue]() {
+        for (int i = 0; i < kNumValues; ++i) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::vector<int> values;
+    values.reserve(kNumValues);
+    while (values.size() < kNumValues) {
+        int value;
+        if (queue.pop(value)) {
+            values.push_back(value);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    // then
+    bool ordered = true;
+    for (int i = 0; i < kNumValues; ++i) {
+        if (values[i] != i) {
+            ordered = false;
+            break;
+        }
+    }
+    EXPECT_TRUE(ordered);
+}
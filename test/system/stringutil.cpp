@@ -41,3 +41,9 @@ TEST(stringutil, strip) {
     EXPECT_EQ(string_strip("foo"), "foo");
     EXPECT_EQ(string_strip(""), "");
 }
+
+TEST(stringutil, json_quote) {
+    EXPECT_EQ(string_json_quote("foo"), "\"foo\"");
+    EXPECT_EQ(string_json_quote("a\"b\\c\nd\te"), "\"a\\\"b\\\\c\\nd e\"");
+    EXPECT_EQ(string_json_quote(""), "\"\"");
+}
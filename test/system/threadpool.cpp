@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include "../fixtures/system.h"
+
 #include "reone/system/threadpool.h"
 
 using namespace reone;
@@ -75,3 +77,186 @@ TEST(ThreadPool, should_cancel_enqueued_task) {
     // then
     EXPECT_TRUE(exited);
 }
+
+TEST(ThreadPool, should_run_job_after_its_dependencies) {
+    // given
+    ThreadPool pool(4);
+    pool.init();
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&](int value) {
+        return [&, value](auto &_) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(value == 1 ? 20 : 0));
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(value);
+        };
+    };
+
+    // when
+    auto first = pool.enqueue(record(1));
+    auto second = pool.enqueue(record(2));
+    auto last = pool.enqueue(record(3), JobPriority::Background, {first, second});
+    pool.wait(*last);
+
+    // then
+    ASSERT_EQ(3, order.size());
+    EXPECT_EQ(3, order.back());
+    EXPECT_TRUE(first->isDone());
+    EXPECT_TRUE(second->isDone());
+}
+
+TEST(ThreadPool, should_run_most_urgent_job_first) {
+    // given
+    ThreadPool pool(1);
+    pool.init();
+    std::atomic_bool blocked {true};
+    std::vector<JobPriority> order;
+    auto gate = pool.enqueue([&blocked](auto &_) {
+        while (blocked) {
+            std::this_thread::yield();
+        }
+    });
+    auto record = [&order](JobPriority priority) {
+        return [&order, priority](auto &_) { order.push_back(priority); };
+    };
+
+    // when
+    auto background = pool.enqueue(record(JobPriority::Background), JobPriority::Background);
+    auto streaming = pool.enqueue(record(JobPriority::Streaming), JobPriority::Streaming);
+    auto critical = pool.enqueue(record(JobPriority::FrameCritical), JobPriority::FrameCritical);
+    blocked = false;
+    background->wait();
+    streaming->wait();
+    critical->wait();
+
+    // then
+    auto expectedOrder = std::vector<JobPriority> {JobPriority::FrameCritical, JobPriority::Streaming, JobPriority::Background};
+    EXPECT_EQ(expectedOrder, order);
+}
+
+TEST(ThreadPool, should_rethrow_job_exception_on_wait) {
+    // given
+    ThreadPool pool(2);
+    pool.init();
+
+    // when
+    auto task = pool.enqueue([](auto &_) { throw std::runtime_error("failed"); });
+
+    // then
+    EXPECT_THROW(pool.wait(*task), std::runtime_error);
+}
+
+TEST(ThreadPool, should_process_each_index_once_in_parallel_for) {
+    // given
+    ThreadPool pool(4);
+    pool.init();
+    auto visits = std::vector<std::atomic_int>(10007);
+
+    // when
+    pool.parallelFor(0, visits.size(), 64, [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+
+    // then
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](auto &count) { return count == 1; }));
+}
+
+TEST(ThreadPool, should_complete_nested_parallel_for_inside_jobs) {
+    // given
+    ThreadPool pool(2);
+    pool.init();
+    std::atomic_int sum {0};
+
+    // when
+    std::vector<std::shared_ptr<Task>> tasks;
+    for (int i = 0; i < 8; ++i) {
+        tasks.push_back(pool.enqueue([&pool, &sum](auto &_) {
+            pool.parallelFor(0, 100, 10, [&sum](size_t begin, size_t end) {
+                sum += static_cast<int>(end - begin);
+            });
+        }));
+    }
+    for (auto &task : tasks) {
+        pool.wait(*task);
+    }
+
+    // then
+    EXPECT_EQ(800, sum);
+}
+
+TEST(ThreadPool, should_rethrow_exception_from_parallel_for) {
+    // given
+    ThreadPool pool(2);
+    pool.init();
+
+    // when
+    auto process = [&pool]() {
+        pool.parallelFor(0, 100, 10, [](size_t begin, size_t end) {
+            if (begin == 50) {
+                throw std::runtime_error("failed");
+            }
+        });
+    };
+
+    // then
+    EXPECT_THROW(process(), std::runtime_error);
+}
+
+TEST(MockThreadPool, should_run_jobs_inline_in_dependency_order) {
+    // given
+    MockThreadPool pool;
+    std::vector<int> order;
+    auto record = [&order](int value) {
+        return [&order, value](auto &_) { order.push_back(value); };
+    };
+    auto pending = std::make_shared<Task>(record(0));
+
+    // when
+    auto first = pool.enqueue(record(1));
+    auto blocked = pool.enqueue(record(2), JobPriority::Background, {first, pending});
+    auto second = pool.enqueue(record(3));
+    pool.parallelFor(0, 5, 2, [&order](size_t begin, size_t end) { order.push_back(100 + static_cast<int>(begin)); });
+
+    // then
+    auto expectedOrder = std::vector<int> {1, 3, 100, 102, 104};
+    EXPECT_EQ(expectedOrder, order);
+    EXPECT_TRUE(first->isDone());
+    EXPECT_FALSE(blocked->isDone());
+    EXPECT_THROW(pool.wait(*blocked), std::logic_error);
+}
+
+TEST(ThreadPool, DISABLED_benchmark_parallel_for_scaling) {
+    // given
+    static constexpr size_t kNumElements = 1 << 22;
+    static constexpr int kNumIterations = 10;
+    auto values = std::vector<float>(kNumElements, 1.0f);
+    int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // when
+    auto measure = [&](int numThreads) {
+        ThreadPool pool(numThreads);
+        pool.init();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kNumIterations; ++i) {
+            pool.parallelFor(0, kNumElements, 0, [&values](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    values[j] = std::sqrt(values[j] * 1.0001f + 0.5f);
+                }
+            });
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kNumIterations;
+    };
+    auto baseline = measure(0);
+
+    // then
+    std::cout << "inline: " << baseline << " ms" << std::endl;
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        auto elapsed = measure(numThreads);
+        std::cout << numThreads << " threads: " << elapsed << " ms, speedup " << baseline / elapsed << "x" << std::endl;
+        if (numThreads < maxThreads && numThreads * 2 > maxThreads) {
+            numThreads = maxThreads / 2;
+        }
+    }
+}
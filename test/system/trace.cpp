@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <boost/json.hpp>
+
+#include "reone/system/trace.h"
+
+using namespace reone;
+
+static boost::json::array traceEvents(TraceRecorder &recorder,
+                                      std::optional<std::pair<uint32_t, uint32_t>> frames = std::nullopt) {
+    std::ostringstream stream;
+    recorder.writeChromeTrace(stream, std::move(frames));
+    auto root = boost::json::parse(stream.str());
+    return root.as_object().at("traceEvents").as_array();
+}
+
+static std::vector<boost::json::object> eventsWithPhase(const boost::json::array &events, const std::string &phase) {
+    std::vector<boost::json::object> filtered;
+    for (auto &event : events) {
+        auto &object = event.as_object();
+        if (object.at("ph").as_string() == phase) {
+            filtered.push_back(object);
+        }
+    }
+    return filtered;
+}
+
+TEST(TraceRecorder, should_write_zones_counters_and_frames_as_chrome_trace_events) {
+    // given
+    TraceRecorder recorder;
+    recorder.setEnabled(true);
+    recorder.markFrame();
+    {
+        TraceZone outer {"outer", recorder};
+        {
+            TraceZone inner {"inner \"quoted\"", recorder};
+        }
+        recorder.recordCounter("draw calls", 42);
+    }
+
+    // when
+    auto events = traceEvents(recorder);
+
+    // then
+    auto metadata = eventsWithPhase(events, "M");
+    ASSERT_EQ(1ll, metadata.size());
+    EXPECT_EQ("thread_name", metadata[0].at("name").as_string());
+    EXPECT_TRUE(metadata[0].at("args").as_object().at("name").is_string());
+
+    auto zones = eventsWithPhase(events, "X");
+    ASSERT_EQ(2ll, zones.size());
+    auto &inner = zones[0];
+    auto &outer = zones[1];
+    EXPECT_EQ("inner \"quoted\"", inner.at("name").as_string());
+    EXPECT_EQ("outer", outer.at("name").as_string());
+    for (auto &zone : zones) {
+        EXPECT_TRUE(zone.at("ts").is_number());
+        EXPECT_TRUE(zone.at("dur").is_number());
+        EXPECT_EQ(1, zone.at("pid").to_number<int64_t>());
+        EXPECT_EQ(metadata[0].at("tid").to_number<int64_t>(), zone.at("tid").to_number<int64_t>());
+        EXPECT_EQ(1, zone.at("args").as_object().at("frame").to_number<int64_t>());
+    }
+    auto innerStart = inner.at("ts").to_number<int64_t>();
+    auto outerStart = outer.at("ts").to_number<int64_t>();
+    EXPECT_LE(outerStart, innerStart);
+    EXPECT_LE(innerStart + inner.at("dur").to_number<int64_t>(), outerStart + outer.at("dur").to_number<int64_t>());
+
+    auto counters = eventsWithPhase(events, "C");
+    ASSERT_EQ(1ll, counters.size());
+    EXPECT_EQ("draw calls", counters[0].at("name").as_string());
+    EXPECT_EQ(42, counters[0].at("args").as_object().at("value").to_number<int64_t>());
+
+    auto frames = eventsWithPhase(events, "i");
+    ASSERT_EQ(1ll, frames.size());
+    EXPECT_EQ("frame", frames[0].at("name").as_string());
+    EXPECT_EQ("g", frames[0].at("s").as_string());
+}
+
+TEST(TraceRecorder, should_export_only_events_of_frame_range) {
+    // given
+    TraceRecorder recorder;
+    recorder.setEnabled(true);
+    for (int i = 0; i < 5; ++i) {
+        recorder.markFrame();
+        recorder.recordCounter("frame counter", i + 1);
+    }
+
+    // when
+    auto events = traceEvents(recorder, std::make_pair(2u, 3u));
+
+    // then
+    auto counters = eventsWithPhase(events, "C");
+    ASSERT_EQ(2ll, counters.size());
+    EXPECT_EQ(2, counters[0].at("args").as_object().at("value").to_number<int64_t>());
+    EXPECT_EQ(3, counters[1].at("args").as_object().at("value").to_number<int64_t>());
+}
+
+TEST(TraceRecorder, should_keep_latest_events_when_ring_buffer_wraps) {
+    // given
+    TraceRecorder recorder {4};
+    recorder.setEnabled(true);
+    for (int i = 0; i < 10; ++i) {
+        recorder.recordCounter("counter", i);
+    }
+
+    // when
+    auto events = traceEvents(recorder);
+
+    // then
+    auto counters = eventsWithPhase(events, "C");
+    ASSERT_EQ(4ll, counters.size());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(6 + i, counters[i].at("args").as_object().at("value").to_number<int64_t>());
+    }
+}
+
+TEST(TraceRecorder, should_record_events_of_each_thread_separately) {
+    // given
+    TraceRecorder recorder;
+    recorder.setEnabled(true);
+    recorder.recordCounter("main", 1);
+    std::thread worker([&recorder]() {
+        TraceZone zone {"worker", recorder};
+    });
+    worker.join();
+
+    // when
+    auto events = traceEvents(recorder);
+
+    // then
+    auto metadata = eventsWithPhase(events, "M");
+    ASSERT_EQ(2ll, metadata.size());
+    EXPECT_NE(metadata[0].at("tid").to_number<int64_t>(), metadata[1].at("tid").to_number<int64_t>());
+    auto zones = eventsWithPhase(events, "X");
+    ASSERT_EQ(1ll, zones.size());
+    EXPECT_EQ(metadata[1].at("tid").to_number<int64_t>(), zones[0].at("tid").to_number<int64_t>());
+}
+
+TEST(TraceRecorder, should_not_record_when_disabled) {
+    // given
+    TraceRecorder recorder;
+    {
+        TraceZone zone {"zone", recorder};
+    }
+    recorder.markFrame();
+
+    // when
+    auto events = traceEvents(recorder);
+
+    // then
+    EXPECT_TRUE(events.empty());
+    EXPECT_EQ(1u, recorder.frame());
+}
+
+TEST(TraceRecorder, should_take_events_and_clear_buffers) {
+    // given
+    TraceRecorder recorder;
+    recorder.setEnabled(true);
+    recorder.recordZone("zone", 10, 25, 0);
+    recorder.markFrame();
+    recorder.recordCounter("counter", 7);
+
+    // when
+    auto events = recorder.takeEvents();
+
+    // then
+    ASSERT_EQ(3ll, events.size());
+    EXPECT_EQ(TraceEventType::Zone, events[0].type);
+    EXPECT_EQ(15u, events[0].duration);
+    EXPECT_EQ(0u, events[0].frame);
+    EXPECT_EQ(TraceEventType::Frame, events[1].type);
+    EXPECT_EQ(TraceEventType::Counter, events[2].type);
+    EXPECT_EQ(7, events[2].value);
+    EXPECT_EQ(1u, events[2].frame);
+    EXPECT_TRUE(recorder.takeEvents().empty());
+}
+
+TEST(TraceRecorder, should_tag_zones_with_frame_they_were_entered_in) {
+    // given
+    TraceRecorder recorder;
+    recorder.setEnabled(true);
+    {
+        TraceZone zone {"zone", recorder};
+        recorder.markFrame();
+    }
+
+    // when
+    auto events = recorder.takeEvents();
+
+    // then
+    ASSERT_EQ(2ll, events.size());
+    EXPECT_EQ(TraceEventType::Frame, events[0].type);
+    EXPECT_EQ(1u, events[0].frame);
+    EXPECT_EQ(TraceEventType::Zone, events[1].type);
+    EXPECT_EQ(0u, events[1].frame);
+}
@@ -76,3 +76,163 @@ TEST(AudioAnalyzer, should_return_waveform_given_mono8_audio_with_sound_and_sile
     EXPECT_NEAR(waveform[10], 0.0f, 0.01f);
     EXPECT_NEAR(waveform[11], 0.0f, 0.01f);
 }
+
+/**
+ * Silence detection, as implemented before frame lookup was indexed and
+ * amplitude was taken from an envelope, rather than from a single sample.
+ */
+static std::vector<TimeSpan> silentSpansReference(const AudioClip &clip, float minSilenceDuration, float maxSilenceAmplitude) {
+    std::vector<TimeSpan> frameSpans;
+    float time = 0.0f;
+    for (int i = 0; i < clip.getFrameCount(); ++i) {
+        const auto &frame = clip.getFrame(i);
+        float duration = frame.samples.size() / frame.stride() / static_cast<float>(frame.sampleRate);
+        frameSpans.push_back(TimeSpan {time, time + duration});
+        time += duration;
+    }
+    std::vector<TimeSpan> silentSpans;
+    float silenceStart = 0.0f;
+    bool silentSpan = false;
+    for (float t = 0.0f; t < clip.duration(); t += 0.001f) {
+        for (int i = 0; i < clip.getFrameCount(); ++i) {
+            if (!frameSpans[i].contains(t)) {
+                continue;
+            }
+            const auto &frame = clip.getFrame(i);
+            int sampleIdx = std::min(
+                static_cast<int>((t - frameSpans[i].startInclusive) * frame.sampleRate),
+                static_cast<int>(frame.samples.size() / frame.stride()) - 1);
+            float sample = reinterpret_cast<const int16_t *>(&frame.samples[0])[sampleIdx] / 65535.0f * 2.0f;
+            bool silent = std::fabs(sample) <= maxSilenceAmplitude;
+            if (silent && !silentSpan) {
+                silenceStart = t;
+                silentSpan = true;
+            } else if (!silent && silentSpan) {
+                if (t - silenceStart >= minSilenceDuration) {
+                    silentSpans.push_back(TimeSpan {silenceStart, t});
+                }
+                silentSpan = false;
+            }
+            break;
+        }
+    }
+    if (silentSpan && clip.duration() - silenceStart >= minSilenceDuration) {
+        silentSpans.push_back(TimeSpan {silenceStart, clip.duration()});
+    }
+    return silentSpans;
+}
+
+/**
+ * Mono16 clip of numFrames frames, alternating between tone and silence every
+ * 0.15 seconds.
+ */
+static void addSpeechLikeFrames(AudioClip &clip, int numFrames, int samplesPerFrame, int sampleRate) {
+    int sampleIdx = 0;
+    for (int i = 0; i < numFrames; ++i) {
+        ByteBuffer samples(2 * samplesPerFrame);
+        auto values = reinterpret_cast<int16_t *>(&samples[0]);
+        for (int j = 0; j < samplesPerFrame; ++j, ++sampleIdx) {
+            float time = sampleIdx / static_cast<float>(sampleRate);
+            bool tone = static_cast<int>(time / 0.15f) % 2 == 0;
+            values[j] = tone ? static_cast<int16_t>(8000.0f * std::sin(2.0f * glm::pi<float>() * 220.0f * time)) : 0;
+        }
+        clip.add(AudioClip::Frame {AudioFormat::Mono16, sampleRate, std::move(samples)});
+    }
+}
+
+TEST(AudioAnalyzer, should_return_silent_spans_matching_reference_given_multi_frame_audio) {
+    // given
+    AudioClip clip;
+    addSpeechLikeFrames(clip, 40, 1152, 22050);
+    AudioAnalyzer analyzer;
+
+    // when
+    auto spans = analyzer.silentSpans(clip, 0.05f, 0.01f);
+
+    // then
+    auto expected = silentSpansReference(clip, 0.05f, 0.01f);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected.size(), spans.size());
+    for (size_t i = 0; i < spans.size(); ++i) {
+        // within a single 1 ms analysis step
+        EXPECT_NEAR(expected[i].startInclusive, spans[i].startInclusive, 0.0015f) << i;
+        EXPECT_NEAR(expected[i].endExclusive, spans[i].endExclusive, 0.0015f) << i;
+    }
+}
+
+TEST(AudioAnalyzer, should_not_return_silent_span_over_sound_between_analysis_steps) {
+    // given
+    // 0.2 seconds of silence at 44100 Hz, interrupted by a 0.2 ms click at 0.1005 seconds
+    ByteBuffer samples(2 * 8820, 0);
+    auto values = reinterpret_cast<int16_t *>(&samples[0]);
+    for (int i = 4432; i < 4441; ++i) {
+        values[i] = 16384;
+    }
+    AudioClip clip;
+    clip.add(AudioClip::Frame {AudioFormat::Mono16, 44100, std::move(samples)});
+    AudioAnalyzer analyzer;
+
+    // when
+    auto spans = analyzer.silentSpans(clip, 0.05f, 0.01f);
+
+    // then
+    ASSERT_EQ(2ll, spans.size());
+    EXPECT_NEAR(0.0f, spans[0].startInclusive, 0.001f);
+    EXPECT_NEAR(0.1f, spans[0].endExclusive, 0.001f);
+    EXPECT_NEAR(0.101f, spans[1].startInclusive, 0.001f);
+    EXPECT_NEAR(0.2f, spans[1].endExclusive, 0.001f);
+    EXPECT_EQ(1ll, silentSpansReference(clip, 0.05f, 0.01f).size());
+}
+
+TEST(AudioAnalyzer, should_return_envelope_given_mono16_audio_across_frames) {
+    // given
+    // 0.5 seconds of square wave with amplitude 0.5, followed by 0.5 seconds of silence
+    AudioClip clip;
+    for (int i = 0; i < 4; ++i) {
+        ByteBuffer samples(2 * 250);
+        auto values = reinterpret_cast<int16_t *>(&samples[0]);
+        for (int j = 0; j < 250; ++j) {
+            values[j] = i < 2 ? ((j % 2) ? 16384 : -16384) : 0;
+        }
+        clip.add(AudioClip::Frame {AudioFormat::Mono16, 1000, std::move(samples)});
+    }
+    AudioAnalyzer analyzer;
+
+    // when
+    auto envelope = analyzer.envelope(clip, 0.1f);
+
+    // then
+    ASSERT_EQ(10ll, envelope.rms.size());
+    ASSERT_EQ(10ll, envelope.peak.size());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_NEAR(0.5f, envelope.rms[i], 0.01f) << i;
+        EXPECT_NEAR(0.5f, envelope.peak[i], 0.01f) << i;
+    }
+    for (int i = 5; i < 10; ++i) {
+        EXPECT_EQ(0.0f, envelope.rms[i]) << i;
+        EXPECT_EQ(0.0f, envelope.peak[i]) << i;
+    }
+}
+
+TEST(AudioAnalyzer, DISABLED_benchmark_silent_spans) {
+    // given
+    // one minute of speech-like audio in MP3-sized frames
+    AudioClip clip;
+    addSpeechLikeFrames(clip, 1150, 1152, 22050);
+    AudioAnalyzer analyzer;
+
+    // when
+    auto measure = [](auto func) {
+        auto start = std::chrono::steady_clock::now();
+        auto numSpans = func().size();
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(elapsed, numSpans);
+    };
+    auto reference = measure([&clip]() { return silentSpansReference(clip, 0.05f, 0.01f); });
+    auto envelope = measure([&clip, &analyzer]() { return analyzer.silentSpans(clip, 0.05f, 0.01f); });
+
+    // then
+    std::cout << "Point sampled, frame scan: " << reference.first << " ms" << std::endl;
+    std::cout << "Envelope, frame cursor: " << envelope.first << " ms" << std::endl;
+    EXPECT_EQ(reference.second, envelope.second);
+}
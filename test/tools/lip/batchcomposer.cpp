@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/lipanimation.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/stream/fileoutput.h"
+#include "reone/tools/lip/batchcomposer.h"
+
+using namespace reone;
+
+/**
+ * Writes a mono 16-bit WAV file, which has a tone for the duration of each
+ * word group, separated by 0.2 seconds of silence.
+ */
+static void writeWav(const std::filesystem::path &path, const std::vector<float> &toneDurations) {
+    static constexpr int kSampleRate = 8000;
+    std::vector<int16_t> samples;
+    for (size_t i = 0; i < toneDurations.size(); ++i) {
+        if (i > 0) {
+            samples.insert(samples.end(), kSampleRate / 5, 0);
+        }
+        int numToneSamples = static_cast<int>(toneDurations[i] * kSampleRate);
+        for (int j = 0; j < numToneSamples; ++j) {
+            samples.push_back((j % 2) ? 8000 : -8000);
+        }
+    }
+    auto stream = FileOutputStream(path);
+    auto writer = BinaryWriter(stream);
+    uint32_t dataSize = static_cast<uint32_t>(2 * samples.size());
+    writer.writeString("RIFF");
+    writer.writeUint32(36 + dataSize);
+    writer.writeString("WAVE");
+    writer.writeString("fmt ");
+    writer.writeUint32(16);
+    writer.writeUint16(1); // PCM
+    writer.writeUint16(1); // mono
+    writer.writeUint32(kSampleRate);
+    writer.writeUint32(2 * kSampleRate);
+    writer.writeUint16(2);
+    writer.writeUint16(16);
+    writer.writeString("data");
+    writer.writeUint32(dataSize);
+    for (auto sample : samples) {
+        writer.writeInt16(sample);
+    }
+}
+
+static void writeText(const std::filesystem::path &path, const std::string &text) {
+    auto stream = FileOutputStream(path);
+    stream.write(text.c_str(), text.size());
+}
+
+static std::vector<LipBatchComposer::Result> composeAll(const std::vector<LipBatchComposer::Line> &lines,
+                                                        std::shared_ptr<const PronouncingDictionary> dict,
+                                                        int numThreads,
+                                                        LipBatchComposer::Progress &lastProgress) {
+    auto threadPool = ThreadPool(numThreads);
+    threadPool.init();
+    auto composer = LipBatchComposer(dict, threadPool);
+    return composer.compose(lines, [&lastProgress](const auto &progress) { lastProgress = progress; });
+}
+
+TEST(LipBatchComposer, should_compose_lines_in_directory_regardless_of_thread_count) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_lipbatch");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directory(tmpDirPath);
+    for (int i = 0; i < 16; ++i) {
+        auto name = str(boost::format("line%02d") % i);
+        writeWav(tmpDirPath / (name + ".wav"), {0.3f + 0.01f * i, 0.5f});
+        writeText(tmpDirPath / (name + ".txt"), (i == 7) ? "(Hello) (unknown)\n" : "(Hello) (world)\n");
+    }
+    writeWav(tmpDirPath / "untranscribed.wav", {0.5f});
+    auto dict = std::make_shared<PronouncingDictionary>(PronouncingDictionary::WordPhonemesMap {
+        {"hello", {"hh", "ah0", "l", "ow1"}}, //
+        {"world", {"w", "er1", "l", "d"}}     //
+    });
+
+    // when
+    auto lines = LipBatchComposer::findLines(tmpDirPath);
+    auto singleProgress = LipBatchComposer::Progress();
+    auto single = composeAll(lines, dict, 1, singleProgress);
+    auto multiProgress = LipBatchComposer::Progress();
+    auto multi = composeAll(lines, dict, 4, multiProgress);
+    std::filesystem::remove_all(tmpDirPath);
+
+    // then
+    ASSERT_EQ(16ll, lines.size());
+    EXPECT_EQ("line00", lines.front().name);
+    EXPECT_EQ("(Hello) (world)", lines.front().text);
+    ASSERT_EQ(16ll, single.size());
+    ASSERT_EQ(16ll, multi.size());
+    for (size_t i = 0; i < single.size(); ++i) {
+        EXPECT_EQ(lines[i].name, single[i].name);
+        EXPECT_EQ(single[i].name, multi[i].name);
+        EXPECT_EQ(single[i].error, multi[i].error);
+        if (i == 7) {
+            EXPECT_FALSE(single[i].error.empty());
+            continue;
+        }
+        ASSERT_TRUE(single[i].animation) << single[i].error;
+        ASSERT_TRUE(multi[i].animation) << multi[i].error;
+        auto &singleFrames = single[i].animation->keyframes();
+        auto &multiFrames = multi[i].animation->keyframes();
+        ASSERT_EQ(singleFrames.size(), multiFrames.size());
+        for (size_t j = 0; j < singleFrames.size(); ++j) {
+            EXPECT_EQ(singleFrames[j].time, multiFrames[j].time);
+            EXPECT_EQ(singleFrames[j].shape, multiFrames[j].shape);
+        }
+    }
+    EXPECT_EQ(16, multiProgress.numLines);
+    EXPECT_EQ(15, multiProgress.numComposed);
+    EXPECT_EQ(1, multiProgress.numFailed);
+}
+
+TEST(LipBatchComposer, DISABLED_benchmark_compose_lines) {
+    // given
+    // 300 lines of one to four seconds each, as in a voice-over pack
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_benchmark_lipbatch");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directory(tmpDirPath);
+    for (int i = 0; i < 300; ++i) {
+        auto name = str(boost::format("line%03d") % i);
+        writeWav(tmpDirPath / (name + ".wav"), {0.4f + 0.01f * (i % 100), 0.3f, 0.5f + 0.01f * (i % 50), 0.2f});
+        writeText(tmpDirPath / (name + ".txt"), "(Hello) (world) (hello) (world)\n");
+    }
+    auto dict = std::make_shared<PronouncingDictionary>(PronouncingDictionary::WordPhonemesMap {
+        {"hello", {"hh", "ah0", "l", "ow1"}}, //
+        {"world", {"w", "er1", "l", "d"}}     //
+    });
+    auto lines = LipBatchComposer::findLines(tmpDirPath);
+    int numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // when
+    auto singleProgress = LipBatchComposer::Progress();
+    composeAll(lines, dict, 1, singleProgress);
+    auto multiProgress = LipBatchComposer::Progress();
+    composeAll(lines, dict, numThreads, multiProgress);
+    std::filesystem::remove_all(tmpDirPath);
+
+    // then
+    std::cout << "Threads: 1, " << singleProgress.elapsed << " s, "
+              << singleProgress.linesPerSecond() << " lines/s" << std::endl;
+    std::cout << "Threads: " << numThreads << ", " << multiProgress.elapsed << " s, "
+              << multiProgress.linesPerSecond() << " lines/s" << std::endl;
+    EXPECT_EQ(300, singleProgress.numComposed);
+    EXPECT_EQ(300, multiProgress.numComposed);
+}